@@ -0,0 +1,326 @@
+/* control.c - commands from other programs, over a Unix domain socket
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* Everything happens on glsnake's own thread, between frames, as with
+ * -stream: one poll() finds whatever has arrived, and commands are carried
+ * out as soon as they are read, so there is nothing to lock and no queue
+ * to fall behind.  Replies are sent without waiting, and a client too slow
+ * to take them is dropped. */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "control.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#define CONTROL_CLIENTS 8
+#define CONTROL_LINE_LENGTH 512
+
+static struct control_client {
+  int fd;
+  /* the other end has finished sending */
+  int eof;
+  char buffer[CONTROL_LINE_LENGTH];
+  size_t buffered;
+} clients[CONTROL_CLIENTS];
+
+static int control_fd = -1;
+static const char *control_path;
+
+static void set_nonblocking(int fd) {
+  int flags = fcntl(fd, F_GETFL);
+
+  if (flags != -1) fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+static void drop(struct control_client *client) {
+  close(client->fd);
+  client->fd = -1;
+  client->eof = 0;
+  client->buffered = 0;
+}
+
+/* Bind to path, taking it over if it is a socket nothing is listening on,
+ * as is left when glsnake is killed. */
+static int bind_path(int fd, const char *path) {
+  struct sockaddr_un addr;
+  struct stat st;
+  int probe, err;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    errno = ENAMETOOLONG;
+    return -1;
+  }
+  strcpy(addr.sun_path, path);
+  if (!bind(fd, (struct sockaddr *)&addr, sizeof(addr))) return 0;
+  if (errno != EADDRINUSE || lstat(path, &st) || !S_ISSOCK(st.st_mode)) {
+    return -1;
+  }
+
+  if ((probe = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) return -1;
+  err = connect(probe, (struct sockaddr *)&addr, sizeof(addr));
+  close(probe);
+  if (!err || errno != ECONNREFUSED) {
+    errno = EADDRINUSE;
+    return -1;
+  }
+  unlink(path);
+  return bind(fd, (struct sockaddr *)&addr, sizeof(addr));
+}
+
+int control_open(const char *path) {
+  int i;
+
+  for (i = 0; i < CONTROL_CLIENTS; i++) clients[i].fd = -1;
+  if ((control_fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) return -1;
+  if (bind_path(control_fd, path) || listen(control_fd, CONTROL_CLIENTS)) {
+    int err = errno;
+
+    close(control_fd);
+    control_fd = -1;
+    errno = err;
+    return -1;
+  }
+  set_nonblocking(control_fd);
+  control_path = path;
+  return 0;
+}
+
+void control_close(void) {
+  int i;
+
+  if (control_fd < 0) return;
+  for (i = 0; i < CONTROL_CLIENTS; i++)
+    if (clients[i].fd >= 0) drop(&clients[i]);
+  close(control_fd);
+  control_fd = -1;
+  unlink(control_path);
+}
+
+static void accept_clients(void) {
+  int fd, i;
+
+  while ((fd = accept(control_fd, NULL, NULL)) >= 0) {
+    for (i = 0; i < CONTROL_CLIENTS && clients[i].fd >= 0; i++)
+      ;
+    if (i == CONTROL_CLIENTS) {
+      close(fd);
+      continue;
+    }
+#ifdef SO_NOSIGPIPE
+    {
+      int one = 1;
+
+      setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+    }
+#endif
+    set_nonblocking(fd);
+    clients[i].fd = fd;
+  }
+}
+
+void control_poll(void) {
+  struct pollfd fds[CONTROL_CLIENTS + 1];
+  int i, n = 0;
+
+  if (control_fd < 0) return;
+  fds[n].fd = control_fd;
+  fds[n++].events = POLLIN;
+  for (i = 0; i < CONTROL_CLIENTS; i++) {
+    /* a client's buffer is only full if its line is too long, which
+     * control_next sorts out */
+    fds[n].fd = clients[i].eof ||
+                        clients[i].buffered == CONTROL_LINE_LENGTH
+                    ? -1
+                    : clients[i].fd;
+    fds[n++].events = POLLIN;
+  }
+  if (poll(fds, (nfds_t)n, 0) <= 0) return;
+
+  if (fds[0].revents) accept_clients();
+  for (i = 0; i < CONTROL_CLIENTS; i++) {
+    struct control_client *client = &clients[i];
+    ssize_t got;
+
+    if (!fds[i + 1].revents) continue;
+    got = read(client->fd, client->buffer + client->buffered,
+               CONTROL_LINE_LENGTH - client->buffered);
+    if (got > 0)
+      client->buffered += (size_t)got;
+    else if (!got)
+      client->eof = 1;
+    else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+      drop(client);
+  }
+}
+
+static void send_line(int client, const char *head, const char *text) {
+  struct control_client *c = &clients[client];
+  char line[CONTROL_LINE_LENGTH];
+  int len;
+
+  if (c->fd < 0) return;
+  len = snprintf(line, sizeof(line), "%s%s%s\n", head, *text ? " " : "", text);
+  if (len < 0 || len >= (int)sizeof(line)) {
+    len = (int)sizeof(line) - 1;
+    line[len - 1] = '\n';
+  }
+  if (send(c->fd, line, (size_t)len, MSG_DONTWAIT | MSG_NOSIGNAL) != len)
+    drop(c);
+}
+
+void control_reply(int client, const char *text) {
+  send_line(client, "ok", text);
+}
+
+void control_error(int client, const char *text) {
+  send_line(client, "error", text);
+}
+
+/* an angle in degrees, or one of Z, L, P and R */
+static int parse_angle(const char *s, float *angle) {
+  static const char turns[] = "ZLPR";
+  const char *turn;
+  char *end;
+  double a;
+
+  if (s[0] && !s[1] && (turn = strchr(turns, s[0]))) {
+    *angle = (float)((turn - turns) * 90);
+    return 0;
+  }
+  a = strtod(s, &end);
+  if (end == s || *end) return -1;
+  a = fmod(a, 360.0);
+  *angle = (float)(a < 0.0 ? a + 360.0 : a);
+  return 0;
+}
+
+/* Fill in command from line, or return the reason it isn't one. */
+static const char *parse_command(char *line, struct control_command *command) {
+  char word[16], arg[32], extra;
+  int len = 0;
+  char *rest;
+
+  if (sscanf(line, "%15s%n", word, &len) != 1) return "empty command";
+  for (rest = line + len; *rest == ' ' || *rest == '\t'; rest++)
+    ;
+
+  if (!strcmp(word, "shape")) {
+    command->op = CONTROL_SHAPE;
+    if (parse_shape(rest, command->name, sizeof(command->name),
+                    &command->shape))
+      return "bad shape";
+  } else if (!strcmp(word, "joint")) {
+    command->op = CONTROL_JOINT;
+    if (sscanf(rest, "%d %31s %c", &command->n, arg, &extra) != 2 ||
+        command->n < 0 || command->n >= NODE_COUNT - 1 ||
+        parse_angle(arg, &command->value[0]))
+      return "usage: joint N ANGLE";
+  } else if (!strcmp(word, "preset")) {
+    command->op = CONTROL_PRESET;
+    if (!*rest) return "usage: preset N|NAME";
+    if (strspn(rest, "0123456789") == strlen(rest)) {
+      command->n = atoi(rest);
+    } else {
+      if (strlen(rest) >= sizeof(command->name)) return "no such model";
+      strcpy(command->name, rest);
+    }
+  } else if (!strcmp(word, "pause")) {
+    command->op = CONTROL_PAUSE;
+    if (!*rest)
+      command->n = -1;
+    else if (!strcmp(rest, "on"))
+      command->n = 1;
+    else if (!strcmp(rest, "off"))
+      command->n = 0;
+    else
+      return "usage: pause [on|off]";
+  } else if (!strcmp(word, "spin")) {
+    command->op = CONTROL_SPIN;
+    if (sscanf(rest, "%f %f %c", &command->value[0], &command->value[1],
+               &extra) != 2)
+      return "usage: spin Y Z";
+  } else if (!strcmp(word, "explode")) {
+    command->op = CONTROL_EXPLODE;
+    if (sscanf(rest, "%f %c", &command->value[0], &extra) != 1 ||
+        command->value[0] < 0.0)
+      return "usage: explode AMOUNT";
+  } else if (!strcmp(word, "state")) {
+    command->op = CONTROL_STATE;
+  } else if (!strcmp(word, "metrics")) {
+    command->op = CONTROL_METRICS;
+  } else if (!strcmp(word, "ping")) {
+    command->op = CONTROL_PING;
+  } else {
+    return "unknown command";
+  }
+  return NULL;
+}
+
+int control_next(struct control_command *command) {
+  int i;
+
+  for (i = 0; i < CONTROL_CLIENTS; i++) {
+    struct control_client *client = &clients[i];
+    char *eol;
+
+    if (client->fd < 0) continue;
+    while ((eol = memchr(client->buffer, '\n', client->buffered))) {
+      char *line = client->buffer;
+      const char *error;
+
+      *eol = '\0';
+      if (eol > line && eol[-1] == '\r') eol[-1] = '\0';
+      memset(command, 0, sizeof(*command));
+      command->client = i;
+      error = parse_command(line, command);
+      /* the line is done with either way */
+      client->buffered -= (size_t)(eol + 1 - line);
+      memmove(line, eol + 1, client->buffered);
+      if (!error) return 1;
+      control_error(i, error);
+      if (client->fd < 0) break;
+    }
+    if (client->fd < 0) continue;
+    if (client->buffered == CONTROL_LINE_LENGTH) {
+      control_error(i, "line too long");
+      if (client->fd >= 0) drop(client);
+    } else if (client->eof) {
+      drop(client);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,87 @@
+/* control.h - commands from other programs, over a Unix domain socket
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_CONTROL_H
+#define GLSNAKE_CONTROL_H
+
+#include "shape.h"
+
+/* Commands are lines of text, and each gets a line back, starting "ok" or
+ * "error".  They are:
+ *
+ *   shape SHAPE       morph to a shape, as a model file line
+ *   joint N ANGLE     turn joint N, from 0, to ANGLE degrees or Z, L, P, R
+ *   preset N|NAME     morph to a model, by number from 0 or by name
+ *   pause [on|off]    stop or start the snake, or toggle it
+ *   spin Y Z          turn the snake to these angles about y and z
+ *   explode AMOUNT    set how far apart the nodes are drawn
+ *   state             the shape, model, spin and so on, as name=value pairs
+ *   metrics           whether the shape is legal and cyclic
+ *   ping              nothing, to time the round trip
+ *
+ * Commands are read and carried out between frames, in the order they
+ * arrive. */
+
+#define CONTROL_NAME_LENGTH 64
+
+enum control_op {
+  CONTROL_SHAPE,
+  CONTROL_JOINT,
+  CONTROL_PRESET,
+  CONTROL_PAUSE,
+  CONTROL_SPIN,
+  CONTROL_EXPLODE,
+  CONTROL_STATE,
+  CONTROL_METRICS,
+  CONTROL_PING
+};
+
+struct control_command {
+  enum control_op op;
+  /* who to reply to */
+  int client;
+  /* shape: the shape and its name, if it had one; preset: the name, or
+   * empty for a number */
+  struct glsnake_shape shape;
+  char name[CONTROL_NAME_LENGTH];
+  /* joint: the joint; preset: the number; pause: 1 on, 0 off, -1 toggle */
+  int n;
+  /* joint: the angle; spin: y and z; explode: the amount */
+  float value[2];
+};
+
+/* Listen on a socket at path; returns -1 with errno set on failure. */
+int control_open(const char *path);
+void control_close(void);
+
+/* Take in any new connections and commands, without waiting.  This costs
+ * a single system call when nothing has arrived. */
+void control_poll(void);
+/* Returns 1 with the next command read, or 0 if there are no more.  Lines
+ * that aren't commands are answered with an error and skipped. */
+int control_next(struct control_command *command);
+
+/* Answer a command.  "ok" is sent ahead of the text, which may be empty. */
+void control_reply(int client, const char *text);
+void control_error(int client, const char *text);
+
+#endif /* GLSNAKE_CONTROL_H */
@@ -0,0 +1,333 @@
+/* geometry.c - the prism that makes up the snake, and where each prism
+ * ends up for a given shape
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "geometry.h"
+
+#ifndef M_SQRT1_2 /* Win32 doesn't have this constant  */
+#define M_SQRT1_2 0.70710678118654752440084436210485
+#endif
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* the triangular prism what makes up the basic unit */
+const float solid_prism_v[][3] = {
+    /* first corner, bottom left front */
+    {VOFFSET, VOFFSET, 1.0},
+    {VOFFSET, 0.00, 1.0 - VOFFSET},
+    {0.00, VOFFSET, 1.0 - VOFFSET},
+    /* second corner, rear */
+    {VOFFSET, VOFFSET, 0.00},
+    {VOFFSET, 0.00, VOFFSET},
+    {0.00, VOFFSET, VOFFSET},
+    /* third, right front */
+    {1.0 - VOFFSET / M_SQRT1_2, VOFFSET, 1.0},
+    {1.0 - VOFFSET / M_SQRT1_2, 0.0, 1.0 - VOFFSET},
+    {1.0 - VOFFSET * M_SQRT1_2, VOFFSET, 1.0 - VOFFSET},
+    /* fourth, right rear */
+    {1.0 - VOFFSET / M_SQRT1_2, VOFFSET, 0.0},
+    {1.0 - VOFFSET / M_SQRT1_2, 0.0, VOFFSET},
+    {1.0 - VOFFSET * M_SQRT1_2, VOFFSET, VOFFSET},
+    /* fifth, upper front */
+    {VOFFSET, 1.0 - VOFFSET / M_SQRT1_2, 1.0},
+    {VOFFSET / M_SQRT1_2, 1.0 - VOFFSET * M_SQRT1_2, 1.0 - VOFFSET},
+    {0.0, 1.0 - VOFFSET / M_SQRT1_2, 1.0 - VOFFSET},
+    /* sixth, upper rear */
+    {VOFFSET, 1.0 - VOFFSET / M_SQRT1_2, 0.0},
+    {VOFFSET / M_SQRT1_2, 1.0 - VOFFSET * M_SQRT1_2, VOFFSET},
+    {0.0, 1.0 - VOFFSET / M_SQRT1_2, VOFFSET}};
+
+const float solid_prism_n[][3] = {/* corners */
+                                   {-VOFFSET, -VOFFSET, VOFFSET},
+                                   {VOFFSET, -VOFFSET, VOFFSET},
+                                   {-VOFFSET, VOFFSET, VOFFSET},
+                                   {-VOFFSET, -VOFFSET, -VOFFSET},
+                                   {VOFFSET, -VOFFSET, -VOFFSET},
+                                   {-VOFFSET, VOFFSET, -VOFFSET},
+                                   /* edges */
+                                   {-VOFFSET, 0.0, VOFFSET},
+                                   {0.0, -VOFFSET, VOFFSET},
+                                   {VOFFSET, VOFFSET, VOFFSET},
+                                   {-VOFFSET, 0.0, -VOFFSET},
+                                   {0.0, -VOFFSET, -VOFFSET},
+                                   {VOFFSET, VOFFSET, -VOFFSET},
+                                   {-VOFFSET, -VOFFSET, 0.0},
+                                   {VOFFSET, -VOFFSET, 0.0},
+                                   {-VOFFSET, VOFFSET, 0.0},
+                                   /* faces */
+                                   {0.0, 0.0, 1.0},
+                                   {0.0, -1.0, 0.0},
+                                   {M_SQRT1_2, M_SQRT1_2, 0.0},
+                                   {-1.0, 0.0, 0.0},
+                                   {0.0, 0.0, -1.0}};
+
+const float wire_prism_v[][3] = {{0.0, 0.0, 1.0},
+                                  {1.0, 0.0, 1.0},
+                                  {0.0, 1.0, 1.0},
+                                  {0.0, 0.0, 0.0},
+                                  {1.0, 0.0, 0.0},
+                                  {0.0, 1.0, 0.0}};
+
+#if 0
+/* this isn't used! */
+const float wire_prism_n[][3] = {{ 0.0, 0.0, 1.0},
+			   { 0.0,-1.0, 0.0},
+			   { M_SQRT1_2, M_SQRT1_2, 0.0},
+			   {-1.0, 0.0, 0.0},
+			   { 0.0, 0.0,-1.0}};
+#endif /* 0 */
+
+const struct prism_face solid_prism_f[SOLID_PRISM_FACES] = {
+    /* corners */
+    {0, 3, {0, 2, 1}},
+    {1, 3, {6, 7, 8}},
+    {2, 3, {12, 13, 14}},
+    {3, 3, {3, 4, 5}},
+    {4, 3, {9, 11, 10}},
+    {5, 3, {16, 15, 17}},
+    /* edges */
+    {6, 4, {0, 12, 14, 2}},
+    {7, 4, {0, 1, 7, 6}},
+    {8, 4, {6, 8, 13, 12}},
+    {9, 4, {3, 5, 17, 15}},
+    {10, 4, {3, 9, 10, 4}},
+    {11, 4, {15, 16, 11, 9}},
+    {12, 4, {1, 2, 5, 4}},
+    {13, 4, {8, 7, 10, 11}},
+    {14, 4, {13, 16, 17, 14}},
+    /* faces */
+    {15, 3, {0, 6, 12}},
+    {19, 3, {3, 15, 9}},
+    {16, 4, {1, 4, 10, 7}},
+    {17, 4, {8, 11, 16, 13}},
+    {18, 4, {2, 14, 17, 5}}};
+
+const struct prism_face wire_prism_f[WIRE_PRISM_FACES] = {
+    {15, 3, {0, 1, 2}},
+    {19, 3, {3, 5, 4}},
+    {16, 4, {0, 3, 4, 1}},
+    {17, 4, {1, 4, 5, 2}},
+    {18, 4, {2, 5, 3, 0}}};
+
+void matrix_identity(float m[16]) {
+  memset(m, 0, 16 * sizeof(float));
+  m[0] = m[5] = m[10] = m[15] = 1.0;
+}
+
+void matrix_multiply(float out[16], const float a[16], const float b[16]) {
+  float r[16];
+  int i, j;
+
+  for (i = 0; i < 4; i++)
+    for (j = 0; j < 4; j++)
+      r[j * 4 + i] = a[i] * b[j * 4] + a[4 + i] * b[j * 4 + 1] +
+                     a[8 + i] * b[j * 4 + 2] + a[12 + i] * b[j * 4 + 3];
+  memcpy(out, r, sizeof(r));
+}
+
+void matrix_transform(const float m[16], const float in[3], float out[3]) {
+  float r[3];
+
+  r[0] = m[0] * in[0] + m[4] * in[1] + m[8] * in[2] + m[12];
+  r[1] = m[1] * in[0] + m[5] * in[1] + m[9] * in[2] + m[13];
+  r[2] = m[2] * in[0] + m[6] * in[1] + m[10] * in[2] + m[14];
+  memcpy(out, r, sizeof(r));
+}
+
+void matrix_rotate(float out[3], const float m[16], const float in[3]) {
+  float r[3];
+
+  r[0] = m[0] * in[0] + m[4] * in[1] + m[8] * in[2];
+  r[1] = m[1] * in[0] + m[5] * in[1] + m[9] * in[2];
+  r[2] = m[2] * in[0] + m[6] * in[1] + m[10] * in[2];
+  memcpy(out, r, sizeof(r));
+}
+
+void matrix_rotation(float m[16], float angle, float x, float y, float z) {
+  double a = angle * M_PI / 180.0, len = sqrt(x * x + y * y + z * z);
+  float c = (float)cos(a), s = (float)sin(a), t = 1.0 - c;
+
+  x /= len;
+  y /= len;
+  z /= len;
+  matrix_identity(m);
+  m[0] = t * x * x + c;
+  m[1] = t * x * y + s * z;
+  m[2] = t * x * z - s * y;
+  m[4] = t * x * y - s * z;
+  m[5] = t * y * y + c;
+  m[6] = t * y * z + s * x;
+  m[8] = t * x * z + s * y;
+  m[9] = t * y * z - s * x;
+  m[10] = t * z * z + c;
+}
+
+void matrix_perspective(float m[16], float fovy, float aspect, float znear,
+                        float zfar) {
+  float f = 1.0 / tan(fovy * M_PI / 360.0);
+
+  memset(m, 0, 16 * sizeof(float));
+  m[0] = f / aspect;
+  m[5] = f;
+  m[10] = (zfar + znear) / (znear - zfar);
+  m[11] = -1.0;
+  m[14] = 2.0 * zfar * znear / (znear - zfar);
+}
+
+void node_transforms(const struct glsnake_shape *shape, float explode,
+                     float m[NODE_COUNT + 1][16]) {
+  int i;
+
+  matrix_identity(m[0]);
+  for (i = 0; i < NODE_COUNT; i++) {
+    /* the product of the glTranslatef and glRotatef calls in
+     * glsnake_display: move to center, reorient, move to the new
+     * position, pivot to the new angle, and return from center */
+    double a = (180.0 + shape->node[i]) * M_PI / 180.0;
+    float c = (float)cos(a), s = (float)sin(a);
+    float step[16];
+
+    step[0] = 0.0;
+    step[1] = -1.0;
+    step[2] = 0.0;
+    step[3] = 0.0;
+    step[4] = c;
+    step[5] = 0.0;
+    step[6] = s;
+    step[7] = 0.0;
+    step[8] = -s;
+    step[9] = 0.0;
+    step[10] = c;
+    step[11] = 0.0;
+    step[12] = 0.5 - 0.5 * (c - s);
+    step[13] = 0.5 - (1.0 + explode) + 0.5;
+    step[14] = 0.5 - 0.5 * (s + c);
+    step[15] = 1.0;
+    matrix_multiply(m[i + 1], m[i], step);
+  }
+}
+
+/* identity first */
+const signed char node_rotations[NODE_ROTATIONS][9] = {
+    {1, 0, 0, 0, 1, 0, 0, 0, 1},
+    {1, 0, 0, 0, -1, 0, 0, 0, -1},
+    {-1, 0, 0, 0, 1, 0, 0, 0, -1},
+    {-1, 0, 0, 0, -1, 0, 0, 0, 1},
+    {1, 0, 0, 0, 0, 1, 0, -1, 0},
+    {1, 0, 0, 0, 0, -1, 0, 1, 0},
+    {-1, 0, 0, 0, 0, 1, 0, 1, 0},
+    {-1, 0, 0, 0, 0, -1, 0, -1, 0},
+    {0, 1, 0, 1, 0, 0, 0, 0, -1},
+    {0, 1, 0, -1, 0, 0, 0, 0, 1},
+    {0, -1, 0, 1, 0, 0, 0, 0, 1},
+    {0, -1, 0, -1, 0, 0, 0, 0, -1},
+    {0, 1, 0, 0, 0, 1, 1, 0, 0},
+    {0, 1, 0, 0, 0, -1, -1, 0, 0},
+    {0, -1, 0, 0, 0, 1, -1, 0, 0},
+    {0, -1, 0, 0, 0, -1, 1, 0, 0},
+    {0, 0, 1, 1, 0, 0, 0, 1, 0},
+    {0, 0, 1, -1, 0, 0, 0, -1, 0},
+    {0, 0, -1, 1, 0, 0, 0, -1, 0},
+    {0, 0, -1, -1, 0, 0, 0, 1, 0},
+    {0, 0, 1, 0, 1, 0, -1, 0, 0},
+    {0, 0, 1, 0, -1, 0, 1, 0, 0},
+    {0, 0, -1, 0, 1, 0, 1, 0, 0},
+    {0, 0, -1, 0, -1, 0, -1, 0, 0},
+};
+
+int node_place(const float m[16], struct node_place *place) {
+  static const int at[9] = {0, 1, 2, 4, 5, 6, 8, 9, 10};
+  double half[3];
+  int r, i;
+
+  for (r = 0; r < NODE_ROTATIONS; r++) {
+    for (i = 0; i < 9; i++)
+      if (fabs(m[at[i]] - node_rotations[r][i]) > 1e-4) break;
+    if (i == 9) break;
+  }
+  if (r == NODE_ROTATIONS) return -1;
+  place->rotation = (signed char)r;
+  for (i = 0; i < 3; i++) {
+    half[i] = floor(m[12 + i] * 2.0 + 0.5);
+    if (fabs(m[12 + i] * 2.0 - half[i]) > 1e-4 || fabs(half[i]) > 127.0)
+      return -1;
+  }
+  place->x = (signed char)half[0];
+  place->y = (signed char)half[1];
+  place->z = (signed char)half[2];
+  return 0;
+}
+
+void placed_transforms(const struct node_place place[NODE_COUNT],
+                       float explode, float m[NODE_COUNT + 1][16]) {
+  float away[3] = {0.0, 0.0, 0.0};
+  int i;
+
+  matrix_identity(m[0]);
+  for (i = 0; i < NODE_COUNT; i++) {
+    const signed char *r = node_rotations[place[i].rotation];
+    const signed char *before = node_rotations[i ? place[i - 1].rotation : 0];
+    float *n = m[i + 1];
+
+    /* -y of the node before, which is its second column */
+    away[0] -= before[3];
+    away[1] -= before[4];
+    away[2] -= before[5];
+    n[0] = r[0];
+    n[1] = r[1];
+    n[2] = r[2];
+    n[3] = 0.0;
+    n[4] = r[3];
+    n[5] = r[4];
+    n[6] = r[5];
+    n[7] = 0.0;
+    n[8] = r[6];
+    n[9] = r[7];
+    n[10] = r[8];
+    n[11] = 0.0;
+    n[12] = place[i].x * 0.5 + explode * away[0];
+    n[13] = place[i].y * 0.5 + explode * away[1];
+    n[14] = place[i].z * 0.5 + explode * away[2];
+    n[15] = 1.0;
+  }
+}
+
+void snake_centre(float m[NODE_COUNT + 1][16], float com[3]) {
+  static const float middle[3] = {0.5, 0.5, 0.5};
+  int i;
+
+  com[0] = com[1] = com[2] = 0.0;
+  for (i = 1; i <= NODE_COUNT; i++) {
+    float p[3];
+
+    matrix_transform(m[i], middle, p);
+    com[0] += p[0];
+    com[1] += p[1];
+    com[2] += p[2];
+  }
+  com[0] /= NODE_COUNT;
+  com[1] /= NODE_COUNT;
+  com[2] /= NODE_COUNT;
+}
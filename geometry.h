@@ -0,0 +1,99 @@
+/* geometry.h - the prism that makes up the snake, and where each prism
+ * ends up for a given shape
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef GLSNAKE_GEOMETRY_H
+#define GLSNAKE_GEOMETRY_H
+
+#include "shape.h"
+
+#define VOFFSET 0.045
+
+#define SOLID_PRISM_VERTICES 18
+#define SOLID_PRISM_FACES 20
+/* the faces, with each quad split in two */
+#define SOLID_PRISM_TRIANGLES 32
+#define WIRE_PRISM_VERTICES 6
+#define WIRE_PRISM_FACES 5
+
+/* the triangular prism, with bevelled edges and corners */
+extern const float solid_prism_v[SOLID_PRISM_VERTICES][3];
+extern const float solid_prism_n[SOLID_PRISM_FACES][3];
+/* the same prism without the bevels */
+extern const float wire_prism_v[WIRE_PRISM_VERTICES][3];
+
+/* Each face of the solid prism is a triangle or a quad, listed
+ * anticlockwise seen from outside, lit with solid_prism_n[normal]. */
+struct prism_face {
+  int normal;
+  int count;
+  int v[4];
+};
+
+extern const struct prism_face solid_prism_f[SOLID_PRISM_FACES];
+/* the faces of the prism without bevels, on wire_prism_v, lit with the
+ * normals of the solid prism's big faces */
+extern const struct prism_face wire_prism_f[WIRE_PRISM_FACES];
+
+/* Matrices are column major, as OpenGL has them. */
+void matrix_identity(float m[16]);
+void matrix_multiply(float out[16], const float a[16], const float b[16]);
+void matrix_transform(const float m[16], const float in[3], float out[3]);
+void matrix_rotate(float out[3], const float m[16], const float in[3]);
+/* the matrices glRotatef and gluPerspective would multiply by */
+void matrix_rotation(float m[16], float angle, float x, float y, float z);
+void matrix_perspective(float m[16], float fovy, float aspect, float znear,
+                        float zfar);
+
+/* Work out the transform that places each node of shape, relative to the
+ * first, exactly as glsnake_display walks along the snake.  m[i] is the
+ * transform of node i; m[NODE_COUNT] is where a node after the last would
+ * go. */
+void node_transforms(const struct glsnake_shape *shape, float explode,
+                     float m[NODE_COUNT + 1][16]);
+
+/* The 24 ways a node can face when every joint is a quarter turn, as the
+ * top left 3x3 of a column major matrix. */
+#define NODE_ROTATIONS 24
+extern const signed char node_rotations[NODE_ROTATIONS][9];
+
+/* Where node_transforms puts a node of such a shape, with no explode: one
+ * of node_rotations, and a translation in half units. */
+struct node_place {
+  signed char rotation;
+  signed char x, y, z;
+};
+
+/* The place of the node m puts, or -1 if it isn't a quarter turn and half
+ * units away from the first. */
+int node_place(const float m[16], struct node_place *place);
+
+/* The same transforms as node_transforms, from where m[1] to m[NODE_COUNT]
+ * are without explode: exploding moves each node along -y of every node
+ * before it. */
+void placed_transforms(const struct node_place place[NODE_COUNT],
+                       float explode, float m[NODE_COUNT + 1][16]);
+
+/* The centre of mass that glsnake_display centres the snake on: the average
+ * of the middles of m[1] to m[NODE_COUNT]. */
+void snake_centre(float m[NODE_COUNT + 1][16], float com[3]);
+
+#endif /* GLSNAKE_GEOMETRY_H */
@@ -0,0 +1,382 @@
+/* glcount.c - counting the OpenGL calls glsnake makes, for glcount=1 builds
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* Redundant calls are found by remembering what the wrapped calls last
+ * set.  Anything that might change state behind their back, such as
+ * calling a display list or popping attributes, makes them forget it, so
+ * a call is only counted as redundant when it certainly was.  Calls made
+ * while compiling a display list aren't made at all, so they are neither
+ * counted nor remembered. */
+
+#ifdef GLSNAKE_GL_COUNT
+
+#include <string.h>
+
+#define GLCOUNT_NO_REDIRECT
+#include "glcount.h"
+
+/* how many capabilities glEnable and glDisable can remember */
+#define ENABLES 32
+#define MATERIAL_FACES 2
+#define MATERIAL_PARAMS 5
+
+static const char *const glcount_name[GLCOUNT_FUNCTIONS] = {
+#define GLCOUNT_NAME(f, setter) "gl" #f,
+    GLCOUNT_FUNCS(GLCOUNT_NAME)
+#undef GLCOUNT_NAME
+};
+
+static const unsigned char glcount_setter[GLCOUNT_FUNCTIONS] = {
+#define GLCOUNT_SETTER(f, setter) setter,
+    GLCOUNT_FUNCS(GLCOUNT_SETTER)
+#undef GLCOUNT_SETTER
+};
+
+/* this frame */
+static unsigned long calls[GLCOUNT_FUNCTIONS], redundant[GLCOUNT_FUNCTIONS];
+/* every frame since glcount_reset */
+static unsigned long total_calls[GLCOUNT_FUNCTIONS];
+static unsigned long total_redundant[GLCOUNT_FUNCTIONS];
+static unsigned long frames;
+static struct glcount_frame last;
+static int compiling;
+
+static struct {
+  int colour_known;
+  GLfloat colour[4];
+  /* a bit for each face and parameter */
+  unsigned int material_known;
+  GLfloat material[MATERIAL_FACES][MATERIAL_PARAMS][4];
+  /* 0 if not known */
+  GLenum matrix_mode;
+  int texture_known;
+  GLuint texture;
+  int enables;
+  struct {
+    GLenum cap;
+    GLboolean on;
+  } enable[ENABLES];
+} known;
+
+static void forget(void) { memset(&known, 0, sizeof(known)); }
+
+void glcount_reset(void) {
+  memset(calls, 0, sizeof(calls));
+  memset(redundant, 0, sizeof(redundant));
+  memset(total_calls, 0, sizeof(total_calls));
+  memset(total_redundant, 0, sizeof(total_redundant));
+  memset(&last, 0, sizeof(last));
+  frames = 0;
+  forget();
+}
+
+void glcount_frame_end(void) {
+  int i;
+
+  memset(&last, 0, sizeof(last));
+  for (i = 0; i < GLCOUNT_FUNCTIONS; i++) {
+    last.calls += calls[i];
+    last.redundant += redundant[i];
+    if (glcount_setter[i]) last.changes += calls[i] - redundant[i];
+    total_calls[i] += calls[i];
+    total_redundant[i] += redundant[i];
+  }
+  memset(calls, 0, sizeof(calls));
+  memset(redundant, 0, sizeof(redundant));
+  frames++;
+}
+
+void glcount_last(struct glcount_frame *frame) { *frame = last; }
+
+void glcount_write_json(FILE *fp) {
+  double n = frames ? (double)frames : 1.0;
+  unsigned long all = 0, changes = 0, wasted = 0;
+  int i, first = 1;
+
+  for (i = 0; i < GLCOUNT_FUNCTIONS; i++) {
+    all += total_calls[i];
+    wasted += total_redundant[i];
+    if (glcount_setter[i]) changes += total_calls[i] - total_redundant[i];
+  }
+  fprintf(fp,
+          ",\n  \"gl_per_frame\": {\"calls\": %.1f, \"changes\": %.1f, "
+          "\"redundant\": %.1f,\n    \"functions\": {",
+          all / n, changes / n, wasted / n);
+  for (i = 0; i < GLCOUNT_FUNCTIONS; i++) {
+    if (!total_calls[i]) continue;
+    fprintf(fp, "%s\n      \"%s\": {\"calls\": %.1f", first ? "" : ",",
+            glcount_name[i], total_calls[i] / n);
+    if (glcount_setter[i])
+      fprintf(fp, ", \"redundant\": %.1f", total_redundant[i] / n);
+    fprintf(fp, "}");
+    first = 0;
+  }
+  fprintf(fp, "}}");
+}
+
+/* Count a call; returns 0 if it is only being compiled into a list. */
+static int count(enum glcount_func f) {
+  if (compiling) return 0;
+  calls[f]++;
+  return 1;
+}
+
+static void set_enabled(enum glcount_func f, GLenum cap, GLboolean on) {
+  int i;
+
+  if (!count(f)) return;
+  for (i = 0; i < known.enables; i++)
+    if (known.enable[i].cap == cap) {
+      if (known.enable[i].on == on) redundant[f]++;
+      known.enable[i].on = on;
+      return;
+    }
+  if (known.enables < ENABLES) {
+    known.enable[known.enables].cap = cap;
+    known.enable[known.enables++].on = on;
+  }
+}
+
+static void set_colour(enum glcount_func f, const GLfloat *v) {
+  if (!count(f)) return;
+  if (known.colour_known && !memcmp(known.colour, v, sizeof(known.colour))) {
+    redundant[f]++;
+    return;
+  }
+  memcpy(known.colour, v, sizeof(known.colour));
+  known.colour_known = 1;
+  /* with GL_COLOR_MATERIAL the colour sets the material too */
+  known.material_known = 0;
+}
+
+void glcount_Begin(GLenum mode) {
+  count(GLCOUNT_Begin);
+  glBegin(mode);
+}
+
+void glcount_BindTexture(GLenum target, GLuint texture) {
+  if (count(GLCOUNT_BindTexture) && target == GL_TEXTURE_2D) {
+    if (known.texture_known && known.texture == texture)
+      redundant[GLCOUNT_BindTexture]++;
+    known.texture = texture;
+    known.texture_known = 1;
+  }
+  glBindTexture(target, texture);
+}
+
+void glcount_CallList(GLuint list) {
+  if (count(GLCOUNT_CallList)) forget();
+  glCallList(list);
+}
+
+void glcount_Clear(GLbitfield mask) {
+  count(GLCOUNT_Clear);
+  glClear(mask);
+}
+
+void glcount_Color4f(GLfloat r, GLfloat g, GLfloat b, GLfloat a) {
+  GLfloat v[4];
+
+  v[0] = r;
+  v[1] = g;
+  v[2] = b;
+  v[3] = a;
+  set_colour(GLCOUNT_Color4f, v);
+  glColor4f(r, g, b, a);
+}
+
+void glcount_Color4fv(const GLfloat *v) {
+  set_colour(GLCOUNT_Color4fv, v);
+  glColor4fv(v);
+}
+
+void glcount_Disable(GLenum cap) {
+  set_enabled(GLCOUNT_Disable, cap, GL_FALSE);
+  glDisable(cap);
+}
+
+void glcount_DrawElements(GLenum mode, GLsizei n, GLenum type,
+                          const GLvoid *indices) {
+  /* a colour array leaves the current colour undefined */
+  if (count(GLCOUNT_DrawElements)) {
+    known.colour_known = 0;
+    known.material_known = 0;
+  }
+  glDrawElements(mode, n, type, indices);
+}
+
+void glcount_Enable(GLenum cap) {
+  set_enabled(GLCOUNT_Enable, cap, GL_TRUE);
+  glEnable(cap);
+}
+
+void glcount_End(void) {
+  count(GLCOUNT_End);
+  glEnd();
+}
+
+void glcount_EndList(void) {
+  compiling = 0;
+  count(GLCOUNT_EndList);
+  glEndList();
+}
+
+void glcount_GetFloatv(GLenum pname, GLfloat *params) {
+  count(GLCOUNT_GetFloatv);
+  glGetFloatv(pname, params);
+}
+
+void glcount_GetIntegerv(GLenum pname, GLint *params) {
+  count(GLCOUNT_GetIntegerv);
+  glGetIntegerv(pname, params);
+}
+
+void glcount_LoadIdentity(void) {
+  count(GLCOUNT_LoadIdentity);
+  glLoadIdentity();
+}
+
+static int material_param(GLenum pname) {
+  switch (pname) {
+    case GL_AMBIENT:
+      return 0;
+    case GL_DIFFUSE:
+      return 1;
+    case GL_SPECULAR:
+      return 2;
+    case GL_EMISSION:
+      return 3;
+    case GL_SHININESS:
+      return 4;
+    default:
+      return -1;
+  }
+}
+
+/* Remember one face's parameter; returns whether it was already so. */
+static int set_material(int face, int param, const GLfloat *params) {
+  unsigned int bit = 1u << (face * MATERIAL_PARAMS + param);
+  size_t size = (param == 4 ? 1 : 4) * sizeof(GLfloat);
+  int same = (known.material_known & bit) &&
+             !memcmp(known.material[face][param], params, size);
+
+  memcpy(known.material[face][param], params, size);
+  known.material_known |= bit;
+  return same;
+}
+
+void glcount_Materialfv(GLenum face, GLenum pname, const GLfloat *params) {
+  int first = face == GL_BACK ? 1 : 0;
+  int last_face = face == GL_FRONT ? 0 : 1;
+  int same = 1, f;
+
+  if (count(GLCOUNT_Materialfv)) {
+    for (f = first; f <= last_face; f++)
+      if (pname == GL_AMBIENT_AND_DIFFUSE) {
+        /* both must be set, so no short cut */
+        same = set_material(f, 0, params) & same;
+        same = set_material(f, 1, params) & same;
+      } else if (material_param(pname) >= 0) {
+        same = set_material(f, material_param(pname), params) & same;
+      } else {
+        same = 0;
+      }
+    if (same) redundant[GLCOUNT_Materialfv]++;
+  }
+  glMaterialfv(face, pname, params);
+}
+
+void glcount_MatrixMode(GLenum mode) {
+  if (count(GLCOUNT_MatrixMode)) {
+    if (known.matrix_mode == mode) redundant[GLCOUNT_MatrixMode]++;
+    known.matrix_mode = mode;
+  }
+  glMatrixMode(mode);
+}
+
+void glcount_MultMatrixf(const GLfloat *m) {
+  count(GLCOUNT_MultMatrixf);
+  glMultMatrixf(m);
+}
+
+void glcount_NewList(GLuint list, GLenum mode) {
+  count(GLCOUNT_NewList);
+  compiling = mode == GL_COMPILE;
+  glNewList(list, mode);
+}
+
+void glcount_Normal3fv(const GLfloat *v) {
+  count(GLCOUNT_Normal3fv);
+  glNormal3fv(v);
+}
+
+void glcount_PopAttrib(void) {
+  if (count(GLCOUNT_PopAttrib)) forget();
+  glPopAttrib();
+}
+
+void glcount_PopMatrix(void) {
+  count(GLCOUNT_PopMatrix);
+  glPopMatrix();
+}
+
+void glcount_PushAttrib(GLbitfield mask) {
+  count(GLCOUNT_PushAttrib);
+  glPushAttrib(mask);
+}
+
+void glcount_PushMatrix(void) {
+  count(GLCOUNT_PushMatrix);
+  glPushMatrix();
+}
+
+void glcount_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+  count(GLCOUNT_Rotatef);
+  glRotatef(angle, x, y, z);
+}
+
+void glcount_Scalef(GLfloat x, GLfloat y, GLfloat z) {
+  count(GLCOUNT_Scalef);
+  glScalef(x, y, z);
+}
+
+void glcount_TexCoord2f(GLfloat s, GLfloat t) {
+  count(GLCOUNT_TexCoord2f);
+  glTexCoord2f(s, t);
+}
+
+void glcount_Translatef(GLfloat x, GLfloat y, GLfloat z) {
+  count(GLCOUNT_Translatef);
+  glTranslatef(x, y, z);
+}
+
+void glcount_Vertex2f(GLfloat x, GLfloat y) {
+  count(GLCOUNT_Vertex2f);
+  glVertex2f(x, y);
+}
+
+void glcount_Vertex3fv(const GLfloat *v) {
+  count(GLCOUNT_Vertex3fv);
+  glVertex3fv(v);
+}
+
+#endif /* GLSNAKE_GL_COUNT */
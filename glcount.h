@@ -0,0 +1,157 @@
+/* glcount.h - counting the OpenGL calls glsnake makes, for glcount=1 builds
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_GLCOUNT_H
+#define GLSNAKE_GLCOUNT_H
+
+/* Built with GLSNAKE_GL_COUNT defined (scons glcount=1), glsnake.c's calls
+ * to the OpenGL functions below go through wrappers that count them, and
+ * count the calls that set state to what it already was.  The counts
+ * show up in the HUD and the -benchmark JSON.  Without it, nothing here
+ * is used. */
+
+#include <stdio.h>
+#ifdef WIN32
+#include <windows.h>
+#endif
+#include <GL/gl.h>
+
+/* each function, and whether it sets state */
+#define GLCOUNT_FUNCS(X) \
+  X(Begin, 0)            \
+  X(BindTexture, 1)      \
+  X(CallList, 0)         \
+  X(Clear, 0)            \
+  X(Color4f, 1)          \
+  X(Color4fv, 1)         \
+  X(Disable, 1)          \
+  X(DrawElements, 0)     \
+  X(Enable, 1)           \
+  X(End, 0)              \
+  X(EndList, 0)          \
+  X(GetFloatv, 0)        \
+  X(GetIntegerv, 0)      \
+  X(LoadIdentity, 0)     \
+  X(Materialfv, 1)       \
+  X(MatrixMode, 1)       \
+  X(MultMatrixf, 0)      \
+  X(NewList, 0)          \
+  X(Normal3fv, 0)        \
+  X(PopAttrib, 0)        \
+  X(PopMatrix, 0)        \
+  X(PushAttrib, 0)       \
+  X(PushMatrix, 0)       \
+  X(Rotatef, 0)          \
+  X(Scalef, 0)           \
+  X(TexCoord2f, 0)       \
+  X(Translatef, 0)       \
+  X(Vertex2f, 0)         \
+  X(Vertex3fv, 0)
+
+enum glcount_func {
+#define GLCOUNT_ENUM(f, setter) GLCOUNT_##f,
+  GLCOUNT_FUNCS(GLCOUNT_ENUM)
+#undef GLCOUNT_ENUM
+  GLCOUNT_FUNCTIONS
+};
+
+struct glcount_frame {
+  unsigned long calls;
+  /* calls to functions that set state, less the redundant ones */
+  unsigned long changes;
+  unsigned long redundant;
+};
+
+/* Start counting afresh. */
+void glcount_reset(void);
+/* The frame is done: keep its counts. */
+void glcount_frame_end(void);
+/* counts for the last whole frame */
+void glcount_last(struct glcount_frame *frame);
+/* Add the counts per frame since glcount_reset to a JSON object, as
+ * members following others. */
+void glcount_write_json(FILE *fp);
+
+void glcount_Begin(GLenum mode);
+void glcount_BindTexture(GLenum target, GLuint texture);
+void glcount_CallList(GLuint list);
+void glcount_Clear(GLbitfield mask);
+void glcount_Color4f(GLfloat r, GLfloat g, GLfloat b, GLfloat a);
+void glcount_Color4fv(const GLfloat *v);
+void glcount_Disable(GLenum cap);
+void glcount_DrawElements(GLenum mode, GLsizei count, GLenum type,
+                          const GLvoid *indices);
+void glcount_Enable(GLenum cap);
+void glcount_End(void);
+void glcount_EndList(void);
+void glcount_GetFloatv(GLenum pname, GLfloat *params);
+void glcount_GetIntegerv(GLenum pname, GLint *params);
+void glcount_LoadIdentity(void);
+void glcount_Materialfv(GLenum face, GLenum pname, const GLfloat *params);
+void glcount_MatrixMode(GLenum mode);
+void glcount_MultMatrixf(const GLfloat *m);
+void glcount_NewList(GLuint list, GLenum mode);
+void glcount_Normal3fv(const GLfloat *v);
+void glcount_PopAttrib(void);
+void glcount_PopMatrix(void);
+void glcount_PushAttrib(GLbitfield mask);
+void glcount_PushMatrix(void);
+void glcount_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z);
+void glcount_Scalef(GLfloat x, GLfloat y, GLfloat z);
+void glcount_TexCoord2f(GLfloat s, GLfloat t);
+void glcount_Translatef(GLfloat x, GLfloat y, GLfloat z);
+void glcount_Vertex2f(GLfloat x, GLfloat y);
+void glcount_Vertex3fv(const GLfloat *v);
+
+#if defined(GLSNAKE_GL_COUNT) && !defined(GLCOUNT_NO_REDIRECT)
+#define glBegin glcount_Begin
+#define glBindTexture glcount_BindTexture
+#define glCallList glcount_CallList
+#define glClear glcount_Clear
+#define glColor4f glcount_Color4f
+#define glColor4fv glcount_Color4fv
+#define glDisable glcount_Disable
+#define glDrawElements glcount_DrawElements
+#define glEnable glcount_Enable
+#define glEnd glcount_End
+#define glEndList glcount_EndList
+#define glGetFloatv glcount_GetFloatv
+#define glGetIntegerv glcount_GetIntegerv
+#define glLoadIdentity glcount_LoadIdentity
+#define glMaterialfv glcount_Materialfv
+#define glMatrixMode glcount_MatrixMode
+#define glMultMatrixf glcount_MultMatrixf
+#define glNewList glcount_NewList
+#define glNormal3fv glcount_Normal3fv
+#define glPopAttrib glcount_PopAttrib
+#define glPopMatrix glcount_PopMatrix
+#define glPushAttrib glcount_PushAttrib
+#define glPushMatrix glcount_PushMatrix
+#define glRotatef glcount_Rotatef
+#define glScalef glcount_Scalef
+#define glTexCoord2f glcount_TexCoord2f
+#define glTranslatef glcount_Translatef
+#define glVertex2f glcount_Vertex2f
+#define glVertex3fv glcount_Vertex3fv
+#endif
+
+#endif /* GLSNAKE_GLCOUNT_H */
@@ -46,11 +46,42 @@
 #include <string.h>
 #include <float.h>
 
-/* angles */
-#define ZERO 0.0
-#define LEFT 90.0
-#define PIN 180.0
-#define RIGHT 270.0
+#include "control.h"
+#include "geometry.h"
+#include "glcount.h"
+#include "gputimer.h"
+#include "history.h"
+#include "jointlog.h"
+#include "models.h"
+#include "raster.h"
+#include "record.h"
+#include "shape.h"
+#include "shmstate.h"
+#include "stats.h"
+#include "perf.h"
+#include "probes.h"
+#include "text.h"
+#include "timeline.h"
+
+#ifdef WIN32
+/* -stats maps its file with mmap */
+#define stats_frame(seconds)
+#define stats_morph(preset)
+#define stats_metrics(hit)
+#endif
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+#ifdef HAVE_INOTIFY
+#include <sys/inotify.h>
+#endif
+
+#ifndef WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #ifdef HAVE_GETTIMEOFDAY
 #ifdef GETTIMEOFDAY_TWO_ARGS
@@ -60,6 +91,8 @@
 typedef struct timeval snaketime;
 #define GETSECS(t) ((t).tv_sec)
 #define GETMSECS(t) ((t).tv_usec / 1000)
+#define SETTIME(t, secs, msecs) \
+  ((t).tv_sec = (secs), (t).tv_usec = (msecs)*1000)
 
 #else /* !GETTIMEOFDAY_TWO_ARGS */
 
@@ -68,6 +101,8 @@ typedef struct timeval snaketime;
 typedef struct timeval snaketime;
 #define GETSECS(t) ((t).tv_sec)
 #define GETMSECS(t) ((t).tv_usec / 1000)
+#define SETTIME(t, secs, msecs) \
+  ((t).tv_sec = (secs), (t).tv_usec = (msecs)*1000)
 
 #endif /* GETTIMEOFDAY_TWO_ARGS */
 
@@ -78,6 +113,8 @@ typedef struct timeval snaketime;
 typedef struct timeb snaketime;
 #define GETSECS(t) ((long)(t).time)
 #define GETMSECS(t) ((t).millitm)
+#define SETTIME(t, secs, msecs) \
+  ((t).time = (secs), (t).millitm = (unsigned short)(msecs))
 #endif /* HAVE_FTIME */
 #endif /* HAVE_GETTIMEOFDAY */
 
@@ -91,8 +128,6 @@ typedef struct timeb snaketime;
 #define ATTRIBUTE_UNUSED __attribute__((__unused__))
 #endif
 
-#define NODE_COUNT 24
-
 #ifdef HAVE_GLUT
 #define DEF_YANGVEL 0.10
 #define DEF_ZANGVEL 0.14
@@ -105,6 +140,20 @@ typedef struct timeb snaketime;
 #define DEF_ZOOM 25.0
 #define DEF_WIREFRAME 0
 #define DEF_TRANSPARENT 1
+#define DEF_STREAM NULL
+#define DEF_STREAM_BINARY 0
+#define DEF_MODELS NULL
+#define DEF_DEPTH_SORT NULL
+#define DEF_SOFTWARE 0
+#define DEF_GALLERY 0
+#define DEF_ATLAS NULL
+#define DEF_HUD 0
+#define DEF_TRACE NULL
+#define DEF_JOINT_LOG NULL
+#define DEF_CONTROL NULL
+#define DEF_SHM NULL
+#define DEF_STATS NULL
+#define DEF_STRICT 0
 #else
 /* xscreensaver options doobies prefer strings */
 #define DEF_YANGVEL "0.10"
@@ -118,6 +167,20 @@ typedef struct timeb snaketime;
 #define DEF_ZOOM "25.0"
 #define DEF_WIREFRAME "False"
 #define DEF_TRANSPARENT "True"
+#define DEF_STREAM ""
+#define DEF_STREAM_BINARY "False"
+#define DEF_MODELS ""
+#define DEF_DEPTH_SORT "insertion"
+#define DEF_SOFTWARE "False"
+#define DEF_GALLERY "False"
+#define DEF_ATLAS ""
+#define DEF_HUD "False"
+#define DEF_TRACE ""
+#define DEF_JOINT_LOG ""
+#define DEF_CONTROL ""
+#define DEF_SHM ""
+#define DEF_STATS ""
+#define DEF_STRICT "False"
 #endif
 
 /* static variables */
@@ -137,10 +200,24 @@ static GLfloat zangvel;
 static Bool altcolour;
 static Bool titles;
 static Bool interactive;
+static Bool strict;
 static Bool wireframe;
 static Bool transparent;
 static GLfloat zoom;
 static GLfloat angvel;
+static char *stream_path;
+static Bool stream_binary;
+static char *models_path;
+static char *depth_sort;
+static Bool software;
+static Bool gallery;
+static char *atlas_path;
+static Bool hud;
+static char *trace_path;
+static char *joint_log_path;
+static char *control_path;
+static char *shm_name;
+static char *stats_dir;
 
 #ifndef HAVE_GLUT
 /* xscreensaver setup */
@@ -180,6 +257,23 @@ static XrmOptionDescRec opts[] = {
     {"-no-wireframe", ".wireframe", XrmoptionNoArg, (caddr_t) "false"},
     {"-transparent", ".transparent", XrmoptionNoArg, (caddr_t) "true"},
     {"-no-transparent", ".transparent", XrmoptionNoArg, (caddr_t) "false"},
+    {"-stream", ".stream", XrmoptionSepArg, 0},
+    {"-stream-binary", ".streamBinary", XrmoptionNoArg, (caddr_t) "true"},
+    {"-models", ".models", XrmoptionSepArg, 0},
+    {"-depth-sort", ".depthSort", XrmoptionSepArg, 0},
+    {"-software", ".software", XrmoptionNoArg, (caddr_t) "true"},
+    {"-gallery", ".gallery", XrmoptionNoArg, (caddr_t) "true"},
+    {"-no-gallery", ".gallery", XrmoptionNoArg, (caddr_t) "false"},
+    {"-atlas", ".atlas", XrmoptionSepArg, 0},
+    {"-hud", ".hud", XrmoptionNoArg, (caddr_t) "true"},
+    {"-no-hud", ".hud", XrmoptionNoArg, (caddr_t) "false"},
+    {"-trace", ".trace", XrmoptionSepArg, 0},
+    {"-joint-log", ".jointLog", XrmoptionSepArg, 0},
+    {"-control", ".control", XrmoptionSepArg, 0},
+    {"-shm", ".shm", XrmoptionSepArg, 0},
+    {"-stats", ".stats", XrmoptionSepArg, 0},
+    {"-strict", ".strict", XrmoptionNoArg, (caddr_t) "true"},
+    {"-no-strict", ".strict", XrmoptionNoArg, (caddr_t) "false"},
 };
 
 static argtype vars[] = {
@@ -196,28 +290,40 @@ static argtype vars[] = {
     {&zoom, "zoom", "Zoom", DEF_ZOOM, t_Float},
     {&wireframe, "wireframe", "Wireframe", DEF_WIREFRAME, t_Bool},
     {&transparent, "transparent", "Transparent!", DEF_TRANSPARENT, t_Bool},
+    {&stream_path, "stream", "Stream", DEF_STREAM, t_String},
+    {&stream_binary, "streamBinary", "StreamBinary", DEF_STREAM_BINARY, t_Bool},
+    {&models_path, "models", "Models", DEF_MODELS, t_String},
+    {&depth_sort, "depthSort", "DepthSort", DEF_DEPTH_SORT, t_String},
+    {&software, "software", "Software", DEF_SOFTWARE, t_Bool},
+    {&gallery, "gallery", "Gallery", DEF_GALLERY, t_Bool},
+    {&atlas_path, "atlas", "Atlas", DEF_ATLAS, t_String},
+    {&hud, "hud", "HUD", DEF_HUD, t_Bool},
+    {&trace_path, "trace", "Trace", DEF_TRACE, t_String},
+    {&joint_log_path, "jointLog", "JointLog", DEF_JOINT_LOG, t_String},
+    {&control_path, "control", "Control", DEF_CONTROL, t_String},
+    {&shm_name, "shm", "Shm", DEF_SHM, t_String},
+    {&stats_dir, "stats", "Stats", DEF_STATS, t_String},
+    {&strict, "strict", "Strict", DEF_STRICT, t_Bool},
 };
 
 ModeSpecOpt sws_opts = {(int)countof(opts), opts, (int)countof(vars), vars,
                         NULL};
 #endif
 
-struct glsnake_shape {
-  float node[NODE_COUNT];
-};
-
-struct model_s {
-  const char *name;
-  struct glsnake_shape shape;
-};
-
 #ifdef HAVE_GLUT
-/* Define a ring buffer to store previous snake shapes.  The 'u' key will go
- * back to the previously stored state. */
-#define UNDO_LENGTH 100
-struct glsnake_shape undo_ring_buffer[UNDO_LENGTH];
-int undo_ring_start;
-int undo_ring_end;
+/* with -history, the undo history is kept in this file, so that the next
+ * session carries on from where this one left off */
+static char *history_path;
+
+/* with -benchmark, how many frames to time before printing how long they
+ * took and quitting */
+static long benchmark_frames;
+
+/* with -record, every clock reading and input event is written to a file;
+ * with -replay, they are read back from one instead, and the session runs
+ * as fast as it can be drawn */
+static char *record_path;
+static char *replay_path;
 #endif
 
 typedef int (*morph_func_t)(long);
@@ -283,15 +389,31 @@ struct glsnake_cfg {
   int old_width, old_height;
 
   /* the id of the display lists for drawing a node */
-  GLuint node_solid, node_wire;
+  GLuint node_solid, node_wire, node_flat;
+
+  /* the font the title and the HUD are drawn in */
+  struct text_font glyphs;
+  int glyphs_tried;
+
+  /* for the HUD and -benchmark */
+  struct gpu_timer gpu_timer;
+  /* frames drawn, for tracing */
+  unsigned long frame;
+
+  /* the title, laid out once for each new model or window size, in the
+   * plane the window's pixels are at in the scene */
+  struct text_line title_line;
+  char title[MODEL_NAME_LENGTH];
+  struct text_plane title_plane;
+  int title_stale;
 
   /* is the window fullscreen? */
   int fullscreen;
 };
 
-#define COLOUR_CYCLIC 0
-#define COLOUR_ACYCLIC 1
-#define COLOUR_INVALID 2
+#define COLOUR_CYCLIC MODEL_CYCLIC
+#define COLOUR_ACYCLIC MODEL_ACYCLIC
+#define COLOUR_INVALID MODEL_INVALID
 #define COLOUR_AUTHENTIC 3
 #define COLOUR_ORIGLOGO 4
 #define COLOUR_SPOOKY 5
@@ -311,1043 +433,17 @@ static float colour[][2][4] = {
     {{1.0, 0x99 / 255.0, 0.0, 1.0}, {0.1, 0.1, 0.1, 1.0}},
 };
 
-/* Dearest reader,
- *
- *   If the models contained within cause offence, you can do one of two
- * things:
- *
- * 1) Complain about it in bug reports and web forums, sharing war stories
- *    of how you were humiliated when you were giving a career-making
- *    presentation to your peers, or company board, and the screensaver
- *    kicked in, or
- *
- * 2) Send a patch to the authors.
- *
- * Contemptuously yours,
- *
- *   Jamie
- */
-static struct model_s model[] = {
+/* the models to choose from: those built in from data/models.glsnake, in
+ * which the straight snake and the one to start with come here, unless
+ * replaced by -models files */
 #define STRAIGHT_MODEL 0
-    {"straight",
-     {{ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO,
-       ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO,
-       ZERO}}},
-    /* the models in the Rubik's snake manual */
-    {"ball",
-     {{RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
-       LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT,
-       LEFT, ZERO}}},
 #define START_MODEL 2
-    {"snow",
-     {{RIGHT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT,
-       RIGHT, LEFT, LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, RIGHT, LEFT, LEFT,
-       LEFT, ZERO}}},
-    {"propellor",
-     {{ZERO, ZERO, ZERO, RIGHT, LEFT, RIGHT, ZERO, LEFT, ZERO, ZERO, ZERO,
-       RIGHT, LEFT, RIGHT, ZERO, LEFT, ZERO, ZERO, ZERO, RIGHT, LEFT, RIGHT,
-       ZERO, LEFT}}},
-    {"flamingo",
-     {{ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, RIGHT, RIGHT, PIN, RIGHT,
-       LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, RIGHT, ZERO, ZERO, ZERO, PIN,
-       ZERO}}},
-    {"cat",
-     {{ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, PIN,
-       PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO}}},
-    {"rooster",
-     {{ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, LEFT, RIGHT, PIN, RIGHT, ZERO,
-       PIN, PIN, ZERO, RIGHT, PIN, RIGHT, LEFT, ZERO, LEFT, ZERO, PIN, ZERO}}},
-    /* These models were taken from Andrew and Peter's original snake.c
-     * as well as some newer ones made up by Jamie, Andrew and Peter. */
-    {"half balls",
-     {{LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT,
-       LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT,
-       LEFT, ZERO}}},
-    {"zigzag1",
-     {{RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT,
-       LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, LEFT,
-       LEFT, ZERO}}},
-    {"zigzag2",
-     {{PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN,
-       ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO}}},
-    {"zigzag3",
-     {{PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN,
-       LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN, ZERO}}},
-    {"caterpillar",
-     {{RIGHT, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, LEFT, PIN,
-       RIGHT, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, LEFT,
-       ZERO}}},
-    {"bow",
-     {{RIGHT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT,
-       RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, RIGHT, LEFT,
-       LEFT, ZERO}}},
-    {"turtle",
-     {{ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, LEFT,
-       RIGHT, LEFT, LEFT, PIN, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT,
-       RIGHT, ZERO}}},
-    {"basket",
-     {{RIGHT, PIN, ZERO, ZERO, PIN, LEFT, ZERO, LEFT, LEFT, ZERO, LEFT, PIN,
-       ZERO, ZERO, PIN, RIGHT, PIN, LEFT, PIN, ZERO, ZERO, PIN, LEFT, ZERO}}},
-    {"thing",
-     {{PIN, RIGHT, LEFT, RIGHT, RIGHT, LEFT, PIN, LEFT, RIGHT, LEFT, LEFT,
-       RIGHT, PIN, RIGHT, LEFT, RIGHT, RIGHT, LEFT, PIN, LEFT, RIGHT, LEFT,
-       LEFT, ZERO}}},
-    {"hexagon",
-     {{ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO,
-       LEFT, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO,
-       RIGHT}}},
-    {"tri1",
-     {{ZERO, ZERO, LEFT, RIGHT, ZERO, LEFT, ZERO, RIGHT, ZERO, ZERO, LEFT,
-       RIGHT, ZERO, LEFT, ZERO, RIGHT, ZERO, ZERO, LEFT, RIGHT, ZERO, LEFT,
-       ZERO, RIGHT}}},
-    {"triangle",
-     {{ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO, ZERO, ZERO,
-       ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, LEFT,
-       RIGHT}}},
-    {"flower",
-     {{ZERO, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT, PIN,
-       ZERO, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT,
-       PIN}}},
-    {"crucifix",
-     {{ZERO, PIN, PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, PIN, PIN,
-       ZERO, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, PIN}}},
-    {"kayak",
-     {{PIN, RIGHT, LEFT, PIN, LEFT, PIN, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO,
-       ZERO, ZERO, ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, PIN,
-       RIGHT}}},
-    {"bird",
-     {{ZERO, ZERO, ZERO, ZERO, RIGHT, RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO,
-       RIGHT, ZERO, RIGHT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, LEFT, ZERO, PIN,
-       ZERO}}},
-    {"seal",
-     {{RIGHT, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, PIN, PIN, ZERO, LEFT, ZERO,
-       LEFT, PIN, RIGHT, ZERO, LEFT, LEFT, LEFT, PIN, RIGHT, RIGHT, LEFT,
-       ZERO}}},
-    {"dog",
-     {{ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO, PIN,
-       PIN, ZERO, ZERO, ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO}}},
-    {"frog",
-     {{RIGHT, RIGHT, LEFT, LEFT, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, RIGHT, ZERO,
-       LEFT, ZERO, LEFT, PIN, RIGHT, ZERO, LEFT, LEFT, RIGHT, LEFT, LEFT,
-       ZERO}}},
-    {"quavers",
-     {{LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, ZERO, ZERO, ZERO, RIGHT, ZERO,
-       ZERO, LEFT, RIGHT, ZERO, ZERO, ZERO, LEFT, LEFT, RIGHT, LEFT, RIGHT,
-       RIGHT, ZERO}}},
-    {"fly",
-     {{LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, ZERO, PIN, ZERO, ZERO, LEFT, PIN,
-       RIGHT, ZERO, ZERO, PIN, ZERO, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT,
-       ZERO}}},
-    {"puppy",
-     {{ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, RIGHT,
-       RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, ZERO,
-       ZERO}}},
-    {"stars",
-     {{LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO, ZERO,
-       ZERO, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT,
-       ZERO}}},
-    {"mountains",
-     {{RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN,
-       RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN}}},
-    {"quad1",
-     {{RIGHT, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT, LEFT, LEFT, PIN, LEFT, PIN,
-       RIGHT, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT, LEFT, LEFT, PIN, LEFT,
-       PIN}}},
-    {"quad2",
-     {{ZERO, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT, LEFT, LEFT, PIN, ZERO, PIN,
-       ZERO, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT, LEFT, LEFT, PIN, ZERO, PIN}}},
-    {"glasses",
-     {{ZERO, PIN, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, PIN, ZERO, PIN,
-       ZERO, PIN, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, PIN, ZERO, PIN}}},
-    {"em",
-     {{ZERO, PIN, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, PIN, ZERO, PIN,
-       ZERO, PIN, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, PIN, ZERO, PIN}}},
-    {"quad3",
-     {{ZERO, RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, LEFT, ZERO, PIN,
-       ZERO, RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, LEFT, ZERO,
-       PIN}}},
-    {"vee",
-     {{ZERO, ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, ZERO, ZERO, PIN,
-       ZERO, ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, ZERO, ZERO, PIN}}},
-    {"square",
-     {{ZERO, ZERO, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, ZERO, ZERO, PIN,
-       ZERO, ZERO, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, ZERO, ZERO,
-       PIN}}},
-    {"eagle",
-     {{RIGHT, ZERO, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, ZERO, LEFT, PIN,
-       RIGHT, ZERO, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, ZERO, LEFT,
-       PIN}}},
-    {"volcano",
-     {{RIGHT, ZERO, LEFT, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT, ZERO, LEFT, PIN,
-       RIGHT, ZERO, LEFT, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT, ZERO, LEFT,
-       PIN}}},
-    {"saddle",
-     {{RIGHT, ZERO, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, ZERO, LEFT, PIN,
-       RIGHT, ZERO, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, ZERO, LEFT,
-       PIN}}},
-    {"c3d",
-     {{ZERO, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, LEFT, ZERO, ZERO, PIN,
-       ZERO, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, LEFT, ZERO, ZERO, PIN}}},
-    {"block",
-     {{ZERO, ZERO, PIN, PIN, ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT,
-       PIN, LEFT, PIN, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, LEFT, PIN, RIGHT}}},
-    {"duck",
-     {{LEFT, PIN, LEFT, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, LEFT, PIN, RIGHT,
-       ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, LEFT, PIN, LEFT, ZERO}}},
-    {"prayer",
-     {{RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, ZERO, ZERO, ZERO, RIGHT,
-       PIN, LEFT, ZERO, ZERO, ZERO, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT,
-       PIN}}},
-    {"giraffe",
-     {{ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, ZERO, RIGHT, RIGHT,
-       RIGHT, PIN, LEFT, RIGHT, ZERO, PIN, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT,
-       LEFT}}},
-    {"tie fighter",
-     {{PIN, LEFT, RIGHT, LEFT, LEFT, PIN, RIGHT, ZERO, RIGHT, LEFT, ZERO, PIN,
-       LEFT, LEFT, RIGHT, RIGHT, RIGHT, PIN, LEFT, ZERO, LEFT, RIGHT, ZERO,
-       ZERO}}},
-    {"Strong Arms",
-     {{PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO, RIGHT, ZERO, RIGHT, RIGHT, PIN,
-       RIGHT, RIGHT, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, PIN, PIN,
-       ZERO}}},
-
-    /* the following modesl were created during the slug/compsoc codefest
-     * febrray 2003 */
-    {"cool looking gegl",
-     {{PIN, PIN, ZERO, ZERO, RIGHT, ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO,
-       ZERO, PIN, ZERO, PIN, PIN, ZERO, LEFT, RIGHT, PIN, ZERO, ZERO, ZERO}}},
-    {"knuckledusters",
-     {{ZERO, ZERO, ZERO, ZERO, PIN, RIGHT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO,
-       RIGHT, RIGHT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, RIGHT, ZERO}}},
-#ifndef WIN32
-    {"k's turd",
-     {{RIGHT, RIGHT, PIN, RIGHT, LEFT, RIGHT, PIN, RIGHT, LEFT, RIGHT, PIN,
-       RIGHT, LEFT, RIGHT, PIN, RIGHT, LEFT, RIGHT, PIN, RIGHT, LEFT, RIGHT,
-       PIN, ZERO}}},
-#endif
-    {"lightsabre",
-     {{ZERO, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO,
-       ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO,
-       ZERO}}},
-    {"not a stairway",
-     {{LEFT, ZERO, RIGHT, LEFT, RIGHT, ZERO, LEFT, RIGHT, LEFT, ZERO, RIGHT,
-       LEFT, RIGHT, ZERO, LEFT, RIGHT, LEFT, ZERO, RIGHT, LEFT, RIGHT, ZERO,
-       LEFT, ZERO}}},
-    {"not very good (but accurate) gegl",
-     {{ZERO, PIN, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, PIN, PIN,
-       ZERO, RIGHT, LEFT, ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO}}},
-    {"box",
-     {{ZERO, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, PIN,
-       ZERO, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO}}},
-    {"kissy box",
-     {{PIN, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, PIN,
-       ZERO, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, ZERO}}},
-#ifndef WIN32
-    {"erect penis", /* thanks benno */
-     {{PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO,
-       ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO}}},
-    {"flaccid penis",
-     {{PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO,
-       ZERO, ZERO, RIGHT, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO}}},
-    {"vagina",
-     {{RIGHT, ZERO, ZERO, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, LEFT, ZERO,
-       ZERO, ZERO, LEFT, ZERO, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, ZERO}}},
-#endif
-    {"mask",
-     {{ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, ZERO, PIN, ZERO, ZERO,
-       PIN, ZERO, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO}}},
-    {"poles or columns or something",
-     {{LEFT, RIGHT, LEFT, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, LEFT,
-       RIGHT, LEFT, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, LEFT, ZERO}}},
-    {"crooked v",
-     {{ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, LEFT,
-       ZERO, LEFT, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO}}},
-    {"dog leg",
-     {{ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, LEFT,
-       ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO}}},
-    {"scrubby",
-     {{ZERO, ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, LEFT, RIGHT,
-       ZERO, ZERO, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO, LEFT, PIN, ZERO,
-       ZERO}}},
-    {"voltron's eyes",
-     {{ZERO, ZERO, PIN, RIGHT, ZERO, LEFT, ZERO, ZERO, RIGHT, ZERO, LEFT, PIN,
-       ZERO, ZERO, PIN, ZERO, LEFT, ZERO, RIGHT, LEFT, ZERO, RIGHT, ZERO,
-       ZERO}}},
-    {"flying toaster",
-     {{PIN, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, RIGHT,
-       ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
-    {"dubbya",
-     {{PIN, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, ZERO,
-       PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
-    {"tap handle",
-     {{PIN, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, LEFT, ZERO,
-       PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
-    {"wingnut",
-     {{PIN, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, PIN, ZERO,
-       PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
-    {"tight twist",
-     {{RIGHT, ZERO, ZERO, LEFT, ZERO, LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT,
-       PIN, RIGHT, LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT, ZERO, ZERO,
-       RIGHT, ZERO}}},
-    {"double helix",
-     {{RIGHT, ZERO, RIGHT, ZERO, RIGHT, ZERO, RIGHT, ZERO, RIGHT, ZERO, RIGHT,
-       ZERO, RIGHT, LEFT, RIGHT, PIN, ZERO, RIGHT, ZERO, RIGHT, ZERO, RIGHT,
-       ZERO, ZERO}}},
-
-/* These models come from the website at
- * http://www.geocities.com/stigeide/snake */
-#if 0
-    { "Abstract",
-      { { RIGHT, LEFT, RIGHT, ZERO, PIN, ZERO, LEFT, RIGHT, LEFT, PIN, ZERO, ZERO, PIN, LEFT, RIGHT, LEFT, ZERO, PIN, ZERO, RIGHT, LEFT, RIGHT, ZERO, ZERO } }
-    },
-#endif
-    {"toadstool",
-     {{LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, PIN, RIGHT,
-       RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, PIN, RIGHT, LEFT,
-       PIN, ZERO}}},
-    {"AlanH2",
-     {{LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, PIN, RIGHT,
-       RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT,
-       RIGHT, ZERO}}},
-    {"AlanH3",
-     {{LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, PIN, RIGHT,
-       RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT, PIN, LEFT, RIGHT,
-       PIN, ZERO}}},
-    {"AlanH4",
-     {{ZERO, ZERO, PIN, LEFT, RIGHT, LEFT, ZERO, RIGHT, LEFT, RIGHT, ZERO, PIN,
-       ZERO, LEFT, RIGHT, LEFT, ZERO, RIGHT, LEFT, RIGHT, PIN, ZERO, ZERO,
-       ZERO}}},
-    {"Alien",
-     {{RIGHT, LEFT, RIGHT, PIN, ZERO, ZERO, PIN, RIGHT, LEFT, RIGHT, ZERO, PIN,
-       PIN, ZERO, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, ZERO, PIN, PIN, ZERO}}},
-    {"Angel",
-     {{ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT,
-       RIGHT, RIGHT, LEFT, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, ZERO, RIGHT,
-       LEFT, ZERO}}},
-    {"AnotherFigure",
-     {{LEFT, PIN, RIGHT, ZERO, ZERO, PIN, RIGHT, LEFT, LEFT, PIN, RIGHT, LEFT,
-       ZERO, PIN, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, LEFT, PIN, ZERO,
-       ZERO}}},
-    {"Ball",
-     {{LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, LEFT,
-       RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT,
-       RIGHT, ZERO}}},
-    {"Basket",
-     {{ZERO, RIGHT, RIGHT, ZERO, RIGHT, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT,
-       LEFT, PIN, RIGHT, LEFT, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, ZERO, LEFT,
-       ZERO}}},
-    {"Beetle",
-     {{PIN, LEFT, RIGHT, ZERO, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT,
-       RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, ZERO, LEFT, RIGHT, PIN,
-       RIGHT, ZERO}}},
-    {"bone",
-     {{PIN, PIN, LEFT, ZERO, PIN, PIN, ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, ZERO,
-       ZERO, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, RIGHT, PIN, PIN, ZERO}}},
-    {"Bow",
-     {{LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT,
-       RIGHT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT,
-       RIGHT, ZERO}}},
-    {"bra",
-     {{RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, LEFT, LEFT,
-       RIGHT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, LEFT,
-       LEFT, ZERO}}},
-    {"bronchosaurus",
-     {{ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO, PIN, PIN,
-       ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, ZERO}}},
-    {"Cactus",
-     {{PIN, LEFT, ZERO, PIN, PIN, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, PIN,
-       RIGHT, PIN, LEFT, ZERO, ZERO, RIGHT, PIN, LEFT, PIN, ZERO, ZERO, ZERO}}},
-    {"Camel",
-     {{RIGHT, ZERO, PIN, RIGHT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, LEFT, PIN,
-       LEFT, RIGHT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, ZERO, ZERO, LEFT,
-       ZERO}}},
-    {"Candlestick",
-     {{LEFT, PIN, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, RIGHT, PIN,
-       LEFT, PIN, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, RIGHT,
-       ZERO}}},
-    {"Cat",
-     {{ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, PIN,
-       PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO}}},
-    {"Cave",
-     {{RIGHT, ZERO, ZERO, PIN, LEFT, ZERO, PIN, PIN, ZERO, RIGHT, LEFT, PIN,
-       RIGHT, RIGHT, LEFT, LEFT, PIN, RIGHT, RIGHT, LEFT, PIN, ZERO, ZERO,
-       ZERO}}},
-    {"Chains",
-     {{PIN, ZERO, ZERO, PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, ZERO,
-       PIN, ZERO, ZERO, PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, ZERO}}},
-    {"Chair",
-     {{RIGHT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, RIGHT, ZERO, ZERO, PIN, PIN,
-       ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, ZERO, LEFT, RIGHT, LEFT, LEFT,
-       ZERO}}},
-    {"Chick",
-     {{RIGHT, RIGHT, RIGHT, PIN, LEFT, PIN, LEFT, PIN, RIGHT, RIGHT, RIGHT, PIN,
-       LEFT, LEFT, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, LEFT, LEFT, ZERO}}},
-    {"Clockwise",
-     {{RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT,
-       RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT,
-       RIGHT, RIGHT, RIGHT, ZERO}}},
-    {"cobra",
-     {{ZERO, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
-       LEFT, LEFT, LEFT, ZERO, LEFT, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, RIGHT,
-       ZERO}}},
-#if 0
-    { "Cobra2",
-        { { LEFT, ZERO, PIN, ZERO, PIN, LEFT, ZERO, PIN, ZERO, LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, PIN, ZERO, RIGHT, PIN, ZERO, PIN, ZERO, RIGHT , ZERO } }
-    },
-#endif
-    {"Cobra3",
-     {{ZERO, LEFT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, ZERO,
-       ZERO, LEFT, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, LEFT, ZERO}}},
-    {"Compact1",
-     {{ZERO, ZERO, PIN, ZERO, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN,
-       RIGHT, PIN, LEFT, ZERO, PIN, PIN, ZERO, ZERO, LEFT, PIN, ZERO}}},
-    {"Compact2",
-     {{LEFT, PIN, RIGHT, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, PIN, LEFT, ZERO,
-       ZERO, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, RIGHT, ZERO, ZERO, ZERO,
-       ZERO}}},
-    {"Compact3",
-     {{ZERO, PIN, ZERO, PIN, PIN, ZERO, LEFT, PIN, RIGHT, ZERO, PIN, PIN, ZERO,
-       PIN, ZERO, PIN, PIN, ZERO, LEFT, PIN, RIGHT, ZERO, PIN, ZERO}}},
-    {"Compact4",
-     {{PIN, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN, RIGHT, PIN,
-       LEFT, PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO}}},
-    {"Compact5",
-     {{LEFT, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, RIGHT, PIN,
-       RIGHT, PIN, LEFT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, PIN, LEFT,
-       ZERO}}},
-    {"Contact",
-     {{PIN, ZERO, ZERO, PIN, LEFT, LEFT, PIN, LEFT, RIGHT, RIGHT, PIN, LEFT,
-       LEFT, RIGHT, PIN, RIGHT, RIGHT, PIN, ZERO, ZERO, PIN, RIGHT, PIN,
-       ZERO}}},
-    {"Contact2",
-     {{RIGHT, PIN, ZERO, LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, PIN, LEFT, PIN,
-       RIGHT, PIN, ZERO, LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, PIN, LEFT,
-       ZERO}}},
-    {"Cook",
-     {{ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, RIGHT, LEFT, PIN, LEFT, ZERO,
-       PIN, PIN, ZERO, LEFT, PIN, LEFT, RIGHT, ZERO, RIGHT, ZERO, PIN, ZERO}}},
-    {"Counterclockwise",
-     {{LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT,
-       LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT,
-       ZERO}}},
-    {"Cradle",
-     {{LEFT, LEFT, ZERO, PIN, LEFT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT,
-       RIGHT, LEFT, RIGHT, PIN, ZERO, RIGHT, RIGHT, LEFT, LEFT, ZERO, ZERO,
-       RIGHT, ZERO}}},
-    {"Crankshaft",
-     {{ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, PIN, LEFT, LEFT, PIN, RIGHT, LEFT,
-       ZERO, PIN, LEFT, PIN, RIGHT, ZERO, ZERO, ZERO, PIN, RIGHT, ZERO}}},
-    {"Cross",
-     {{ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO,
-       ZERO, ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, PIN, ZERO}}},
-    {"Cross2",
-     {{ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, ZERO, PIN, PIN, ZERO, RIGHT,
-       ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, ZERO, PIN, PIN, ZERO, ZERO}}},
-    {"Cross3",
-     {{ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, ZERO, PIN, PIN, ZERO, RIGHT,
-       ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, ZERO, PIN, PIN, ZERO, ZERO}}},
-    {"CrossVersion1",
-     {{PIN, ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, PIN,
-       RIGHT, ZERO, PIN, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN,
-       ZERO}}},
-    {"CrossVersion2",
-     {{RIGHT, LEFT, PIN, LEFT, LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN,
-       LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, LEFT, LEFT, PIN, LEFT, RIGHT,
-       ZERO}}},
-    {"Crown",
-     {{LEFT, ZERO, PIN, ZERO, RIGHT, ZERO, ZERO, LEFT, ZERO, PIN, ZERO, RIGHT,
-       LEFT, ZERO, PIN, ZERO, RIGHT, ZERO, ZERO, LEFT, ZERO, PIN, ZERO, ZERO}}},
-    {"DNAStrand",
-     {{RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN,
-       RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT,
-       ZERO}}},
-    {"Diamond",
-     {{ZERO, RIGHT, ZERO, ZERO, LEFT, ZERO, ZERO, RIGHT, PIN, LEFT, LEFT, RIGHT,
-       LEFT, RIGHT, RIGHT, PIN, LEFT, ZERO, ZERO, RIGHT, ZERO, ZERO, LEFT,
-       ZERO}}},
-    {"Dog",
-     {{RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT,
-       LEFT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, ZERO, LEFT,
-       RIGHT, ZERO}}},
-    {"DogFace",
-     {{ZERO, ZERO, PIN, PIN, ZERO, LEFT, LEFT, RIGHT, PIN, ZERO, PIN, PIN, ZERO,
-       PIN, LEFT, RIGHT, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
-    {"DoublePeak",
-     {{ZERO, ZERO, PIN, ZERO, ZERO, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT,
-       LEFT, LEFT, ZERO, PIN, ZERO, RIGHT, RIGHT, LEFT, PIN, LEFT, RIGHT,
-       ZERO}}},
-    {"DoubleRoof",
-     {{ZERO, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, LEFT,
-       RIGHT, RIGHT, LEFT, LEFT, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT,
-       ZERO}}},
-    {"txoboggan",
-     {{ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, ZERO, PIN, PIN, ZERO,
-       ZERO, ZERO, ZERO, LEFT, PIN, RIGHT, ZERO, ZERO, ZERO, ZERO, PIN, ZERO}}},
-    {"Doubled",
-     {{LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT, LEFT, ZERO,
-       LEFT, PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, ZERO}}},
-    {"Doubled1",
-     {{LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, ZERO, RIGHT, ZERO,
-       RIGHT, ZERO, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT,
-       ZERO}}},
-    {"Doubled2",
-     {{LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, LEFT, RIGHT, ZERO,
-       RIGHT, LEFT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT,
-       ZERO}}},
-    {"DumblingSpoon",
-     {{PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO, LEFT, RIGHT,
-       ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO,
-       ZERO}}},
-    {"Embrace",
-     {{PIN, ZERO, ZERO, PIN, RIGHT, PIN, LEFT, PIN, ZERO, RIGHT, PIN, RIGHT,
-       PIN, LEFT, PIN, LEFT, ZERO, PIN, RIGHT, PIN, LEFT, PIN, ZERO, ZERO}}},
-    {"EndlessBelt",
-     {{ZERO, RIGHT, LEFT, ZERO, ZERO, ZERO, LEFT, RIGHT, ZERO, PIN, RIGHT, LEFT,
-       ZERO, LEFT, RIGHT, LEFT, PIN, LEFT, RIGHT, LEFT, ZERO, LEFT, RIGHT,
-       ZERO}}},
-    {"Entrance",
-     {{LEFT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT,
-       RIGHT, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, LEFT, LEFT,
-       RIGHT, ZERO}}},
-    {"Esthetic",
-     {{LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, PIN,
-       LEFT, PIN, RIGHT, PIN, LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT,
-       ZERO}}},
-    {"Explosion",
-     {{RIGHT, RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, RIGHT,
-       LEFT, RIGHT, LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT,
-       LEFT, ZERO}}},
-    {"F-ZeroXCar",
-     {{RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, ZERO,
-       RIGHT, LEFT, ZERO, ZERO, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT,
-       ZERO}}},
-    {"Face",
-     {{ZERO, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN,
-       RIGHT, LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO}}},
-    {"FaserGun",
-     {{ZERO, ZERO, LEFT, RIGHT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, LEFT, PIN,
-       LEFT, RIGHT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, RIGHT, ZERO, PIN,
-       ZERO}}},
-    {"FelixW",
-     {{ZERO, RIGHT, ZERO, PIN, LEFT, ZERO, LEFT, RIGHT, ZERO, ZERO, RIGHT, PIN,
-       LEFT, ZERO, ZERO, LEFT, RIGHT, ZERO, RIGHT, PIN, ZERO, LEFT, ZERO,
-       ZERO}}},
-    {"Flamingo",
-     {{ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, LEFT, LEFT, PIN, LEFT,
-       RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, LEFT, ZERO, ZERO, ZERO, PIN, ZERO}}},
-    {"FlatOnTheTop",
-     {{ZERO, PIN, PIN, ZERO, PIN, RIGHT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT,
-       PIN, LEFT, RIGHT, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO}}},
-    {"Fly",
-     {{ZERO, LEFT, PIN, RIGHT, ZERO, PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT,
-       PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO}}},
-    {"Fountain",
-     {{LEFT, RIGHT, LEFT, RIGHT, RIGHT, PIN, LEFT, PIN, LEFT, RIGHT, RIGHT, PIN,
-       LEFT, LEFT, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT, PIN, RIGHT, PIN,
-       ZERO}}},
-    {"Frog",
-     {{LEFT, LEFT, RIGHT, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO,
-       RIGHT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, RIGHT, LEFT, RIGHT, RIGHT,
-       ZERO}}},
-    {"Frog2",
-     {{LEFT, ZERO, LEFT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, ZERO, RIGHT, PIN,
-       LEFT, ZERO, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, RIGHT, ZERO, RIGHT,
-       ZERO}}},
-    {"Furby",
-     {{PIN, ZERO, LEFT, PIN, RIGHT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, ZERO,
-       PIN, ZERO, RIGHT, PIN, LEFT, ZERO, PIN, ZERO, ZERO, PIN, ZERO}}},
-    {"Gate",
-     {{ZERO, ZERO, PIN, ZERO, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, LEFT, PIN,
-       LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, RIGHT, ZERO, PIN, PIN, ZERO, ZERO}}},
-    {"Ghost",
-     {{LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, RIGHT,
-       RIGHT, PIN, LEFT, RIGHT, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO, LEFT,
-       RIGHT, ZERO}}},
-    {"Globus",
-     {{RIGHT, LEFT, ZERO, PIN, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
-       LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, PIN, ZERO, RIGHT, LEFT,
-       ZERO, ZERO}}},
-    {"Grotto",
-     {{PIN, PIN, ZERO, LEFT, RIGHT, LEFT, ZERO, PIN, RIGHT, PIN, LEFT, ZERO,
-       ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, PIN, ZERO, RIGHT, LEFT, RIGHT,
-       ZERO}}},
-    {"H",
-     {{PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, PIN, LEFT,
-       ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO}}},
-    {"HeadOfDevil",
-     {{PIN, ZERO, RIGHT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, RIGHT, LEFT,
-       PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, RIGHT, LEFT, ZERO, ZERO,
-       ZERO}}},
-    {"Heart",
-     {{RIGHT, ZERO, ZERO, ZERO, PIN, LEFT, PIN, LEFT, RIGHT, RIGHT, ZERO, PIN,
-       ZERO, LEFT, LEFT, RIGHT, PIN, RIGHT, PIN, ZERO, ZERO, ZERO, LEFT,
-       ZERO}}},
-    {"Heart2",
-     {{ZERO, PIN, ZERO, ZERO, LEFT, ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, PIN,
-       ZERO, ZERO, ZERO, ZERO, RIGHT, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO,
-       ZERO}}},
-    {"Hexagon",
-     {{ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO,
-       LEFT, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO,
-       ZERO}}},
-    {"HoleInTheMiddle1",
-     {{ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, LEFT, RIGHT,
-       ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, RIGHT,
-       ZERO}}},
-    {"HoleInTheMiddle2",
-     {{ZERO, LEFT, RIGHT, ZERO, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, RIGHT,
-       LEFT, ZERO, LEFT, RIGHT, ZERO, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO,
-       RIGHT, ZERO}}},
-    {"HouseBoat",
-     {{RIGHT, RIGHT, PIN, LEFT, LEFT, LEFT, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT,
-       RIGHT, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, RIGHT, PIN, ZERO}}},
-    {"HouseByHouse",
-     {{LEFT, PIN, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN,
-       LEFT, PIN, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, ZERO}}},
-    {"Infinity",
-     {{LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT,
-       LEFT, LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT,
-       LEFT, ZERO}}},
-    {"Integral",
-     {{RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT,
-       LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
-       LEFT, ZERO}}},
-    {"Iron",
-     {{ZERO, ZERO, ZERO, ZERO, PIN, RIGHT, ZERO, RIGHT, ZERO, ZERO, LEFT, PIN,
-       RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, RIGHT, ZERO, RIGHT,
-       ZERO}}},
-    {"just squares",
-     {{RIGHT, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, LEFT, PIN,
-       RIGHT, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, LEFT,
-       ZERO}}},
-    {"Kink",
-     {{ZERO, PIN, PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, RIGHT, PIN, LEFT,
-       ZERO, ZERO, PIN, PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO}}},
-    {"Knot",
-     {{LEFT, LEFT, PIN, LEFT, ZERO, LEFT, RIGHT, LEFT, PIN, LEFT, LEFT, RIGHT,
-       RIGHT, PIN, RIGHT, LEFT, RIGHT, ZERO, RIGHT, PIN, RIGHT, RIGHT, LEFT,
-       ZERO}}},
-    {"Leaf",
-     {{ZERO, PIN, PIN, ZERO, ZERO, LEFT, ZERO, LEFT, ZERO, ZERO, PIN, ZERO,
-       ZERO, RIGHT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO,
-       ZERO}}},
-    {"LeftAsRight",
-     {{RIGHT, PIN, LEFT, RIGHT, LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN,
-       LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, RIGHT, LEFT, RIGHT, PIN, LEFT,
-       ZERO}}},
-    {"Long-necked",
-     {{PIN, ZERO, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, ZERO, PIN, ZERO,
-       LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO, PIN, PIN, ZERO, ZERO}}},
-    {"lunar module",
-     {{PIN, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT,
-       RIGHT, LEFT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO,
-       LEFT, ZERO}}},
-    {"magnifying glass",
-     {{ZERO, ZERO, PIN, ZERO, LEFT, ZERO, PIN, PIN, ZERO, ZERO, RIGHT, PIN,
-       LEFT, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, ZERO, ZERO, ZERO}}},
-    {"Mask",
-     {{ZERO, ZERO, ZERO, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT, PIN, ZERO, PIN,
-       ZERO, ZERO, PIN, ZERO, PIN, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT,
-       ZERO}}},
-    {"Microscope",
-     {{PIN, PIN, ZERO, ZERO, PIN, ZERO, RIGHT, PIN, ZERO, ZERO, RIGHT, PIN,
-       LEFT, ZERO, ZERO, PIN, LEFT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO}}},
-    {"Mirror",
-     {{PIN, RIGHT, LEFT, ZERO, PIN, PIN, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO,
-       PIN, ZERO, ZERO, LEFT, RIGHT, PIN, RIGHT, ZERO, PIN, PIN, ZERO, ZERO}}},
-    {"MissPiggy",
-     {{ZERO, LEFT, LEFT, PIN, RIGHT, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT,
-       RIGHT, PIN, LEFT, LEFT, ZERO, LEFT, PIN, RIGHT, RIGHT, ZERO, RIGHT,
-       ZERO}}},
-    {"Mole",
-     {{ZERO, RIGHT, ZERO, RIGHT, LEFT, RIGHT, PIN, ZERO, LEFT, PIN, RIGHT, ZERO,
-       PIN, LEFT, RIGHT, LEFT, ZERO, LEFT, ZERO, RIGHT, RIGHT, PIN, LEFT,
-       ZERO}}},
-    {"Monk",
-     {{LEFT, ZERO, PIN, PIN, ZERO, LEFT, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN,
-       PIN, ZERO, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, ZERO}}},
-    {"Mountain",
-     {{ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, LEFT, PIN,
-       LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO,
-       ZERO}}},
-    {"mountains",
-     {{ZERO, PIN, ZERO, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN,
-       LEFT, PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO, PIN, ZERO, ZERO}}},
-    {"MouseWithoutTail",
-     {{ZERO, PIN, PIN, ZERO, LEFT, ZERO, PIN, PIN, ZERO, ZERO, RIGHT, PIN, LEFT,
-       ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO}}},
-    {"mushroom",
-     {{PIN, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, ZERO,
-       LEFT, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, LEFT, ZERO, PIN, ZERO}}},
-    {"necklace",
-     {{ZERO, ZERO, LEFT, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, PIN,
-       ZERO, ZERO, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, RIGHT, ZERO, ZERO,
-       ZERO}}},
-    {"NestledAgainst",
-     {{LEFT, ZERO, PIN, LEFT, LEFT, RIGHT, RIGHT, PIN, ZERO, RIGHT, PIN, LEFT,
-       ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT,
-       ZERO}}},
-    {"NoClue",
-     {{ZERO, RIGHT, PIN, LEFT, LEFT, LEFT, ZERO, LEFT, PIN, RIGHT, RIGHT, PIN,
-       LEFT, LEFT, PIN, RIGHT, ZERO, RIGHT, RIGHT, RIGHT, PIN, LEFT, ZERO,
-       ZERO}}},
-    {"Noname",
-     {{LEFT, PIN, RIGHT, PIN, RIGHT, ZERO, PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN,
-       PIN, ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, ZERO}}},
-    {"Obelisk",
-     {{PIN, ZERO, ZERO, ZERO, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, LEFT,
-       RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, ZERO, ZERO, ZERO, ZERO}}},
-    {"Ostrich",
-     {{ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO,
-       RIGHT, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, ZERO}}},
-    {"Ostrich2",
-     {{PIN, PIN, ZERO, PIN, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT,
-       RIGHT, LEFT, LEFT, RIGHT, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO}}},
-    {"pair of glasses",
-     {{ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, LEFT, ZERO, PIN, ZERO,
-       RIGHT, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO}}},
-    {"Parrot",
-     {{ZERO, ZERO, ZERO, ZERO, RIGHT, RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO,
-       RIGHT, ZERO, RIGHT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, LEFT, ZERO, PIN,
-       ZERO}}},
-#ifndef WIN32
-    {"Penis",
-     {{PIN, PIN, RIGHT, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, RIGHT, PIN, LEFT,
-       ZERO, ZERO, PIN, ZERO, PIN, PIN, ZERO, LEFT, PIN, PIN, ZERO}}},
-#endif
-    {"PictureCommingSoon",
-     {{LEFT, LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, RIGHT, LEFT, PIN,
-       LEFT, RIGHT, PIN, RIGHT, RIGHT, PIN, RIGHT, LEFT, ZERO, RIGHT, RIGHT,
-       ZERO}}},
-    {"Pitti",
-     {{LEFT, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, RIGHT, PIN,
-       LEFT, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, RIGHT, ZERO}}},
-    {"Plait",
-     {{LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, RIGHT, LEFT,
-       RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT,
-       LEFT, ZERO}}},
-    {"Platform",
-     {{RIGHT, PIN, ZERO, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN,
-       LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO}}},
-    {"PodRacer",
-     {{ZERO, PIN, ZERO, PIN, RIGHT, PIN, ZERO, RIGHT, PIN, LEFT, LEFT, PIN,
-       RIGHT, LEFT, ZERO, PIN, PIN, ZERO, ZERO, LEFT, ZERO, PIN, LEFT, ZERO}}},
-#if 0
-    { "Pokemon",
-        { { LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, ZERO } }
-    },
-#endif
-    {"Prawn",
-     {{RIGHT, PIN, ZERO, PIN, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, LEFT, PIN,
-       RIGHT, ZERO, ZERO, PIN, PIN, ZERO, LEFT, PIN, ZERO, PIN, LEFT, ZERO}}},
-    {"Propeller",
-     {{ZERO, ZERO, ZERO, RIGHT, ZERO, LEFT, RIGHT, LEFT, ZERO, ZERO, ZERO,
-       RIGHT, ZERO, LEFT, RIGHT, LEFT, ZERO, ZERO, ZERO, RIGHT, ZERO, LEFT,
-       RIGHT, ZERO}}},
-    {"Pyramid",
-     {{ZERO, LEFT, PIN, RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO, LEFT, PIN, RIGHT,
-       ZERO, PIN, RIGHT, LEFT, LEFT, LEFT, PIN, RIGHT, RIGHT, RIGHT, LEFT,
-       ZERO}}},
-    {"QuarterbackTiltedAndReadyToHut",
-     {{PIN, ZERO, RIGHT, RIGHT, LEFT, RIGHT, PIN, RIGHT, LEFT, RIGHT, ZERO, PIN,
-       ZERO, LEFT, RIGHT, LEFT, PIN, LEFT, RIGHT, LEFT, LEFT, ZERO, PIN,
-       ZERO}}},
-    {"Ra",
-     {{PIN, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
-       LEFT, ZERO, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
-       LEFT, ZERO}}},
-    {"Rattlesnake",
-     {{LEFT, ZERO, LEFT, ZERO, LEFT, ZERO, LEFT, LEFT, ZERO, LEFT, ZERO, LEFT,
-       ZERO, LEFT, RIGHT, ZERO, PIN, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT,
-       ZERO}}},
-    {"Revelation",
-     {{ZERO, ZERO, ZERO, PIN, ZERO, ZERO, PIN, RIGHT, LEFT, LEFT, LEFT, RIGHT,
-       RIGHT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, PIN, ZERO, ZERO, PIN,
-       ZERO}}},
-    {"Revolution1",
-     {{LEFT, LEFT, PIN, RIGHT, ZERO, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT, PIN,
-       LEFT, LEFT, PIN, RIGHT, ZERO, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT,
-       ZERO}}},
-    {"Ribbon",
-     {{RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, PIN, ZERO, PIN, PIN, ZERO, PIN,
-       ZERO, PIN, PIN, ZERO, PIN, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT,
-       ZERO}}},
-    {"Rocket",
-     {{RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO, RIGHT, ZERO, LEFT, ZERO, RIGHT, PIN,
-       LEFT, ZERO, RIGHT, ZERO, LEFT, ZERO, LEFT, PIN, RIGHT, ZERO, LEFT,
-       ZERO}}},
-    {"Roofed",
-     {{ZERO, LEFT, PIN, RIGHT, ZERO, PIN, LEFT, ZERO, PIN, ZERO, RIGHT, PIN,
-       ZERO, LEFT, PIN, RIGHT, ZERO, PIN, LEFT, ZERO, PIN, ZERO, RIGHT, ZERO}}},
-    {"Roofs",
-     {{PIN, PIN, RIGHT, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN,
-       RIGHT, PIN, RIGHT, PIN, LEFT, PIN, RIGHT, ZERO, LEFT, PIN, PIN, ZERO}}},
-    {"RowHouses",
-     {{RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN,
-       RIGHT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO}}},
-    {"Sculpture",
-     {{RIGHT, LEFT, PIN, ZERO, ZERO, ZERO, LEFT, RIGHT, LEFT, PIN, ZERO, ZERO,
-       PIN, LEFT, RIGHT, LEFT, ZERO, ZERO, ZERO, PIN, LEFT, RIGHT, LEFT,
-       ZERO}}},
-    {"Seal",
-     {{LEFT, LEFT, LEFT, PIN, RIGHT, RIGHT, RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO,
-       LEFT, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, PIN, PIN, ZERO, LEFT, ZERO}}},
-    {"Seal2",
-     {{RIGHT, PIN, ZERO, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, RIGHT,
-       PIN, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO,
-       ZERO}}},
-    {"Sheep",
-     {{RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT,
-       RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT, LEFT, LEFT, RIGHT,
-       LEFT, ZERO}}},
-    {"Shelter",
-     {{LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, ZERO,
-       ZERO, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, RIGHT,
-       ZERO}}},
-    {"Ship",
-     {{PIN, RIGHT, LEFT, LEFT, LEFT, LEFT, PIN, RIGHT, RIGHT, RIGHT, RIGHT,
-       LEFT, ZERO, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, LEFT, ZERO, PIN, PIN,
-       ZERO}}},
-    {"Shpongle",
-     {{LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT, ZERO,
-       RIGHT, LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT,
-       ZERO, ZERO}}},
-    {"Slide",
-     {{LEFT, RIGHT, LEFT, RIGHT, ZERO, LEFT, RIGHT, LEFT, PIN, ZERO, ZERO, PIN,
-       ZERO, ZERO, PIN, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, RIGHT, LEFT,
-       ZERO}}},
-    {"SmallShip",
-     {{ZERO, LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT, RIGHT, ZERO, LEFT,
-       RIGHT, ZERO, LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT, RIGHT, ZERO,
-       LEFT, ZERO}}},
-    {"SnakeReadyToStrike",
-     {{LEFT, ZERO, LEFT, ZERO, LEFT, ZERO, LEFT, RIGHT, ZERO, RIGHT, ZERO,
-       RIGHT, ZERO, LEFT, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, LEFT,
-       ZERO}}},
-    {"Snakes14",
-     {{RIGHT, RIGHT, PIN, ZERO, RIGHT, LEFT, RIGHT, ZERO, ZERO, ZERO, RIGHT,
-       PIN, LEFT, PIN, ZERO, PIN, LEFT, PIN, RIGHT, ZERO, ZERO, LEFT, RIGHT,
-       ZERO}}},
-    {"Snakes15",
-     {{ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, PIN, LEFT, LEFT, PIN, RIGHT, LEFT,
-       ZERO, PIN, LEFT, PIN, RIGHT, ZERO, ZERO, ZERO, PIN, RIGHT, ZERO}}},
-    {"Snakes18",
-     {{PIN, PIN, LEFT, PIN, LEFT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, ZERO,
-       RIGHT, PIN, LEFT, PIN, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
-    {"Snowflake",
-     {{LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, LEFT,
-       RIGHT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT,
-       RIGHT, ZERO}}},
-    {"Snowman",
-     {{ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, PIN,
-       PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, ZERO}}},
-    {"Source",
-     {{PIN, RIGHT, ZERO, PIN, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, LEFT, RIGHT,
-       LEFT, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, PIN,
-       ZERO}}},
-    {"Spaceship",
-     {{PIN, PIN, RIGHT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, PIN,
-       RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, PIN, ZERO}}},
-    {"Spaceship2",
-     {{PIN, PIN, LEFT, PIN, LEFT, PIN, RIGHT, ZERO, PIN, PIN, ZERO, LEFT, PIN,
-       RIGHT, ZERO, PIN, ZERO, LEFT, PIN, LEFT, LEFT, PIN, PIN, ZERO}}},
-    {"Speedboat",
-     {{LEFT, ZERO, ZERO, LEFT, PIN, RIGHT, ZERO, ZERO, LEFT, ZERO, ZERO, PIN,
-       ZERO, ZERO, RIGHT, ZERO, ZERO, LEFT, PIN, RIGHT, ZERO, ZERO, RIGHT,
-       ZERO}}},
-    {"Speedboat2",
-     {{PIN, RIGHT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, ZERO, LEFT, PIN, RIGHT,
-       ZERO, LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, PIN, ZERO, RIGHT, PIN, LEFT,
-       ZERO}}},
-    {"Spider",
-     {{RIGHT, RIGHT, ZERO, ZERO, LEFT, RIGHT, LEFT, PIN, ZERO, LEFT, ZERO, PIN,
-       PIN, ZERO, RIGHT, ZERO, PIN, RIGHT, LEFT, RIGHT, ZERO, ZERO, LEFT,
-       ZERO}}},
-    {"Spitzbergen",
-     {{PIN, LEFT, ZERO, RIGHT, RIGHT, LEFT, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT,
-       PIN, LEFT, LEFT, PIN, RIGHT, ZERO, PIN, RIGHT, LEFT, LEFT, ZERO, ZERO}}},
-    {"Square",
-     {{ZERO, ZERO, LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, ZERO, LEFT, LEFT, PIN,
-       RIGHT, RIGHT, ZERO, ZERO, LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, ZERO,
-       ZERO}}},
-    {"SquareHole",
-     {{PIN, ZERO, PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO,
-       ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, PIN, ZERO}}},
-    {"Stage",
-     {{RIGHT, ZERO, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, RIGHT, PIN, RIGHT,
-       LEFT, PIN, LEFT, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO,
-       ZERO}}},
-    {"Stairs",
-     {{ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO,
-       PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, ZERO}}},
-    {"Stairs2",
-     {{ZERO, PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, PIN, ZERO,
-       PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO}}},
-    {"Straight",
-     {{ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO,
-       ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO,
-       ZERO}}},
-    {"Swan",
-     {{ZERO, PIN, ZERO, PIN, LEFT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT,
-       LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, RIGHT, ZERO}}},
-    {"Swan2",
-     {{PIN, ZERO, PIN, RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT,
-       LEFT, RIGHT, RIGHT, RIGHT, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, PIN,
-       ZERO}}},
-    {"Swan3",
-     {{PIN, PIN, ZERO, ZERO, ZERO, RIGHT, ZERO, RIGHT, ZERO, ZERO, LEFT, PIN,
-       RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, RIGHT, ZERO, RIGHT,
-       ZERO}}},
-    {"Symbol",
-     {{RIGHT, RIGHT, PIN, ZERO, PIN, PIN, ZERO, PIN, LEFT, LEFT, RIGHT, LEFT,
-       RIGHT, RIGHT, PIN, ZERO, PIN, PIN, ZERO, PIN, LEFT, LEFT, RIGHT, ZERO}}},
-    {"Symmetry",
-     {{RIGHT, ZERO, LEFT, RIGHT, LEFT, ZERO, LEFT, RIGHT, LEFT, ZERO, RIGHT,
-       PIN, LEFT, ZERO, RIGHT, LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT, ZERO,
-       LEFT, ZERO}}},
-    {"Symmetry2",
-     {{ZERO, PIN, LEFT, LEFT, PIN, ZERO, ZERO, LEFT, PIN, RIGHT, PIN, LEFT,
-       LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT, PIN, LEFT, ZERO}}},
-    {"TableFireworks",
-     {{ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO,
-       RIGHT, LEFT, PIN, RIGHT, RIGHT, RIGHT, PIN, RIGHT, LEFT, ZERO, RIGHT,
-       PIN, ZERO}}},
-    {"Tapering",
-     {{ZERO, ZERO, RIGHT, LEFT, PIN, LEFT, ZERO, PIN, PIN, ZERO, LEFT, PIN,
-       RIGHT, ZERO, PIN, PIN, ZERO, RIGHT, PIN, RIGHT, LEFT, ZERO, ZERO,
-       ZERO}}},
-    {"TaperingTurned",
-     {{ZERO, ZERO, RIGHT, LEFT, PIN, LEFT, ZERO, PIN, PIN, ZERO, LEFT, ZERO,
-       RIGHT, ZERO, PIN, PIN, ZERO, RIGHT, PIN, RIGHT, LEFT, ZERO, ZERO,
-       ZERO}}},
-    {"TeaLightStick",
-     {{RIGHT, ZERO, PIN, PIN, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, RIGHT, RIGHT,
-       PIN, LEFT, LEFT, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT, RIGHT, PIN,
-       ZERO}}},
-    {"thighmaster",
-     {{RIGHT, ZERO, ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, ZERO, ZERO,
-       LEFT, RIGHT, ZERO, ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, ZERO,
-       ZERO, ZERO}}},
-    {"Terraces",
-     {{RIGHT, LEFT, ZERO, RIGHT, LEFT, PIN, LEFT, LEFT, PIN, LEFT, RIGHT, RIGHT,
-       RIGHT, LEFT, LEFT, LEFT, RIGHT, PIN, RIGHT, RIGHT, PIN, RIGHT, LEFT,
-       ZERO}}},
-    {"Terrier",
-     {{PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, PIN,
-       ZERO, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO}}},
-    {"Three-Legged",
-     {{RIGHT, ZERO, LEFT, RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO, RIGHT, ZERO, PIN,
-       ZERO, LEFT, ZERO, LEFT, PIN, RIGHT, ZERO, LEFT, RIGHT, ZERO, LEFT,
-       ZERO}}},
-    {"ThreePeaks",
-     {{RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, RIGHT, PIN,
-       LEFT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO, ZERO, LEFT, ZERO}}},
-    {"ToTheFront",
-     {{ZERO, PIN, RIGHT, LEFT, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, PIN, PIN,
-       ZERO, LEFT, LEFT, PIN, ZERO, LEFT, RIGHT, ZERO, PIN, ZERO, LEFT, ZERO}}},
-    {"Top",
-     {{PIN, LEFT, LEFT, PIN, LEFT, ZERO, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT,
-       LEFT, RIGHT, LEFT, LEFT, PIN, RIGHT, PIN, RIGHT, RIGHT, PIN, ZERO,
-       ZERO}}},
-    {"Transport",
-     {{PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, PIN,
-       PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO}}},
-    {"Triangle",
-     {{ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, RIGHT, LEFT, ZERO, ZERO, ZERO, ZERO,
-       ZERO, ZERO, RIGHT, LEFT, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, RIGHT,
-       ZERO}}},
-    {"Tripple",
-     {{PIN, ZERO, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, ZERO, PIN, LEFT, PIN,
-       RIGHT, PIN, ZERO, PIN, LEFT, PIN, LEFT, PIN, RIGHT, PIN, ZERO}}},
-#if 0
-    { "Turtle",
-        { { RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT, PIN, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO } }
-    },
-#endif
-    {"Twins",
-     {{ZERO, PIN, ZERO, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, PIN, ZERO, ZERO,
-       PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO, PIN, ZERO, ZERO, ZERO}}},
-    {"TwoSlants",
-     {{ZERO, PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN, ZERO, RIGHT, PIN, RIGHT,
-       LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO, ZERO, RIGHT, PIN, ZERO}}},
-    {"TwoWings",
-     {{PIN, LEFT, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, PIN, PIN,
-       ZERO, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, LEFT, ZERO, ZERO}}},
-    {"UFO",
-     {{LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT,
-       PIN, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
-       LEFT, ZERO}}},
-    {"USS Enterprise",
-     {{LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, ZERO, PIN, PIN, ZERO, RIGHT, LEFT,
-       ZERO, PIN, PIN, ZERO, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, ZERO, ZERO}}},
-    {"UpAndDown",
-     {{ZERO, PIN, ZERO, PIN, ZERO, PIN, LEFT, PIN, RIGHT, PIN, ZERO, PIN, ZERO,
-       PIN, ZERO, PIN, ZERO, PIN, LEFT, PIN, RIGHT, PIN, ZERO, ZERO}}},
-    {"Upright",
-     {{ZERO, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, PIN, ZERO, ZERO, LEFT, PIN,
-       RIGHT, ZERO, ZERO, PIN, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, ZERO,
-       ZERO}}},
-    {"Upside-down",
-     {{PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, RIGHT, LEFT, LEFT, PIN,
-       RIGHT, RIGHT, LEFT, LEFT, ZERO, PIN, PIN, ZERO, ZERO, ZERO, PIN, ZERO}}},
-    {"Valley",
-     {{ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, RIGHT, ZERO, PIN,
-       ZERO, LEFT, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO, ZERO}}},
-    {"Viaduct",
-     {{PIN, RIGHT, PIN, LEFT, PIN, ZERO, ZERO, PIN, RIGHT, ZERO, RIGHT, RIGHT,
-       ZERO, RIGHT, PIN, ZERO, ZERO, PIN, LEFT, PIN, RIGHT, PIN, ZERO, ZERO}}},
-    {"View",
-     {{ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, LEFT,
-       RIGHT, RIGHT, PIN, LEFT, ZERO, ZERO, LEFT, PIN, RIGHT, PIN, LEFT,
-       ZERO}}},
-    {"Waterfall",
-     {{LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN,
-       LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT,
-       ZERO}}},
-    {"windwheel",
-     {{PIN, RIGHT, RIGHT, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, LEFT,
-       PIN, RIGHT, RIGHT, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO,
-       ZERO}}},
-    {"Window",
-     {{PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, ZERO,
-       PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO}}},
-    {"WindowToTheWorld",
-     {{PIN, LEFT, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, RIGHT, PIN,
-       LEFT, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO}}},
-    {"Windshield",
-     {{PIN, PIN, ZERO, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT, ZERO, PIN, ZERO,
-       LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, ZERO, PIN, PIN, ZERO, PIN, ZERO}}},
-    {"WingNut",
-     {{ZERO, ZERO, ZERO, ZERO, PIN, RIGHT, RIGHT, RIGHT, PIN, RIGHT, LEFT, PIN,
-       LEFT, RIGHT, PIN, RIGHT, RIGHT, RIGHT, PIN, ZERO, ZERO, ZERO, ZERO,
-       ZERO}}},
-    {"Wings2",
-     {{RIGHT, ZERO, PIN, ZERO, LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, RIGHT, RIGHT,
-       LEFT, LEFT, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, ZERO, PIN, ZERO, ZERO}}},
-    {"WithoutName",
-     {{PIN, RIGHT, PIN, RIGHT, RIGHT, PIN, LEFT, LEFT, PIN, ZERO, PIN, RIGHT,
-       PIN, LEFT, PIN, ZERO, PIN, RIGHT, RIGHT, PIN, LEFT, LEFT, PIN, ZERO}}},
-    {"Wolf",
-     {{ZERO, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO, PIN, PIN, ZERO,
-       PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, PIN, ZERO}}},
-    {"X",
-     {{LEFT, ZERO, ZERO, PIN, LEFT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, PIN,
-       PIN, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, RIGHT, PIN, ZERO, ZERO, ZERO}}},
-};
-
-static size_t models = sizeof(model) / sizeof(struct model_s);
-
-#define VOFFSET 0.045
-
-#define X_MASK 1
-#define Y_MASK 2
-#define Z_MASK 4
+static struct model_s *model = builtin_model;
+static size_t models;
 
 /* the connecting string that holds the snake together */
 #define MAGICAL_RED_STRING 0
 
-#define GETSCALAR(vec, mask) ((vec) == (mask) ? 1 : ((vec) == -(mask) ? -1 : 0))
-
 #ifndef MAX
 #define MAX(x, y) ((x) > (y) ? (x) : (y))
 #endif
@@ -1358,73 +454,6 @@ static size_t models = sizeof(model) / sizeof(struct model_s);
 #define RAND(n) ((random() & 0x7fffffff) % ((long)(n)))
 #define RANDSIGN() ((random() & 1) ? 1 : -1)
 
-/* the triangular prism what makes up the basic unit */
-static float solid_prism_v[][3] = {
-    /* first corner, bottom left front */
-    {VOFFSET, VOFFSET, 1.0},
-    {VOFFSET, 0.00, 1.0 - VOFFSET},
-    {0.00, VOFFSET, 1.0 - VOFFSET},
-    /* second corner, rear */
-    {VOFFSET, VOFFSET, 0.00},
-    {VOFFSET, 0.00, VOFFSET},
-    {0.00, VOFFSET, VOFFSET},
-    /* third, right front */
-    {1.0 - VOFFSET / M_SQRT1_2, VOFFSET, 1.0},
-    {1.0 - VOFFSET / M_SQRT1_2, 0.0, 1.0 - VOFFSET},
-    {1.0 - VOFFSET * M_SQRT1_2, VOFFSET, 1.0 - VOFFSET},
-    /* fourth, right rear */
-    {1.0 - VOFFSET / M_SQRT1_2, VOFFSET, 0.0},
-    {1.0 - VOFFSET / M_SQRT1_2, 0.0, VOFFSET},
-    {1.0 - VOFFSET * M_SQRT1_2, VOFFSET, VOFFSET},
-    /* fifth, upper front */
-    {VOFFSET, 1.0 - VOFFSET / M_SQRT1_2, 1.0},
-    {VOFFSET / M_SQRT1_2, 1.0 - VOFFSET * M_SQRT1_2, 1.0 - VOFFSET},
-    {0.0, 1.0 - VOFFSET / M_SQRT1_2, 1.0 - VOFFSET},
-    /* sixth, upper rear */
-    {VOFFSET, 1.0 - VOFFSET / M_SQRT1_2, 0.0},
-    {VOFFSET / M_SQRT1_2, 1.0 - VOFFSET * M_SQRT1_2, VOFFSET},
-    {0.0, 1.0 - VOFFSET / M_SQRT1_2, VOFFSET}};
-
-static float solid_prism_n[][3] = {/* corners */
-                                   {-VOFFSET, -VOFFSET, VOFFSET},
-                                   {VOFFSET, -VOFFSET, VOFFSET},
-                                   {-VOFFSET, VOFFSET, VOFFSET},
-                                   {-VOFFSET, -VOFFSET, -VOFFSET},
-                                   {VOFFSET, -VOFFSET, -VOFFSET},
-                                   {-VOFFSET, VOFFSET, -VOFFSET},
-                                   /* edges */
-                                   {-VOFFSET, 0.0, VOFFSET},
-                                   {0.0, -VOFFSET, VOFFSET},
-                                   {VOFFSET, VOFFSET, VOFFSET},
-                                   {-VOFFSET, 0.0, -VOFFSET},
-                                   {0.0, -VOFFSET, -VOFFSET},
-                                   {VOFFSET, VOFFSET, -VOFFSET},
-                                   {-VOFFSET, -VOFFSET, 0.0},
-                                   {VOFFSET, -VOFFSET, 0.0},
-                                   {-VOFFSET, VOFFSET, 0.0},
-                                   /* faces */
-                                   {0.0, 0.0, 1.0},
-                                   {0.0, -1.0, 0.0},
-                                   {M_SQRT1_2, M_SQRT1_2, 0.0},
-                                   {-1.0, 0.0, 0.0},
-                                   {0.0, 0.0, -1.0}};
-
-static float wire_prism_v[][3] = {{0.0, 0.0, 1.0},
-                                  {1.0, 0.0, 1.0},
-                                  {0.0, 1.0, 1.0},
-                                  {0.0, 0.0, 0.0},
-                                  {1.0, 0.0, 0.0},
-                                  {0.0, 1.0, 0.0}};
-
-#if 0
-/* this isn't used! */
-static float wire_prism_n[][3] = {{ 0.0, 0.0, 1.0},
-			   { 0.0,-1.0, 0.0},
-			   { M_SQRT1_2, M_SQRT1_2, 0.0},
-			   {-1.0, 0.0, 0.0},
-			   { 0.0, 0.0,-1.0}};
-#endif /* 0 */
-
 static struct glsnake_cfg *glc = NULL;
 #ifdef HAVE_GLUT
 #define bp glc
@@ -1460,6 +489,9 @@ void gl_init(
   if (transparent) {
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glEnable(GL_BLEND);
+    /* the prisms are convex, so without their back faces each one blends
+     * correctly whatever order its faces are drawn in */
+    glEnable(GL_CULL_FACE);
   }
 
   if (!wireframe) {
@@ -1484,7 +516,41 @@ void gl_init(
   }
 }
 
+#ifdef HAVE_GLUT
+static void record_input(enum record_type type, long a, long b, long c,
+                         long d) {
+  struct record_event event;
+
+  if (!record_path) return;
+  event.type = type;
+  event.arg[0] = a;
+  event.arg[1] = b;
+  event.arg[2] = c;
+  event.arg[3] = d;
+  record_put(&event);
+}
+
+/* The recording has run out, which ends the session, or it doesn't match
+ * what glsnake is doing. */
+static void replay_stop(int got) {
+  if (!got) exit(0);
+  fprintf(stderr, "glsnake: %s is corrupt, or from another version\n",
+          replay_path);
+  exit(1);
+}
+#endif
+
 static void gettime(snaketime *t) {
+#ifdef HAVE_GLUT
+  if (replay_path) {
+    struct record_event event;
+    int got = replay_get(&event);
+
+    if (got != 1 || event.type != RECORD_CLOCK) replay_stop(got);
+    SETTIME(*t, event.arg[0], event.arg[1]);
+    return;
+  }
+#endif
 #ifdef HAVE_GETTIMEOFDAY
 #ifdef GETTIMEOFDAY_TWO_ARGS
   struct timezone tzp;
@@ -1497,6 +563,9 @@ static void gettime(snaketime *t) {
   ftime(t);
 #endif /* HAVE_FTIME */
 #endif /* !HAVE_GETTIMEOFDAY */
+#ifdef HAVE_GLUT
+  record_input(RECORD_CLOCK, (long)GETSECS(*t), (long)GETMSECS(*t), 0, 0);
+#endif
 }
 
 static void start_morph(unsigned int model_index, int immediate);
@@ -1505,6 +574,15 @@ static float morph_percent(void);
 static int morph_all_at_once(long iter_msec);
 static int morph_one_at_a_time(long iter_msec);
 static float morph_percent_one_at_a_time(void);
+static void add_model_file(const char *path);
+static void models_load(void);
+static void stream_open(void);
+static void control_start(void);
+static void shm_start(void);
+static void stats_start(void);
+static void depth_sort_init(void);
+static void gallery_forget(void);
+static void gallery_idle(long iter_msec);
 
 struct morph_method_t {
   morph_func_t morph;
@@ -1519,6 +597,25 @@ static struct morph_method_t morph_methods[] = {
 static size_t MORPH_METHOD_COUNT =
     sizeof(morph_methods) / sizeof(struct morph_method_t);
 
+/* draw the faces of a prism, batching up runs of triangles and quads */
+static void draw_prism_faces(const struct prism_face *faces, int count,
+                             const float v[][3]) {
+  int f, k, run = 0;
+
+  for (f = 0; f < count; f++) {
+    const struct prism_face *face = &faces[f];
+
+    if (face->count != run) {
+      if (run) glEnd();
+      run = face->count;
+      glBegin(run == 3 ? GL_TRIANGLES : GL_QUADS);
+    }
+    glNormal3fv(solid_prism_n[face->normal]);
+    for (k = 0; k < face->count; k++) glVertex3fv(v[face->v[k]]);
+  }
+  glEnd();
+}
+
 /* wot initialises it */
 void glsnake_init(
 #ifndef HAVE_GLUT
@@ -1563,138 +660,56 @@ void glsnake_init(
   gettime(&bp->last_iteration);
   memcpy(&bp->last_morph, &bp->last_iteration, sizeof(bp->last_morph));
 
+  if (models_path && *models_path) add_model_file(models_path);
+  models_load();
+
+  /* before the first morph, so that it is counted */
+  if (stats_dir && *stats_dir) stats_start();
   bp->prev_colour = bp->next_colour = COLOUR_ACYCLIC;
-  start_morph(START_MODEL, 1);
+  start_morph(models > START_MODEL ? START_MODEL : 0, 1);
+
+  if (stream_path && *stream_path) stream_open();
+  if (control_path && *control_path) control_start();
+  if (shm_name && *shm_name) shm_start();
+
+  depth_sort_init();
+  if (trace_path && *trace_path) {
+    if (timeline_open(trace_path)) {
+      perror(trace_path);
+      exit(1);
+    }
+    timeline_thread_name("glsnake");
+    atexit(timeline_close);
+  }
+  if (joint_log_path && *joint_log_path) {
+    if (joint_log_open(joint_log_path)) {
+      perror(joint_log_path);
+      exit(1);
+    }
+    atexit(joint_log_close);
+  }
+#ifdef HAVE_GLUT
+  perf_enable(hud || benchmark_frames > 0 || replay_path);
+#else
+  perf_enable(hud);
+#endif
 
 /* set up a font for the labels */
 #ifndef HAVE_GLUT
-  if (titles) load_font(mi->dpy, "labelfont", &bp->font, &bp->font_list);
+  if (titles || hud)
+    load_font(mi->dpy, "labelfont", &bp->font, &bp->font_list);
 #endif
 
   /* build a solid display list */
   glc->node_solid = glGenLists(1);
   glNewList(glc->node_solid, GL_COMPILE);
-  /* corners */
-  glBegin(GL_TRIANGLES);
-  glNormal3fv(solid_prism_n[0]);
-  glVertex3fv(solid_prism_v[0]);
-  glVertex3fv(solid_prism_v[2]);
-  glVertex3fv(solid_prism_v[1]);
-
-  glNormal3fv(solid_prism_n[1]);
-  glVertex3fv(solid_prism_v[6]);
-  glVertex3fv(solid_prism_v[7]);
-  glVertex3fv(solid_prism_v[8]);
-
-  glNormal3fv(solid_prism_n[2]);
-  glVertex3fv(solid_prism_v[12]);
-  glVertex3fv(solid_prism_v[13]);
-  glVertex3fv(solid_prism_v[14]);
-
-  glNormal3fv(solid_prism_n[3]);
-  glVertex3fv(solid_prism_v[3]);
-  glVertex3fv(solid_prism_v[4]);
-  glVertex3fv(solid_prism_v[5]);
-
-  glNormal3fv(solid_prism_n[4]);
-  glVertex3fv(solid_prism_v[9]);
-  glVertex3fv(solid_prism_v[11]);
-  glVertex3fv(solid_prism_v[10]);
-
-  glNormal3fv(solid_prism_n[5]);
-  glVertex3fv(solid_prism_v[16]);
-  glVertex3fv(solid_prism_v[15]);
-  glVertex3fv(solid_prism_v[17]);
-  glEnd();
-  /* edges */
-  glBegin(GL_QUADS);
-  glNormal3fv(solid_prism_n[6]);
-  glVertex3fv(solid_prism_v[0]);
-  glVertex3fv(solid_prism_v[12]);
-  glVertex3fv(solid_prism_v[14]);
-  glVertex3fv(solid_prism_v[2]);
-
-  glNormal3fv(solid_prism_n[7]);
-  glVertex3fv(solid_prism_v[0]);
-  glVertex3fv(solid_prism_v[1]);
-  glVertex3fv(solid_prism_v[7]);
-  glVertex3fv(solid_prism_v[6]);
-
-  glNormal3fv(solid_prism_n[8]);
-  glVertex3fv(solid_prism_v[6]);
-  glVertex3fv(solid_prism_v[8]);
-  glVertex3fv(solid_prism_v[13]);
-  glVertex3fv(solid_prism_v[12]);
-
-  glNormal3fv(solid_prism_n[9]);
-  glVertex3fv(solid_prism_v[3]);
-  glVertex3fv(solid_prism_v[5]);
-  glVertex3fv(solid_prism_v[17]);
-  glVertex3fv(solid_prism_v[15]);
-
-  glNormal3fv(solid_prism_n[10]);
-  glVertex3fv(solid_prism_v[3]);
-  glVertex3fv(solid_prism_v[9]);
-  glVertex3fv(solid_prism_v[10]);
-  glVertex3fv(solid_prism_v[4]);
-
-  glNormal3fv(solid_prism_n[11]);
-  glVertex3fv(solid_prism_v[15]);
-  glVertex3fv(solid_prism_v[16]);
-  glVertex3fv(solid_prism_v[11]);
-  glVertex3fv(solid_prism_v[9]);
-
-  glNormal3fv(solid_prism_n[12]);
-  glVertex3fv(solid_prism_v[1]);
-  glVertex3fv(solid_prism_v[2]);
-  glVertex3fv(solid_prism_v[5]);
-  glVertex3fv(solid_prism_v[4]);
-
-  glNormal3fv(solid_prism_n[13]);
-  glVertex3fv(solid_prism_v[8]);
-  glVertex3fv(solid_prism_v[7]);
-  glVertex3fv(solid_prism_v[10]);
-  glVertex3fv(solid_prism_v[11]);
-
-  glNormal3fv(solid_prism_n[14]);
-  glVertex3fv(solid_prism_v[13]);
-  glVertex3fv(solid_prism_v[16]);
-  glVertex3fv(solid_prism_v[17]);
-  glVertex3fv(solid_prism_v[14]);
-  glEnd();
-
-  /* faces */
-  glBegin(GL_TRIANGLES);
-  glNormal3fv(solid_prism_n[15]);
-  glVertex3fv(solid_prism_v[0]);
-  glVertex3fv(solid_prism_v[6]);
-  glVertex3fv(solid_prism_v[12]);
-
-  glNormal3fv(solid_prism_n[19]);
-  glVertex3fv(solid_prism_v[3]);
-  glVertex3fv(solid_prism_v[15]);
-  glVertex3fv(solid_prism_v[9]);
-  glEnd();
+  draw_prism_faces(solid_prism_f, SOLID_PRISM_FACES, solid_prism_v);
+  glEndList();
 
-  glBegin(GL_QUADS);
-  glNormal3fv(solid_prism_n[16]);
-  glVertex3fv(solid_prism_v[1]);
-  glVertex3fv(solid_prism_v[4]);
-  glVertex3fv(solid_prism_v[10]);
-  glVertex3fv(solid_prism_v[7]);
-
-  glNormal3fv(solid_prism_n[17]);
-  glVertex3fv(solid_prism_v[8]);
-  glVertex3fv(solid_prism_v[11]);
-  glVertex3fv(solid_prism_v[16]);
-  glVertex3fv(solid_prism_v[13]);
-
-  glNormal3fv(solid_prism_n[18]);
-  glVertex3fv(solid_prism_v[2]);
-  glVertex3fv(solid_prism_v[14]);
-  glVertex3fv(solid_prism_v[17]);
-  glVertex3fv(solid_prism_v[5]);
-  glEnd();
+  /* and one for the same prism without bevels, for distant snakes */
+  glc->node_flat = glGenLists(1);
+  glNewList(glc->node_flat, GL_COMPILE);
+  draw_prism_faces(wire_prism_f, WIRE_PRISM_FACES, wire_prism_v);
   glEndList();
 
   /* build wire display list */
@@ -1724,6 +739,52 @@ void glsnake_init(
 #endif
 }
 
+#ifdef HAVE_GLUT
+/* the font titles are drawn in, and how far it reaches below the baseline
+ * and in all */
+#define TITLE_FONT GLUT_BITMAP_HELVETICA_12
+#define TITLE_FONT_HEIGHT 16
+#define TITLE_FONT_DESCENT 3
+
+static void draw_glyph(int c, void *arg ATTRIBUTE_UNUSED) {
+  glutBitmapCharacter(TITLE_FONT, c);
+}
+#else
+static void draw_glyph(int c, void *arg) {
+  glCallList(((struct glsnake_cfg *)arg)->font_list + c);
+}
+#endif
+
+/* Capture the font into a texture.  It draws over the back buffer,
+ * so this is done at the start of a frame, before it is cleared. */
+static void glyphs_init(
+#ifndef HAVE_GLUT
+    ModeInfo *mi
+#endif
+    ) {
+#ifndef HAVE_GLUT
+  struct glsnake_cfg *bp = &glc[MI_SCREEN(mi)];
+#endif
+  int advance[TEXT_GLYPHS], i;
+
+  bp->glyphs_tried = 1;
+#ifdef HAVE_GLUT
+  for (i = 0; i < TEXT_GLYPHS; i++)
+    advance[i] = glutBitmapWidth(TITLE_FONT, TEXT_FIRST + i);
+  text_font_build(&bp->glyphs, draw_glyph, NULL, advance,
+                  TITLE_FONT_HEIGHT, TITLE_FONT_DESCENT);
+#else
+  if (!bp->font) return;
+  for (i = 0; i < TEXT_GLYPHS; i++) {
+    char c = (char)(TEXT_FIRST + i);
+
+    advance[i] = XTextWidth(bp->font, &c, 1);
+  }
+  text_font_build(&bp->glyphs, draw_glyph, bp, advance,
+                  bp->font->ascent + bp->font->descent, bp->font->descent);
+#endif
+}
+
 static void draw_title(
 #ifndef HAVE_GLUT
     ModeInfo *mi
@@ -1732,8 +793,30 @@ static void draw_title(
 #ifndef HAVE_GLUT
   struct glsnake_cfg *bp = &glc[MI_SCREEN(mi)];
 #endif
+  const char *s = interactive ? "interactive" : glc->next_model_s.name;
+
+  glColor4f(1.0, 1.0, 1.0, 1.0);
+  if (bp->glyphs.texture) {
+    /* lay the title out again only when it or the window changes, where
+     * it goes in the scene, so that drawing it needs nothing set up */
+    if (bp->title_stale || strncmp(s, bp->title, sizeof(bp->title))) {
+      strncpy(bp->title, s, sizeof(bp->title) - 1);
+      bp->title[sizeof(bp->title) - 1] = '\0';
+#ifdef HAVE_GLUT
+      text_line_set(&bp->title_line, &bp->glyphs, s,
+                    (float)(glc->width - text_width(&bp->glyphs, s) - 3), 4.0,
+                    &bp->title_plane);
+#else
+      text_line_set(&bp->title_line, &bp->glyphs, s, 10.0,
+                    (float)mi->xgwa.height - 10.0, &bp->title_plane);
+#endif
+      bp->title_stale = 0;
+    }
+    text_line_draw(&bp->glyphs, &bp->title_line);
+    return;
+  }
 
-  /* draw some text */
+  /* the window was too small to capture the font in */
   glPushAttrib((GLbitfield)GL_TRANSFORM_BIT | GL_ENABLE_BIT);
   glDisable(GL_LIGHTING);
   glDisable(GL_DEPTH_TEST);
@@ -1749,70 +832,158 @@ static void draw_title(
 #ifdef HAVE_GLUT
   gluOrtho2D((GLdouble)0., (GLdouble)glc->width, (GLdouble)0.,
              (GLdouble)glc->height);
+  {
+    unsigned int i = 0;
+    int w = glutBitmapLength(TITLE_FONT, (const unsigned char *)s);
+
+    glRasterPos2f((GLfloat)(glc->width - w - 3), 4.0);
+    while (s[i] != '\0') glutBitmapCharacter(TITLE_FONT, s[i++]);
+  }
 #else
   gluOrtho2D((GLdouble)0., (GLdouble)mi->xgwa.width, (GLdouble)0.,
              (GLdouble)mi->xgwa.height);
+  print_gl_string(mi->dpy, bp->font, bp->font_list, mi->xgwa.width,
+                  mi->xgwa.height, 10.0, (float)mi->xgwa.height - 10.0, s);
 #endif
-  glColor4f(1.0, 1.0, 1.0, 1.0);
-  {
-    char interactstr[] = "interactive";
-    const char *s;
-#ifdef HAVE_GLUT
-    int w;
+  glPopMatrix();
+  glMatrixMode(GL_PROJECTION);
+  glPopMatrix();
+  glPopAttrib();
+}
+
+/* The HUD shows how fast frames are coming and where their time goes,
+ * over the last PERF_FRAMES frames, with a graph of each frame's time
+ * along the bottom.  Its text is only laid out again a few times a
+ * second, so that it can be read. */
+#ifdef GLSNAKE_GL_COUNT
+#define HUD_LINES 5
+#else
+#define HUD_LINES 4
 #endif
+#define HUD_INTERVAL 0.25
+/* the graph has a pixel across for each frame, and this many pixels up
+ * for each millisecond */
+#define HUD_GRAPH_SCALE 2.0
+/* frames longer than this have missed a 60Hz refresh */
+#define HUD_BUDGET (1000.0 / 60.0)
+
+static struct text_line hud_line[HUD_LINES];
+static double hud_updated;
+
+static void hud_update(const struct text_font *font,
+                       const struct gpu_timer *timer) {
+  struct perf_summary sum;
+  char text[HUD_LINES][128];
+  int i;
 
-    if (interactive)
-      s = interactstr;
-    else
-      s = glc->next_model_s.name;
+  perf_summarise(&sum);
+  snprintf(text[0], sizeof(text[0]), "%.1f fps  %.2f ms  p99 %.2f ms",
+           sum.mean > 0.0 ? 1000.0 / sum.mean : 0.0, sum.mean, sum.p99);
+  snprintf(text[1], sizeof(text[1]),
+           "idle %.2f  kinematics %.2f  draw %.2f  swap %.2f ms",
+           sum.phase[PERF_IDLE], sum.phase[PERF_KINEMATICS],
+           sum.phase[PERF_DRAW], sum.phase[PERF_SWAP]);
+  snprintf(text[2], sizeof(text[2]),
+           "%.1f legality checks/s  %.1f morphs/min",
+           sum.rate[PERF_LEGALITY_CHECKS], sum.rate[PERF_MORPHS] * 60.0);
+  if (timer->state != 1)
+    snprintf(text[3], sizeof(text[3]), "gpu: no timer queries");
+  else if (!sum.gpu_frames)
+    snprintf(text[3], sizeof(text[3]), "gpu: waiting");
+  else
+    snprintf(text[3], sizeof(text[3]),
+             "gpu: clear %.2f  nodes %.2f  title %.2f ms",
+             sum.gpu[PERF_GPU_CLEAR], sum.gpu[PERF_GPU_NODES],
+             sum.gpu[PERF_GPU_TITLE]);
+#ifdef GLSNAKE_GL_COUNT
+  {
+    struct glcount_frame gl;
 
-#ifdef HAVE_GLUT
-    {
-      unsigned int i = 0;
+    glcount_last(&gl);
+    snprintf(text[4], sizeof(text[4]),
+             "gl: %lu calls  %lu changes  %lu redundant", gl.calls,
+             gl.changes, gl.redundant);
+  }
+#endif
+  for (i = 0; i < HUD_LINES; i++)
+    text_line_set(&hud_line[i], font, text[i], 0.0, 0.0, NULL);
+}
 
-      w = glutBitmapLength(GLUT_BITMAP_HELVETICA_12, (const unsigned char *)s);
-      glRasterPos2f((GLfloat)(glc->width - w - 3), 4.0);
-      while (s[i] != '\0')
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, s[i++]);
-    }
+static void draw_hud(
+#ifndef HAVE_GLUT
+    ModeInfo *mi
+#endif
+    ) {
+#ifndef HAVE_GLUT
+  struct glsnake_cfg *bp = &glc[MI_SCREEN(mi)];
+  int width = mi->xgwa.width, height = mi->xgwa.height;
 #else
-    print_gl_string(mi->dpy, bp->font, bp->font_list, mi->xgwa.width,
-                    mi->xgwa.height, 10.0, (float)mi->xgwa.height - 10.0, s);
+  int width = glc->width, height = glc->height;
 #endif
+  const struct perf_frame *frames;
+  int count, first, i;
+  double now = perf_now();
+
+  count = perf_history(&frames, &first);
+  if (bp->glyphs.texture && now - hud_updated > HUD_INTERVAL) {
+    hud_update(&bp->glyphs, &bp->gpu_timer);
+    hud_updated = now;
+  }
+
+  glPushAttrib((GLbitfield)GL_TRANSFORM_BIT | GL_ENABLE_BIT);
+  glDisable(GL_LIGHTING);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_BLEND);
+  glMatrixMode(GL_PROJECTION);
+  glPushMatrix();
+  glLoadIdentity();
+  gluOrtho2D((GLdouble)0., (GLdouble)width, (GLdouble)0., (GLdouble)height);
+  glMatrixMode(GL_MODELVIEW);
+  glPushMatrix();
+  glLoadIdentity();
+
+  /* a frame time graph along the bottom, red where a refresh was missed */
+  glBegin(GL_LINES);
+  glColor4f(0.5, 0.5, 0.5, 1.0);
+  glVertex2f(10.0, 10.0 + HUD_BUDGET * HUD_GRAPH_SCALE);
+  glVertex2f(10.0 + PERF_FRAMES, 10.0 + HUD_BUDGET * HUD_GRAPH_SCALE);
+  for (i = 0; i < count; i++) {
+    float t = frames[(first + i) % PERF_FRAMES].total;
+
+    if (t > HUD_BUDGET)
+      glColor4f(1.0, 0.2, 0.2, 1.0);
+    else
+      glColor4f(0.2, 1.0, 0.2, 1.0);
+    glVertex2f(10.5 + i, 10.0);
+    glVertex2f(10.5 + i, 10.0 + t * HUD_GRAPH_SCALE);
+  }
+  glEnd();
+
+  if (bp->glyphs.texture) {
+    glColor4f(1.0, 1.0, 1.0, 1.0);
+    for (i = 0; i < HUD_LINES; i++) {
+      glLoadIdentity();
+      glTranslatef(10.0, (GLfloat)(height - 10 - (i + 1) * bp->glyphs.cell),
+                   0.0);
+      text_line_draw(&bp->glyphs, &hud_line[i]);
+    }
   }
+
   glPopMatrix();
   glMatrixMode(GL_PROJECTION);
   glPopMatrix();
   glPopAttrib();
 }
 
-/* apply the matrix to the origin and stick it in vec */
-static void matmult_origin(float rotmat[16], float vec[4]) {
-#if 1
-  vec[0] = 0.5 * rotmat[0] + 0.5 * rotmat[4] + 0.5 * rotmat[8] + 1 * rotmat[12];
-  vec[1] = 0.5 * rotmat[1] + 0.5 * rotmat[5] + 0.5 * rotmat[9] + 1 * rotmat[13];
-  vec[2] =
-      0.5 * rotmat[2] + 0.5 * rotmat[6] + 0.5 * rotmat[10] + 1 * rotmat[14];
-  vec[3] =
-      0.5 * rotmat[3] + 0.5 * rotmat[7] + 0.5 * rotmat[11] + 1 * rotmat[15];
-#else
-  vec[0] = 0 * rotmat[0] + 0 * rotmat[1] + 0 * rotmat[2] + 1 * rotmat[3];
-  vec[1] = 0 * rotmat[4] + 0 * rotmat[5] + 0 * rotmat[6] + 1 * rotmat[7];
-  vec[2] = 0 * rotmat[8] + 0 * rotmat[9] + 0 * rotmat[10] + 1 * rotmat[11];
-  vec[3] = 0 * rotmat[12] + 0 * rotmat[13] + 0 * rotmat[14] + 1 * rotmat[15];
-#endif
-  vec[0] /= vec[3];
-  vec[1] /= vec[3];
-  vec[2] /= vec[3];
-  vec[3] = 1.0;
-}
-
 /* wot gets called when the winder is resized */
 void glsnake_reshape(
 #ifndef HAVE_GLUT
     ModeInfo *mi,
 #endif
     int w, int h) {
+#ifndef HAVE_GLUT
+  struct glsnake_cfg *bp = &glc[MI_SCREEN(mi)];
+#endif
   glViewport(0, 0, (GLint)w, (GLint)h);
   glMatrixMode(GL_PROJECTION);
   glLoadIdentity();
@@ -1825,105 +996,89 @@ void glsnake_reshape(
   glc->width = w;
   glc->height = h;
 #endif
+  /* the title is drawn with the modelview matrix left as it is here */
+  text_plane_set(&bp->title_plane);
+  bp->title_stale = 1;
 }
 
-/* Returns the new dst_dir for the given src_dir and dst_dir */
-static int cross_product(int src_dir, int dst_dir) {
-  return X_MASK * (GETSCALAR(src_dir, Y_MASK) * GETSCALAR(dst_dir, Z_MASK) -
-                   GETSCALAR(src_dir, Z_MASK) * GETSCALAR(dst_dir, Y_MASK)) +
-         Y_MASK * (GETSCALAR(src_dir, Z_MASK) * GETSCALAR(dst_dir, X_MASK) -
-                   GETSCALAR(src_dir, X_MASK) * GETSCALAR(dst_dir, Z_MASK)) +
-         Z_MASK * (GETSCALAR(src_dir, X_MASK) * GETSCALAR(dst_dir, Y_MASK) -
-                   GETSCALAR(src_dir, Y_MASK) * GETSCALAR(dst_dir, X_MASK));
-}
-
-/* calculate orthogonal snake metrics
- *  is_legal  = true if model does not pass through itself
- *  is_cyclic = true if last node connects back to first node
- *  last_turn = for cyclic snakes, specifes what the 24th turn would be
- */
-static void calc_snake_metrics_shape(struct glsnake_shape *shape);
+/* calculate orthogonal snake metrics for the model we are morphing to */
 static void calc_snake_metrics_model_s(struct model_s *mdl);
 static void calc_snake_metrics(void) {
   calc_snake_metrics_model_s(&glc->next_model_s);
 }
 
-static void calc_snake_metrics_model_s(struct model_s *mdl) {
-  calc_snake_metrics_shape(&mdl->shape);
-}
-
-static void calc_snake_metrics_shape(struct glsnake_shape *shape) {
-  int srcDir, dstDir;
-  int i, x, y, z;
-  int prevSrcDir = -Y_MASK;
-  int prevDstDir = Z_MASK;
-  int grid[25][25][25];
-
-  /* zero the grid */
-  memset(&grid, 0, sizeof(int) * 25 * 25 * 25);
-
-  glc->is_legal = 1;
-  x = y = z = 12;
-
-  /* trace path of snake - and keep record for is_legal */
-  for (i = 0; i < NODE_COUNT - 1; i++) {
-    /*int ang_card;*/ /* cardinal direction of node angle */
-    /* establish new state vars */
-    srcDir = -prevDstDir;
-    x += GETSCALAR(prevDstDir, X_MASK);
-    y += GETSCALAR(prevDstDir, Y_MASK);
-    z += GETSCALAR(prevDstDir, Z_MASK);
-
-    switch ((int)shape->node[i]) {
-      case (int)(ZERO):
-        dstDir = -prevSrcDir;
-        break;
-      case (int)(PIN):
-        dstDir = prevSrcDir;
-        break;
-      case (int)(RIGHT):
-      case (int)(LEFT):
-        dstDir = cross_product(prevSrcDir, prevDstDir);
-        if (fabs(shape->node[i] - RIGHT) < FLT_EPSILON) dstDir = -dstDir;
-        break;
-      default:
-        /* Prevent spurious "might be used
-         * uninitialised" warnings when compiling
-         * with -O2 */
-        dstDir = 0;
-        break;
-    }
+static int compare_model_keys(const void *a, const void *b) {
+  const struct model_key *x = a, *y = b;
 
-    if (grid[x][y][z] == 0)
-      grid[x][y][z] = srcDir + dstDir;
-    else if (grid[x][y][z] + srcDir + dstDir == 0)
-      grid[x][y][z] = 8;
-    else
-      glc->is_legal = 0;
+  return x->key < y->key ? -1 : x->key > y->key ? 1 : 0;
+}
 
-    prevSrcDir = srcDir;
-    prevDstDir = dstDir;
-  }
+/* what was worked out about a packed shape when glsnake was built, if it
+ * is one of the built in models, whichever models are in use */
+static const struct model_info *builtin_shape(uint64_t packed) {
+  struct model_key key;
+  const struct model_key *found;
 
-  /* determine if the snake is cyclic */
-  glc->is_cyclic = (dstDir == Y_MASK && x == 12 && y == 11 && z == 12);
+  key.key = MODEL_KEY(packed);
+  found = bsearch(&key, builtin_keys, builtin_models, sizeof(*builtin_keys),
+                  compare_model_keys);
+  return found ? &builtin_info[found->index] : NULL;
+}
 
-  /* determine last_turn */
-  glc->last_turn = -1;
-  if (glc->is_cyclic) switch (srcDir) {
-      case -Z_MASK:
-        glc->last_turn = ZERO;
-        break;
-      case Z_MASK:
-        glc->last_turn = PIN;
-        break;
-      case X_MASK:
-        glc->last_turn = LEFT;
-        break;
-      case -X_MASK:
-        glc->last_turn = RIGHT;
-        break;
+/* Other shapes seen lately, so that going back and forth between the same
+ * few with undo or while editing doesn't trace them every time.  Each key
+ * has one slot, and a new shape simply replaces whatever was there. */
+#define METRICS_CACHE_BITS 8
+#define METRICS_CACHE_SIZE (1 << METRICS_CACHE_BITS)
+/* marks a slot in use, as no key has the top bit set */
+#define METRICS_CACHED ((uint64_t)1 << 63)
+
+static struct {
+  uint64_t key;
+  struct snake_metrics metrics;
+} metrics_cache[METRICS_CACHE_SIZE];
+
+static int metrics_slot(uint64_t key) {
+  /* Fibonacci hashing stirs every joint into the top bits, so that shapes
+   * a joint apart land in different slots */
+  return (int)((key * UINT64_C(0x9e3779b97f4a7c15)) >>
+               (64 - METRICS_CACHE_BITS));
+}
+
+static void calc_snake_metrics_model_s(struct model_s *mdl) {
+  const struct model_info *known = NULL;
+  struct snake_metrics metrics;
+  uint64_t key = 0;
+  int slot = -1;
+
+  /* only shapes of quarter turns have keys */
+  if (!pack_shape(&mdl->shape, &key)) {
+    known = builtin_shape(key);
+    key = MODEL_KEY(key) | METRICS_CACHED;
+    slot = metrics_slot(key);
+  }
+  /* built in shapes never go in the cache, so don't count towards its
+   * hit rate */
+  if (known) {
+    metrics = known->metrics;
+  } else if (slot >= 0 && metrics_cache[slot].key == key) {
+    metrics = metrics_cache[slot].metrics;
+    stats_metrics(1);
+  } else {
+    perf_count(PERF_LEGALITY_CHECKS);
+    TIMELINE_BEGIN("calc_snake_metrics_shape");
+    calc_snake_metrics_shape(&mdl->shape, &metrics);
+    TIMELINE_END("calc_snake_metrics_shape");
+    stats_metrics(0);
+    if (slot >= 0) {
+      metrics_cache[slot].key = key;
+      metrics_cache[slot].metrics = metrics;
     }
+  }
+  PROBE3(metrics, metrics.is_legal, metrics.is_cyclic, metrics.last_turn);
+  glc->is_legal = metrics.is_legal;
+  glc->is_cyclic = metrics.is_cyclic;
+  glc->last_turn = metrics.last_turn;
 }
 
 int spooky(void) {
@@ -2012,12 +1167,31 @@ static void morph_colour(void) {
 
 /* Start morph process to this model */
 static void start_morph(unsigned int model_index, int immediate) {
+  glc->preset_index = model_index;
   start_morph_shape(&model[model_index].shape, immediate);
   glc->next_model_s.name = model[model_index].name;
-  glc->preset_index = model_index;
+}
+
+/* the colour for the metrics of the shape being morphed to */
+static void choose_colour(void) {
+  if (!glc->is_legal)
+    glc->next_colour = COLOUR_INVALID;
+  else if (altcolour) {
+    if (spooky()) {
+      glc->next_colour = COLOUR_SPOOKY;
+    } else {
+      glc->next_colour = COLOUR_AUTHENTIC;
+    }
+  } else if (glc->is_cyclic)
+    glc->next_colour = COLOUR_CYCLIC;
+  else
+    glc->next_colour = COLOUR_ACYCLIC;
 }
 
 static void start_morph_shape(struct glsnake_shape *shape, int immediate) {
+  perf_count(PERF_MORPHS);
+  stats_morph(glc->preset_index);
+
   /* if immediate, don't bother morphing, go straight to the next model */
   if (immediate) {
     int i;
@@ -2031,18 +1205,7 @@ static void start_morph_shape(struct glsnake_shape *shape, int immediate) {
   glc->prev_colour = glc->next_colour;
 
   calc_snake_metrics();
-  if (!glc->is_legal)
-    glc->next_colour = COLOUR_INVALID;
-  else if (altcolour) {
-    if (spooky()) {
-      glc->next_colour = COLOUR_SPOOKY;
-    } else {
-      glc->next_colour = COLOUR_AUTHENTIC;
-    }
-  } else if (glc->is_cyclic)
-    glc->next_colour = COLOUR_CYCLIC;
-  else
-    glc->next_colour = COLOUR_ACYCLIC;
+  choose_colour();
 
   if (immediate) {
     glc->colour[0][0] = colour[glc->next_colour][0][0];
@@ -2053,6 +1216,7 @@ static void start_morph_shape(struct glsnake_shape *shape, int immediate) {
     glc->colour[1][1] = colour[glc->next_colour][1][1];
     glc->colour[1][2] = colour[glc->next_colour][1][2];
     glc->colour[1][3] = colour[glc->next_colour][1][3];
+    PROBE3(morph__start, glc->preset_index, -1, glc->is_legal);
   } else {
     /* Randomly select the next morph method */
     int morph_method = RAND(MORPH_METHOD_COUNT);
@@ -2060,6 +1224,7 @@ static void start_morph_shape(struct glsnake_shape *shape, int immediate) {
     glc->morph_percent = morph_methods[morph_method].morph_percent;
     /* Signal to the morph method that this is a new morph */
     glc->new_morph = 1;
+    PROBE3(morph__start, glc->preset_index, morph_method, glc->is_legal);
   }
   glc->morphing = 1;
 
@@ -2102,73 +1267,622 @@ static float morph(long iter_msec) {
 }
 #endif /* 0 */
 
-/* Allocate a new undo entry in undo_ring_buffer, and return its index. */
-int push_undo_entry() {
-  /* calculate new ring buffer indices */
-  undo_ring_end++;
-  undo_ring_end %= UNDO_LENGTH;
-  if (undo_ring_end == undo_ring_start) {
-    /* We have a full buffer.  We're about to overwrite the oldest entry,
-     * so increment the start pointer. */
-    undo_ring_start++;
-    undo_ring_start %= UNDO_LENGTH;
-  }
-  return undo_ring_end;
-}
-
-/* Deallocate the most recent undo entry, and return its index.
- *
- * Make sure you use or copy the entry before doing another push, or it may be
- * overwritten!
- *
- * Returns -1 if there are no entries to pop. */
-int pop_undo_entry() {
-  int entry;
-  if (undo_ring_start == undo_ring_end) return -1;
-  entry = undo_ring_end--;
-  undo_ring_end %= UNDO_LENGTH;
-  return entry;
-}
-
-/* Store the current snake shape */
-void save_snake_state() {
-  struct glsnake_shape *undo_shape = &undo_ring_buffer[push_undo_entry()];
+/* Store the current snake shape in the undo history, before it is edited */
+static void save_snake_state(void) {
   /* By "current snake shape", we mean the shape we are currently
    * transitioning to, rather than the currently displayed shape.  i.e., if we
    * are mid-transition, we don't capture the half-transitioned shape, but the
    * destination shape. */
-  memcpy(undo_shape, &glc->next_model_s.shape, sizeof(struct glsnake_shape));
+  history_save(&glc->next_model_s.shape);
 }
 
-#ifdef HAVE_GLUT
-static void glsnake_idle();
+/* the lattice walk of the shape being morphed to, so that a twist only
+ * walks the nodes after the joint again */
+static struct snake_walk edit_walk;
+static int edit_walked;
+
+/* Twist one joint of the shape being morphed to, saving the shape before
+ * for undo if save is set.  With -strict a twist that would make a legal
+ * snake pass through itself is refused, and -1 returned. */
+static int twist_joint(int joint, float angle, int save) {
+  struct glsnake_shape *shape = &glc->next_model_s.shape;
+  struct snake_metrics metrics;
+  float was = shape->node[joint];
+  int was_legal;
+
+  /* anything but a twist starts the walk again */
+  if (!edit_walked || memcmp(&edit_walk.shape, shape, sizeof(*shape))) {
+    snake_walk_start(&edit_walk, shape, &metrics);
+    edit_walked = 1;
+  }
+  /* whatever glc says, which may be from before an undo */
+  was_legal = !edit_walk.clashes;
+  perf_count(PERF_LEGALITY_CHECKS);
+  TIMELINE_BEGIN("snake_walk_twist");
+  snake_walk_twist(&edit_walk, joint, angle, &metrics);
+  TIMELINE_END("snake_walk_twist");
+  PROBE3(metrics, metrics.is_legal, metrics.is_cyclic, metrics.last_turn);
+  if (strict && was_legal && !metrics.is_legal) {
+    snake_walk_twist(&edit_walk, joint, was, &metrics);
+    return -1;
+  }
 
-static void restore_idle(int v ATTRIBUTE_UNUSED) { glutIdleFunc(glsnake_idle); }
-#endif
+  if (save) save_snake_state();
+  shape->node[joint] = angle;
+  glc->is_legal = metrics.is_legal;
+  glc->is_cyclic = metrics.is_cyclic;
+  glc->last_turn = metrics.last_turn;
+  glc->morphing = glc->new_morph = 1;
+  return 0;
+}
 
-static void quick_sleep(void) {
 #ifdef HAVE_GLUT
-  /* By using glutTimerFunc we can keep responding to
-   * mouse and keyboard events, unlike using something like
-   * usleep. */
-  glutIdleFunc(NULL);
-  glutTimerFunc(5, restore_idle, 0);
-#else
-  usleep(1);
-#endif
+/* Undo, redo or change branch with move, and morph to where it goes */
+static void history_move(int (*move)(struct glsnake_shape *)) {
+  struct glsnake_shape shape;
+
+  /* the shape being undone might not be saved yet */
+  save_snake_state();
+  if (move(&shape)) {
+    memcpy(&glc->next_model_s.shape, &shape, sizeof(struct glsnake_shape));
+    glc->prev_colour = glc->next_colour;
+    calc_snake_metrics();
+    choose_colour();
+    glc->morphing = glc->new_morph = 1;
+  }
 }
+#endif
 
-/* returns a flag indicating if any rotation happened */
-int rotate_joint(int current_node, float iter_angle_max) {
-  struct glsnake_shape *shape = &(glc->shape);
-  float cur_angle = shape->node[current_node];
-  float dest_angle = glc->next_model_s.shape.node[current_node];
-  int rotated = 0;
+#ifndef WIN32
+/* Shapes read from the -stream file wait in this queue until the current
+ * morph has finished.  If they arrive faster than we can morph, the oldest
+ * queued shape is dropped. */
+#define STREAM_QUEUE_LENGTH 16
+#define STREAM_NAME_LENGTH 64
+#define STREAM_BUFFER_LENGTH 4096
+
+struct stream_entry {
+  char name[STREAM_NAME_LENGTH];
+  struct glsnake_shape shape;
+};
 
-  if (cur_angle != dest_angle) {
-    rotated = 1;
+static int stream_fd = -1;
+static struct stream_entry stream_queue[STREAM_QUEUE_LENGTH];
+static int stream_queue_start;
+static int stream_queue_count;
+static char stream_buffer[STREAM_BUFFER_LENGTH];
+static size_t stream_buffered;
+static unsigned long stream_dropped;
+/* title of the streamed shape currently on display */
+static char stream_title[STREAM_NAME_LENGTH];
+
+static void stream_open(void) {
+  int flags;
+
+  if (stream_fd >= 0) return;
+  if (!strcmp(stream_path, "-"))
+    stream_fd = 0;
+  else
+    /* O_NONBLOCK also stops the open itself waiting for a FIFO writer */
+    stream_fd = open(stream_path, O_RDONLY | O_NONBLOCK);
+  if (stream_fd < 0) {
+    perror(stream_path);
+    exit(1);
   }
-  if (fabs(cur_angle - dest_angle) <= iter_angle_max)
+  flags = fcntl(stream_fd, F_GETFL);
+  if (flags != -1) fcntl(stream_fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+static struct stream_entry *stream_push(void) {
+  if (stream_queue_count == STREAM_QUEUE_LENGTH) {
+    stream_queue_start = (stream_queue_start + 1) % STREAM_QUEUE_LENGTH;
+    stream_queue_count--;
+    stream_dropped++;
+  }
+  stream_queue_count++;
+  return &stream_queue[(stream_queue_start + stream_queue_count - 1) %
+                       STREAM_QUEUE_LENGTH];
+}
+
+/* Drain whatever input is available without blocking, and queue any
+ * complete shapes found in it. */
+static void stream_poll(void) {
+  size_t used = 0;
+  ssize_t n;
+
+  if (stream_fd < 0) return;
+
+  n = read(stream_fd, stream_buffer + stream_buffered,
+           STREAM_BUFFER_LENGTH - stream_buffered);
+  if (n < 0) {
+    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+      perror(stream_path);
+      close(stream_fd);
+      stream_fd = -1;
+    }
+    return;
+  }
+  stream_buffered += (size_t)n;
+
+  if (stream_binary) {
+    while (stream_buffered - used >= 8) {
+      struct stream_entry *entry = stream_push();
+
+      strcpy(entry->name, "(stream)");
+      unpack_shape(packed_from_bytes((unsigned char *)stream_buffer + used),
+                   &entry->shape);
+      used += 8;
+    }
+  } else {
+    char *eol;
+
+    while ((eol = memchr(stream_buffer + used, '\n', stream_buffered - used))) {
+      char *line = stream_buffer + used;
+      struct stream_entry entry;
+
+      *eol = '\0';
+      used = (size_t)(eol - stream_buffer) + 1;
+      if (*line == '#') continue;
+      if (parse_shape(line, entry.name, sizeof(entry.name), &entry.shape) ==
+          0) {
+        if (!entry.name[0]) strcpy(entry.name, "(stream)");
+        memcpy(stream_push(), &entry, sizeof(entry));
+      }
+      else if (*line && *line != '\r')
+        fprintf(stderr, "glsnake: ignoring bad shape \"%s\"\n", line);
+    }
+    /* a line longer than the whole buffer can never complete */
+    if (used == 0 && stream_buffered == STREAM_BUFFER_LENGTH) {
+      fprintf(stderr, "glsnake: ignoring overlong stream line\n");
+      used = stream_buffered;
+    }
+  }
+
+  stream_buffered -= used;
+  memmove(stream_buffer, stream_buffer + used, stream_buffered);
+}
+
+/* Start morphing to the next queued shape, if there is one.  Returns 1 if a
+ * morph was started. */
+static int stream_next(void) {
+  struct stream_entry *entry;
+
+  if (!stream_queue_count) return 0;
+  entry = &stream_queue[stream_queue_start];
+  stream_queue_start = (stream_queue_start + 1) % STREAM_QUEUE_LENGTH;
+  stream_queue_count--;
+
+  strcpy(stream_title, entry->name);
+  glc->preset_index = -1;
+  start_morph_shape(&entry->shape, 0);
+  glc->next_model_s.name = stream_title;
+  return 1;
+}
+#else
+static void stream_open(void) {
+  fprintf(stderr, "glsnake: -stream is not supported on this platform\n");
+}
+#define stream_fd (-1)
+#define stream_poll()
+#define stream_next() 0
+#endif /* !WIN32 */
+
+/* the index of the model called name, or -1 if there isn't one */
+static int find_model(const char *name) {
+  int i;
+
+  for (i = 0; i < (int)models; i++)
+    if (model[i].name && !strcmp(model[i].name, name)) return i;
+  return -1;
+}
+
+#ifndef WIN32
+/* title of the shape last sent with -control's shape command */
+static char control_title[CONTROL_NAME_LENGTH];
+
+static void control_start(void) {
+  if (control_open(control_path)) {
+    perror(control_path);
+    exit(1);
+  }
+  atexit(control_close);
+}
+
+/* Carry out whatever commands have come in on the -control socket. */
+static void control_apply(void) {
+  struct control_command command;
+  char reply[256], turns[NODE_COUNT * 2], shape[NODE_COUNT];
+  int i;
+
+  control_poll();
+  while (control_next(&command)) {
+    reply[0] = '\0';
+    switch (command.op) {
+      case CONTROL_SHAPE:
+        strcpy(control_title, command.name[0] ? command.name : "(control)");
+        glc->preset_index = -1;
+        start_morph_shape(&command.shape, 0);
+        glc->next_model_s.name = control_title;
+        gettime(&glc->last_morph);
+        break;
+      case CONTROL_JOINT:
+        if (twist_joint(command.n, command.value[0], 0)) {
+          control_error(command.client, "the snake would pass through itself");
+          continue;
+        }
+        break;
+      case CONTROL_PRESET:
+        i = command.name[0] ? find_model(command.name) : command.n;
+        if (i < 0 || i >= (int)models) {
+          control_error(command.client, "no such model");
+          continue;
+        }
+        start_morph((unsigned int)i, 0);
+        gettime(&glc->last_morph);
+        break;
+      case CONTROL_PAUSE:
+        if (command.n < 0) command.n = !glc->paused;
+        if (glc->paused && !command.n) {
+          /* as for the 'p' key */
+          gettime(&glc->last_iteration);
+          gettime(&glc->last_morph);
+        }
+        glc->paused = command.n;
+        break;
+      case CONTROL_SPIN:
+        yspin = command.value[0];
+        zspin = command.value[1];
+        break;
+      case CONTROL_EXPLODE:
+        explode = command.value[0];
+        break;
+      case CONTROL_STATE:
+        /* the turns without the spaces between them */
+        if (format_shape(&glc->next_model_s.shape, turns, sizeof(turns))) {
+          strcpy(shape, "-");
+        } else {
+          for (i = 0; i < NODE_COUNT - 1; i++) shape[i] = turns[2 * i];
+          shape[i] = '\0';
+        }
+        /* the name last, as it can have spaces */
+        snprintf(reply, sizeof(reply),
+                 "frame=%lu preset=%d morphing=%d paused=%d yspin=%.2f "
+                 "zspin=%.2f explode=%.3f shape=%s name=%s",
+                 glc->frame, glc->preset_index, glc->morphing, glc->paused,
+                 yspin, zspin, explode, shape,
+                 glc->next_model_s.name ? glc->next_model_s.name : "");
+        break;
+      case CONTROL_METRICS:
+        snprintf(reply, sizeof(reply), "legal=%d cyclic=%d last_turn=%.0f",
+                 glc->is_legal, glc->is_cyclic, glc->last_turn);
+        break;
+      case CONTROL_PING:
+        break;
+    }
+    control_reply(command.client, reply);
+  }
+}
+#else
+static void control_start(void) {
+  fprintf(stderr, "glsnake: -control is not supported on this platform\n");
+}
+#define control_apply()
+#endif /* !WIN32 */
+
+/* Model files given with -models replace the built in models.  Where inotify
+ * is available a thread watches them, re-parses any file that is rewritten,
+ * and hands the new set of models to glsnake_idle to swap in. */
+#define MAX_MODEL_FILES 16
+
+struct model_set {
+  struct model_s *model;
+  char **names;
+  size_t count;
+};
+
+struct model_file {
+  const char *path;
+  /* the legal models this file held when it was last read */
+  struct model_set set;
+#ifdef HAVE_INOTIFY
+  /* watch on the containing directory, so that editors which save by
+   * renaming a new file over the old one are noticed too */
+  int wd;
+  const char *base;
+  int changed;
+#endif
+};
+
+static struct model_file model_files[MAX_MODEL_FILES];
+static int model_file_count;
+/* the models in use if they came from files, NULL for the built in ones */
+static struct model_set *current_models;
+/* title of the current model, which must outlive the set it came from */
+static char model_title[MODEL_NAME_LENGTH];
+
+static void add_model_file(const char *path) {
+  int i;
+
+  for (i = 0; i < model_file_count; i++)
+    if (!strcmp(model_files[i].path, path)) return;
+  if (model_file_count == MAX_MODEL_FILES) {
+    fprintf(stderr, "glsnake: too many model files, ignoring %s\n", path);
+    return;
+  }
+  model_files[model_file_count++].path = path;
+}
+
+static void free_model_set(struct model_set *set) {
+  size_t i;
+
+  for (i = 0; i < set->count; i++) free(set->names[i]);
+  free(set->names);
+  free(set->model);
+  set->names = NULL;
+  set->model = NULL;
+  set->count = 0;
+}
+
+static void model_set_add(struct model_set *set, size_t *size,
+                          const char *name, const struct glsnake_shape *shape) {
+  if (set->count == *size) {
+    *size = *size ? *size * 2 : 64;
+    set->model = realloc(set->model, *size * sizeof(struct model_s));
+    set->names = realloc(set->names, *size * sizeof(char *));
+    if (!set->model || !set->names) {
+      fprintf(stderr, "glsnake: out of memory\n");
+      exit(1);
+    }
+  }
+  set->names[set->count] = malloc(strlen(name) + 1);
+  if (!set->names[set->count]) {
+    fprintf(stderr, "glsnake: out of memory\n");
+    exit(1);
+  }
+  strcpy(set->names[set->count], name);
+  set->model[set->count].name = set->names[set->count];
+  memcpy(&set->model[set->count].shape, shape, sizeof(struct glsnake_shape));
+  set->count++;
+}
+
+/* (Re-)read one model file.  Models which don't parse or which intersect
+ * themselves are reported and left out.  If the file can't be opened, the
+ * models previously read from it are kept. */
+static int load_model_file(struct model_file *file) {
+  struct model_set set = {NULL, NULL, 0};
+  size_t size = 0;
+  char line[1024];
+  int lineno = 0;
+  FILE *fp;
+
+  if (!(fp = fopen(file->path, "r"))) {
+    perror(file->path);
+    return -1;
+  }
+  while (fgets(line, sizeof(line), fp)) {
+    char name[MODEL_NAME_LENGTH];
+    struct glsnake_shape shape;
+    struct snake_metrics metrics;
+    char *p = line + strspn(line, " \t");
+
+    lineno++;
+    p[strcspn(p, "\r\n")] = '\0';
+    if (*p == '#' || *p == '\0') continue;
+    if (parse_shape(p, name, sizeof(name), &shape)) {
+      fprintf(stderr, "%s:%d: can't parse model\n", file->path, lineno);
+      continue;
+    }
+    TIMELINE_BEGIN("calc_snake_metrics_shape");
+    calc_snake_metrics_shape(&shape, &metrics);
+    TIMELINE_END("calc_snake_metrics_shape");
+    PROBE3(metrics, metrics.is_legal, metrics.is_cyclic, metrics.last_turn);
+    if (!metrics.is_legal) {
+      fprintf(stderr, "%s:%d: %s intersects itself\n", file->path, lineno,
+              name);
+      continue;
+    }
+    model_set_add(&set, &size, *name ? name : "(unnamed)", &shape);
+  }
+  fclose(fp);
+
+  free_model_set(&file->set);
+  memcpy(&file->set, &set, sizeof(set));
+  return 0;
+}
+
+/* Gather the models of every file into one new set, or NULL if there are
+ * none at all. */
+static struct model_set *build_model_set(void) {
+  struct model_set *set = calloc(1, sizeof(struct model_set));
+  size_t size = 0, i;
+  int f;
+
+  if (!set) {
+    fprintf(stderr, "glsnake: out of memory\n");
+    exit(1);
+  }
+  for (f = 0; f < model_file_count; f++)
+    for (i = 0; i < model_files[f].set.count; i++)
+      model_set_add(set, &size, model_files[f].set.model[i].name,
+                    &model_files[f].set.model[i].shape);
+  if (!set->count) {
+    fprintf(stderr, "glsnake: no models in model files, keeping old ones\n");
+    free(set);
+    return NULL;
+  }
+  return set;
+}
+
+/* Switch to a new set of models.  Only call this from the thread that
+ * morphs the snake. */
+static void use_model_set(struct model_set *set) {
+  if (glc->next_model_s.name && glc->next_model_s.name != model_title) {
+    strncpy(model_title, glc->next_model_s.name, sizeof(model_title) - 1);
+    model_title[sizeof(model_title) - 1] = '\0';
+  }
+  glc->prev_model_s.name = glc->next_model_s.name = model_title;
+
+  if (current_models) {
+    free_model_set(current_models);
+    free(current_models);
+  }
+  current_models = set;
+  model = set->model;
+  models = set->count;
+  gallery_forget();
+  /* the model being shown may have moved in the file, or gone */
+  if (glc->preset_index >= 0) glc->preset_index = find_model(model_title);
+}
+
+#ifdef HAVE_INOTIFY
+static int model_inotify_fd = -1;
+static pthread_mutex_t models_lock = PTHREAD_MUTEX_INITIALIZER;
+/* a newly read set of models waiting for glsnake_idle to pick it up */
+static struct model_set *pending_models;
+
+static void *model_watcher(void *arg ATTRIBUTE_UNUSED) {
+  char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+  timeline_thread_name("model watcher");
+  for (;;) {
+    ssize_t len = read(model_inotify_fd, buf, sizeof(buf));
+    const struct inotify_event *event;
+    struct model_set *set;
+    int changed = 0, i;
+    char *p;
+
+    if (len < 0 && errno == EINTR) continue;
+    if (len <= 0) break;
+
+    for (p = buf; p < buf + len; p += sizeof(*event) + event->len) {
+      event = (const struct inotify_event *)p;
+      for (i = 0; i < model_file_count; i++)
+        if (event->wd == model_files[i].wd && event->len &&
+            !strcmp(event->name, model_files[i].base))
+          model_files[i].changed = 1;
+    }
+
+    /* a single save usually generates several events, so only read each
+     * file once */
+    for (i = 0; i < model_file_count; i++) {
+      if (!model_files[i].changed) continue;
+      model_files[i].changed = 0;
+      if (load_model_file(&model_files[i]) == 0) changed = 1;
+    }
+    if (!changed || !(set = build_model_set())) continue;
+
+    pthread_mutex_lock(&models_lock);
+    if (pending_models) {
+      /* never picked up, so nothing can be using it */
+      free_model_set(pending_models);
+      free(pending_models);
+    }
+    pending_models = set;
+    pthread_mutex_unlock(&models_lock);
+  }
+  return NULL;
+}
+
+static void models_watch(void) {
+  pthread_t thread;
+  int i;
+
+  if ((model_inotify_fd = inotify_init()) < 0) {
+    perror("inotify_init");
+    return;
+  }
+  for (i = 0; i < model_file_count; i++) {
+    struct model_file *file = &model_files[i];
+    const char *slash = strrchr(file->path, '/');
+    char dir[1024];
+
+    if (slash) {
+      size_t len = (size_t)(slash - file->path);
+
+      if (len >= sizeof(dir)) continue;
+      memcpy(dir, file->path, len);
+      dir[len ? len : 1] = '\0';
+      if (!len) dir[0] = '/';
+      file->base = slash + 1;
+    } else {
+      strcpy(dir, ".");
+      file->base = file->path;
+    }
+    file->wd = inotify_add_watch(model_inotify_fd, dir,
+                                 IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (file->wd < 0) perror(dir);
+  }
+  if (pthread_create(&thread, NULL, model_watcher, NULL) == 0)
+    pthread_detach(thread);
+  else
+    fprintf(stderr, "glsnake: can't start model file watcher\n");
+}
+
+/* Pick up models re-read by the watcher thread.  This never waits for the
+ * lock; if the watcher is busy we just try again next time. */
+static void models_update(void) {
+  struct model_set *set;
+
+  if (pthread_mutex_trylock(&models_lock)) return;
+  set = pending_models;
+  pending_models = NULL;
+  pthread_mutex_unlock(&models_lock);
+  if (set) use_model_set(set);
+}
+#else
+#define models_update()
+#endif /* HAVE_INOTIFY */
+
+/* Read the model files named on the command line, once. */
+static void models_load(void) {
+  struct model_set *set;
+  int i;
+
+  if (!current_models) models = builtin_models;
+  if (!model_file_count || current_models) return;
+  for (i = 0; i < model_file_count; i++) load_model_file(&model_files[i]);
+  if ((set = build_model_set())) use_model_set(set);
+#ifdef HAVE_INOTIFY
+#ifdef HAVE_GLUT
+  /* the models must stay as they were for a recording to replay */
+  if (record_path || replay_path) return;
+#endif
+  models_watch();
+#endif
+}
+
+#ifdef HAVE_GLUT
+static void glsnake_idle();
+static void replay_input(void);
+
+static void restore_idle(int v ATTRIBUTE_UNUSED) { glutIdleFunc(glsnake_idle); }
+#endif
+
+static void quick_sleep(void) {
+#ifdef HAVE_GLUT
+  /* a played back session has no time to waste */
+  if (replay_path) return;
+  /* By using glutTimerFunc we can keep responding to
+   * mouse and keyboard events, unlike using something like
+   * usleep. */
+  glutIdleFunc(NULL);
+  glutTimerFunc(5, restore_idle, 0);
+#else
+  usleep(1);
+#endif
+}
+
+/* returns a flag indicating if any rotation happened */
+int rotate_joint(int current_node, float iter_angle_max) {
+  struct glsnake_shape *shape = &(glc->shape);
+  float cur_angle = shape->node[current_node];
+  float dest_angle = glc->next_model_s.shape.node[current_node];
+  int rotated = 0;
+
+  if (cur_angle != dest_angle) {
+    rotated = 1;
+  }
+  if (fabs(cur_angle - dest_angle) <= iter_angle_max)
     shape->node[current_node] = dest_angle;
   else if (fmod(cur_angle - dest_angle + 360, 360) > 180)
     shape->node[current_node] = fmod(cur_angle + iter_angle_max, 360);
@@ -2229,7 +1943,7 @@ static float morph_percent_one_at_a_time(void) {
   return morph_one_at_time_current_node / NODE_COUNT;
 }
 
-void glsnake_idle(
+static void idle_step(
 #ifndef HAVE_GLUT
     struct glsnake_cfg *bp
 #endif
@@ -2241,6 +1955,11 @@ void glsnake_idle(
   snaketime current_time;
   int still_morphing;
 
+  /* keep the stream drained even when paused, so writers never block */
+  stream_poll();
+  control_apply();
+  models_update();
+
   /* Do nothing to the model if we are paused */
   if (glc->paused) {
     /* Avoid busy waiting when nothing is changing */
@@ -2267,6 +1986,18 @@ void glsnake_idle(
   if (iter_msec) {
     /* save the current time */
     memcpy(&glc->last_iteration, &current_time, sizeof(snaketime));
+    PROBE1(idle__tick, iter_msec);
+
+    /* the gallery only spins and scrolls; nothing morphs */
+    if (gallery) {
+      yspin += 360 / ((1000 / yangvel) / iter_msec);
+      zspin += 360 / ((1000 / zangvel) / iter_msec);
+      gallery_idle(iter_msec);
+#ifdef HAVE_GLUT
+      glutPostRedisplay();
+#endif
+      return;
+    }
 
     /* work out if we have to switch models */
     morf_msec =
@@ -2274,7 +2005,13 @@ void glsnake_idle(
         ((long)(GETSECS(glc->last_iteration) - GETSECS(glc->last_morph)) *
          1000L);
 
-    if ((morf_msec > statictime) && !interactive && !glc->morphing) {
+    if (stream_fd >= 0) {
+      /* streamed shapes replace the random presets, and are shown as soon
+       * as the previous morph is done */
+      if (!interactive && !glc->morphing && stream_next())
+        memcpy(&glc->last_morph, &(glc->last_iteration),
+               sizeof(glc->last_morph));
+    } else if ((morf_msec > statictime) && !interactive && !glc->morphing) {
       /*printf("starting morph\n");*/
       memcpy(&glc->last_morph, &(glc->last_iteration), sizeof(glc->last_morph));
       start_morph(RAND(models), 0);
@@ -2297,14 +2034,23 @@ void glsnake_idle(
       /*printf("yspin: %f, zspin: %f\n", yspin, zspin);*/
     }
 
+    PERF_BEGIN(PERF_KINEMATICS);
+    TIMELINE_BEGIN("morph");
     still_morphing = glc->morph(iter_msec);
+    TIMELINE_END("morph");
+    PERF_END(PERF_KINEMATICS);
 
+    if (!still_morphing && glc->morphing) {
+      PROBE1(morph__finish, glc->preset_index);
+    }
     if (!still_morphing) {
       glc->morphing = 0;
     }
 
     /* colour cycling */
+    TIMELINE_BEGIN("morph_colour");
     morph_colour();
+    TIMELINE_END("morph_colour");
 
 #ifdef HAVE_GLUT
     glutPostRedisplay();
@@ -2316,87 +2062,237 @@ void glsnake_idle(
   }
 }
 
-/* wot draws it */
-void glsnake_display(
+void glsnake_idle(
 #ifndef HAVE_GLUT
-    ModeInfo *mi
+    struct glsnake_cfg *bp
 #endif
     ) {
-#ifndef HAVE_GLUT
-  struct glsnake_cfg *bp = &glc[MI_SCREEN(mi)];
-  Display *dpy = MI_DISPLAY(mi);
-  Window window = MI_WINDOW(mi);
+#ifdef HAVE_GLUT
+  record_input(RECORD_IDLE, 0, 0, 0, 0);
+  if (replay_path) replay_input();
 #endif
-  int i;
-  float ang;
-  float positions[NODE_COUNT][4]; /* origin points for each node */
-  float com[4];                   /* it's the CENTRE of MASS */
-
-#ifndef HAVE_GLUT
-  if (!bp->glx_context) return;
+  PERF_BEGIN(PERF_IDLE);
+  TIMELINE_BEGIN("glsnake_idle");
+#ifdef HAVE_GLUT
+  idle_step();
+#else
+  idle_step(bp);
 #endif
+  TIMELINE_END("glsnake_idle");
+  PERF_END(PERF_IDLE);
+}
 
-  /* clear the buffer */
-  glClear((GLbitfield)GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+/* Transparent nodes have to be drawn farthest first.  From one frame to the
+ * next the order hardly changes, so by default last frame's order is
+ * insertion sorted, which is close to linear when little has moved.
+ * "-depth-sort qsort" sorts from scratch every frame instead, and
+ * "-depth-sort none" draws the nodes in order along the snake. */
+#define DEPTH_SORT_NONE 0
+#define DEPTH_SORT_INSERTION 1
+#define DEPTH_SORT_QSORT 2
 
-  /* go into the modelview stack */
-  glMatrixMode(GL_MODELVIEW);
-  glLoadIdentity();
+static int depth_sort_method;
+static int node_order[NODE_COUNT];
+static float node_depth[NODE_COUNT];
 
-  /* get the centre of each node, by moving through the snake and
-   * performing the rotations, then grabbing the matrix at each point
-   * and applying it to the origin */
-  glPushMatrix();
+static void depth_sort_init(void) {
+  int i;
 
-#ifdef HAVE_GLUT
-  /* apply the mouse drag rotation */
-  ui_mousedrag();
-#endif
+  if (!depth_sort || !*depth_sort || !strcmp(depth_sort, "insertion"))
+    depth_sort_method = DEPTH_SORT_INSERTION;
+  else if (!strcmp(depth_sort, "qsort"))
+    depth_sort_method = DEPTH_SORT_QSORT;
+  else if (!strcmp(depth_sort, "none"))
+    depth_sort_method = DEPTH_SORT_NONE;
+  else {
+    fprintf(stderr, "glsnake: unknown depth sort %s\n", depth_sort);
+    exit(1);
+  }
+  for (i = 0; i < NODE_COUNT; i++) node_order[i] = i;
+}
+
+static int compare_depth(const void *a, const void *b) {
+  float da = node_depth[*(const int *)a], db = node_depth[*(const int *)b];
+
+  return da < db ? -1 : da > db;
+}
 
-  /* apply the continuous rotation */
-  glRotatef(yspin, 0.0, 1.0, 0.0);
-  glRotatef(zspin, 0.0, 0.0, 1.0);
+/* Sort node_order by how far each node, placed by m and moved by -com, is in
+ * front of the viewer under the modelview matrix mv.  Returns 1 if the
+ * order changed. */
+static int sort_nodes(float m[NODE_COUNT + 1][16], const float com[3],
+                      const float mv[16]) {
+  /* the middle of the prism */
+  static const float centre[3] = {1.0 / 3.0, 1.0 / 3.0, 0.5};
+  int i, j, changed = 0;
 
-  com[0] = 0.0;
-  com[1] = 0.0;
-  com[2] = 0.0;
-  com[3] = 0.0;
   for (i = 0; i < NODE_COUNT; i++) {
-    float rotmat[16];
+    float p[3];
 
-    ang = glc->shape.node[i];
+    matrix_transform(m[i], centre, p);
+    node_depth[i] = mv[2] * (p[0] - com[0]) + mv[6] * (p[1] - com[1]) +
+                    mv[10] * (p[2] - com[2]);
+  }
 
-    /*printf("ang = %f\n", ang);*/
+  if (depth_sort_method == DEPTH_SORT_QSORT) {
+    int old[NODE_COUNT];
 
-    glTranslatef(0.5, 0.5, 0.5);           /* move to center */
-    glRotatef(90.0, 0.0, 0.0, -1.0);       /* reorient  */
-    glTranslatef(1.0 + explode, 0.0, 0.0); /* move to new pos. */
-    glRotatef(180.0 + ang, 1.0, 0.0, 0.0); /* pivot to new angle */
-    glTranslatef(-0.5, -0.5, -0.5);        /* return from center */
+    memcpy(old, node_order, sizeof(old));
+    for (i = 0; i < NODE_COUNT; i++) node_order[i] = i;
+    qsort(node_order, NODE_COUNT, sizeof(node_order[0]), compare_depth);
+    return memcmp(old, node_order, sizeof(old)) != 0;
+  }
 
-    glGetFloatv(GL_MODELVIEW_MATRIX, rotmat);
+  for (i = 1; i < NODE_COUNT; i++) {
+    int node = node_order[i];
+    float depth = node_depth[node];
 
-    matmult_origin(rotmat, positions[i]);
+    for (j = i; j > 0 && node_depth[node_order[j - 1]] > depth; j--) {
+      node_order[j] = node_order[j - 1];
+      changed = 1;
+    }
+    node_order[j] = node;
+  }
+  return changed;
+}
 
-    /*printf("positions %f %f %f %f\n", positions[i][0], positions[i][1],
-     * positions[i][2], positions[i][3]);*/
+/* Sort the nodes for the current modelview matrix, if they need it. */
+static int depth_sort_nodes(float m[NODE_COUNT + 1][16], const float com[3]) {
+  float mv[16];
 
-    com[0] += positions[i][0];
-    com[1] += positions[i][1];
-    com[2] += positions[i][2];
-    com[3] += positions[i][3];
+  if (!transparent || depth_sort_method == DEPTH_SORT_NONE) return 0;
+  glGetFloatv(GL_MODELVIEW_MATRIX, mv);
+  return sort_nodes(m, com, mv);
+}
+
+/* While the snake holds still only the spin changes, so the whole snake is
+ * baked into one vertex array, already placed, centred and coloured, and
+ * drawn with a single call.  Baking is spread over a few frames so that it
+ * never causes a hitch, and starts again whenever anything it was baked
+ * from changes. */
+#define BAKE_NODES_PER_FRAME 8
+#define BAKE_VERTICES (NODE_COUNT * SOLID_PRISM_TRIANGLES * 3)
+
+/* laid out for GL_C4F_N3F_V3F */
+struct bake_vertex {
+  GLfloat c[4];
+  GLfloat n[3];
+  GLfloat v[3];
+};
+
+static struct {
+  /* what the bake is of */
+  struct glsnake_shape shape;
+  float explode;
+  float colour[2][4];
+
+  float m[NODE_COUNT + 1][16];
+  float com[3];
+  /* has baking started, and how many nodes are done */
+  int started;
+  int nodes;
+  int count;
+  struct bake_vertex vertex[BAKE_VERTICES];
+  /* the vertices in node_order, if indexed is set */
+  int indexed;
+  GLushort index[BAKE_VERTICES];
+} bake;
+
+static void bake_node(int node) {
+  const float *m = bake.m[node];
+  const float *c = bake.colour[(node + 1) % 2];
+  float v[SOLID_PRISM_VERTICES][3];
+  int f, k;
+
+  for (k = 0; k < SOLID_PRISM_VERTICES; k++) {
+    matrix_transform(m, solid_prism_v[k], v[k]);
+    v[k][0] -= bake.com[0];
+    v[k][1] -= bake.com[1];
+    v[k][2] -= bake.com[2];
   }
-  glPopMatrix();
-  com[0] /= NODE_COUNT;
-  com[1] /= NODE_COUNT;
-  com[2] /= NODE_COUNT;
-  com[3] /= NODE_COUNT;
+  for (f = 0; f < SOLID_PRISM_FACES; f++) {
+    const struct prism_face *face = &solid_prism_f[f];
+    float n[3];
+
+    matrix_rotate(n, m, solid_prism_n[face->normal]);
+    for (k = 0; k < 3 * (face->count - 2); k++) {
+      /* fan out from the first corner */
+      static const int corner[] = {0, 1, 2, 0, 2, 3};
+      struct bake_vertex *out = &bake.vertex[bake.count++];
+
+      memcpy(out->c, c, sizeof(out->c));
+      memcpy(out->n, n, sizeof(out->n));
+      memcpy(out->v, v[face->v[corner[k]]], sizeof(out->v));
+    }
+  }
+}
+
+/* Do the next bit of baking.  Returns 1 once the bake matches the snake as
+ * it is now. */
+static int bake_step(void) {
+  int end;
+
+  if (!bake.started ||
+      memcmp(&bake.shape, &glc->shape, sizeof(bake.shape)) ||
+      bake.explode != explode ||
+      memcmp(bake.colour, glc->colour, sizeof(bake.colour))) {
+    memcpy(&bake.shape, &glc->shape, sizeof(bake.shape));
+    bake.explode = explode;
+    memcpy(bake.colour, glc->colour, sizeof(bake.colour));
+    PERF_BEGIN(PERF_KINEMATICS);
+    node_transforms(&bake.shape, explode, bake.m);
+    snake_centre(bake.m, bake.com);
+    PERF_END(PERF_KINEMATICS);
+    bake.started = 1;
+    bake.nodes = 0;
+    bake.count = 0;
+    bake.indexed = 0;
+  }
+
+  end = bake.nodes + BAKE_NODES_PER_FRAME;
+  if (end > NODE_COUNT) end = NODE_COUNT;
+  for (; bake.nodes < end; bake.nodes++) bake_node(bake.nodes);
+
+  return bake.nodes == NODE_COUNT;
+}
+
+static void bake_draw(void) {
+  /* each node has the same number of vertices */
+  const int per_node = SOLID_PRISM_TRIANGLES * 3;
+
+  if (depth_sort_nodes(bake.m, bake.com) || !bake.indexed) {
+    int k, j;
+
+    for (k = 0; k < NODE_COUNT; k++)
+      for (j = 0; j < per_node; j++)
+        bake.index[k * per_node + j] =
+            (GLushort)(node_order[k] * per_node + j);
+    bake.indexed = 1;
+  }
+
+  glPushAttrib((GLbitfield)GL_ENABLE_BIT | GL_LIGHTING_BIT);
+  glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+  glColorMaterial(GL_FRONT, GL_AMBIENT_AND_DIFFUSE);
+  glEnable(GL_COLOR_MATERIAL);
+  glInterleavedArrays(GL_C4F_N3F_V3F, 0, bake.vertex);
+  glDrawElements(GL_TRIANGLES, bake.count, GL_UNSIGNED_SHORT, bake.index);
+  glPopClientAttrib();
+  glPopAttrib();
+}
 
-  com[0] /= com[3];
-  com[1] /= com[3];
-  com[2] /= com[3];
+/* draw each node in turn, farthest first if they are sorted */
+static void draw_nodes(void) {
+  /* the node transforms and the CENTRE of MASS, worked out on the CPU rather
+   * than read back from GL after every step */
+  float m[NODE_COUNT + 1][16];
+  float com[3];
+  int i, k;
 
-/*printf("com: %f, %f, %f, %f\n", com[0], com[1], com[2], com[3]);*/
+  PERF_BEGIN(PERF_KINEMATICS);
+  node_transforms(&glc->shape, explode, m);
+  snake_centre(m, com);
+  depth_sort_nodes(m, com);
+  PERF_END(PERF_KINEMATICS);
 
 #if MAGICAL_RED_STRING
   glPushMatrix();
@@ -2405,29 +2301,24 @@ void glsnake_display(
   glDisable(GL_LIGHTING);
   glColor4f(1.0, 0.0, 0.0, 1.0);
   glBegin(GL_LINE_STRIP);
-  for (i = 0; i < NODE_COUNT - 1; i++) {
-    glVertex3fv(positions[i]);
+  for (i = 1; i < NODE_COUNT; i++) {
+    static const float middle[3] = {0.5, 0.5, 0.5};
+    float p[3];
+
+    matrix_transform(m[i], middle, p);
+    glVertex3fv(p);
   }
   glEnd();
   glEnable(GL_LIGHTING);
-  /*glTranslatef(com[0], com[1], com[2]);*/
   glPopMatrix();
 #endif
 
-  glPushMatrix();
   glTranslatef(-com[0], -com[1], -com[2]);
 
-#ifdef HAVE_GLUT
-  /* apply the mouse drag rotation */
-  ui_mousedrag();
-#endif
-
-  /* apply the continuous rotation */
-  glRotatef(yspin, 0.0, 1.0, 0.0);
-  glRotatef(zspin, 0.0, 0.0, 1.0);
+  /* now draw each node */
+  for (k = 0; k < NODE_COUNT; k++) {
+    i = node_order[k];
 
-  /* now draw each node along the snake -- this is quite ugly :p */
-  for (i = 0; i < NODE_COUNT; i++) {
     /* choose a colour for this node */
     if ((i == glc->selected || i == glc->selected + 1) && interactive)
       if (wireframe) {
@@ -2445,31 +2336,589 @@ void glsnake_display(
       }
     }
 
-    /* draw the node */
+    /* draw the node where the walk along the snake put it */
+    glPushMatrix();
+    glMultMatrixf(m[i]);
     if (wireframe)
       glCallList(glc->node_wire);
     else
       glCallList(glc->node_solid);
+    glPopMatrix();
+  }
+}
 
-    /* now work out where to draw the next one */
+/* Draw the snake with the software renderer, and put the frame up in place
+ * of GL's drawing.  Wireframe mode is drawn solid. */
+static struct raster *software_raster;
 
-    /* Interpolate between models */
-    ang = glc->shape.node[i];
+static void draw_software(void) {
+  float m[NODE_COUNT + 1][16];
+  float node_colour[NODE_COUNT][4];
+  struct raster_scene scene;
+  GLint viewport[4];
+  int i;
 
-    glTranslatef(0.5, 0.5, 0.5);           /* move to center */
-    glRotatef(90.0, 0.0, 0.0, -1.0);       /* reorient  */
-    glTranslatef(1.0 + explode, 0.0, 0.0); /* move to new pos. */
-    glRotatef(180.0 + ang, 1.0, 0.0, 0.0); /* pivot to new angle */
-    glTranslatef(-0.5, -0.5, -0.5);        /* return from center */
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  if ((!software_raster && !(software_raster = raster_new(0))) ||
+      raster_resize(software_raster, viewport[2], viewport[3])) {
+    fprintf(stderr, "glsnake: out of memory\n");
+    exit(1);
   }
 
+  memset(&scene, 0, sizeof(scene));
+  node_transforms(&glc->shape, explode, m);
+  scene.m = m;
+  snake_centre(m, scene.com);
+  for (i = 0; i < NODE_COUNT; i++)
+    memcpy(node_colour[i],
+           (i == glc->selected || i == glc->selected + 1) && interactive
+               ? yellow_light
+               : glc->colour[(i + 1) % 2],
+           sizeof(node_colour[i]));
+  scene.colour = (const float(*)[4])node_colour;
+  depth_sort_nodes(m, scene.com);
+  scene.order = node_order;
+  scene.blend = transparent;
+  glGetFloatv(GL_MODELVIEW_MATRIX, scene.modelview);
+  glGetFloatv(GL_PROJECTION_MATRIX, scene.projection);
+  glGetFloatv(GL_COLOR_CLEAR_VALUE, scene.background);
+
+  raster_draw(software_raster, &scene);
+
+  glPushAttrib((GLbitfield)GL_ENABLE_BIT | GL_TRANSFORM_BIT);
+  glDisable(GL_LIGHTING);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_BLEND);
+  glMatrixMode(GL_PROJECTION);
+  glPushMatrix();
+  glLoadIdentity();
+  glMatrixMode(GL_MODELVIEW);
+  glPushMatrix();
+  glLoadIdentity();
+  glRasterPos2f(-1.0, -1.0);
+  glDrawPixels(viewport[2], viewport[3], GL_RGBA, GL_UNSIGNED_BYTE,
+               raster_pixels(software_raster));
   glPopMatrix();
+  glMatrixMode(GL_PROJECTION);
+  glPopMatrix();
+  glPopAttrib();
+}
+
+/* Gallery mode shows every model at once on a wall that scrolls slowly
+ * upwards and wraps around, each snake spinning at its own rate.  Only the
+ * rows on screen are worked out and drawn, and snakes too small to show
+ * their bevels are drawn with plain prisms, or smaller still as a single
+ * square in their colour.  Given an atlas from glsnake-thumbs, those
+ * snakes are drawn from their thumbnails instead. */
+#define GALLERY_COLUMNS 6
+#define GALLERY_MAX_COLUMNS 1000
+/* rows per second */
+#define GALLERY_SCROLL 0.1
+/* pixels across a cell below which the simpler snakes are used */
+#define GALLERY_SOLID_PIXELS 96
+#define GALLERY_FLAT_PIXELS 16
+
+static int gallery_columns = GALLERY_COLUMNS;
+/* the row at the top of the screen */
+static float gallery_scroll;
+/* what has been worked out about each model */
+struct gallery_model {
+  /* 0 if not worked out yet, 1 if acyclic and 2 if cyclic */
+  unsigned char cyclic;
+  unsigned char thumb_known;
+  /* the cell of its thumbnail in the atlas, or -1 if it has none */
+  int thumb;
+};
+static struct gallery_model *gallery_info;
+
+/* The atlas drawn by glsnake-thumbs: a PPM whose header comments give the
+ * size of a thumbnail and the packed shape in each cell. */
+struct atlas_cell {
+  uint64_t packed;
+  int cell;
+};
+static int atlas_tried;
+static GLuint atlas_texture;
+static int atlas_size, atlas_width, atlas_height;
+/* sorted by packed shape */
+static struct atlas_cell *atlas_cells;
+static size_t atlas_count;
+
+/* the models have changed, so what is known about them has to go */
+static void gallery_forget(void) {
+  free(gallery_info);
+  gallery_info = NULL;
+}
+
+static struct gallery_model *gallery_model(size_t index) {
+  if (!gallery_info &&
+      !(gallery_info = calloc(models, sizeof(struct gallery_model))))
+    return NULL;
+  return &gallery_info[index];
+}
+
+static const float *gallery_colour(size_t index, int which) {
+  struct gallery_model *info = gallery_model(index);
+  struct snake_metrics metrics;
+
+  /* known already for the built in models */
+  if (!current_models) return colour[builtin_info[index].colour][which];
+  if (!info) return colour[COLOUR_ACYCLIC][which];
+  if (!info->cyclic) {
+    perf_count(PERF_LEGALITY_CHECKS);
+    TIMELINE_BEGIN("calc_snake_metrics_shape");
+    calc_snake_metrics_shape(&model[index].shape, &metrics);
+    TIMELINE_END("calc_snake_metrics_shape");
+    PROBE3(metrics, metrics.is_legal, metrics.is_cyclic, metrics.last_turn);
+    info->cyclic = metrics.is_cyclic ? 2 : 1;
+  }
+  return colour[info->cyclic == 2 ? COLOUR_CYCLIC : COLOUR_ACYCLIC][which];
+}
+
+static int compare_atlas_cells(const void *a, const void *b) {
+  const struct atlas_cell *x = a, *y = b;
+
+  return x->packed < y->packed ? -1 : x->packed > y->packed ? 1 : 0;
+}
+
+static int power_of_two(int n) { return n > 0 && !(n & (n - 1)); }
+
+/* Read the header and pixels of an atlas; returns the pixels, or NULL if
+ * it isn't one. */
+static unsigned char *atlas_read(FILE *fp) {
+  char line[256];
+  unsigned char *pixels;
+  size_t alloc = 0;
+  int max = 0;
+
+  if (!fgets(line, sizeof(line), fp) || strcmp(line, "P6\n")) return NULL;
+  while (fgets(line, sizeof(line), fp) && line[0] == '#') {
+    unsigned long high, low;
+
+    if (sscanf(line, "# glsnake-thumbs %d", &atlas_size) == 1) continue;
+    if (sscanf(line, "# %8lx%8lx", &high, &low) != 2) continue;
+    if (atlas_count == alloc) {
+      struct atlas_cell *more;
+
+      alloc = alloc ? alloc * 2 : 256;
+      if (!(more = realloc(atlas_cells, alloc * sizeof(*atlas_cells))))
+        return NULL;
+      atlas_cells = more;
+    }
+    atlas_cells[atlas_count].packed = (uint64_t)high << 32 | low;
+    atlas_cells[atlas_count].cell = (int)atlas_count;
+    atlas_count++;
+  }
+  if (sscanf(line, "%d %d", &atlas_width, &atlas_height) != 2 ||
+      !fgets(line, sizeof(line), fp) || sscanf(line, "%d", &max) != 1 ||
+      max != 255 || atlas_size <= 0 || !power_of_two(atlas_width) ||
+      !power_of_two(atlas_height) || atlas_width % atlas_size ||
+      atlas_count > (size_t)(atlas_width / atlas_size) *
+                        (atlas_height / atlas_size))
+    return NULL;
+  if (!(pixels = malloc((size_t)atlas_width * atlas_height * 3))) return NULL;
+  if (fread(pixels, 3, (size_t)atlas_width * atlas_height, fp) !=
+      (size_t)atlas_width * atlas_height) {
+    free(pixels);
+    return NULL;
+  }
+  return pixels;
+}
+
+/* Load the atlas into a texture.  Anything wrong with it just means the
+ * gallery draws every snake itself. */
+static void atlas_load(void) {
+  FILE *fp;
+  unsigned char *pixels;
+  GLint fits;
+
+  atlas_tried = 1;
+  if (!(fp = fopen(atlas_path, "rb"))) {
+    perror(atlas_path);
+    return;
+  }
+  pixels = atlas_read(fp);
+  fclose(fp);
+  if (!pixels) {
+    fprintf(stderr, "glsnake: %s is not an atlas from glsnake-thumbs\n",
+            atlas_path);
+    atlas_count = 0;
+    return;
+  }
+
+  /* make sure the driver can take a texture this big */
+  glTexImage2D(GL_PROXY_TEXTURE_2D, 0, GL_RGB, atlas_width, atlas_height, 0,
+               GL_RGB, GL_UNSIGNED_BYTE, NULL);
+  glGetTexLevelParameteriv(GL_PROXY_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &fits);
+  if (!fits) {
+    fprintf(stderr, "glsnake: %s is too big for a texture\n", atlas_path);
+    free(pixels);
+    atlas_count = 0;
+    return;
+  }
+
+  glGenTextures(1, &atlas_texture);
+  glBindTexture(GL_TEXTURE_2D, atlas_texture);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  /* a PPM is top row first, so the top of the atlas is at t = 0 */
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, atlas_width, atlas_height, 0, GL_RGB,
+               GL_UNSIGNED_BYTE, pixels);
+  free(pixels);
+
+  qsort(atlas_cells, atlas_count, sizeof(*atlas_cells), compare_atlas_cells);
+}
+
+/* the atlas cell holding the thumbnail of a model, or -1 */
+static int gallery_thumb(size_t index) {
+  struct gallery_model *info = gallery_model(index);
+  struct atlas_cell key, *found;
+
+  if (!info) return -1;
+  if (!info->thumb_known) {
+    info->thumb = -1;
+    if (!pack_shape(&model[index].shape, &key.packed) &&
+        (found = bsearch(&key, atlas_cells, atlas_count, sizeof(*atlas_cells),
+                         compare_atlas_cells)))
+      info->thumb = found->cell;
+    info->thumb_known = 1;
+  }
+  return info->thumb;
+}
+
+/* draw the rows from first to last that have thumbnails, in one batch */
+static void gallery_thumbs(long first, long last, size_t rows) {
+  int columns = atlas_width / atlas_size;
+  float ds = (float)atlas_size / atlas_width;
+  float dt = (float)atlas_size / atlas_height;
+  long row;
+  int col;
+
+  glPushAttrib(GL_ENABLE_BIT);
+  glDisable(GL_LIGHTING);
+  glEnable(GL_TEXTURE_2D);
+  glBindTexture(GL_TEXTURE_2D, atlas_texture);
+  glColor4f(1.0, 1.0, 1.0, 1.0);
+  glBegin(GL_QUADS);
+  for (row = first; row <= last; row++)
+    for (col = 0; col < gallery_columns; col++) {
+      size_t index = (row % rows) * gallery_columns + col;
+      float s, t;
+      int thumb;
+
+      if (index >= models) break;
+      if ((thumb = gallery_thumb(index)) < 0) continue;
+      s = (thumb % columns) * ds;
+      t = (thumb / columns) * dt;
+      glTexCoord2f(s, t + dt);
+      glVertex2f(col, -row - 1);
+      glTexCoord2f(s + ds, t + dt);
+      glVertex2f(col + 1, -row - 1);
+      glTexCoord2f(s + ds, t);
+      glVertex2f(col + 1, -row);
+      glTexCoord2f(s, t);
+      glVertex2f(col, -row);
+    }
+  glEnd();
+  glPopAttrib();
+}
+
+/* scroll the wall by some rows, wrapping around at either end */
+static void gallery_move(float by) {
+  size_t rows = (models + gallery_columns - 1) / gallery_columns;
+
+  gallery_scroll = fmod(gallery_scroll + by, (float)rows);
+  if (gallery_scroll < 0.0) gallery_scroll += rows;
+}
+
+static void gallery_idle(long iter_msec) {
+  gallery_move(GALLERY_SCROLL * iter_msec / 1000.0);
+}
+
+/* draw one snake spinning in the middle of the cell at (x, y) */
+static void gallery_snake(size_t index, float x, float y, GLuint list) {
+  float m[NODE_COUNT + 1][16];
+  float com[3], radius = 0.0;
+  int i;
+
+  PERF_BEGIN(PERF_KINEMATICS);
+  if (!current_models) {
+    /* the built in models were placed when glsnake was built */
+    const struct model_info *info = &builtin_info[index];
+
+    placed_transforms(info->node, explode, m);
+    for (i = 0; i < 3; i++)
+      com[i] = info->centre[i] + explode * info->centre_explode[i];
+    radius = info->radius + explode * info->radius_explode;
+  } else {
+    node_transforms(&model[index].shape, explode, m);
+    snake_centre(m, com);
+    /* scale it to fit the cell, whatever its shape */
+    for (i = 1; i <= NODE_COUNT; i++) {
+      static const float middle[3] = {0.5, 0.5, 0.5};
+      float p[3], r;
+
+      matrix_transform(m[i], middle, p);
+      r = sqrt((p[0] - com[0]) * (p[0] - com[0]) +
+               (p[1] - com[1]) * (p[1] - com[1]) +
+               (p[2] - com[2]) * (p[2] - com[2]));
+      if (r > radius) radius = r;
+    }
+    /* a node reaches this far past its middle */
+    radius += M_SQRT1_2 + explode;
+  }
+  PERF_END(PERF_KINEMATICS);
+
+  glPushMatrix();
+  glTranslatef(x, y, 0.0);
+  glScalef(0.45 / radius, 0.45 / radius, 0.45 / radius);
+  glRotatef(yspin * (0.6 + 0.1 * (index % 7)) + 47.0 * index, 0.0, 1.0, 0.0);
+  glRotatef(zspin * (0.6 + 0.1 * (index % 5)) + 29.0 * index, 0.0, 0.0, 1.0);
+  glTranslatef(-com[0], -com[1], -com[2]);
+  for (i = 0; i < NODE_COUNT; i++) {
+    const float *c = gallery_colour(index, (i + 1) % 2);
+
+    glMaterialfv(GL_FRONT, GL_AMBIENT, c);
+    glMaterialfv(GL_FRONT, GL_DIFFUSE, c);
+    glPushMatrix();
+    glMultMatrixf(m[i]);
+    glCallList(list);
+    glPopMatrix();
+  }
+  glPopMatrix();
+}
+
+static void draw_gallery(void) {
+  GLint viewport[4];
+  float cell, view_rows;
+  long row, first, last;
+  size_t rows = (models + gallery_columns - 1) / gallery_columns;
+  int col, thumbs;
+
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  cell = (float)viewport[2] / gallery_columns;
+  view_rows = viewport[3] / cell;
+
+  /* one unit to a cell, with row r from -r down to -(r + 1) */
+  glPushAttrib((GLbitfield)GL_ENABLE_BIT | GL_TRANSFORM_BIT | GL_LIGHTING_BIT);
+  glDisable(GL_BLEND);
+  glEnable(GL_CULL_FACE);
+  glMatrixMode(GL_PROJECTION);
+  glPushMatrix();
+  glLoadIdentity();
+  glOrtho(0.0, gallery_columns, -(gallery_scroll + view_rows), -gallery_scroll,
+          -1.0, 1.0);
+  glMatrixMode(GL_MODELVIEW);
+  glPushMatrix();
+  glLoadIdentity();
+
+  /* the scroll is never negative, so these round down */
+  first = (long)gallery_scroll;
+  last = (long)(gallery_scroll + view_rows);
+  /* a wall shorter than the screen is shown once, not repeated */
+  if (last - first >= (long)rows) last = first + rows - 1;
+
+  if (atlas_path && *atlas_path && !atlas_tried) atlas_load();
+  thumbs = atlas_texture && !wireframe && cell < GALLERY_SOLID_PIXELS;
+  if (thumbs) gallery_thumbs(first, last, rows);
+
+  if (cell < GALLERY_FLAT_PIXELS) {
+    /* too small to make out: a flat square each, in one batch */
+    glDisable(GL_LIGHTING);
+    glBegin(GL_QUADS);
+    for (row = first; row <= last; row++)
+      for (col = 0; col < gallery_columns; col++) {
+        size_t index = (row % rows) * gallery_columns + col;
+
+        if (index >= models) break;
+        if (thumbs && gallery_thumb(index) >= 0) continue;
+        glColor4fv(gallery_colour(index, 0));
+        glVertex2f(col + 0.2, -row - 0.8);
+        glVertex2f(col + 0.8, -row - 0.8);
+        glVertex2f(col + 0.8, -row - 0.2);
+        glVertex2f(col + 0.2, -row - 0.2);
+      }
+    glEnd();
+  } else {
+    GLuint list = wireframe ? glc->node_wire
+                  : cell < GALLERY_SOLID_PIXELS ? glc->node_flat
+                                                : glc->node_solid;
+
+    for (row = first; row <= last; row++)
+      for (col = 0; col < gallery_columns; col++) {
+        size_t index = (row % rows) * gallery_columns + col;
+
+        if (index >= models) break;
+        if (thumbs && gallery_thumb(index) >= 0) continue;
+        gallery_snake(index, col + 0.5, -row - 0.5, list);
+      }
+  }
+
+  glPopMatrix();
+  glMatrixMode(GL_PROJECTION);
+  glPopMatrix();
+  glPopAttrib();
+}
+
+#ifndef WIN32
+static void shm_start(void) {
+  if (shm_state_open(shm_name)) {
+    perror(shm_name);
+    exit(1);
+  }
+  atexit(shm_state_close);
+}
+
+/* Write the snake just drawn into the -shm segment.  The nodes are placed
+ * again rather than kept from drawing, as each way of drawing places them
+ * itself; it costs a few microseconds.  The frame is put together first
+ * and then copied in, so that readers are only held up for the copy. */
+static void shm_publish(void) {
+  static struct glsnake_state frame;
+  struct glsnake_state *state = &frame;
+  int i;
+
+  state->frame = glc->frame;
+  state->seconds = perf_now();
+  memcpy(state->joint, glc->shape.node, sizeof(state->joint));
+  memcpy(state->target, glc->next_model_s.shape.node, sizeof(state->target));
+  node_transforms(&glc->shape, explode, state->m);
+  snake_centre(state->m, state->com);
+  state->yspin = yspin;
+  state->zspin = zspin;
+  state->explode = explode;
+  for (i = 0; i < NODE_COUNT; i++)
+    memcpy(state->colour[i],
+           (i == glc->selected || i == glc->selected + 1) && interactive
+               ? yellow_light
+               : glc->colour[(i + 1) % 2],
+           sizeof(state->colour[i]));
+  /* calc_snake_metrics keeps these for the shape being morphed to */
+  state->is_legal = glc->is_legal;
+  state->is_cyclic = glc->is_cyclic;
+  state->last_turn = glc->last_turn;
+  state->preset_index = glc->preset_index;
+  state->morphing = glc->morphing;
+  state->paused = glc->paused;
+  state->selected = interactive ? glc->selected : -1;
+  strncpy(state->name, glc->next_model_s.name ? glc->next_model_s.name : "",
+          sizeof(state->name) - 1);
+  state->name[sizeof(state->name) - 1] = '\0';
+  memcpy(shm_state_begin(), state, sizeof(*state));
+  shm_state_end();
+}
+
+static void stats_start(void) {
+  if (stats_open(stats_dir)) {
+    perror(stats_dir);
+    exit(1);
+  }
+  atexit(stats_close);
+}
+#else
+static void shm_start(void) {
+  fprintf(stderr, "glsnake: -shm is not supported on this platform\n");
+}
+#define shm_publish()
+
+static void stats_start(void) {
+  fprintf(stderr, "glsnake: -stats is not supported on this platform\n");
+}
+#endif /* !WIN32 */
+
+/* time a phase of drawing on the GPU, while anyone is looking */
+#define GPU_BEGIN(p)                                        \
+  do {                                                      \
+    if (perf_enabled) gpu_timer_begin(&bp->gpu_timer, (p)); \
+  } while (0)
+#define GPU_END(p)                                        \
+  do {                                                    \
+    if (perf_enabled) gpu_timer_end(&bp->gpu_timer, (p)); \
+  } while (0)
+
+/* wot draws it */
+void glsnake_display(
+#ifndef HAVE_GLUT
+    ModeInfo *mi
+#endif
+    ) {
+#ifndef HAVE_GLUT
+  struct glsnake_cfg *bp = &glc[MI_SCREEN(mi)];
+  Display *dpy = MI_DISPLAY(mi);
+  Window window = MI_WINDOW(mi);
+
+  if (!bp->glx_context) return;
+#endif
+
+  PERF_BEGIN(PERF_DRAW);
+  TIMELINE_BEGIN("glsnake_display");
+  if (perf_enabled && !bp->gpu_timer.state) gpu_timer_init(&bp->gpu_timer);
+
+  if ((titles || hud) && !bp->glyphs_tried)
+#ifdef HAVE_GLUT
+    glyphs_init();
+#else
+    glyphs_init(mi);
+#endif
+
+  /* clear the buffer */
+  GPU_BEGIN(PERF_GPU_CLEAR);
+  glClear((GLbitfield)GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  GPU_END(PERF_GPU_CLEAR);
+
+  /* go into the modelview stack */
+  glMatrixMode(GL_MODELVIEW);
+  glLoadIdentity();
+
+  if (gallery) {
+    GPU_BEGIN(PERF_GPU_NODES);
+    draw_gallery();
+    GPU_END(PERF_GPU_NODES);
+  } else {
+    glPushMatrix();
+
+#ifdef HAVE_GLUT
+    /* apply the mouse drag rotation */
+    ui_mousedrag();
+#endif
+
+    /* apply the continuous rotation */
+    glRotatef(yspin, 0.0, 1.0, 0.0);
+    glRotatef(zspin, 0.0, 0.0, 1.0);
+
+    /* a still snake is drawn from its baked vertex array */
+    GPU_BEGIN(PERF_GPU_NODES);
+    if (software)
+      draw_software();
+    else if (!glc->morphing && !wireframe && !interactive && bake_step())
+      bake_draw();
+    else
+      draw_nodes();
+    GPU_END(PERF_GPU_NODES);
 
-  if (titles)
+    glPopMatrix();
+
+    if (titles) {
+      TIMELINE_BEGIN("draw_title");
+      GPU_BEGIN(PERF_GPU_TITLE);
+#ifdef HAVE_GLUT
+      draw_title();
+#else
+      draw_title(mi);
+#endif
+      GPU_END(PERF_GPU_TITLE);
+      TIMELINE_END("draw_title");
+    }
+  }
+
+  if (hud)
 #ifdef HAVE_GLUT
-    draw_title();
+    draw_hud();
 #else
-    draw_title(mi);
+    draw_hud(mi);
 #endif
 
 #ifndef HAVE_GLUT
@@ -2477,23 +2926,100 @@ void glsnake_display(
 #endif
 
   glFlush();
+  PERF_BEGIN(PERF_SWAP);
+  TIMELINE_BEGIN("swap");
 #ifdef HAVE_GLUT
   glutSwapBuffers();
 #else
   glXSwapBuffers(dpy, window);
+#endif
+  TIMELINE_END("swap");
+  PERF_END(PERF_SWAP);
+  TIMELINE_END("glsnake_display");
+  PERF_END(PERF_DRAW);
+  if (perf_enabled) gpu_timer_frame_end(&bp->gpu_timer);
+  perf_frame_end();
+  if (joint_log_path && *joint_log_path)
+    joint_log_frame(bp->shape.node, yspin, zspin);
+  if (shm_name && *shm_name) shm_publish();
+  if (stats_dir && *stats_dir) stats_frame(perf_now());
+  bp->frame++;
+  PROBE2(display__frame, bp->frame, bp->morphing);
+
+#ifdef HAVE_GLUT
+  /* report prints what was timed */
+  if (benchmark_frames > 0 && !--benchmark_frames) exit(0);
 #endif
 }
 
 #ifdef HAVE_GLUT
 /* anything that needs to be cleaned up goes here */
 static void unmain() {
+  int i;
+
+  if (software_raster) raster_free(software_raster);
+  gallery_forget();
+  free(atlas_cells);
+  text_font_free(&glc->glyphs);
+  text_line_free(&glc->title_line);
+  gpu_timer_free(&glc->gpu_timer);
+  for (i = 0; i < HUD_LINES; i++) text_line_free(&hud_line[i]);
   glutDestroyWindow(glc->window);
   free(glc);
 }
 
 static void ui_init(int *, char **);
 
+/* what -benchmark and -replay print when they are done */
+static void report(void) { perf_write_json(stdout); }
+
+/* Start recording or playing back, before anything reads the clock, and
+ * return the random seed. */
+static unsigned long session_open(void) {
+  unsigned long seed = (unsigned long)time(NULL);
+  int err;
+
+  if (record_path) {
+    if (record_create(record_path, seed)) {
+      perror(record_path);
+      exit(1);
+    }
+    atexit(record_close);
+  }
+  if (replay_path && (err = replay_open(replay_path, &seed))) {
+    if (err == -1)
+      perror(replay_path);
+    else
+      fprintf(stderr, "glsnake: %s isn't a recording\n", replay_path);
+    exit(1);
+  }
+  return seed;
+}
+
+/* Open the -history file, and go back to the shape it was left at. */
+static void history_start(void) {
+  struct glsnake_shape shape;
+  int err;
+
+  atexit(history_close);
+  if (!history_path) return;
+  if ((err = history_open(history_path))) {
+    if (err == -1)
+      perror(history_path);
+    else
+      fprintf(stderr, "glsnake: %s isn't an undo history\n", history_path);
+    exit(1);
+  }
+  if (history_current(&shape)) {
+    glc->preset_index = -1;
+    start_morph_shape(&shape, 0);
+    glc->next_model_s.name = "(history)";
+  }
+}
+
 int main(int argc, char **argv) {
+  unsigned long seed;
+
   glc = malloc(sizeof(struct glsnake_cfg));
   memset(glc, 0, sizeof(struct glsnake_cfg));
 
@@ -2501,15 +3027,18 @@ int main(int argc, char **argv) {
   glc->height = 480;
 
   ui_init(&argc, argv);
+  seed = session_open();
+  if (benchmark_frames > 0 || replay_path) atexit(report);
 
   gettime(&glc->last_iteration);
   memcpy(&glc->last_morph, &glc->last_iteration, sizeof(snaketime));
-  srand((unsigned int)GETSECS(glc->last_iteration));
+  srand((unsigned int)seed);
 
   glc->prev_colour = glc->next_colour =
       spooky() ? COLOUR_SPOOKY : COLOUR_ACYCLIC;
 
   glsnake_init();
+  history_start();
 
   atexit(unmain);
   glutSwapBuffers();
@@ -2577,8 +3106,8 @@ static void calc_rotation() {
 
 static void ui_mousedrag() { glMultMatrixf(rotation); }
 
-static void ui_keyboard(unsigned char c, int x ATTRIBUTE_UNUSED,
-                        int y ATTRIBUTE_UNUSED) {
+static void ui_keyboard(unsigned char c, int x, int y) {
+  record_input(RECORD_KEY, c, x, y, 0);
   switch (c) {
     case 27: /* ESC */
     case 'q':
@@ -2639,8 +3168,10 @@ static void ui_keyboard(unsigned char c, int x ATTRIBUTE_UNUSED,
       transparent = 1 - transparent;
       if (transparent) {
         glEnable(GL_BLEND);
+        glEnable(GL_CULL_FACE);
       } else {
         glDisable(GL_BLEND);
+        glDisable(GL_CULL_FACE);
       }
       break;
     case 'p':
@@ -2687,6 +3218,11 @@ static void ui_keyboard(unsigned char c, int x ATTRIBUTE_UNUSED,
         glutPositionWindow(50, 50);
       }
       break;
+    case 'h':
+      hud = 1 - hud;
+      perf_enable(hud || benchmark_frames > 0 || replay_path);
+      glutPostRedisplay();
+      break;
     case 't':
       titles = 1 - titles;
       if (interactive || glc->paused) glutPostRedisplay();
@@ -2695,31 +3231,79 @@ static void ui_keyboard(unsigned char c, int x ATTRIBUTE_UNUSED,
       altcolour = 1 - altcolour;
       break;
     case 'z':
+      if (gallery) {
+        if (gallery_columns > 1) gallery_columns--;
+        gallery_move(0.0);
+        glutPostRedisplay();
+        break;
+      }
       zoom += 1.0;
       glsnake_reshape(glc->width, glc->height);
       break;
     case 'Z':
+      if (gallery) {
+        if (gallery_columns < GALLERY_MAX_COLUMNS) gallery_columns++;
+        gallery_move(0.0);
+        glutPostRedisplay();
+        break;
+      }
       zoom -= 1.0;
       glsnake_reshape(glc->width, glc->height);
       break;
-    case 'u': {
-      int undo_idx = pop_undo_entry();
-      if (undo_idx != -1) {
-        memcpy(&glc->next_model_s.shape, &undo_ring_buffer[undo_idx],
-               sizeof(struct glsnake_shape));
-        glc->morphing = glc->new_morph = 1;
+    case 'g':
+      gallery = 1 - gallery;
+      if (!gallery) {
+        /* carry on morphing from where the snake was left */
+        gettime(&glc->last_iteration);
+        gettime(&glc->last_morph);
       }
-    } break;
+      glutPostRedisplay();
+      break;
+    case 'u':
+      history_move(history_undo);
+      break;
+    case 'U':
+      history_move(history_redo);
+      break;
+    case 'b':
+      history_move(history_branch);
+      break;
     default:
       break;
   }
 }
 
-static void ui_special(int key, int x ATTRIBUTE_UNUSED,
-                       int y ATTRIBUTE_UNUSED) {
+static void ui_special(int key, int x, int y) {
   float *destAngle = &(glc->next_model_s.shape.node[glc->selected]);
   int unknown_key = 0;
 
+  record_input(RECORD_SPECIAL, key, x, y, 0);
+
+  if (gallery) {
+    switch (key) {
+      case GLUT_KEY_UP:
+        gallery_move(-1.0);
+        break;
+      case GLUT_KEY_DOWN:
+        gallery_move(1.0);
+        break;
+      case GLUT_KEY_PAGE_UP:
+        gallery_move(-(float)glc->height * gallery_columns / glc->width);
+        break;
+      case GLUT_KEY_PAGE_DOWN:
+        gallery_move((float)glc->height * gallery_columns / glc->width);
+        break;
+      case GLUT_KEY_HOME:
+        gallery_scroll = 0.0;
+        break;
+      default:
+        unknown_key = 1;
+        break;
+    }
+    if (!unknown_key) glutPostRedisplay();
+    return;
+  }
+
   if (interactive) {
     switch (key) {
       case GLUT_KEY_UP:
@@ -2729,14 +3313,10 @@ static void ui_special(int key, int x ATTRIBUTE_UNUSED,
         glc->selected = (glc->selected + 1) % (NODE_COUNT - 1);
         break;
       case GLUT_KEY_LEFT:
-        save_snake_state();
-        *destAngle = fmod(*destAngle + (LEFT), 360);
-        glc->morphing = glc->new_morph = 1;
+        twist_joint(glc->selected, fmod(*destAngle + (LEFT), 360), 1);
         break;
       case GLUT_KEY_RIGHT:
-        save_snake_state();
-        *destAngle = fmod(*destAngle + (RIGHT), 360);
-        glc->morphing = glc->new_morph = 1;
+        twist_joint(glc->selected, fmod(*destAngle + (RIGHT), 360), 1);
         break;
       case GLUT_KEY_HOME:
         save_snake_state();
@@ -2748,12 +3328,11 @@ static void ui_special(int key, int x ATTRIBUTE_UNUSED,
     }
   }
 
-  calc_snake_metrics();
-
   if (!unknown_key) glutPostRedisplay();
 }
 
 static inline void ui_mouse(int button, int state, int x, int y) {
+  record_input(RECORD_MOUSE, button, state, x, y);
   if (button == 0) {
     switch (state) {
       case GLUT_DOWN:
@@ -2783,6 +3362,8 @@ static void ui_motion(int x, int y) {
   double norm;
   float q[4];
 
+  record_input(RECORD_MOTION, x, y, 0, 0);
+
   if (dragging) {
     /* construct the motion end vector from the x,y position on the
      * window */
@@ -2822,14 +3403,56 @@ static void ui_motion(int x, int y) {
   glutPostRedisplay();
 }
 
+static void ui_reshape(int w, int h) {
+  /* a played back session keeps to the recorded size */
+  if (replay_path) return;
+  record_input(RECORD_RESHAPE, w, h, 0, 0);
+  glsnake_reshape(w, h);
+}
+
+/* Play back the input that came before this idle tick. */
+static void replay_input(void) {
+  struct record_event e;
+  int got;
+
+  while ((got = replay_get(&e)) == 1) {
+    switch (e.type) {
+      case RECORD_IDLE:
+        return;
+      case RECORD_KEY:
+        ui_keyboard((unsigned char)e.arg[0], (int)e.arg[1], (int)e.arg[2]);
+        break;
+      case RECORD_SPECIAL:
+        ui_special((int)e.arg[0], (int)e.arg[1], (int)e.arg[2]);
+        break;
+      case RECORD_MOUSE:
+        ui_mouse((int)e.arg[0], (int)e.arg[1], (int)e.arg[2], (int)e.arg[3]);
+        break;
+      case RECORD_MOTION:
+        ui_motion((int)e.arg[0], (int)e.arg[1]);
+        break;
+      case RECORD_RESHAPE:
+        glutReshapeWindow((int)e.arg[0], (int)e.arg[1]);
+        glsnake_reshape((int)e.arg[0], (int)e.arg[1]);
+        break;
+      default:
+        /* clock readings only come from gettime */
+        replay_stop(-1);
+    }
+  }
+  replay_stop(got);
+}
+
 static void ui_init(int *argc, char **argv) {
+  int i;
+
   glutInit(argc, argv);
   glutInitDisplayMode(GLUT_RGBA | GLUT_DOUBLE | GLUT_DEPTH);
   glutInitWindowSize(glc->width, glc->height);
   glc->window = glutCreateWindow("glsnake");
 
   glutDisplayFunc(glsnake_display);
-  glutReshapeFunc(glsnake_reshape);
+  glutReshapeFunc(ui_reshape);
   glutIdleFunc(glsnake_idle);
   glutKeyboardFunc(ui_keyboard);
   glutSpecialFunc(ui_special);
@@ -2847,7 +3470,71 @@ static void ui_init(int *argc, char **argv) {
   zoom = DEF_ZOOM;
   wireframe = DEF_WIREFRAME;
   transparent = DEF_TRANSPARENT;
-  undo_ring_start = 0;
-  undo_ring_end = 0;
+  strict = DEF_STRICT;
+
+  /* glutInit has already removed the options it understands */
+  for (i = 1; i < *argc; i++) {
+    if (!strcmp(argv[i], "-stream") && i + 1 < *argc)
+      stream_path = argv[++i];
+    else if (!strcmp(argv[i], "-stream-binary"))
+      stream_binary = 1;
+    else if (!strcmp(argv[i], "-models") && i + 1 < *argc)
+      add_model_file(argv[++i]);
+    else if (!strcmp(argv[i], "-depth-sort") && i + 1 < *argc)
+      depth_sort = argv[++i];
+    else if (!strcmp(argv[i], "-software"))
+      software = 1;
+    else if (!strcmp(argv[i], "-gallery"))
+      gallery = 1;
+    else if (!strcmp(argv[i], "-atlas") && i + 1 < *argc)
+      atlas_path = argv[++i];
+    else if (!strcmp(argv[i], "-hud"))
+      hud = 1;
+    else if (!strcmp(argv[i], "-benchmark") && i + 1 < *argc)
+      benchmark_frames = atol(argv[++i]);
+    else if (!strcmp(argv[i], "-record") && i + 1 < *argc)
+      record_path = argv[++i];
+    else if (!strcmp(argv[i], "-replay") && i + 1 < *argc)
+      replay_path = argv[++i];
+    else if (!strcmp(argv[i], "-history") && i + 1 < *argc)
+      history_path = argv[++i];
+    else if (!strcmp(argv[i], "-trace") && i + 1 < *argc)
+      trace_path = argv[++i];
+    else if (!strcmp(argv[i], "-joint-log") && i + 1 < *argc)
+      joint_log_path = argv[++i];
+    else if (!strcmp(argv[i], "-control") && i + 1 < *argc)
+      control_path = argv[++i];
+    else if (!strcmp(argv[i], "-shm") && i + 1 < *argc)
+      shm_name = argv[++i];
+    else if (!strcmp(argv[i], "-stats") && i + 1 < *argc)
+      stats_dir = argv[++i];
+    else if (!strcmp(argv[i], "-strict"))
+      strict = 1;
+    else {
+      fprintf(stderr, "glsnake: unknown option %s\n", argv[i]);
+      exit(1);
+    }
+  }
+
+  if (record_path && replay_path) {
+    fprintf(stderr, "glsnake: can't both record and replay\n");
+    exit(1);
+  }
+  /* a recording has only the clock and input events in it, so nothing
+   * else may change the snake */
+  if ((record_path || replay_path) && (stream_path || control_path ||
+                                       history_path)) {
+    fprintf(stderr,
+            "glsnake: can't record or replay with -stream, -control or "
+            "-history\n");
+    exit(1);
+  }
+  /* the recording stands in for the mouse and keyboard */
+  if (replay_path) {
+    glutKeyboardFunc(NULL);
+    glutSpecialFunc(NULL);
+    glutMouseFunc(NULL);
+    glutMotionFunc(NULL);
+  }
 }
 #endif /* HAVE_GLUT */
@@ -0,0 +1,191 @@
+/* gputimer.c - timing phases of a frame on the GPU with timer queries
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* CPU timers only see how long it takes to hand commands to the driver,
+ * not how long the GPU takes over them.  GL_TIME_ELAPSED queries, from
+ * GL_ARB_timer_query (core in OpenGL 3.3) or GL_EXT_timer_query, measure
+ * the GPU.  None of the entry points are in OpenGL 1.1, so they are all
+ * looked up at run time. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#ifndef WIN32
+#include <GL/glx.h>
+#endif
+
+#include "gputimer.h"
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+#ifndef GL_QUERY_COUNTER_BITS
+#define GL_QUERY_COUNTER_BITS 0x8864
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+
+typedef void(APIENTRY *gen_queries_func)(GLsizei n, GLuint *ids);
+typedef void(APIENTRY *delete_queries_func)(GLsizei n, const GLuint *ids);
+typedef void(APIENTRY *begin_query_func)(GLenum target, GLuint id);
+typedef void(APIENTRY *end_query_func)(GLenum target);
+typedef void(APIENTRY *get_queryiv_func)(GLenum target, GLenum pname,
+                                         GLint *params);
+typedef void(APIENTRY *get_query_objectiv_func)(GLuint id, GLenum pname,
+                                                GLint *params);
+typedef void(APIENTRY *get_query_objectui64v_func)(GLuint id, GLenum pname,
+                                                   uint64_t *params);
+
+static gen_queries_func gen_queries;
+static delete_queries_func delete_queries;
+static begin_query_func begin_query;
+static end_query_func end_query;
+static get_queryiv_func get_queryiv;
+static get_query_objectiv_func get_query_objectiv;
+static get_query_objectui64v_func get_query_objectui64v;
+
+typedef void (*any_func)(void);
+
+static any_func get_proc(const char *name) {
+#ifdef WIN32
+  return (any_func)wglGetProcAddress(name);
+#else
+  return (any_func)glXGetProcAddressARB((const GLubyte *)name);
+#endif
+}
+
+/* the core name, or failing that the ARB or EXT one */
+static any_func get_proc_any(const char *name) {
+  char suffixed[64];
+  any_func f;
+
+  if ((f = get_proc(name))) return f;
+  snprintf(suffixed, sizeof(suffixed), "%sARB", name);
+  if ((f = get_proc(suffixed))) return f;
+  snprintf(suffixed, sizeof(suffixed), "%sEXT", name);
+  return get_proc(suffixed);
+}
+
+/* whether name is a whole word of the extension string */
+static int has_extension(const char *name) {
+  const char *all = (const char *)glGetString(GL_EXTENSIONS), *p;
+  size_t len = strlen(name);
+
+  for (p = all; p && (p = strstr(p, name)); p += len)
+    if ((p == all || p[-1] == ' ') && (p[len] == ' ' || p[len] == '\0'))
+      return 1;
+  return 0;
+}
+
+static const char *timer_queries_missing(void) {
+  const char *version = (const char *)glGetString(GL_VERSION);
+  int major = 0, minor = 0;
+  GLint bits = 0;
+
+  if (version) sscanf(version, "%d.%d", &major, &minor);
+  if (major * 10 + minor < 33 && !has_extension("GL_ARB_timer_query") &&
+      !has_extension("GL_EXT_timer_query"))
+    return "no GL_ARB_timer_query or GL_EXT_timer_query";
+
+  gen_queries = (gen_queries_func)get_proc_any("glGenQueries");
+  delete_queries = (delete_queries_func)get_proc_any("glDeleteQueries");
+  begin_query = (begin_query_func)get_proc_any("glBeginQuery");
+  end_query = (end_query_func)get_proc_any("glEndQuery");
+  get_queryiv = (get_queryiv_func)get_proc_any("glGetQueryiv");
+  get_query_objectiv =
+      (get_query_objectiv_func)get_proc_any("glGetQueryObjectiv");
+  get_query_objectui64v =
+      (get_query_objectui64v_func)get_proc_any("glGetQueryObjectui64v");
+  if (!gen_queries || !delete_queries || !begin_query || !end_query ||
+      !get_queryiv || !get_query_objectiv || !get_query_objectui64v)
+    return "the driver doesn't have the query functions";
+
+  /* some drivers list the extension but have no counter behind it */
+  get_queryiv(GL_TIME_ELAPSED, GL_QUERY_COUNTER_BITS, &bits);
+  if (!bits) return "GL_TIME_ELAPSED has no counter";
+  return NULL;
+}
+
+int gpu_timer_init(struct gpu_timer *timer) {
+  const char *missing = timer_queries_missing();
+
+  memset(timer, 0, sizeof(*timer));
+  timer->active = -1;
+  if (missing) {
+    fprintf(stderr, "glsnake: can't time the GPU: %s\n", missing);
+    timer->state = -1;
+    return -1;
+  }
+  gen_queries(GPU_TIMER_FRAMES * PERF_GPU_PHASES, timer->query[0]);
+  timer->state = 1;
+  return 0;
+}
+
+void gpu_timer_free(struct gpu_timer *timer) {
+  if (timer->state == 1)
+    delete_queries(GPU_TIMER_FRAMES * PERF_GPU_PHASES, timer->query[0]);
+  timer->state = 0;
+}
+
+void gpu_timer_begin(struct gpu_timer *timer, enum perf_gpu_phase phase) {
+  if (timer->state != 1 || timer->active >= 0 ||
+      timer->pending[timer->frame][phase])
+    return;
+  begin_query(GL_TIME_ELAPSED, timer->query[timer->frame][phase]);
+  timer->active = (int)phase;
+}
+
+void gpu_timer_end(struct gpu_timer *timer, enum perf_gpu_phase phase) {
+  if (timer->active != (int)phase) return;
+  end_query(GL_TIME_ELAPSED);
+  timer->pending[timer->frame][phase] = 1;
+  timer->active = -1;
+}
+
+void gpu_timer_frame_end(struct gpu_timer *timer) {
+  int i, k;
+
+  if (timer->state != 1) return;
+  for (i = 0; i < GPU_TIMER_FRAMES; i++)
+    for (k = 0; k < PERF_GPU_PHASES; k++) {
+      GLint ready = 0;
+      uint64_t ns;
+
+      if (!timer->pending[i][k]) continue;
+      get_query_objectiv(timer->query[i][k], GL_QUERY_RESULT_AVAILABLE,
+                         &ready);
+      if (!ready) continue;
+      get_query_objectui64v(timer->query[i][k], GL_QUERY_RESULT, &ns);
+      perf_gpu((enum perf_gpu_phase)k, ns / 1e6);
+      timer->pending[i][k] = 0;
+    }
+  timer->frame = (timer->frame + 1) % GPU_TIMER_FRAMES;
+}
@@ -0,0 +1,62 @@
+/* gputimer.h - timing phases of a frame on the GPU with timer queries
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_GPUTIMER_H
+#define GLSNAKE_GPUTIMER_H
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+#include <GL/gl.h>
+
+#include "perf.h"
+
+/* A query's result is only read once it is ready, which is usually a
+ * frame or two later; this many frames of queries are kept in flight so
+ * that waiting for one never stalls the pipeline. */
+#define GPU_TIMER_FRAMES 4
+
+struct gpu_timer {
+  /* 0 before gpu_timer_init, 1 if the GPU can be timed, -1 if not */
+  int state;
+  GLuint query[GPU_TIMER_FRAMES][PERF_GPU_PHASES];
+  /* queries issued but not yet read */
+  unsigned char pending[GPU_TIMER_FRAMES][PERF_GPU_PHASES];
+  int frame;
+  /* the phase being timed, or -1 */
+  int active;
+};
+
+/* Find out whether the current context has timer queries, and make a
+ * timer's queries if so; returns -1, having said why on stderr, if not. */
+int gpu_timer_init(struct gpu_timer *timer);
+void gpu_timer_free(struct gpu_timer *timer);
+
+/* Time a phase.  A phase whose query from GPU_TIMER_FRAMES frames ago
+ * still isn't ready goes untimed this frame. */
+void gpu_timer_begin(struct gpu_timer *timer, enum perf_gpu_phase phase);
+void gpu_timer_end(struct gpu_timer *timer, enum perf_gpu_phase phase);
+
+/* Pass whatever results are ready on to perf_gpu, without waiting. */
+void gpu_timer_frame_end(struct gpu_timer *timer);
+
+#endif /* GLSNAKE_GPUTIMER_H */
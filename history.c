@@ -0,0 +1,340 @@
+/* history.c - every shape the snake has been edited into, for undo and redo
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* The records are kept in one array, in the order they were made, so a
+ * shape's parent always comes before it and its children after.  A shape
+ * stored as a change of joint is found by following parents back to a
+ * whole shape, and no more than HISTORY_CHAIN are followed, as after that
+ * many a whole shape is stored again. */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "history.h"
+
+#define HISTORY_CHAIN 32
+/* records to make room for at a time, at first */
+#define HISTORY_GROW 1024
+#define HISTORY_DELTA ((uint64_t)1 << 63)
+
+/* the header followed by room for capacity records */
+static unsigned char *base;
+static unsigned long capacity;
+/* how many records there are, and the current one plus one */
+static unsigned long records, current;
+#ifndef WIN32
+/* the file base is mapped from, if any */
+static int history_fd = -1;
+#endif
+
+/* the records undone, latest last, for redo to go back down */
+static unsigned long *undone;
+static size_t undone_count, undone_alloc;
+
+static unsigned long get32(const unsigned char *p) {
+  return (unsigned long)p[0] | (unsigned long)p[1] << 8 |
+         (unsigned long)p[2] << 16 | (unsigned long)p[3] << 24;
+}
+
+static void put32(unsigned char *p, unsigned long n) {
+  p[0] = (unsigned char)n;
+  p[1] = (unsigned char)(n >> 8);
+  p[2] = (unsigned char)(n >> 16);
+  p[3] = (unsigned char)(n >> 24);
+}
+
+static unsigned char *record(unsigned long i) {
+  return base + HISTORY_HEADER + i * HISTORY_RECORD;
+}
+
+/* the parent of record i, plus one */
+static unsigned long parent(unsigned long i) { return get32(record(i)); }
+
+static uint64_t payload(unsigned long i) {
+  return packed_from_bytes(record(i) + 4);
+}
+
+static void set_current(unsigned long i) {
+  current = i;
+  put32(base + 20, current);
+}
+
+/* how many changes of joint have to be followed from record i to reach a
+ * whole shape, or HISTORY_CHAIN + 1 if more than HISTORY_CHAIN */
+static int chain(unsigned long i) {
+  int n = 0;
+
+  while (payload(i) & HISTORY_DELTA) {
+    if (++n > HISTORY_CHAIN) break;
+    i = parent(i) - 1;
+  }
+  return n;
+}
+
+static int shape_of(unsigned long i, struct glsnake_shape *shape) {
+  unsigned long delta[HISTORY_CHAIN];
+  uint64_t p;
+  int n = 0;
+
+  while ((p = payload(i)) & HISTORY_DELTA) {
+    if (n == HISTORY_CHAIN) return -1;
+    delta[n++] = i;
+    i = parent(i) - 1;
+  }
+  unpack_shape(p, shape);
+  while (n--) {
+    p = payload(delta[n]);
+    shape->node[p & 31] = (float)(((p >> 5) & 3) * 90);
+  }
+  return 0;
+}
+
+/* Make room for want records. */
+static int reserve(unsigned long want) {
+  unsigned long more = capacity ? capacity * 2 : HISTORY_GROW;
+  size_t size;
+
+  if (want <= capacity) return 0;
+  while (more < want) more *= 2;
+  size = HISTORY_HEADER + (size_t)more * HISTORY_RECORD;
+
+#ifndef WIN32
+  if (history_fd >= 0) {
+    void *map;
+
+    if (ftruncate(history_fd, (off_t)size)) return -1;
+    if (base) munmap(base, HISTORY_HEADER + (size_t)capacity * HISTORY_RECORD);
+    map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, history_fd, 0);
+    if (map == MAP_FAILED) {
+      /* there is no getting the old mapping back */
+      close(history_fd);
+      history_fd = -1;
+      base = NULL;
+      capacity = records = current = 0;
+      return -1;
+    }
+    base = map;
+    capacity = more;
+    return 0;
+  }
+#endif
+  {
+    unsigned char *grown = realloc(base, size);
+
+    if (!grown) return -1;
+    if (!base) {
+      memset(grown, 0, HISTORY_HEADER);
+      memcpy(grown, HISTORY_MAGIC, 16);
+    }
+    base = grown;
+    capacity = more;
+  }
+  return 0;
+}
+
+static int append(unsigned long parent_index, uint64_t p) {
+  static int warned;
+
+  if (reserve(records + 1)) {
+    if (!warned) perror("glsnake: can't grow the undo history");
+    warned = 1;
+    return -1;
+  }
+  put32(record(records), parent_index);
+  packed_to_bytes(p, record(records) + 4);
+  /* only count the record once it is all there */
+  put32(base + 16, ++records);
+  set_current(records);
+  undone_count = 0;
+  return 0;
+}
+
+/* Check every record refers only to those before it, so that following
+ * parents always ends. */
+static int valid(void) {
+  unsigned long i;
+
+  if (memcmp(base, HISTORY_MAGIC, 16)) return 0;
+  records = get32(base + 16);
+  current = get32(base + 20);
+  if (records > capacity || current > records) return 0;
+  for (i = 0; i < records; i++) {
+    uint64_t p = payload(i);
+
+    if (parent(i) > i) return 0;
+    if (p & HISTORY_DELTA) {
+      if (!parent(i) || (p & 31) >= NODE_COUNT || chain(i) > HISTORY_CHAIN)
+        return 0;
+    } else if (p >> (2 * NODE_COUNT)) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+int history_open(const char *path) {
+#ifdef WIN32
+  (void)path;
+  errno = ENOSYS;
+  return -1;
+#else
+  struct stat st;
+  void *map;
+
+  if ((history_fd = open(path, O_RDWR | O_CREAT, 0666)) < 0) return -1;
+  if (fstat(history_fd, &st)) {
+    history_close();
+    return -1;
+  }
+  if (!st.st_size) {
+    /* a new history */
+    if (reserve(HISTORY_GROW)) {
+      history_close();
+      return -1;
+    }
+    memcpy(base, HISTORY_MAGIC, 16);
+    return 0;
+  }
+  if (st.st_size < HISTORY_HEADER) {
+    history_close();
+    return -2;
+  }
+  map = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+             history_fd, 0);
+  if (map == MAP_FAILED) {
+    history_close();
+    return -1;
+  }
+  base = map;
+  capacity = (unsigned long)(st.st_size - HISTORY_HEADER) / HISTORY_RECORD;
+  if (!valid()) {
+    history_close();
+    return -2;
+  }
+  return 0;
+#endif
+}
+
+void history_close(void) {
+#ifndef WIN32
+  if (history_fd >= 0) {
+    if (base) munmap(base, HISTORY_HEADER + (size_t)capacity * HISTORY_RECORD);
+    close(history_fd);
+    history_fd = -1;
+    base = NULL;
+  }
+#endif
+  free(base);
+  base = NULL;
+  capacity = records = current = 0;
+  free(undone);
+  undone = NULL;
+  undone_count = undone_alloc = 0;
+}
+
+void history_save(const struct glsnake_shape *shape) {
+  struct glsnake_shape was;
+  uint64_t packed, now, diff;
+  int joint = 0;
+
+  if (pack_shape(shape, &packed)) return;
+  if (!current) {
+    append(0, packed);
+    return;
+  }
+  if (shape_of(current - 1, &was) || pack_shape(&was, &now)) return;
+  if (now == packed) return;
+
+  /* store just the joint if only one changed */
+  diff = now ^ packed;
+  while (!(diff & 3)) {
+    diff >>= 2;
+    joint++;
+  }
+  if (diff >> 2 || chain(current - 1) >= HISTORY_CHAIN)
+    append(current, packed);
+  else
+    append(current, HISTORY_DELTA | (uint64_t)joint |
+                        ((packed >> (2 * joint)) & 3) << 5);
+}
+
+static int go(unsigned long i, struct glsnake_shape *shape) {
+  if (shape_of(i - 1, shape)) return 0;
+  set_current(i);
+  return 1;
+}
+
+int history_undo(struct glsnake_shape *shape) {
+  if (!current || !parent(current - 1)) return 0;
+  if (undone_count == undone_alloc) {
+    size_t alloc = undone_alloc ? undone_alloc * 2 : 64;
+    unsigned long *grown = realloc(undone, alloc * sizeof(*undone));
+
+    /* redo will go down the newest branch instead */
+    if (grown) {
+      undone = grown;
+      undone_alloc = alloc;
+    }
+  }
+  if (undone_count < undone_alloc) undone[undone_count++] = current;
+  return go(parent(current - 1), shape);
+}
+
+int history_redo(struct glsnake_shape *shape) {
+  unsigned long i;
+
+  if (!current) return 0;
+  while (undone_count) {
+    i = undone[--undone_count];
+    if (parent(i - 1) == current) return go(i, shape);
+  }
+  for (i = records; i > current; i--)
+    if (parent(i - 1) == current) return go(i, shape);
+  return 0;
+}
+
+int history_branch(struct glsnake_shape *shape) {
+  unsigned long up, i;
+
+  if (!current || !(up = parent(current - 1))) return 0;
+  /* the next sibling made after this one, or else the first */
+  for (i = current + 1; i <= records; i++)
+    if (parent(i - 1) == up) break;
+  if (i > records)
+    for (i = up + 1; i < current; i++)
+      if (parent(i - 1) == up) break;
+  if (i == current) return 0;
+  undone_count = 0;
+  return go(i, shape);
+}
+
+int history_current(struct glsnake_shape *shape) {
+  return current && go(current, shape);
+}
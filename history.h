@@ -0,0 +1,64 @@
+/* history.h - every shape the snake has been edited into, for undo and redo
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_HISTORY_H
+#define GLSNAKE_HISTORY_H
+
+#include "shape.h"
+
+/* The history is a tree of shapes: undoing an edit and then making another
+ * starts a new branch, and the old one is kept.  Nothing is ever dropped,
+ * and each shape costs HISTORY_RECORD bytes, as it is stored as the joint
+ * that changed from its parent where that is all that changed.  Only shapes
+ * of quarter turns are kept. */
+
+/* A history file is HISTORY_HEADER bytes: the magic, the number of
+ * records and which is current, plus one, both 32 bits little-endian; then
+ * the records.  Each is its parent plus one, 32 bits, 0 for the root; then
+ * 64 bits that are either a packed shape or, with the top bit set, a joint
+ * in the bottom five bits and its quarter turns in the next two. */
+#define HISTORY_MAGIC "glsnake-history1"
+#define HISTORY_HEADER 32
+#define HISTORY_RECORD 12
+
+/* Keep the history in path, mapped into memory, so that it carries on
+ * from where the last session left it; without this it is only kept in
+ * memory.  Returns -1 with errno set if path can't be opened, or -2 if it
+ * isn't a history. */
+int history_open(const char *path);
+void history_close(void);
+
+/* Make shape the current one, as a child of the current one if it
+ * differs. */
+void history_save(const struct glsnake_shape *shape);
+
+/* Each returns 1 and the shape moved to, or 0 if there is nowhere to go.
+ * Redo goes back down the branch last undone, or else the newest; branch
+ * goes to the next of the current shape's siblings. */
+int history_undo(struct glsnake_shape *shape);
+int history_redo(struct glsnake_shape *shape);
+int history_branch(struct glsnake_shape *shape);
+
+/* Returns 1 and the current shape, or 0 if the history is empty. */
+int history_current(struct glsnake_shape *shape);
+
+#endif /* GLSNAKE_HISTORY_H */
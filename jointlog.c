@@ -0,0 +1,398 @@
+/* jointlog.c - a compact log of every frame's joint angles and spin
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* glsnake hands each frame to a ring and carries on; a thread of the log's
+ * own encodes frames from the ring into the current block, and writes the
+ * block over its place in the file every so often, so that a screensaver
+ * that is killed loses at most a second or so.  Memory is bounded by the
+ * ring and one block.  Without threads, frames are encoded as they come. */
+
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#include "jointlog.h"
+
+#define JOINT_LOG_MAGIC "glsnake-joints1\n"
+/* bytes at the start of each block before its first frame */
+#define BLOCK_HEADER 8
+/* the most a frame can take: a mask and a change in every field */
+#define FRAME_MAX (5 + JOINT_LOG_FIELDS * 5)
+/* a whole turn of spin */
+#define TURN (360 * JOINT_LOG_SCALE)
+/* frames waiting for the writer */
+#define RING 1024
+
+struct pending {
+  unsigned long frame;
+  float value[JOINT_LOG_FIELDS];
+};
+
+static FILE *log_fp;
+static unsigned long next_frame;
+
+/* the writer's block, and the frame it last encoded */
+static unsigned char block[JOINT_LOG_BLOCK];
+static long block_index = -1;
+static unsigned long block_first, block_frames, block_used;
+static long last[JOINT_LOG_FIELDS];
+
+#ifdef HAVE_PTHREAD
+static struct pending ring[RING], batch[RING];
+static unsigned long ring_head, ring_tail;
+static int closing;
+static pthread_t writer;
+static pthread_mutex_t ring_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ring_filling = PTHREAD_COND_INITIALIZER;
+#endif
+
+static long quantise(float degrees) {
+  double q = degrees * JOINT_LOG_SCALE;
+
+  return (long)(q < 0.0 ? q - 0.5 : q + 0.5);
+}
+
+static long quantise_spin(float degrees) {
+  long q = quantise((float)fmod(degrees, 360.0));
+
+  if (q < 0) q += TURN;
+  return q >= TURN ? q - TURN : q;
+}
+
+static unsigned char *put_unsigned(unsigned char *p, unsigned long n) {
+  while (n >= 0x80) {
+    *p++ = (unsigned char)((n & 0x7f) | 0x80);
+    n >>= 7;
+  }
+  *p++ = (unsigned char)n;
+  return p;
+}
+
+static unsigned char *put_signed(unsigned char *p, long n) {
+  return put_unsigned(p, n < 0 ? ((unsigned long)~n << 1) | 1
+                               : (unsigned long)n << 1);
+}
+
+static void put_le(unsigned char *p, unsigned long n, int bytes) {
+  while (bytes--) {
+    *p++ = (unsigned char)(n & 0xff);
+    n >>= 8;
+  }
+}
+
+static void write_block(void) {
+  if (block_index < 0) return;
+  put_le(block, block_first, 4);
+  put_le(block + 4, block_frames, 2);
+  put_le(block + 6, block_used, 2);
+  memset(block + block_used, 0, JOINT_LOG_BLOCK - block_used);
+  fseek(log_fp, JOINT_LOG_HEADER + block_index * (long)JOINT_LOG_BLOCK,
+        SEEK_SET);
+  fwrite(block, JOINT_LOG_BLOCK, 1, log_fp);
+  fflush(log_fp);
+}
+
+static void encode(const struct pending *f) {
+  long q[JOINT_LOG_FIELDS];
+  unsigned char *p;
+  int i;
+
+  for (i = 0; i < JOINT_LOG_JOINTS; i++) q[i] = quantise(f->value[i]);
+  for (; i < JOINT_LOG_FIELDS; i++) q[i] = quantise_spin(f->value[i]);
+
+  if (block_index < 0 || f->frame != block_first + block_frames ||
+      block_used + FRAME_MAX > JOINT_LOG_BLOCK || block_frames == 0xffff) {
+    /* a new block, starting with the whole frame */
+    write_block();
+    block_index++;
+    block_first = f->frame;
+    block_frames = 1;
+    p = block + BLOCK_HEADER;
+    for (i = 0; i < JOINT_LOG_FIELDS; i++) p = put_signed(p, q[i]);
+  } else {
+    unsigned long mask = 0;
+
+    for (i = 0; i < JOINT_LOG_FIELDS; i++)
+      if (q[i] != last[i]) mask |= 1UL << i;
+    p = put_unsigned(block + block_used, mask);
+    for (i = 0; i < JOINT_LOG_FIELDS; i++) {
+      long d = q[i] - last[i];
+
+      if (!(mask & (1UL << i))) continue;
+      /* spins go the short way round */
+      if (i >= JOINT_LOG_JOINTS) {
+        if (d >= TURN / 2) d -= TURN;
+        if (d < -TURN / 2) d += TURN;
+      }
+      p = put_signed(p, d);
+    }
+    block_frames++;
+  }
+  block_used = (unsigned long)(p - block);
+  memcpy(last, q, sizeof(last));
+}
+
+#ifdef HAVE_PTHREAD
+static void *joint_log_writer(void *arg) {
+  int done;
+
+  (void)arg;
+  do {
+    unsigned long count, i;
+    struct timespec until;
+
+    pthread_mutex_lock(&ring_lock);
+    /* wake when the ring is half full, or once a second */
+    clock_gettime(CLOCK_REALTIME, &until);
+    until.tv_sec++;
+    while (!closing && ring_head - ring_tail < RING / 2)
+      if (pthread_cond_timedwait(&ring_filling, &ring_lock, &until) ==
+          ETIMEDOUT)
+        break;
+    for (count = 0; ring_tail != ring_head; ring_tail++)
+      batch[count++] = ring[ring_tail % RING];
+    done = closing;
+    pthread_mutex_unlock(&ring_lock);
+
+    for (i = 0; i < count; i++) encode(&batch[i]);
+    if (count) write_block();
+  } while (!done);
+  return NULL;
+}
+#endif
+
+int joint_log_open(const char *path) {
+  if (!(log_fp = fopen(path, "wb"))) return -1;
+  fwrite(JOINT_LOG_MAGIC, JOINT_LOG_HEADER, 1, log_fp);
+#ifdef HAVE_PTHREAD
+  if ((errno = pthread_create(&writer, NULL, joint_log_writer, NULL))) {
+    fclose(log_fp);
+    log_fp = NULL;
+    return -1;
+  }
+#endif
+  return 0;
+}
+
+void joint_log_frame(const float *joints, float yspin, float zspin) {
+  struct pending *f;
+#ifndef HAVE_PTHREAD
+  struct pending now;
+#endif
+
+  if (!log_fp) return;
+#ifdef HAVE_PTHREAD
+  pthread_mutex_lock(&ring_lock);
+  if (ring_head - ring_tail == RING) {
+    /* dropped; the gap starts a new block */
+    pthread_mutex_unlock(&ring_lock);
+    next_frame++;
+    return;
+  }
+  f = &ring[ring_head % RING];
+#else
+  f = &now;
+#endif
+  f->frame = next_frame++;
+  memcpy(f->value, joints, JOINT_LOG_JOINTS * sizeof(float));
+  f->value[JOINT_LOG_JOINTS] = yspin;
+  f->value[JOINT_LOG_JOINTS + 1] = zspin;
+#ifdef HAVE_PTHREAD
+  if (++ring_head - ring_tail == RING / 2)
+    pthread_cond_signal(&ring_filling);
+  pthread_mutex_unlock(&ring_lock);
+#else
+  encode(f);
+#endif
+}
+
+void joint_log_close(void) {
+  if (!log_fp) return;
+#ifdef HAVE_PTHREAD
+  pthread_mutex_lock(&ring_lock);
+  closing = 1;
+  pthread_cond_signal(&ring_filling);
+  pthread_mutex_unlock(&ring_lock);
+  pthread_join(writer, NULL);
+#else
+  write_block();
+#endif
+  fclose(log_fp);
+  log_fp = NULL;
+}
+
+static unsigned long get_le(const unsigned char *p, int bytes) {
+  unsigned long n = 0;
+
+  while (bytes--) n = n << 8 | p[bytes];
+  return n;
+}
+
+/* These return NULL if the number runs past end. */
+static const unsigned char *get_unsigned(const unsigned char *p,
+                                         const unsigned char *end,
+                                         unsigned long *n) {
+  int shift = 0;
+
+  *n = 0;
+  do {
+    if (p >= end || shift >= (int)sizeof(*n) * 8) return NULL;
+    *n |= (unsigned long)(*p & 0x7f) << shift;
+    shift += 7;
+  } while (*p++ & 0x80);
+  return p;
+}
+
+static const unsigned char *get_signed(const unsigned char *p,
+                                       const unsigned char *end, long *n) {
+  unsigned long u;
+
+  if (!(p = get_unsigned(p, end, &u))) return NULL;
+  *n = u & 1 ? (long)~(u >> 1) : (long)(u >> 1);
+  return p;
+}
+
+static int read_block(struct joint_log_reader *reader, long index) {
+  if (reader->block == index) return 0;
+  reader->decoded = 0;
+  if (fseek(reader->fp, JOINT_LOG_HEADER + index * (long)JOINT_LOG_BLOCK,
+            SEEK_SET) ||
+      fread(reader->data, JOINT_LOG_BLOCK, 1, reader->fp) != 1) {
+    reader->block = -1;
+    return -1;
+  }
+  reader->block = index;
+  return 0;
+}
+
+int joint_log_read_open(struct joint_log_reader *reader, const char *path) {
+  char magic[JOINT_LOG_HEADER];
+  long size;
+
+  reader->block = -1;
+  reader->decoded = 0;
+  if (!(reader->fp = fopen(path, "rb"))) return -1;
+  if (fread(magic, sizeof(magic), 1, reader->fp) != 1 ||
+      memcmp(magic, JOINT_LOG_MAGIC, sizeof(magic)) ||
+      fseek(reader->fp, 0, SEEK_END) || (size = ftell(reader->fp)) < 0) {
+    joint_log_read_close(reader);
+    return -2;
+  }
+  reader->blocks = (size - JOINT_LOG_HEADER) / JOINT_LOG_BLOCK;
+  return 0;
+}
+
+int joint_log_read_block(struct joint_log_reader *reader, long index,
+                         unsigned long *first, unsigned long *frames) {
+  if (index < 0 || index >= reader->blocks || read_block(reader, index))
+    return -1;
+  *first = get_le(reader->data, 4);
+  *frames = get_le(reader->data + 4, 2);
+  return 0;
+}
+
+int joint_log_read_range(struct joint_log_reader *reader,
+                         unsigned long *first, unsigned long *end) {
+  unsigned long frames;
+
+  if (joint_log_read_block(reader, 0, first, &frames) ||
+      joint_log_read_block(reader, reader->blocks - 1, end, &frames))
+    return -1;
+  *end += frames;
+  return 0;
+}
+
+/* Find the block holding frame, and decode up to it. */
+static int decode_to(struct joint_log_reader *reader, unsigned long frame) {
+  unsigned long first, frames;
+  const unsigned char *p, *end;
+  long lo = 0, hi = reader->blocks - 1;
+  int i;
+
+  if (!reader->decoded || frame < reader->frame ||
+      frame - get_le(reader->data, 4) >= get_le(reader->data + 4, 2)) {
+    /* the last block starting at or before frame */
+    while (lo < hi) {
+      long mid = lo + (hi - lo + 1) / 2;
+
+      if (joint_log_read_block(reader, mid, &first, &frames)) return -1;
+      if (first <= frame)
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
+    if (joint_log_read_block(reader, lo, &first, &frames) || frame < first ||
+        frame - first >= frames)
+      return -1;
+
+    end = reader->data + get_le(reader->data + 6, 2);
+    p = reader->data + BLOCK_HEADER;
+    for (i = 0; i < JOINT_LOG_FIELDS && p; i++)
+      p = get_signed(p, end, &reader->value[i]);
+    if (!p) return -1;
+    reader->frame = first;
+    reader->offset = (size_t)(p - reader->data);
+    reader->decoded = 1;
+  }
+
+  end = reader->data + get_le(reader->data + 6, 2);
+  p = reader->data + reader->offset;
+  while (reader->frame < frame) {
+    unsigned long mask;
+
+    if (!(p = get_unsigned(p, end, &mask))) return -1;
+    for (i = 0; i < JOINT_LOG_FIELDS; i++) {
+      long *q = &reader->value[i], d;
+
+      if (!(mask & (1UL << i))) continue;
+      if (!(p = get_signed(p, end, &d))) return -1;
+      *q += d;
+      if (i >= JOINT_LOG_JOINTS) *q = (*q % TURN + TURN) % TURN;
+    }
+    reader->frame++;
+    reader->offset = (size_t)(p - reader->data);
+  }
+  return 0;
+}
+
+int joint_log_read_frame(struct joint_log_reader *reader, unsigned long frame,
+                         float value[JOINT_LOG_FIELDS]) {
+  int i;
+
+  if (decode_to(reader, frame)) {
+    reader->decoded = 0;
+    return -1;
+  }
+  for (i = 0; i < JOINT_LOG_FIELDS; i++)
+    value[i] = (float)reader->value[i] / JOINT_LOG_SCALE;
+  return 0;
+}
+
+void joint_log_read_close(struct joint_log_reader *reader) {
+  if (reader->fp) fclose(reader->fp);
+  reader->fp = NULL;
+}
@@ -0,0 +1,90 @@
+/* jointlog.h - a compact log of every frame's joint angles and spin
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_JOINTLOG_H
+#define GLSNAKE_JOINTLOG_H
+
+#include <stdio.h>
+
+#include "shape.h"
+
+/* Each frame logs every joint and the two spin angles, in hundredths of a
+ * degree.
+ *
+ * The file is a JOINT_LOG_HEADER byte header followed by blocks of exactly
+ * JOINT_LOG_BLOCK bytes.  A block starts with the number of its first frame
+ * (four bytes, little endian), how many frames it holds and how many of its
+ * bytes are used (two bytes each).  The first frame follows in full, as
+ * variable length zigzagged integers; each later frame is a variable length
+ * mask of the fields that changed followed by the change in each.  Spins
+ * are kept within a turn, and change by the shortest way round.  A gap in
+ * the frame numbers, where the writer fell behind, starts a new block.
+ *
+ * As blocks are all the same size and in order, a reader finds any frame
+ * with a binary search over their headers, then decodes at most one block
+ * of frames. */
+
+#define JOINT_LOG_JOINTS (NODE_COUNT - 1)
+/* the joints, then the spins about y and z */
+#define JOINT_LOG_FIELDS (JOINT_LOG_JOINTS + 2)
+#define JOINT_LOG_SCALE 100
+#define JOINT_LOG_HEADER 16
+#define JOINT_LOG_BLOCK 16384
+
+/* Start logging to path, from a thread of its own; returns -1 with errno
+ * set on failure. */
+int joint_log_open(const char *path);
+/* Log a frame.  This never waits for the disk: if the writer has fallen
+ * too far behind, the frame is dropped. */
+void joint_log_frame(const float *joints, float yspin, float zspin);
+/* Write out everything logged so far and stop. */
+void joint_log_close(void);
+
+struct joint_log_reader {
+  FILE *fp;
+  long blocks;
+  /* the block last read */
+  long block;
+  unsigned char data[JOINT_LOG_BLOCK];
+  /* the frame of it last decoded, so that reading frames in order decodes
+   * each only once */
+  int decoded;
+  unsigned long frame;
+  long value[JOINT_LOG_FIELDS];
+  size_t offset;
+};
+
+/* Returns -1 with errno set if path can't be read, or -2 if it isn't a
+ * joint log. */
+int joint_log_read_open(struct joint_log_reader *reader, const char *path);
+/* The first frame logged and one past the last; returns -1 if nothing was. */
+int joint_log_read_range(struct joint_log_reader *reader,
+                         unsigned long *first, unsigned long *end);
+/* The first frame in a block and how many it holds. */
+int joint_log_read_block(struct joint_log_reader *reader, long index,
+                         unsigned long *first, unsigned long *frames);
+/* Reconstruct a frame's fields in degrees; returns -1 if it wasn't logged. */
+int joint_log_read_frame(struct joint_log_reader *reader, unsigned long frame,
+                         float value[JOINT_LOG_FIELDS]);
+void joint_log_read_close(struct joint_log_reader *reader);
+
+#endif /* GLSNAKE_JOINTLOG_H */
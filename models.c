@@ -0,0 +1,4509 @@
+/* models.c - the built in models, and what is known about each of them
+ *
+ * Generated from data/models.glsnake by glsnake-convert -f c; edit that
+ * instead. */
+
+#include "models.h"
+
+/* where each model is in builtin_model */
+enum {
+  BUILTIN_0,
+  BUILTIN_1,
+  BUILTIN_2,
+  BUILTIN_3,
+  BUILTIN_4,
+  BUILTIN_5,
+  BUILTIN_6,
+  BUILTIN_7,
+  BUILTIN_8,
+  BUILTIN_9,
+  BUILTIN_10,
+  BUILTIN_11,
+  BUILTIN_12,
+  BUILTIN_13,
+  BUILTIN_14,
+  BUILTIN_15,
+  BUILTIN_16,
+  BUILTIN_17,
+  BUILTIN_18,
+  BUILTIN_19,
+  BUILTIN_20,
+  BUILTIN_21,
+  BUILTIN_22,
+  BUILTIN_23,
+  BUILTIN_24,
+  BUILTIN_25,
+  BUILTIN_26,
+  BUILTIN_27,
+  BUILTIN_28,
+  BUILTIN_29,
+  BUILTIN_30,
+  BUILTIN_31,
+  BUILTIN_32,
+  BUILTIN_33,
+  BUILTIN_34,
+  BUILTIN_35,
+  BUILTIN_36,
+  BUILTIN_37,
+  BUILTIN_38,
+  BUILTIN_39,
+  BUILTIN_40,
+  BUILTIN_41,
+  BUILTIN_42,
+  BUILTIN_43,
+  BUILTIN_44,
+  BUILTIN_45,
+  BUILTIN_46,
+  BUILTIN_47,
+  BUILTIN_48,
+  BUILTIN_49,
+#ifndef WIN32
+  BUILTIN_50,
+#endif
+  BUILTIN_51,
+  BUILTIN_52,
+  BUILTIN_53,
+  BUILTIN_54,
+  BUILTIN_55,
+#ifndef WIN32
+  BUILTIN_56,
+  BUILTIN_57,
+  BUILTIN_58,
+#endif
+  BUILTIN_59,
+  BUILTIN_60,
+  BUILTIN_61,
+  BUILTIN_62,
+  BUILTIN_63,
+  BUILTIN_64,
+  BUILTIN_65,
+  BUILTIN_66,
+  BUILTIN_67,
+  BUILTIN_68,
+  BUILTIN_69,
+  BUILTIN_70,
+  BUILTIN_71,
+  BUILTIN_72,
+  BUILTIN_73,
+  BUILTIN_74,
+  BUILTIN_75,
+  BUILTIN_76,
+  BUILTIN_77,
+  BUILTIN_78,
+  BUILTIN_79,
+  BUILTIN_80,
+  BUILTIN_81,
+  BUILTIN_82,
+  BUILTIN_83,
+  BUILTIN_84,
+  BUILTIN_85,
+  BUILTIN_86,
+  BUILTIN_87,
+  BUILTIN_88,
+  BUILTIN_89,
+  BUILTIN_90,
+  BUILTIN_91,
+  BUILTIN_92,
+  BUILTIN_93,
+  BUILTIN_94,
+  BUILTIN_95,
+  BUILTIN_96,
+  BUILTIN_97,
+  BUILTIN_98,
+  BUILTIN_99,
+  BUILTIN_100,
+  BUILTIN_101,
+  BUILTIN_102,
+  BUILTIN_103,
+  BUILTIN_104,
+  BUILTIN_105,
+  BUILTIN_106,
+  BUILTIN_107,
+  BUILTIN_108,
+  BUILTIN_109,
+  BUILTIN_110,
+  BUILTIN_111,
+  BUILTIN_112,
+  BUILTIN_113,
+  BUILTIN_114,
+  BUILTIN_115,
+  BUILTIN_116,
+  BUILTIN_117,
+  BUILTIN_118,
+  BUILTIN_119,
+  BUILTIN_120,
+  BUILTIN_121,
+  BUILTIN_122,
+  BUILTIN_123,
+  BUILTIN_124,
+  BUILTIN_125,
+  BUILTIN_126,
+  BUILTIN_127,
+  BUILTIN_128,
+  BUILTIN_129,
+  BUILTIN_130,
+  BUILTIN_131,
+  BUILTIN_132,
+  BUILTIN_133,
+  BUILTIN_134,
+  BUILTIN_135,
+  BUILTIN_136,
+  BUILTIN_137,
+  BUILTIN_138,
+  BUILTIN_139,
+  BUILTIN_140,
+  BUILTIN_141,
+  BUILTIN_142,
+  BUILTIN_143,
+  BUILTIN_144,
+  BUILTIN_145,
+  BUILTIN_146,
+  BUILTIN_147,
+  BUILTIN_148,
+  BUILTIN_149,
+  BUILTIN_150,
+  BUILTIN_151,
+  BUILTIN_152,
+  BUILTIN_153,
+  BUILTIN_154,
+  BUILTIN_155,
+  BUILTIN_156,
+  BUILTIN_157,
+  BUILTIN_158,
+  BUILTIN_159,
+  BUILTIN_160,
+  BUILTIN_161,
+  BUILTIN_162,
+  BUILTIN_163,
+  BUILTIN_164,
+  BUILTIN_165,
+  BUILTIN_166,
+  BUILTIN_167,
+  BUILTIN_168,
+  BUILTIN_169,
+  BUILTIN_170,
+  BUILTIN_171,
+  BUILTIN_172,
+  BUILTIN_173,
+  BUILTIN_174,
+  BUILTIN_175,
+  BUILTIN_176,
+  BUILTIN_177,
+  BUILTIN_178,
+  BUILTIN_179,
+  BUILTIN_180,
+  BUILTIN_181,
+  BUILTIN_182,
+#ifndef WIN32
+  BUILTIN_183,
+#endif
+  BUILTIN_184,
+  BUILTIN_185,
+  BUILTIN_186,
+  BUILTIN_187,
+  BUILTIN_188,
+  BUILTIN_189,
+  BUILTIN_190,
+  BUILTIN_191,
+  BUILTIN_192,
+  BUILTIN_193,
+  BUILTIN_194,
+  BUILTIN_195,
+  BUILTIN_196,
+  BUILTIN_197,
+  BUILTIN_198,
+  BUILTIN_199,
+  BUILTIN_200,
+  BUILTIN_201,
+  BUILTIN_202,
+  BUILTIN_203,
+  BUILTIN_204,
+  BUILTIN_205,
+  BUILTIN_206,
+  BUILTIN_207,
+  BUILTIN_208,
+  BUILTIN_209,
+  BUILTIN_210,
+  BUILTIN_211,
+  BUILTIN_212,
+  BUILTIN_213,
+  BUILTIN_214,
+  BUILTIN_215,
+  BUILTIN_216,
+  BUILTIN_217,
+  BUILTIN_218,
+  BUILTIN_219,
+  BUILTIN_220,
+  BUILTIN_221,
+  BUILTIN_222,
+  BUILTIN_223,
+  BUILTIN_224,
+  BUILTIN_225,
+  BUILTIN_226,
+  BUILTIN_227,
+  BUILTIN_228,
+  BUILTIN_229,
+  BUILTIN_230,
+  BUILTIN_231,
+  BUILTIN_232,
+  BUILTIN_233,
+  BUILTIN_234,
+  BUILTIN_235,
+  BUILTIN_236,
+  BUILTIN_237,
+  BUILTIN_238,
+  BUILTIN_239,
+  BUILTIN_240,
+  BUILTIN_241,
+  BUILTIN_242,
+  BUILTIN_243,
+  BUILTIN_244,
+  BUILTIN_245,
+  BUILTIN_246,
+  BUILTIN_247,
+  BUILTIN_248,
+  BUILTIN_249,
+  BUILTIN_250,
+  BUILTIN_251,
+  BUILTIN_252,
+  BUILTIN_253,
+  BUILTIN_254,
+  BUILTIN_255,
+  BUILTIN_256,
+  BUILTIN_257,
+  BUILTIN_258,
+  BUILTIN_259,
+  BUILTIN_260,
+  BUILTIN_261,
+  BUILTIN_262,
+  BUILTIN_263,
+  BUILTIN_264,
+  BUILTIN_265,
+  BUILTIN_266,
+  BUILTIN_267,
+  BUILTIN_268,
+  BUILTIN_269,
+  BUILTIN_270,
+  BUILTIN_MODELS
+};
+
+struct model_s builtin_model[] = {
+    {"straight",
+     {{ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO,
+       ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO,
+       ZERO}}},
+    {"ball",
+     {{RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
+       LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT,
+       LEFT, ZERO}}},
+    {"snow",
+     {{RIGHT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT,
+       RIGHT, LEFT, LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, RIGHT, LEFT, LEFT,
+       LEFT, ZERO}}},
+    {"propellor",
+     {{ZERO, ZERO, ZERO, RIGHT, LEFT, RIGHT, ZERO, LEFT, ZERO, ZERO, ZERO,
+       RIGHT, LEFT, RIGHT, ZERO, LEFT, ZERO, ZERO, ZERO, RIGHT, LEFT, RIGHT,
+       ZERO, LEFT}}},
+    {"flamingo",
+     {{ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, RIGHT, RIGHT, PIN, RIGHT,
+       LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, RIGHT, ZERO, ZERO, ZERO, PIN,
+       ZERO}}},
+    {"cat",
+     {{ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, PIN,
+       PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO}}},
+    {"rooster",
+     {{ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, LEFT, RIGHT, PIN, RIGHT, ZERO,
+       PIN, PIN, ZERO, RIGHT, PIN, RIGHT, LEFT, ZERO, LEFT, ZERO, PIN, ZERO}}},
+    {"half balls",
+     {{LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT,
+       LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT,
+       LEFT, ZERO}}},
+    {"zigzag1",
+     {{RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT,
+       LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, LEFT,
+       LEFT, ZERO}}},
+    {"zigzag2",
+     {{PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN,
+       ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO}}},
+    {"zigzag3",
+     {{PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN,
+       LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN, ZERO}}},
+    {"caterpillar",
+     {{RIGHT, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, LEFT, PIN,
+       RIGHT, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, LEFT,
+       ZERO}}},
+    {"bow",
+     {{RIGHT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT,
+       RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, RIGHT, LEFT,
+       LEFT, ZERO}}},
+    {"turtle",
+     {{ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, LEFT,
+       RIGHT, LEFT, LEFT, PIN, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT,
+       RIGHT, ZERO}}},
+    {"basket",
+     {{RIGHT, PIN, ZERO, ZERO, PIN, LEFT, ZERO, LEFT, LEFT, ZERO, LEFT, PIN,
+       ZERO, ZERO, PIN, RIGHT, PIN, LEFT, PIN, ZERO, ZERO, PIN, LEFT, ZERO}}},
+    {"thing",
+     {{PIN, RIGHT, LEFT, RIGHT, RIGHT, LEFT, PIN, LEFT, RIGHT, LEFT, LEFT,
+       RIGHT, PIN, RIGHT, LEFT, RIGHT, RIGHT, LEFT, PIN, LEFT, RIGHT, LEFT,
+       LEFT, ZERO}}},
+    {"hexagon",
+     {{ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO,
+       LEFT, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO,
+       RIGHT}}},
+    {"tri1",
+     {{ZERO, ZERO, LEFT, RIGHT, ZERO, LEFT, ZERO, RIGHT, ZERO, ZERO, LEFT,
+       RIGHT, ZERO, LEFT, ZERO, RIGHT, ZERO, ZERO, LEFT, RIGHT, ZERO, LEFT,
+       ZERO, RIGHT}}},
+    {"triangle",
+     {{ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO, ZERO, ZERO,
+       ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, LEFT,
+       RIGHT}}},
+    {"flower",
+     {{ZERO, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT, PIN,
+       ZERO, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT,
+       PIN}}},
+    {"crucifix",
+     {{ZERO, PIN, PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, PIN, PIN,
+       ZERO, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, PIN}}},
+    {"kayak",
+     {{PIN, RIGHT, LEFT, PIN, LEFT, PIN, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO,
+       ZERO, ZERO, ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, PIN,
+       RIGHT}}},
+    {"bird",
+     {{ZERO, ZERO, ZERO, ZERO, RIGHT, RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO,
+       RIGHT, ZERO, RIGHT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, LEFT, ZERO, PIN,
+       ZERO}}},
+    {"seal",
+     {{RIGHT, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, PIN, PIN, ZERO, LEFT, ZERO,
+       LEFT, PIN, RIGHT, ZERO, LEFT, LEFT, LEFT, PIN, RIGHT, RIGHT, LEFT,
+       ZERO}}},
+    {"dog",
+     {{ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO, PIN,
+       PIN, ZERO, ZERO, ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO}}},
+    {"frog",
+     {{RIGHT, RIGHT, LEFT, LEFT, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, RIGHT, ZERO,
+       LEFT, ZERO, LEFT, PIN, RIGHT, ZERO, LEFT, LEFT, RIGHT, LEFT, LEFT,
+       ZERO}}},
+    {"quavers",
+     {{LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, ZERO, ZERO, ZERO, RIGHT, ZERO,
+       ZERO, LEFT, RIGHT, ZERO, ZERO, ZERO, LEFT, LEFT, RIGHT, LEFT, RIGHT,
+       RIGHT, ZERO}}},
+    {"fly",
+     {{LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, ZERO, PIN, ZERO, ZERO, LEFT, PIN,
+       RIGHT, ZERO, ZERO, PIN, ZERO, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT,
+       ZERO}}},
+    {"puppy",
+     {{ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, RIGHT,
+       RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, ZERO,
+       ZERO}}},
+    {"stars",
+     {{LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO, ZERO,
+       ZERO, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT,
+       ZERO}}},
+    {"mountains",
+     {{RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN,
+       RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, LEFT, PIN}}},
+    {"quad1",
+     {{RIGHT, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT, LEFT, LEFT, PIN, LEFT, PIN,
+       RIGHT, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT, LEFT, LEFT, PIN, LEFT,
+       PIN}}},
+    {"quad2",
+     {{ZERO, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT, LEFT, LEFT, PIN, ZERO, PIN,
+       ZERO, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT, LEFT, LEFT, PIN, ZERO, PIN}}},
+    {"glasses",
+     {{ZERO, PIN, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, PIN, ZERO, PIN,
+       ZERO, PIN, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, PIN, ZERO, PIN}}},
+    {"em",
+     {{ZERO, PIN, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, PIN, ZERO, PIN,
+       ZERO, PIN, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, PIN, ZERO, PIN}}},
+    {"quad3",
+     {{ZERO, RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, LEFT, ZERO, PIN,
+       ZERO, RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, LEFT, ZERO,
+       PIN}}},
+    {"vee",
+     {{ZERO, ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, ZERO, ZERO, PIN,
+       ZERO, ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, ZERO, ZERO, PIN}}},
+    {"square",
+     {{ZERO, ZERO, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, ZERO, ZERO, PIN,
+       ZERO, ZERO, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, ZERO, ZERO,
+       PIN}}},
+    {"eagle",
+     {{RIGHT, ZERO, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, ZERO, LEFT, PIN,
+       RIGHT, ZERO, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, ZERO, ZERO, LEFT,
+       PIN}}},
+    {"volcano",
+     {{RIGHT, ZERO, LEFT, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT, ZERO, LEFT, PIN,
+       RIGHT, ZERO, LEFT, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT, ZERO, LEFT,
+       PIN}}},
+    {"saddle",
+     {{RIGHT, ZERO, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, ZERO, LEFT, PIN,
+       RIGHT, ZERO, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, ZERO, LEFT,
+       PIN}}},
+    {"c3d",
+     {{ZERO, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, LEFT, ZERO, ZERO, PIN,
+       ZERO, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, LEFT, ZERO, ZERO, PIN}}},
+    {"block",
+     {{ZERO, ZERO, PIN, PIN, ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT,
+       PIN, LEFT, PIN, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, LEFT, PIN, RIGHT}}},
+    {"duck",
+     {{LEFT, PIN, LEFT, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, LEFT, PIN, RIGHT,
+       ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, LEFT, PIN, LEFT, ZERO}}},
+    {"prayer",
+     {{RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, ZERO, ZERO, ZERO, RIGHT,
+       PIN, LEFT, ZERO, ZERO, ZERO, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT,
+       PIN}}},
+    {"giraffe",
+     {{ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, ZERO, RIGHT, RIGHT,
+       RIGHT, PIN, LEFT, RIGHT, ZERO, PIN, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT,
+       LEFT}}},
+    {"tie fighter",
+     {{PIN, LEFT, RIGHT, LEFT, LEFT, PIN, RIGHT, ZERO, RIGHT, LEFT, ZERO, PIN,
+       LEFT, LEFT, RIGHT, RIGHT, RIGHT, PIN, LEFT, ZERO, LEFT, RIGHT, ZERO,
+       ZERO}}},
+    {"Strong Arms",
+     {{PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO, RIGHT, ZERO, RIGHT, RIGHT, PIN,
+       RIGHT, RIGHT, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, PIN, PIN,
+       ZERO}}},
+    {"cool looking gegl",
+     {{PIN, PIN, ZERO, ZERO, RIGHT, ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO,
+       ZERO, PIN, ZERO, PIN, PIN, ZERO, LEFT, RIGHT, PIN, ZERO, ZERO, ZERO}}},
+    {"knuckledusters",
+     {{ZERO, ZERO, ZERO, ZERO, PIN, RIGHT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO,
+       RIGHT, RIGHT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, RIGHT, ZERO}}},
+#ifndef WIN32
+    {"k's turd",
+     {{RIGHT, RIGHT, PIN, RIGHT, LEFT, RIGHT, PIN, RIGHT, LEFT, RIGHT, PIN,
+       RIGHT, LEFT, RIGHT, PIN, RIGHT, LEFT, RIGHT, PIN, RIGHT, LEFT, RIGHT,
+       PIN, ZERO}}},
+#endif
+    {"lightsabre",
+     {{ZERO, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO,
+       ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO,
+       ZERO}}},
+    {"not a stairway",
+     {{LEFT, ZERO, RIGHT, LEFT, RIGHT, ZERO, LEFT, RIGHT, LEFT, ZERO, RIGHT,
+       LEFT, RIGHT, ZERO, LEFT, RIGHT, LEFT, ZERO, RIGHT, LEFT, RIGHT, ZERO,
+       LEFT, ZERO}}},
+    {"not very good (but accurate) gegl",
+     {{ZERO, PIN, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, PIN, PIN,
+       ZERO, RIGHT, LEFT, ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO}}},
+    {"box",
+     {{ZERO, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, PIN,
+       ZERO, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO}}},
+    {"kissy box",
+     {{PIN, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, PIN,
+       ZERO, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, ZERO}}},
+#ifndef WIN32
+    {"erect penis",
+     {{PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO,
+       ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO}}},
+    {"flaccid penis",
+     {{PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO,
+       ZERO, ZERO, RIGHT, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO}}},
+    {"vagina",
+     {{RIGHT, ZERO, ZERO, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, LEFT, ZERO,
+       ZERO, ZERO, LEFT, ZERO, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, ZERO}}},
+#endif
+    {"mask",
+     {{ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, ZERO, PIN, ZERO, ZERO,
+       PIN, ZERO, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO}}},
+    {"poles or columns or something",
+     {{LEFT, RIGHT, LEFT, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, LEFT,
+       RIGHT, LEFT, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, LEFT, ZERO}}},
+    {"crooked v",
+     {{ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, LEFT,
+       ZERO, LEFT, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO}}},
+    {"dog leg",
+     {{ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, LEFT,
+       ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO}}},
+    {"scrubby",
+     {{ZERO, ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, LEFT, RIGHT,
+       ZERO, ZERO, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO, LEFT, PIN, ZERO,
+       ZERO}}},
+    {"voltron's eyes",
+     {{ZERO, ZERO, PIN, RIGHT, ZERO, LEFT, ZERO, ZERO, RIGHT, ZERO, LEFT, PIN,
+       ZERO, ZERO, PIN, ZERO, LEFT, ZERO, RIGHT, LEFT, ZERO, RIGHT, ZERO,
+       ZERO}}},
+    {"flying toaster",
+     {{PIN, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, RIGHT,
+       ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
+    {"dubbya",
+     {{PIN, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, ZERO,
+       PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
+    {"tap handle",
+     {{PIN, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, LEFT, ZERO,
+       PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
+    {"wingnut",
+     {{PIN, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, PIN, ZERO,
+       PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
+    {"tight twist",
+     {{RIGHT, ZERO, ZERO, LEFT, ZERO, LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT,
+       PIN, RIGHT, LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT, ZERO, ZERO,
+       RIGHT, ZERO}}},
+    {"double helix",
+     {{RIGHT, ZERO, RIGHT, ZERO, RIGHT, ZERO, RIGHT, ZERO, RIGHT, ZERO, RIGHT,
+       ZERO, RIGHT, LEFT, RIGHT, PIN, ZERO, RIGHT, ZERO, RIGHT, ZERO, RIGHT,
+       ZERO, ZERO}}},
+    {"toadstool",
+     {{LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, PIN, RIGHT,
+       RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, PIN, RIGHT, LEFT,
+       PIN, ZERO}}},
+    {"AlanH2",
+     {{LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, PIN, RIGHT,
+       RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT,
+       RIGHT, ZERO}}},
+    {"AlanH3",
+     {{LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, PIN, RIGHT,
+       RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT, PIN, LEFT, RIGHT,
+       PIN, ZERO}}},
+    {"AlanH4",
+     {{ZERO, ZERO, PIN, LEFT, RIGHT, LEFT, ZERO, RIGHT, LEFT, RIGHT, ZERO, PIN,
+       ZERO, LEFT, RIGHT, LEFT, ZERO, RIGHT, LEFT, RIGHT, PIN, ZERO, ZERO,
+       ZERO}}},
+    {"Alien",
+     {{RIGHT, LEFT, RIGHT, PIN, ZERO, ZERO, PIN, RIGHT, LEFT, RIGHT, ZERO, PIN,
+       PIN, ZERO, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, ZERO, PIN, PIN, ZERO}}},
+    {"Angel",
+     {{ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT,
+       RIGHT, RIGHT, LEFT, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, ZERO, RIGHT,
+       LEFT, ZERO}}},
+    {"AnotherFigure",
+     {{LEFT, PIN, RIGHT, ZERO, ZERO, PIN, RIGHT, LEFT, LEFT, PIN, RIGHT, LEFT,
+       ZERO, PIN, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, LEFT, PIN, ZERO,
+       ZERO}}},
+    {"Ball",
+     {{LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, LEFT,
+       RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT,
+       RIGHT, ZERO}}},
+    {"Basket",
+     {{ZERO, RIGHT, RIGHT, ZERO, RIGHT, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT,
+       LEFT, PIN, RIGHT, LEFT, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, ZERO, LEFT,
+       ZERO}}},
+    {"Beetle",
+     {{PIN, LEFT, RIGHT, ZERO, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT,
+       RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, ZERO, LEFT, RIGHT, PIN,
+       RIGHT, ZERO}}},
+    {"bone",
+     {{PIN, PIN, LEFT, ZERO, PIN, PIN, ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, ZERO,
+       ZERO, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, RIGHT, PIN, PIN, ZERO}}},
+    {"Bow",
+     {{LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT,
+       RIGHT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT,
+       RIGHT, ZERO}}},
+    {"bra",
+     {{RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, LEFT, LEFT,
+       RIGHT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, LEFT,
+       LEFT, ZERO}}},
+    {"bronchosaurus",
+     {{ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO, PIN, PIN,
+       ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, ZERO}}},
+    {"Cactus",
+     {{PIN, LEFT, ZERO, PIN, PIN, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, PIN,
+       RIGHT, PIN, LEFT, ZERO, ZERO, RIGHT, PIN, LEFT, PIN, ZERO, ZERO, ZERO}}},
+    {"Camel",
+     {{RIGHT, ZERO, PIN, RIGHT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, LEFT, PIN,
+       LEFT, RIGHT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, ZERO, ZERO, LEFT,
+       ZERO}}},
+    {"Candlestick",
+     {{LEFT, PIN, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, RIGHT, PIN,
+       LEFT, PIN, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, RIGHT,
+       ZERO}}},
+    {"Cat",
+     {{ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, PIN,
+       PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO}}},
+    {"Cave",
+     {{RIGHT, ZERO, ZERO, PIN, LEFT, ZERO, PIN, PIN, ZERO, RIGHT, LEFT, PIN,
+       RIGHT, RIGHT, LEFT, LEFT, PIN, RIGHT, RIGHT, LEFT, PIN, ZERO, ZERO,
+       ZERO}}},
+    {"Chains",
+     {{PIN, ZERO, ZERO, PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, ZERO,
+       PIN, ZERO, ZERO, PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, ZERO}}},
+    {"Chair",
+     {{RIGHT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, RIGHT, ZERO, ZERO, PIN, PIN,
+       ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, ZERO, LEFT, RIGHT, LEFT, LEFT,
+       ZERO}}},
+    {"Chick",
+     {{RIGHT, RIGHT, RIGHT, PIN, LEFT, PIN, LEFT, PIN, RIGHT, RIGHT, RIGHT, PIN,
+       LEFT, LEFT, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, LEFT, LEFT, ZERO}}},
+    {"Clockwise",
+     {{RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT,
+       RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT,
+       RIGHT, RIGHT, RIGHT, ZERO}}},
+    {"cobra",
+     {{ZERO, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
+       LEFT, LEFT, LEFT, ZERO, LEFT, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, RIGHT,
+       ZERO}}},
+    {"Cobra3",
+     {{ZERO, LEFT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, ZERO,
+       ZERO, LEFT, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, LEFT, ZERO}}},
+    {"Compact1",
+     {{ZERO, ZERO, PIN, ZERO, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN,
+       RIGHT, PIN, LEFT, ZERO, PIN, PIN, ZERO, ZERO, LEFT, PIN, ZERO}}},
+    {"Compact2",
+     {{LEFT, PIN, RIGHT, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, PIN, LEFT, ZERO,
+       ZERO, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, RIGHT, ZERO, ZERO, ZERO,
+       ZERO}}},
+    {"Compact3",
+     {{ZERO, PIN, ZERO, PIN, PIN, ZERO, LEFT, PIN, RIGHT, ZERO, PIN, PIN, ZERO,
+       PIN, ZERO, PIN, PIN, ZERO, LEFT, PIN, RIGHT, ZERO, PIN, ZERO}}},
+    {"Compact4",
+     {{PIN, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN, RIGHT, PIN,
+       LEFT, PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO}}},
+    {"Compact5",
+     {{LEFT, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, RIGHT, PIN,
+       RIGHT, PIN, LEFT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, PIN, LEFT,
+       ZERO}}},
+    {"Contact",
+     {{PIN, ZERO, ZERO, PIN, LEFT, LEFT, PIN, LEFT, RIGHT, RIGHT, PIN, LEFT,
+       LEFT, RIGHT, PIN, RIGHT, RIGHT, PIN, ZERO, ZERO, PIN, RIGHT, PIN,
+       ZERO}}},
+    {"Contact2",
+     {{RIGHT, PIN, ZERO, LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, PIN, LEFT, PIN,
+       RIGHT, PIN, ZERO, LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, PIN, LEFT,
+       ZERO}}},
+    {"Cook",
+     {{ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, RIGHT, LEFT, PIN, LEFT, ZERO,
+       PIN, PIN, ZERO, LEFT, PIN, LEFT, RIGHT, ZERO, RIGHT, ZERO, PIN, ZERO}}},
+    {"Counterclockwise",
+     {{LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT,
+       LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT,
+       ZERO}}},
+    {"Cradle",
+     {{LEFT, LEFT, ZERO, PIN, LEFT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT,
+       RIGHT, LEFT, RIGHT, PIN, ZERO, RIGHT, RIGHT, LEFT, LEFT, ZERO, ZERO,
+       RIGHT, ZERO}}},
+    {"Crankshaft",
+     {{ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, PIN, LEFT, LEFT, PIN, RIGHT, LEFT,
+       ZERO, PIN, LEFT, PIN, RIGHT, ZERO, ZERO, ZERO, PIN, RIGHT, ZERO}}},
+    {"Cross",
+     {{ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO,
+       ZERO, ZERO, PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, PIN, ZERO}}},
+    {"Cross2",
+     {{ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, ZERO, PIN, PIN, ZERO, RIGHT,
+       ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, ZERO, PIN, PIN, ZERO, ZERO}}},
+    {"Cross3",
+     {{ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, ZERO, PIN, PIN, ZERO, RIGHT,
+       ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, ZERO, PIN, PIN, ZERO, ZERO}}},
+    {"CrossVersion1",
+     {{PIN, ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, PIN,
+       RIGHT, ZERO, PIN, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN,
+       ZERO}}},
+    {"CrossVersion2",
+     {{RIGHT, LEFT, PIN, LEFT, LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN,
+       LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, LEFT, LEFT, PIN, LEFT, RIGHT,
+       ZERO}}},
+    {"Crown",
+     {{LEFT, ZERO, PIN, ZERO, RIGHT, ZERO, ZERO, LEFT, ZERO, PIN, ZERO, RIGHT,
+       LEFT, ZERO, PIN, ZERO, RIGHT, ZERO, ZERO, LEFT, ZERO, PIN, ZERO, ZERO}}},
+    {"DNAStrand",
+     {{RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN,
+       RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT,
+       ZERO}}},
+    {"Diamond",
+     {{ZERO, RIGHT, ZERO, ZERO, LEFT, ZERO, ZERO, RIGHT, PIN, LEFT, LEFT, RIGHT,
+       LEFT, RIGHT, RIGHT, PIN, LEFT, ZERO, ZERO, RIGHT, ZERO, ZERO, LEFT,
+       ZERO}}},
+    {"Dog",
+     {{RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT,
+       LEFT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, ZERO, LEFT,
+       RIGHT, ZERO}}},
+    {"DogFace",
+     {{ZERO, ZERO, PIN, PIN, ZERO, LEFT, LEFT, RIGHT, PIN, ZERO, PIN, PIN, ZERO,
+       PIN, LEFT, RIGHT, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
+    {"DoublePeak",
+     {{ZERO, ZERO, PIN, ZERO, ZERO, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT,
+       LEFT, LEFT, ZERO, PIN, ZERO, RIGHT, RIGHT, LEFT, PIN, LEFT, RIGHT,
+       ZERO}}},
+    {"DoubleRoof",
+     {{ZERO, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, LEFT,
+       RIGHT, RIGHT, LEFT, LEFT, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT,
+       ZERO}}},
+    {"txoboggan",
+     {{ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, ZERO, PIN, PIN, ZERO,
+       ZERO, ZERO, ZERO, LEFT, PIN, RIGHT, ZERO, ZERO, ZERO, ZERO, PIN, ZERO}}},
+    {"Doubled",
+     {{LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT, LEFT, ZERO,
+       LEFT, PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, ZERO}}},
+    {"Doubled1",
+     {{LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, ZERO, RIGHT, ZERO,
+       RIGHT, ZERO, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT,
+       ZERO}}},
+    {"Doubled2",
+     {{LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, LEFT, RIGHT, ZERO,
+       RIGHT, LEFT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT,
+       ZERO}}},
+    {"DumblingSpoon",
+     {{PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO, LEFT, RIGHT,
+       ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO,
+       ZERO}}},
+    {"Embrace",
+     {{PIN, ZERO, ZERO, PIN, RIGHT, PIN, LEFT, PIN, ZERO, RIGHT, PIN, RIGHT,
+       PIN, LEFT, PIN, LEFT, ZERO, PIN, RIGHT, PIN, LEFT, PIN, ZERO, ZERO}}},
+    {"EndlessBelt",
+     {{ZERO, RIGHT, LEFT, ZERO, ZERO, ZERO, LEFT, RIGHT, ZERO, PIN, RIGHT, LEFT,
+       ZERO, LEFT, RIGHT, LEFT, PIN, LEFT, RIGHT, LEFT, ZERO, LEFT, RIGHT,
+       ZERO}}},
+    {"Entrance",
+     {{LEFT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT,
+       RIGHT, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, LEFT, LEFT,
+       RIGHT, ZERO}}},
+    {"Esthetic",
+     {{LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, PIN,
+       LEFT, PIN, RIGHT, PIN, LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT,
+       ZERO}}},
+    {"Explosion",
+     {{RIGHT, RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, RIGHT,
+       LEFT, RIGHT, LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT,
+       LEFT, ZERO}}},
+    {"F-ZeroXCar",
+     {{RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, ZERO,
+       RIGHT, LEFT, ZERO, ZERO, LEFT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, RIGHT,
+       ZERO}}},
+    {"Face",
+     {{ZERO, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN,
+       RIGHT, LEFT, PIN, LEFT, PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO}}},
+    {"FaserGun",
+     {{ZERO, ZERO, LEFT, RIGHT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, LEFT, PIN,
+       LEFT, RIGHT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, RIGHT, ZERO, PIN,
+       ZERO}}},
+    {"FelixW",
+     {{ZERO, RIGHT, ZERO, PIN, LEFT, ZERO, LEFT, RIGHT, ZERO, ZERO, RIGHT, PIN,
+       LEFT, ZERO, ZERO, LEFT, RIGHT, ZERO, RIGHT, PIN, ZERO, LEFT, ZERO,
+       ZERO}}},
+    {"Flamingo",
+     {{ZERO, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, LEFT, LEFT, PIN, LEFT,
+       RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, LEFT, ZERO, ZERO, ZERO, PIN, ZERO}}},
+    {"FlatOnTheTop",
+     {{ZERO, PIN, PIN, ZERO, PIN, RIGHT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT,
+       PIN, LEFT, RIGHT, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO}}},
+    {"Fly",
+     {{ZERO, LEFT, PIN, RIGHT, ZERO, PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT,
+       PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO}}},
+    {"Fountain",
+     {{LEFT, RIGHT, LEFT, RIGHT, RIGHT, PIN, LEFT, PIN, LEFT, RIGHT, RIGHT, PIN,
+       LEFT, LEFT, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT, PIN, RIGHT, PIN,
+       ZERO}}},
+    {"Frog",
+     {{LEFT, LEFT, RIGHT, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO,
+       RIGHT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, RIGHT, LEFT, RIGHT, RIGHT,
+       ZERO}}},
+    {"Frog2",
+     {{LEFT, ZERO, LEFT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, ZERO, RIGHT, PIN,
+       LEFT, ZERO, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, RIGHT, ZERO, RIGHT,
+       ZERO}}},
+    {"Furby",
+     {{PIN, ZERO, LEFT, PIN, RIGHT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, ZERO,
+       PIN, ZERO, RIGHT, PIN, LEFT, ZERO, PIN, ZERO, ZERO, PIN, ZERO}}},
+    {"Gate",
+     {{ZERO, ZERO, PIN, ZERO, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, LEFT, PIN,
+       LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, RIGHT, ZERO, PIN, PIN, ZERO, ZERO}}},
+    {"Ghost",
+     {{LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, RIGHT,
+       RIGHT, PIN, LEFT, RIGHT, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO, LEFT,
+       RIGHT, ZERO}}},
+    {"Globus",
+     {{RIGHT, LEFT, ZERO, PIN, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
+       LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, PIN, ZERO, RIGHT, LEFT,
+       ZERO, ZERO}}},
+    {"Grotto",
+     {{PIN, PIN, ZERO, LEFT, RIGHT, LEFT, ZERO, PIN, RIGHT, PIN, LEFT, ZERO,
+       ZERO, ZERO, ZERO, RIGHT, PIN, LEFT, PIN, ZERO, RIGHT, LEFT, RIGHT,
+       ZERO}}},
+    {"H",
+     {{PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, PIN, LEFT,
+       ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO}}},
+    {"HeadOfDevil",
+     {{PIN, ZERO, RIGHT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, RIGHT, LEFT,
+       PIN, LEFT, LEFT, PIN, RIGHT, RIGHT, PIN, RIGHT, LEFT, ZERO, ZERO,
+       ZERO}}},
+    {"Heart",
+     {{RIGHT, ZERO, ZERO, ZERO, PIN, LEFT, PIN, LEFT, RIGHT, RIGHT, ZERO, PIN,
+       ZERO, LEFT, LEFT, RIGHT, PIN, RIGHT, PIN, ZERO, ZERO, ZERO, LEFT,
+       ZERO}}},
+    {"Heart2",
+     {{ZERO, PIN, ZERO, ZERO, LEFT, ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, PIN,
+       ZERO, ZERO, ZERO, ZERO, RIGHT, ZERO, RIGHT, ZERO, ZERO, PIN, ZERO,
+       ZERO}}},
+    {"Hexagon",
+     {{ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO,
+       LEFT, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO,
+       ZERO}}},
+    {"HoleInTheMiddle1",
+     {{ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, LEFT, RIGHT,
+       ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, RIGHT,
+       ZERO}}},
+    {"HoleInTheMiddle2",
+     {{ZERO, LEFT, RIGHT, ZERO, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, RIGHT,
+       LEFT, ZERO, LEFT, RIGHT, ZERO, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO,
+       RIGHT, ZERO}}},
+    {"HouseBoat",
+     {{RIGHT, RIGHT, PIN, LEFT, LEFT, LEFT, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT,
+       RIGHT, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, RIGHT, PIN, ZERO}}},
+    {"HouseByHouse",
+     {{LEFT, PIN, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN,
+       LEFT, PIN, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, RIGHT, ZERO}}},
+    {"Infinity",
+     {{LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT,
+       LEFT, LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT,
+       LEFT, ZERO}}},
+    {"Integral",
+     {{RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT,
+       LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
+       LEFT, ZERO}}},
+    {"Iron",
+     {{ZERO, ZERO, ZERO, ZERO, PIN, RIGHT, ZERO, RIGHT, ZERO, ZERO, LEFT, PIN,
+       RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, RIGHT, ZERO, RIGHT,
+       ZERO}}},
+    {"just squares",
+     {{RIGHT, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, LEFT, PIN,
+       RIGHT, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, LEFT,
+       ZERO}}},
+    {"Kink",
+     {{ZERO, PIN, PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, RIGHT, PIN, LEFT,
+       ZERO, ZERO, PIN, PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO}}},
+    {"Knot",
+     {{LEFT, LEFT, PIN, LEFT, ZERO, LEFT, RIGHT, LEFT, PIN, LEFT, LEFT, RIGHT,
+       RIGHT, PIN, RIGHT, LEFT, RIGHT, ZERO, RIGHT, PIN, RIGHT, RIGHT, LEFT,
+       ZERO}}},
+    {"Leaf",
+     {{ZERO, PIN, PIN, ZERO, ZERO, LEFT, ZERO, LEFT, ZERO, ZERO, PIN, ZERO,
+       ZERO, RIGHT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO,
+       ZERO}}},
+    {"LeftAsRight",
+     {{RIGHT, PIN, LEFT, RIGHT, LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN,
+       LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, RIGHT, LEFT, RIGHT, PIN, LEFT,
+       ZERO}}},
+    {"Long-necked",
+     {{PIN, ZERO, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, ZERO, PIN, ZERO,
+       LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO, PIN, PIN, ZERO, ZERO}}},
+    {"lunar module",
+     {{PIN, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT,
+       RIGHT, LEFT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO,
+       LEFT, ZERO}}},
+    {"magnifying glass",
+     {{ZERO, ZERO, PIN, ZERO, LEFT, ZERO, PIN, PIN, ZERO, ZERO, RIGHT, PIN,
+       LEFT, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, ZERO, ZERO, ZERO}}},
+    {"Mask",
+     {{ZERO, ZERO, ZERO, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT, PIN, ZERO, PIN,
+       ZERO, ZERO, PIN, ZERO, PIN, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT,
+       ZERO}}},
+    {"Microscope",
+     {{PIN, PIN, ZERO, ZERO, PIN, ZERO, RIGHT, PIN, ZERO, ZERO, RIGHT, PIN,
+       LEFT, ZERO, ZERO, PIN, LEFT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO}}},
+    {"Mirror",
+     {{PIN, RIGHT, LEFT, ZERO, PIN, PIN, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO,
+       PIN, ZERO, ZERO, LEFT, RIGHT, PIN, RIGHT, ZERO, PIN, PIN, ZERO, ZERO}}},
+    {"MissPiggy",
+     {{ZERO, LEFT, LEFT, PIN, RIGHT, ZERO, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT,
+       RIGHT, PIN, LEFT, LEFT, ZERO, LEFT, PIN, RIGHT, RIGHT, ZERO, RIGHT,
+       ZERO}}},
+    {"Mole",
+     {{ZERO, RIGHT, ZERO, RIGHT, LEFT, RIGHT, PIN, ZERO, LEFT, PIN, RIGHT, ZERO,
+       PIN, LEFT, RIGHT, LEFT, ZERO, LEFT, ZERO, RIGHT, RIGHT, PIN, LEFT,
+       ZERO}}},
+    {"Monk",
+     {{LEFT, ZERO, PIN, PIN, ZERO, LEFT, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN,
+       PIN, ZERO, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, ZERO}}},
+    {"Mountain",
+     {{ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, LEFT, PIN,
+       LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO,
+       ZERO}}},
+    {"mountains",
+     {{ZERO, PIN, ZERO, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN,
+       LEFT, PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO, PIN, ZERO, ZERO}}},
+    {"MouseWithoutTail",
+     {{ZERO, PIN, PIN, ZERO, LEFT, ZERO, PIN, PIN, ZERO, ZERO, RIGHT, PIN, LEFT,
+       ZERO, ZERO, PIN, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, ZERO}}},
+    {"mushroom",
+     {{PIN, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, ZERO,
+       LEFT, PIN, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, LEFT, ZERO, PIN, ZERO}}},
+    {"necklace",
+     {{ZERO, ZERO, LEFT, ZERO, ZERO, ZERO, LEFT, ZERO, ZERO, ZERO, ZERO, PIN,
+       ZERO, ZERO, ZERO, ZERO, RIGHT, ZERO, ZERO, ZERO, RIGHT, ZERO, ZERO,
+       ZERO}}},
+    {"NestledAgainst",
+     {{LEFT, ZERO, PIN, LEFT, LEFT, RIGHT, RIGHT, PIN, ZERO, RIGHT, PIN, LEFT,
+       ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT,
+       ZERO}}},
+    {"NoClue",
+     {{ZERO, RIGHT, PIN, LEFT, LEFT, LEFT, ZERO, LEFT, PIN, RIGHT, RIGHT, PIN,
+       LEFT, LEFT, PIN, RIGHT, ZERO, RIGHT, RIGHT, RIGHT, PIN, LEFT, ZERO,
+       ZERO}}},
+    {"Noname",
+     {{LEFT, PIN, RIGHT, PIN, RIGHT, ZERO, PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN,
+       PIN, ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, ZERO}}},
+    {"Obelisk",
+     {{PIN, ZERO, ZERO, ZERO, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, LEFT,
+       RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, ZERO, ZERO, ZERO, ZERO}}},
+    {"Ostrich",
+     {{ZERO, ZERO, PIN, PIN, ZERO, LEFT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO,
+       RIGHT, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, ZERO}}},
+    {"Ostrich2",
+     {{PIN, PIN, ZERO, PIN, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT,
+       RIGHT, LEFT, LEFT, RIGHT, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO}}},
+    {"pair of glasses",
+     {{ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, LEFT, ZERO, PIN, ZERO,
+       RIGHT, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO}}},
+    {"Parrot",
+     {{ZERO, ZERO, ZERO, ZERO, RIGHT, RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO,
+       RIGHT, ZERO, RIGHT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, LEFT, ZERO, PIN,
+       ZERO}}},
+#ifndef WIN32
+    {"Penis",
+     {{PIN, PIN, RIGHT, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, RIGHT, PIN, LEFT,
+       ZERO, ZERO, PIN, ZERO, PIN, PIN, ZERO, LEFT, PIN, PIN, ZERO}}},
+#endif
+    {"PictureCommingSoon",
+     {{LEFT, LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, RIGHT, LEFT, PIN,
+       LEFT, RIGHT, PIN, RIGHT, RIGHT, PIN, RIGHT, LEFT, ZERO, RIGHT, RIGHT,
+       ZERO}}},
+    {"Pitti",
+     {{LEFT, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, RIGHT, PIN,
+       LEFT, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, RIGHT, ZERO}}},
+    {"Plait",
+     {{LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, LEFT, RIGHT, LEFT,
+       RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT,
+       LEFT, ZERO}}},
+    {"Platform",
+     {{RIGHT, PIN, ZERO, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN,
+       LEFT, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO}}},
+    {"PodRacer",
+     {{ZERO, PIN, ZERO, PIN, RIGHT, PIN, ZERO, RIGHT, PIN, LEFT, LEFT, PIN,
+       RIGHT, LEFT, ZERO, PIN, PIN, ZERO, ZERO, LEFT, ZERO, PIN, LEFT, ZERO}}},
+    {"Prawn",
+     {{RIGHT, PIN, ZERO, PIN, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, LEFT, PIN,
+       RIGHT, ZERO, ZERO, PIN, PIN, ZERO, LEFT, PIN, ZERO, PIN, LEFT, ZERO}}},
+    {"Propeller",
+     {{ZERO, ZERO, ZERO, RIGHT, ZERO, LEFT, RIGHT, LEFT, ZERO, ZERO, ZERO,
+       RIGHT, ZERO, LEFT, RIGHT, LEFT, ZERO, ZERO, ZERO, RIGHT, ZERO, LEFT,
+       RIGHT, ZERO}}},
+    {"Pyramid",
+     {{ZERO, LEFT, PIN, RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO, LEFT, PIN, RIGHT,
+       ZERO, PIN, RIGHT, LEFT, LEFT, LEFT, PIN, RIGHT, RIGHT, RIGHT, LEFT,
+       ZERO}}},
+    {"QuarterbackTiltedAndReadyToHut",
+     {{PIN, ZERO, RIGHT, RIGHT, LEFT, RIGHT, PIN, RIGHT, LEFT, RIGHT, ZERO, PIN,
+       ZERO, LEFT, RIGHT, LEFT, PIN, LEFT, RIGHT, LEFT, LEFT, ZERO, PIN,
+       ZERO}}},
+    {"Ra",
+     {{PIN, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
+       LEFT, ZERO, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
+       LEFT, ZERO}}},
+    {"Rattlesnake",
+     {{LEFT, ZERO, LEFT, ZERO, LEFT, ZERO, LEFT, LEFT, ZERO, LEFT, ZERO, LEFT,
+       ZERO, LEFT, RIGHT, ZERO, PIN, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT, RIGHT,
+       ZERO}}},
+    {"Revelation",
+     {{ZERO, ZERO, ZERO, PIN, ZERO, ZERO, PIN, RIGHT, LEFT, LEFT, LEFT, RIGHT,
+       RIGHT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, LEFT, PIN, ZERO, ZERO, PIN,
+       ZERO}}},
+    {"Revolution1",
+     {{LEFT, LEFT, PIN, RIGHT, ZERO, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT, PIN,
+       LEFT, LEFT, PIN, RIGHT, ZERO, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT,
+       ZERO}}},
+    {"Ribbon",
+     {{RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, PIN, ZERO, PIN, PIN, ZERO, PIN,
+       ZERO, PIN, PIN, ZERO, PIN, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT,
+       ZERO}}},
+    {"Rocket",
+     {{RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO, RIGHT, ZERO, LEFT, ZERO, RIGHT, PIN,
+       LEFT, ZERO, RIGHT, ZERO, LEFT, ZERO, LEFT, PIN, RIGHT, ZERO, LEFT,
+       ZERO}}},
+    {"Roofed",
+     {{ZERO, LEFT, PIN, RIGHT, ZERO, PIN, LEFT, ZERO, PIN, ZERO, RIGHT, PIN,
+       ZERO, LEFT, PIN, RIGHT, ZERO, PIN, LEFT, ZERO, PIN, ZERO, RIGHT, ZERO}}},
+    {"Roofs",
+     {{PIN, PIN, RIGHT, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN,
+       RIGHT, PIN, RIGHT, PIN, LEFT, PIN, RIGHT, ZERO, LEFT, PIN, PIN, ZERO}}},
+    {"RowHouses",
+     {{RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN,
+       RIGHT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO}}},
+    {"Sculpture",
+     {{RIGHT, LEFT, PIN, ZERO, ZERO, ZERO, LEFT, RIGHT, LEFT, PIN, ZERO, ZERO,
+       PIN, LEFT, RIGHT, LEFT, ZERO, ZERO, ZERO, PIN, LEFT, RIGHT, LEFT,
+       ZERO}}},
+    {"Seal",
+     {{LEFT, LEFT, LEFT, PIN, RIGHT, RIGHT, RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO,
+       LEFT, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, PIN, PIN, ZERO, LEFT, ZERO}}},
+    {"Seal2",
+     {{RIGHT, PIN, ZERO, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, RIGHT,
+       PIN, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, ZERO, LEFT, RIGHT, ZERO, ZERO,
+       ZERO}}},
+    {"Sheep",
+     {{RIGHT, LEFT, LEFT, RIGHT, RIGHT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT,
+       RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT, LEFT, LEFT, RIGHT,
+       LEFT, ZERO}}},
+    {"Shelter",
+     {{LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT, ZERO,
+       ZERO, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, RIGHT,
+       ZERO}}},
+    {"Ship",
+     {{PIN, RIGHT, LEFT, LEFT, LEFT, LEFT, PIN, RIGHT, RIGHT, RIGHT, RIGHT,
+       LEFT, ZERO, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, LEFT, ZERO, PIN, PIN,
+       ZERO}}},
+    {"Shpongle",
+     {{LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT, ZERO,
+       RIGHT, LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT,
+       ZERO, ZERO}}},
+    {"Slide",
+     {{LEFT, RIGHT, LEFT, RIGHT, ZERO, LEFT, RIGHT, LEFT, PIN, ZERO, ZERO, PIN,
+       ZERO, ZERO, PIN, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, RIGHT, LEFT,
+       ZERO}}},
+    {"SmallShip",
+     {{ZERO, LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT, RIGHT, ZERO, LEFT,
+       RIGHT, ZERO, LEFT, RIGHT, ZERO, RIGHT, LEFT, ZERO, LEFT, RIGHT, ZERO,
+       LEFT, ZERO}}},
+    {"SnakeReadyToStrike",
+     {{LEFT, ZERO, LEFT, ZERO, LEFT, ZERO, LEFT, RIGHT, ZERO, RIGHT, ZERO,
+       RIGHT, ZERO, LEFT, ZERO, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO, LEFT,
+       ZERO}}},
+    {"Snakes14",
+     {{RIGHT, RIGHT, PIN, ZERO, RIGHT, LEFT, RIGHT, ZERO, ZERO, ZERO, RIGHT,
+       PIN, LEFT, PIN, ZERO, PIN, LEFT, PIN, RIGHT, ZERO, ZERO, LEFT, RIGHT,
+       ZERO}}},
+    {"Snakes15",
+     {{ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, PIN, LEFT, LEFT, PIN, RIGHT, LEFT,
+       ZERO, PIN, LEFT, PIN, RIGHT, ZERO, ZERO, ZERO, PIN, RIGHT, ZERO}}},
+    {"Snakes18",
+     {{PIN, PIN, LEFT, PIN, LEFT, PIN, RIGHT, ZERO, RIGHT, PIN, RIGHT, ZERO,
+       RIGHT, PIN, LEFT, PIN, RIGHT, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO}}},
+    {"Snowflake",
+     {{LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, LEFT,
+       RIGHT, RIGHT, RIGHT, RIGHT, LEFT, LEFT, LEFT, LEFT, RIGHT, RIGHT, RIGHT,
+       RIGHT, ZERO}}},
+    {"Snowman",
+     {{ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, PIN,
+       PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, ZERO}}},
+    {"Source",
+     {{PIN, RIGHT, ZERO, PIN, ZERO, LEFT, PIN, RIGHT, PIN, LEFT, LEFT, RIGHT,
+       LEFT, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, PIN,
+       ZERO}}},
+    {"Spaceship",
+     {{PIN, PIN, RIGHT, RIGHT, PIN, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, PIN,
+       RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, PIN, RIGHT, PIN, PIN, ZERO}}},
+    {"Spaceship2",
+     {{PIN, PIN, LEFT, PIN, LEFT, PIN, RIGHT, ZERO, PIN, PIN, ZERO, LEFT, PIN,
+       RIGHT, ZERO, PIN, ZERO, LEFT, PIN, LEFT, LEFT, PIN, PIN, ZERO}}},
+    {"Speedboat",
+     {{LEFT, ZERO, ZERO, LEFT, PIN, RIGHT, ZERO, ZERO, LEFT, ZERO, ZERO, PIN,
+       ZERO, ZERO, RIGHT, ZERO, ZERO, LEFT, PIN, RIGHT, ZERO, ZERO, RIGHT,
+       ZERO}}},
+    {"Speedboat2",
+     {{PIN, RIGHT, LEFT, LEFT, RIGHT, RIGHT, RIGHT, ZERO, LEFT, PIN, RIGHT,
+       ZERO, LEFT, LEFT, LEFT, RIGHT, RIGHT, LEFT, PIN, ZERO, RIGHT, PIN, LEFT,
+       ZERO}}},
+    {"Spider",
+     {{RIGHT, RIGHT, ZERO, ZERO, LEFT, RIGHT, LEFT, PIN, ZERO, LEFT, ZERO, PIN,
+       PIN, ZERO, RIGHT, ZERO, PIN, RIGHT, LEFT, RIGHT, ZERO, ZERO, LEFT,
+       ZERO}}},
+    {"Spitzbergen",
+     {{PIN, LEFT, ZERO, RIGHT, RIGHT, LEFT, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT,
+       PIN, LEFT, LEFT, PIN, RIGHT, ZERO, PIN, RIGHT, LEFT, LEFT, ZERO, ZERO}}},
+    {"Square",
+     {{ZERO, ZERO, LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, ZERO, LEFT, LEFT, PIN,
+       RIGHT, RIGHT, ZERO, ZERO, LEFT, LEFT, PIN, RIGHT, RIGHT, ZERO, ZERO,
+       ZERO}}},
+    {"SquareHole",
+     {{PIN, ZERO, PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO,
+       ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, PIN, ZERO}}},
+    {"Stage",
+     {{RIGHT, ZERO, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, LEFT, RIGHT, PIN, RIGHT,
+       LEFT, PIN, LEFT, RIGHT, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO,
+       ZERO}}},
+    {"Stairs",
+     {{ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO,
+       PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, ZERO}}},
+    {"Stairs2",
+     {{ZERO, PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, PIN, ZERO,
+       PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO}}},
+    {"Straight",
+     {{ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO,
+       ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO,
+       ZERO}}},
+    {"Swan",
+     {{ZERO, PIN, ZERO, PIN, LEFT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT,
+       LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, PIN, LEFT, PIN, LEFT, RIGHT, ZERO}}},
+    {"Swan2",
+     {{PIN, ZERO, PIN, RIGHT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, RIGHT,
+       LEFT, RIGHT, RIGHT, RIGHT, PIN, ZERO, ZERO, ZERO, ZERO, ZERO, PIN, PIN,
+       ZERO}}},
+    {"Swan3",
+     {{PIN, PIN, ZERO, ZERO, ZERO, RIGHT, ZERO, RIGHT, ZERO, ZERO, LEFT, PIN,
+       RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, ZERO, ZERO, RIGHT, ZERO, RIGHT,
+       ZERO}}},
+    {"Symbol",
+     {{RIGHT, RIGHT, PIN, ZERO, PIN, PIN, ZERO, PIN, LEFT, LEFT, RIGHT, LEFT,
+       RIGHT, RIGHT, PIN, ZERO, PIN, PIN, ZERO, PIN, LEFT, LEFT, RIGHT, ZERO}}},
+    {"Symmetry",
+     {{RIGHT, ZERO, LEFT, RIGHT, LEFT, ZERO, LEFT, RIGHT, LEFT, ZERO, RIGHT,
+       PIN, LEFT, ZERO, RIGHT, LEFT, RIGHT, ZERO, RIGHT, LEFT, RIGHT, ZERO,
+       LEFT, ZERO}}},
+    {"Symmetry2",
+     {{ZERO, PIN, LEFT, LEFT, PIN, ZERO, ZERO, LEFT, PIN, RIGHT, PIN, LEFT,
+       LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT, PIN, LEFT, ZERO}}},
+    {"TableFireworks",
+     {{ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO,
+       RIGHT, LEFT, PIN, RIGHT, RIGHT, RIGHT, PIN, RIGHT, LEFT, ZERO, RIGHT,
+       PIN, ZERO}}},
+    {"Tapering",
+     {{ZERO, ZERO, RIGHT, LEFT, PIN, LEFT, ZERO, PIN, PIN, ZERO, LEFT, PIN,
+       RIGHT, ZERO, PIN, PIN, ZERO, RIGHT, PIN, RIGHT, LEFT, ZERO, ZERO,
+       ZERO}}},
+    {"TaperingTurned",
+     {{ZERO, ZERO, RIGHT, LEFT, PIN, LEFT, ZERO, PIN, PIN, ZERO, LEFT, ZERO,
+       RIGHT, ZERO, PIN, PIN, ZERO, RIGHT, PIN, RIGHT, LEFT, ZERO, ZERO,
+       ZERO}}},
+    {"TeaLightStick",
+     {{RIGHT, ZERO, PIN, PIN, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, RIGHT, RIGHT,
+       PIN, LEFT, LEFT, RIGHT, RIGHT, PIN, LEFT, LEFT, RIGHT, RIGHT, PIN,
+       ZERO}}},
+    {"thighmaster",
+     {{RIGHT, ZERO, ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, ZERO, ZERO,
+       LEFT, RIGHT, ZERO, ZERO, RIGHT, LEFT, ZERO, ZERO, RIGHT, LEFT, ZERO,
+       ZERO, ZERO}}},
+    {"Terraces",
+     {{RIGHT, LEFT, ZERO, RIGHT, LEFT, PIN, LEFT, LEFT, PIN, LEFT, RIGHT, RIGHT,
+       RIGHT, LEFT, LEFT, LEFT, RIGHT, PIN, RIGHT, RIGHT, PIN, RIGHT, LEFT,
+       ZERO}}},
+    {"Terrier",
+     {{PIN, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, PIN,
+       ZERO, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO}}},
+    {"Three-Legged",
+     {{RIGHT, ZERO, LEFT, RIGHT, ZERO, LEFT, PIN, RIGHT, ZERO, RIGHT, ZERO, PIN,
+       ZERO, LEFT, ZERO, LEFT, PIN, RIGHT, ZERO, LEFT, RIGHT, ZERO, LEFT,
+       ZERO}}},
+    {"ThreePeaks",
+     {{RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, RIGHT, PIN,
+       LEFT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO, ZERO, LEFT, ZERO}}},
+    {"ToTheFront",
+     {{ZERO, PIN, RIGHT, LEFT, LEFT, LEFT, PIN, RIGHT, LEFT, ZERO, PIN, PIN,
+       ZERO, LEFT, LEFT, PIN, ZERO, LEFT, RIGHT, ZERO, PIN, ZERO, LEFT, ZERO}}},
+    {"Top",
+     {{PIN, LEFT, LEFT, PIN, LEFT, ZERO, ZERO, RIGHT, LEFT, PIN, RIGHT, RIGHT,
+       LEFT, RIGHT, LEFT, LEFT, PIN, RIGHT, PIN, RIGHT, RIGHT, PIN, ZERO,
+       ZERO}}},
+    {"Transport",
+     {{PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, PIN,
+       PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, ZERO, ZERO, ZERO}}},
+    {"Triangle",
+     {{ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, RIGHT, LEFT, ZERO, ZERO, ZERO, ZERO,
+       ZERO, ZERO, RIGHT, LEFT, ZERO, ZERO, ZERO, ZERO, ZERO, ZERO, RIGHT,
+       ZERO}}},
+    {"Tripple",
+     {{PIN, ZERO, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, PIN, ZERO, PIN, LEFT, PIN,
+       RIGHT, PIN, ZERO, PIN, LEFT, PIN, LEFT, PIN, RIGHT, PIN, ZERO}}},
+    {"Twins",
+     {{ZERO, PIN, ZERO, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, PIN, ZERO, ZERO,
+       PIN, LEFT, PIN, LEFT, RIGHT, PIN, RIGHT, ZERO, PIN, ZERO, ZERO, ZERO}}},
+    {"TwoSlants",
+     {{ZERO, PIN, ZERO, ZERO, PIN, PIN, ZERO, PIN, ZERO, RIGHT, PIN, RIGHT,
+       LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO, ZERO, RIGHT, PIN, ZERO}}},
+    {"TwoWings",
+     {{PIN, LEFT, ZERO, RIGHT, ZERO, PIN, PIN, ZERO, PIN, PIN, ZERO, PIN, PIN,
+       ZERO, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, LEFT, ZERO, ZERO}}},
+    {"UFO",
+     {{LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, LEFT,
+       PIN, LEFT, LEFT, LEFT, RIGHT, LEFT, RIGHT, RIGHT, LEFT, RIGHT, LEFT,
+       LEFT, ZERO}}},
+    {"USS Enterprise",
+     {{LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, ZERO, PIN, PIN, ZERO, RIGHT, LEFT,
+       ZERO, PIN, PIN, ZERO, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, ZERO, ZERO}}},
+    {"UpAndDown",
+     {{ZERO, PIN, ZERO, PIN, ZERO, PIN, LEFT, PIN, RIGHT, PIN, ZERO, PIN, ZERO,
+       PIN, ZERO, PIN, ZERO, PIN, LEFT, PIN, RIGHT, PIN, ZERO, ZERO}}},
+    {"Upright",
+     {{ZERO, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, PIN, ZERO, ZERO, LEFT, PIN,
+       RIGHT, ZERO, ZERO, PIN, RIGHT, RIGHT, LEFT, RIGHT, LEFT, LEFT, ZERO,
+       ZERO}}},
+    {"Upside-down",
+     {{PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, RIGHT, RIGHT, LEFT, LEFT, PIN,
+       RIGHT, RIGHT, LEFT, LEFT, ZERO, PIN, PIN, ZERO, ZERO, ZERO, PIN, ZERO}}},
+    {"Valley",
+     {{ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, RIGHT, ZERO, PIN,
+       ZERO, LEFT, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, PIN, LEFT, ZERO, ZERO}}},
+    {"Viaduct",
+     {{PIN, RIGHT, PIN, LEFT, PIN, ZERO, ZERO, PIN, RIGHT, ZERO, RIGHT, RIGHT,
+       ZERO, RIGHT, PIN, ZERO, ZERO, PIN, LEFT, PIN, RIGHT, PIN, ZERO, ZERO}}},
+    {"View",
+     {{ZERO, RIGHT, PIN, LEFT, PIN, RIGHT, ZERO, ZERO, RIGHT, PIN, LEFT, LEFT,
+       RIGHT, RIGHT, PIN, LEFT, ZERO, ZERO, LEFT, PIN, RIGHT, PIN, LEFT,
+       ZERO}}},
+    {"Waterfall",
+     {{LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN,
+       LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT, PIN, LEFT, ZERO, RIGHT,
+       ZERO}}},
+    {"windwheel",
+     {{PIN, RIGHT, RIGHT, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO, LEFT,
+       PIN, RIGHT, RIGHT, PIN, ZERO, LEFT, PIN, RIGHT, RIGHT, PIN, ZERO,
+       ZERO}}},
+    {"Window",
+     {{PIN, ZERO, PIN, PIN, ZERO, ZERO, PIN, ZERO, PIN, ZERO, PIN, ZERO, ZERO,
+       PIN, ZERO, PIN, ZERO, PIN, PIN, ZERO, ZERO, ZERO, ZERO, ZERO}}},
+    {"WindowToTheWorld",
+     {{PIN, LEFT, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, RIGHT, PIN,
+       LEFT, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO, PIN, ZERO, ZERO}}},
+    {"Windshield",
+     {{PIN, PIN, ZERO, RIGHT, PIN, LEFT, LEFT, PIN, RIGHT, ZERO, PIN, ZERO,
+       LEFT, PIN, RIGHT, RIGHT, PIN, LEFT, ZERO, PIN, PIN, ZERO, PIN, ZERO}}},
+    {"WingNut",
+     {{ZERO, ZERO, ZERO, ZERO, PIN, RIGHT, RIGHT, RIGHT, PIN, RIGHT, LEFT, PIN,
+       LEFT, RIGHT, PIN, RIGHT, RIGHT, RIGHT, PIN, ZERO, ZERO, ZERO, ZERO,
+       ZERO}}},
+    {"Wings2",
+     {{RIGHT, ZERO, PIN, ZERO, LEFT, PIN, RIGHT, PIN, RIGHT, LEFT, RIGHT, RIGHT,
+       LEFT, LEFT, RIGHT, LEFT, PIN, LEFT, PIN, RIGHT, ZERO, PIN, ZERO, ZERO}}},
+    {"WithoutName",
+     {{PIN, RIGHT, PIN, RIGHT, RIGHT, PIN, LEFT, LEFT, PIN, ZERO, PIN, RIGHT,
+       PIN, LEFT, PIN, ZERO, PIN, RIGHT, RIGHT, PIN, LEFT, LEFT, PIN, ZERO}}},
+    {"Wolf",
+     {{ZERO, ZERO, PIN, PIN, ZERO, PIN, ZERO, ZERO, PIN, ZERO, PIN, PIN, ZERO,
+       PIN, ZERO, ZERO, ZERO, PIN, PIN, ZERO, ZERO, ZERO, PIN, ZERO}}},
+    {"X",
+     {{LEFT, ZERO, ZERO, PIN, LEFT, RIGHT, RIGHT, PIN, LEFT, RIGHT, ZERO, PIN,
+       PIN, ZERO, LEFT, RIGHT, PIN, LEFT, LEFT, RIGHT, PIN, ZERO, ZERO, ZERO}}},
+};
+
+const size_t builtin_models = BUILTIN_MODELS;
+
+const struct model_info builtin_info[] = {
+    /* straight */
+    {UINT64_C(0x0000000000000000), {1, 0, -1}, MODEL_ACYCLIC,
+     {6.5, -6, 0.5},
+     {6, -6.5, 0},
+     8.84651661, 9.13941002,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {11, 6, -4, 2}, {0, 6, -6, 0}, {11, 8, -6, 2}, {0, 8, -8, 0},
+      {11, 10, -8, 2}, {0, 10, -10, 0}, {11, 12, -10, 2}, {0, 12, -12, 0},
+      {11, 14, -12, 2}, {0, 14, -14, 0}, {11, 16, -14, 2}, {0, 16, -16, 0},
+      {11, 18, -16, 2}, {0, 18, -18, 0}, {11, 20, -18, 2}, {0, 20, -20, 0},
+      {11, 22, -20, 2}, {0, 22, -22, 0}, {11, 24, -22, 2}, {0, 24, -24, 0}}},
+    /* ball */
+    {UINT64_C(0x00001df75f5df75f), {1, 1, 90}, MODEL_CYCLIC,
+     {0.5, 0.5, -0.5},
+     {0, 0, -1},
+     2.12132025, 2.41421366,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {1, 2, 0, 0}, {12, 2, 0, -2},
+      {18, 2, 2, -2}, {2, 2, 0, -2}, {15, 0, 0, -2}, {16, 0, -2, -2},
+      {3, 0, 0, -2}, {12, -2, 0, -2}, {19, 0, 0, -2}, {1, 0, 2, -2},
+      {13, 2, 2, -2}, {17, 2, 4, -2}, {0, 2, 2, -2}, {15, 2, 2, 0},
+      {16, 2, 0, 0}, {3, 2, 2, 0}, {12, 0, 2, 0}, {18, 0, 4, 0}, {2, 0, 2, 0},
+      {15, -2, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* snow */
+    {UINT64_C(0x000015ff55ff55ff), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.5, -0.5, -1.5},
+     {-1, -1, -2},
+     3.15659642, 3.44948983,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {0, 2, -2, -2}, {14, 4, -2, -2},
+      {18, 2, -2, -2}, {2, 2, -4, -2}, {14, 2, -4, -4}, {18, 0, -4, -4},
+      {3, 0, -4, -6}, {12, -2, -4, -6}, {18, -2, -2, -6}, {3, -2, -2, -8},
+      {13, -2, -2, -6}, {16, -4, -2, -6}, {3, -4, 0, -6}, {13, -4, 0, -4},
+      {17, -4, 2, -4}, {1, -4, 2, -2}, {13, -2, 2, -2}, {17, -2, 4, -2},
+      {0, -2, 2, -2}, {15, -2, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* propellor */
+    {UINT64_C(0x00004dc04dc04dc0), {1, 1, 90}, MODEL_CYCLIC,
+     {0.666666687, 0.666666687, 1.33333337},
+     {0.166666627, 0.166666627, 0.833333373},
+     3.66514659, 3.95804,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {5, 4, -4, 2},
+      {21, 4, -2, 2}, {8, 4, -2, 4}, {3, 4, 0, 2}, {13, 4, 0, 4}, {21, 2, 2, 4},
+      {13, 4, 2, 6}, {21, 2, 4, 6}, {8, 2, 4, 8}, {6, 2, 4, 6}, {22, 0, 4, 6},
+      {14, 2, 4, 4}, {18, 0, 4, 4}, {6, 0, 2, 2}, {18, -2, 4, 2}, {6, -2, 2, 0},
+      {22, -4, 2, 0}, {11, -2, 2, 0}, {5, -2, 0, 0}, {17, 0, 2, 0},
+      {0, 0, 0, 0}}},
+    /* flamingo */
+    {UINT64_C(0x0000203ed9ef8008), {1, 0, -1}, MODEL_ACYCLIC,
+     {4.58333349, 1.75, 0.5},
+     {4.08333349, 1.25, 0},
+     5.36930704, 5.66220045,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {1, 4, 2, 2}, {9, 6, 2, 0},
+      {1, 6, 4, 2}, {9, 8, 4, 0}, {0, 8, 4, 0}, {14, 10, 4, 0}, {19, 10, 2, 0},
+      {5, 10, 2, 0}, {20, 12, 2, 0}, {10, 10, 2, 0}, {3, 10, 2, 0},
+      {13, 10, 2, 2}, {17, 10, 4, 2}, {4, 10, 4, 2}, {23, 12, 4, 2},
+      {9, 12, 4, 0}, {1, 12, 6, 2}, {9, 14, 6, 0}, {1, 14, 8, 2}, {8, 14, 8, 2},
+      {3, 14, 10, 0}}},
+    /* cat */
+    {UINT64_C(0x000000028a28ca28), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.33333325, 0.5, -0.333333343},
+     {1.83333325, 0, -0.833333254},
+     4.36618996, 4.65908289,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {9, 2, 2, 0},
+      {0, 2, 2, 0}, {11, 4, 2, 2}, {5, 4, 0, 2}, {17, 6, 2, 2}, {4, 6, 2, 2},
+      {18, 6, 2, 2}, {6, 6, 0, 0}, {19, 6, 0, 0}, {5, 6, 0, 0}, {17, 8, 2, 0},
+      {4, 8, 2, 0}, {18, 8, 2, 0}, {6, 8, 0, -2}, {18, 6, 2, -2}, {6, 6, 0, -4},
+      {18, 4, 2, -4}, {6, 4, 0, -6}, {18, 2, 2, -6}, {6, 2, 0, -8}}},
+    /* rooster */
+    {UINT64_C(0x0000211eca3b44a0), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.833333313, -1.08333337, 0.5},
+     {-1.33333349, -1.58333337, 0},
+     3.21404147, 3.50693464,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {3, 2, -2, 0},
+      {8, 0, -2, 2}, {6, 0, -2, 0}, {18, -2, 0, 0}, {2, -2, -2, 0},
+      {15, -4, -2, 0}, {21, -4, -2, 0}, {8, -4, -2, 2}, {3, -4, 0, 0},
+      {9, -4, 0, 0}, {0, -4, 0, 0}, {11, -2, 0, 2}, {5, -2, -2, 2},
+      {16, -2, -2, 2}, {2, -2, -2, 4}, {14, -2, -2, 2}, {22, -4, -4, 2},
+      {11, -2, -4, 2}, {0, -2, -6, 0}, {10, -2, -6, 0}, {2, -2, -8, 2}}},
+    /* half balls */
+    {UINT64_C(0x000015df7555df75), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.16666675, 0.5, 2.33333325},
+     {1.66666651, 0, 1.83333325},
+     3.89126897, 4.18416262,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {1, 2, 0, 4}, {12, 2, 0, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {13, 2, 2, 2}, {17, 2, 4, 2}, {0, 2, 2, 2}, {15, 2, 2, 4},
+      {17, 4, 2, 4}, {0, 4, 0, 4}, {15, 4, 0, 6}, {17, 6, 0, 6}, {1, 6, 0, 8},
+      {12, 6, 0, 6}, {18, 6, 2, 6}, {3, 6, 2, 4}, {13, 6, 2, 6}, {17, 6, 4, 6},
+      {0, 6, 2, 6}, {15, 6, 2, 8}, {17, 8, 2, 8}, {5, 8, 0, 10}}},
+    /* zigzag1 */
+    {UINT64_C(0x000017f57f57f57f), {1, 0, -1}, MODEL_ACYCLIC,
+     {4.33333349, -4, 0},
+     {3.83333349, -4.5, -0.5},
+     6.17163897, 6.4645319,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {0, 2, -2, -2}, {15, 2, -2, 0},
+      {17, 4, -2, 0}, {0, 4, -4, 0}, {14, 6, -4, 0}, {19, 6, -6, 0},
+      {0, 6, -6, -2}, {15, 6, -6, 0}, {17, 8, -6, 0}, {0, 8, -8, 0},
+      {14, 10, -8, 0}, {19, 10, -10, 0}, {0, 10, -10, -2}, {15, 10, -10, 0},
+      {17, 12, -10, 0}, {0, 12, -12, 0}, {14, 14, -12, 0}, {19, 14, -14, 0},
+      {0, 14, -14, -2}, {15, 14, -14, 0}, {17, 16, -14, 0}, {5, 16, -16, 2}}},
+    /* zigzag2 */
+    {UINT64_C(0x0000222222222222), {1, 0, -1}, MODEL_ACYCLIC,
+     {0, -6, 0.5},
+     {-0.5, -6.5, 0},
+     6.22978735, 6.52268028,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {11, 0, -2, 2}, {0, 0, -4, 0},
+      {10, 0, -4, 0}, {2, 0, -6, 2}, {11, 0, -6, 2}, {0, 0, -8, 0},
+      {10, 0, -8, 0}, {2, 0, -10, 2}, {11, 0, -10, 2}, {0, 0, -12, 0},
+      {10, 0, -12, 0}, {2, 0, -14, 2}, {11, 0, -14, 2}, {0, 0, -16, 0},
+      {10, 0, -16, 0}, {2, 0, -18, 2}, {11, 0, -18, 2}, {0, 0, -20, 0},
+      {10, 0, -20, 0}, {2, 0, -22, 2}, {11, 0, -22, 2}, {0, 0, -24, 0}}},
+    /* zigzag3 */
+    {UINT64_C(0x0000266666666666), {1, 0, -1}, MODEL_ACYCLIC,
+     {0, -3, 3.5},
+     {-0.5, -3.5, 3},
+     4.64411068, 4.93700409,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {17, 0, 0, 2}, {0, 0, -2, 2}, {10, 0, -2, 2},
+      {7, 0, -2, 4}, {17, 0, -2, 4}, {0, 0, -4, 4}, {10, 0, -4, 4},
+      {7, 0, -4, 6}, {17, 0, -4, 6}, {0, 0, -6, 6}, {10, 0, -6, 6},
+      {7, 0, -6, 8}, {17, 0, -6, 8}, {0, 0, -8, 8}, {10, 0, -8, 8},
+      {7, 0, -8, 10}, {17, 0, -8, 10}, {0, 0, -10, 10}, {10, 0, -10, 10},
+      {7, 0, -10, 12}, {17, 0, -10, 12}, {5, 0, -12, 14}}},
+    /* caterpillar */
+    {UINT64_C(0x000016f96f96f96f), {1, 0, -1}, MODEL_ACYCLIC,
+     {4.33333349, -0.166666672, 0.166666672},
+     {3.83333349, -0.666666627, -0.333333343},
+     4.93991518, 5.23280811,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {5, 2, -2, 0}, {21, 2, 0, 0}, {9, 4, 0, 0},
+      {0, 4, 0, 0}, {14, 6, 0, 0}, {19, 6, -2, 0}, {5, 6, -2, 0}, {21, 6, 0, 0},
+      {9, 8, 0, 0}, {0, 8, 0, 0}, {14, 10, 0, 0}, {19, 10, -2, 0},
+      {5, 10, -2, 0}, {21, 10, 0, 0}, {9, 12, 0, 0}, {0, 12, 0, 0},
+      {14, 14, 0, 0}, {19, 14, -2, 0}, {5, 14, -2, 0}, {21, 14, 0, 0},
+      {9, 16, 0, 0}, {1, 16, 2, 2}}},
+    /* bow */
+    {UINT64_C(0x000017f757f757f7), {1, 1, 90}, MODEL_CYCLIC,
+     {-1.25, 0.75, -0.75},
+     {-1.75, 0.25, -1.25},
+     3.19457531, 3.48746848,
+     {{14, 2, 0, 0}, {18, 0, 0, 0}, {3, 0, 0, -2}, {12, -2, 0, -2},
+      {18, -2, 2, -2}, {2, -2, 0, -2}, {14, -2, 0, -4}, {18, -4, 0, -4},
+      {3, -4, 0, -6}, {13, -4, 0, -4}, {17, -4, 2, -4}, {1, -4, 2, -2},
+      {13, -2, 2, -2}, {16, -4, 2, -2}, {3, -4, 4, -2}, {13, -4, 4, 0},
+      {17, -4, 6, 0}, {0, -4, 4, 0}, {14, -2, 4, 0}, {19, -2, 2, 0},
+      {0, -2, 2, -2}, {15, -2, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* turtle */
+    {UINT64_C(0x00003f7565df9c1c), {1, 1, 0}, MODEL_CYCLIC,
+     {0.333333343, 1.08333337, 0.916666687},
+     {-0.166666672, 0.583333254, 0.416666687},
+     3.42280197, 3.71569538,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {21, 2, 0, 2}, {13, 4, 0, 4}, {21, 2, 2, 4},
+      {8, 2, 2, 6}, {6, 2, 2, 4}, {19, 2, 2, 4}, {0, 2, 2, 2}, {14, 4, 2, 2},
+      {18, 2, 2, 2}, {3, 2, 2, 0}, {13, 2, 2, 2}, {16, 0, 2, 2}, {6, 0, 2, 2},
+      {23, 0, 4, 2}, {8, -2, 4, 2}, {6, -2, 4, 0}, {22, -4, 4, 0},
+      {11, -2, 4, 0}, {5, -2, 2, 0}, {20, 0, 2, 0}, {11, 0, 2, 2},
+      {0, 0, 0, 0}}},
+    /* basket */
+    {UINT64_C(0x00001826e091460b), {1, 1, 180}, MODEL_CYCLIC,
+     {-0.5, 0.583333313, -0.416666657},
+     {-1, 0.0833333731, -0.916666746},
+     2.4431622, 2.73605561,
+     {{14, 2, 0, 0}, {23, 2, 0, 0}, {12, 0, 0, -2}, {23, 2, 2, -2},
+      {13, 2, 2, -2}, {16, 0, 2, -2}, {7, 0, 4, 0}, {20, 0, 2, 0},
+      {10, -2, 2, 0}, {2, -2, 0, 2}, {14, -2, 0, 0}, {23, -2, 0, 0},
+      {12, -4, 0, -2}, {23, -2, 2, -2}, {13, -2, 2, -2}, {17, -2, 4, -2},
+      {4, -2, 4, -2}, {22, -2, 2, -2}, {15, -2, 2, -2}, {20, 0, 0, -2},
+      {15, -2, 0, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* thing */
+    {UINT64_C(0x00001767ded767de), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.66666663, 0, -1.66666663},
+     {1.16666663, -0.5, -2.16666651},
+     4.11868858, 4.41158152,
+     {{10, 0, 0, 0}, {6, 0, -2, 0}, {23, 0, 0, 0}, {9, 0, 0, -2}, {4, 0, 2, -2},
+      {22, 0, 0, -2}, {15, 0, 0, -2}, {17, 2, 0, -2}, {1, 2, 0, 0},
+      {12, 2, 0, -2}, {19, 4, 0, -2}, {0, 4, 0, -4}, {10, 4, 0, -4},
+      {6, 4, -2, -4}, {23, 4, 0, -4}, {9, 4, 0, -6}, {4, 4, 2, -6},
+      {22, 4, 0, -6}, {15, 4, 0, -6}, {17, 6, 0, -6}, {1, 6, 0, -4},
+      {12, 6, 0, -6}, {19, 8, 0, -6}, {4, 8, 2, -8}}},
+    /* hexagon */
+    {UINT64_C(0x0000c100c100c100), {1, 1, 270}, MODEL_CYCLIC,
+     {0.333333343, -1.66666663, 2.33333325},
+     {-0.166666672, -2.16666651, 1.83333325},
+     3.66514659, 3.95804,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {15, 4, -4, 2}, {20, 6, -6, 2}, {15, 4, -6, 4}, {16, 4, -8, 4},
+      {7, 4, -6, 6}, {16, 2, -8, 6}, {7, 2, -6, 8}, {16, 0, -8, 8},
+      {3, 0, -6, 8}, {8, -2, -6, 10}, {3, -2, -4, 8}, {12, -4, -4, 8},
+      {23, -2, -2, 8}, {12, -4, -2, 6}, {23, -2, 0, 6}, {12, -4, 0, 4},
+      {19, -2, 0, 4}, {4, -2, 2, 2}, {19, 0, 0, 2}, {0, 0, 0, 0}}},
+    /* tri1 */
+    {UINT64_C(0x0000c4d0c4d0c4d0), {1, 1, 270}, MODEL_CYCLIC,
+     {-0.666666687, -0.666666687, 2.33333325},
+     {-1.16666675, -1.16666675, 1.83333325},
+     3.66514659, 3.95804,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {15, 2, -2, 2}, {16, 2, -4, 2},
+      {7, 2, -2, 4}, {20, 2, -4, 4}, {15, 0, -4, 6}, {16, 0, -6, 6},
+      {7, 0, -4, 8}, {16, -2, -6, 8}, {3, -2, -4, 8}, {12, -4, -4, 8},
+      {23, -2, -2, 8}, {8, -4, -2, 8}, {3, -4, 0, 6}, {12, -6, 0, 6},
+      {23, -4, 2, 6}, {12, -6, 2, 4}, {19, -4, 2, 4}, {0, -4, 2, 2},
+      {11, -2, 2, 4}, {4, -2, 2, 2}, {19, 0, 0, 2}, {0, 0, 0, 0}}},
+    /* triangle */
+    {UINT64_C(0x0000d000d000d000), {1, 1, 270}, MODEL_CYCLIC,
+     {1, -2, 2},
+     {0.5, -2.5, 1.5},
+     3.98582602, 4.27871943,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {11, 6, -4, 2}, {0, 6, -6, 0}, {15, 6, -6, 2}, {16, 6, -8, 2},
+      {7, 6, -6, 4}, {16, 4, -8, 4}, {7, 4, -6, 6}, {16, 2, -8, 6},
+      {7, 2, -6, 8}, {16, 0, -8, 8}, {3, 0, -6, 8}, {12, -2, -6, 8},
+      {23, 0, -4, 8}, {12, -2, -4, 6}, {23, 0, -2, 6}, {12, -2, -2, 4},
+      {23, 0, 0, 4}, {12, -2, 0, 2}, {19, 0, 0, 2}, {0, 0, 0, 0}}},
+    /* flower */
+    {UINT64_C(0x0000be4be4be4be4), {1, 1, 180}, MODEL_CYCLIC,
+     {-0.5, -0.166666672, -0.5},
+     {-1, -0.666666627, -1},
+     2.96788335, 3.26077676,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {18, 2, 0, 0}, {3, 2, 0, -2}, {12, 0, 0, -2},
+      {22, 0, 0, -2}, {14, 2, 0, -4}, {18, 0, 0, -4}, {7, 0, 0, -4},
+      {21, -2, 0, -4}, {8, -2, 0, -2}, {2, -2, 0, -2}, {10, -4, 0, -4},
+      {7, -4, 0, -2}, {17, -4, 0, -2}, {1, -4, 0, 0}, {13, -2, 0, 0},
+      {20, -2, 0, 0}, {15, -4, 0, 2}, {17, -2, 0, 2}, {4, -2, 0, 2},
+      {23, 0, 0, 2}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* crucifix */
+    {UINT64_C(0x000080a02288a228), {1, 1, 180}, MODEL_CYCLIC,
+     {-0.333333343, 0.666666687, 0.5},
+     {-0.833333254, 0.166666627, 0},
+     3.77123618, 4.06412935,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {9, 2, 2, 0},
+      {1, 2, 4, 2}, {8, 2, 4, 2}, {2, 2, 4, 2}, {10, 0, 4, 0}, {3, 0, 4, 0},
+      {8, -2, 4, 2}, {2, -2, 4, 2}, {11, -2, 4, 2}, {0, -2, 2, 0},
+      {10, -2, 2, 0}, {2, -2, 0, 2}, {10, -4, 0, 0}, {2, -4, -2, 2},
+      {11, -4, -2, 2}, {1, -4, -2, 2}, {9, -2, -2, 0}, {1, -2, 0, 2},
+      {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* kayak */
+    {UINT64_C(0x0000e06c001b099e), {1, 1, 270}, MODEL_CYCLIC,
+     {-0.583333313, 0, 0.583333313},
+     {-1.08333325, -0.5, 0.0833333731},
+     3.58180499, 3.87469816,
+     {{10, 0, 0, 0}, {6, 0, -2, 0}, {23, 0, 0, 0}, {13, 0, 0, 0},
+      {16, -2, 0, 0}, {6, -2, 0, 0}, {18, -4, 2, 0}, {6, -4, 0, -2},
+      {22, -6, 0, -2}, {15, -6, 0, -2}, {17, -4, 0, -2}, {5, -4, -2, 0},
+      {17, -2, 0, 0}, {5, -2, -2, 2}, {17, 0, 0, 2}, {5, 0, -2, 4},
+      {17, 2, 0, 4}, {1, 2, 0, 6}, {8, 2, 0, 6}, {6, 2, 0, 4}, {18, 0, 2, 4},
+      {6, 0, 0, 2}, {19, 0, 0, 2}, {0, 0, 0, 0}}},
+    /* bird */
+    {UINT64_C(0x000021c6ccce4f00), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.75, -3, 0.5},
+     {2.25, -3.5, 0},
+     4.07051277, 4.36340618,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {14, 6, -4, 0}, {19, 6, -6, 0}, {4, 6, -4, -2}, {22, 6, -6, -2},
+      {15, 6, -6, -2}, {16, 6, -8, -2}, {7, 6, -6, 0}, {21, 4, -6, 0},
+      {13, 6, -6, 2}, {17, 6, -4, 2}, {5, 6, -6, 4}, {20, 8, -6, 4},
+      {14, 8, -6, 4}, {18, 6, -6, 4}, {6, 6, -8, 2}, {22, 4, -8, 2},
+      {11, 6, -8, 2}, {0, 6, -10, 0}, {10, 6, -10, 0}, {2, 6, -12, 2}}},
+    /* seal */
+    {UINT64_C(0x00001f9539128797), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.458333343, -1.33333337, 1.04166663},
+     {-0.0416666865, -1.83333337, 0.541666746},
+     3.17143559, 3.46432877,
+     {{14, 2, 0, 0}, {18, 0, 0, 0}, {2, 0, -2, 0}, {11, 0, -2, 0},
+      {5, 0, -4, 0}, {21, 0, -2, 0}, {13, 2, -2, 2}, {20, 2, -2, 2},
+      {14, 2, -2, 2}, {22, 0, -4, 2}, {11, 2, -4, 2}, {0, 2, -6, 0},
+      {15, 2, -6, 2}, {21, 2, -6, 2}, {8, 2, -6, 4}, {3, 2, -4, 2},
+      {13, 2, -4, 4}, {16, 0, -4, 4}, {3, 0, -2, 4}, {9, 0, -2, 4},
+      {4, 0, 0, 4}, {23, 2, 0, 4}, {8, 0, 0, 4}, {3, 0, 2, 2}}},
+    /* dog */
+    {UINT64_C(0x000022880a208a00), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.5, -2.5, 0.5},
+     {-1, -3, 0},
+     3.86938453, 4.1622777,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {10, 4, -4, 0}, {3, 4, -4, 0}, {8, 2, -4, 2}, {2, 2, -4, 2},
+      {10, 0, -4, 0}, {2, 0, -6, 2}, {11, 0, -6, 2}, {0, 0, -8, 0},
+      {10, 0, -8, 0}, {3, 0, -8, 0}, {8, -2, -8, 2}, {3, -2, -6, 0},
+      {8, -4, -6, 2}, {2, -4, -6, 2}, {10, -6, -6, 0}, {3, -6, -6, 0},
+      {9, -6, -6, 0}, {1, -6, -4, 2}, {8, -6, -4, 2}, {3, -6, -2, 0}}},
+    /* frog */
+    {UINT64_C(0x000017539139bb5f), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.20833337, 1.04166663, -0.166666672},
+     {0.708333254, 0.541666746, -0.666666627},
+     2.88416505, 3.17705846,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {1, 2, 0, 0}, {12, 2, 0, -2},
+      {18, 2, 2, -2}, {7, 2, 2, -2}, {21, 0, 2, -2}, {12, 0, 2, -2},
+      {19, 2, 2, -2}, {5, 2, 2, -2}, {20, 4, 2, -2}, {15, 2, 2, 0},
+      {17, 4, 2, 0}, {5, 4, 0, 2}, {21, 4, 2, 2}, {12, 4, 2, 2}, {18, 4, 4, 2},
+      {6, 4, 2, 0}, {23, 4, 4, 0}, {8, 2, 4, 0}, {7, 2, 6, 0}, {20, 2, 4, 0},
+      {10, 0, 4, 0}, {2, 0, 2, 2}}},
+    /* quavers */
+    {UINT64_C(0x00003dd40d0c0f75), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.375, 0.875, 1.83333337},
+     {-0.875, 0.375, 1.33333337},
+     3.46404243, 3.7569356,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {1, 2, 0, 4}, {12, 2, 0, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {8, 0, 2, 2}, {3, 0, 4, 0}, {8, -2, 4, 2}, {7, -2, 6, 2},
+      {16, -4, 4, 2}, {7, -4, 6, 4}, {20, -4, 4, 4}, {11, -4, 4, 6},
+      {0, -4, 2, 4}, {11, -2, 2, 6}, {0, -2, 0, 4}, {15, -2, 0, 6},
+      {17, 0, 0, 6}, {1, 0, 0, 8}, {12, 0, 0, 6}, {18, 0, 2, 6}, {3, 0, 2, 4},
+      {8, -2, 2, 6}}},
+    /* fly */
+    {UINT64_C(0x00003dd483908f75), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.208333328, 0.333333343, -0.0416666679},
+     {-0.291666657, -0.166666672, -0.541666627},
+     2.88416505, 3.17705846,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {1, 2, 0, 4}, {12, 2, 0, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {8, 0, 2, 2}, {2, 0, 2, 2}, {10, -2, 2, 0}, {2, -2, 0, 2},
+      {14, -2, 0, 0}, {23, -2, 0, 0}, {9, -2, 0, -2}, {1, -2, 2, 0},
+      {9, 0, 2, -2}, {0, 0, 2, -2}, {11, 2, 2, 0}, {4, 2, 2, -2},
+      {22, 2, 0, -2}, {10, 2, 0, -4}, {7, 2, 0, -2}, {21, 0, 0, -2},
+      {8, 0, 0, 0}, {3, 0, 2, -2}}},
+    /* puppy */
+    {UINT64_C(0x000007b67bc0a288), {1, 0, -1}, MODEL_ACYCLIC,
+     {3.33333325, 0.333333343, 0.5},
+     {2.83333325, -0.166666672, 0},
+     3.6604476, 3.95334077,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {10, 4, 0, 0},
+      {2, 4, -2, 2}, {11, 4, -2, 2}, {1, 4, -2, 2}, {9, 6, -2, 0}, {1, 6, 0, 2},
+      {9, 8, 0, 0}, {4, 8, 2, 0}, {23, 10, 2, 0}, {13, 10, 2, 0},
+      {17, 10, 4, 0}, {0, 10, 2, 0}, {10, 10, 2, 0}, {7, 10, 2, 2},
+      {21, 8, 2, 2}, {12, 8, 2, 2}, {18, 8, 4, 2}, {2, 8, 2, 2}, {10, 6, 2, 0},
+      {2, 6, 0, 2}}},
+    /* stars */
+    {UINT64_C(0x00001ed9ec0ed9ed), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.0416666679, 0.5, 1.04166663},
+     {-0.541666627, 0, 0.541666746},
+     2.84878969, 3.14168286,
+     {{15, 0, 0, 2}, {16, 0, -2, 2}, {6, 0, -2, 2}, {22, -2, -2, 2},
+      {11, 0, -2, 2}, {1, 0, -2, 2}, {12, 0, -2, 0}, {18, 0, 0, 0},
+      {7, 0, 0, 0}, {21, -2, 0, 0}, {13, 0, 0, 2}, {21, -2, 2, 2},
+      {13, 0, 2, 4}, {17, 0, 4, 4}, {4, 0, 4, 4}, {23, 2, 4, 4}, {8, 0, 4, 4},
+      {2, 0, 4, 4}, {14, 0, 4, 2}, {19, 0, 2, 2}, {5, 0, 2, 2}, {20, 2, 2, 2},
+      {10, 0, 2, 2}, {2, 0, 0, 4}}},
+    /* mountains */
+    {UINT64_C(0x0000999bbb999bbb), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 0, -1},
+     {-0.5, -0.5, -1.5},
+     2.36541915, 2.65831232,
+     {{14, 2, 0, 0}, {23, 2, 0, 0}, {9, 2, 0, -2}, {0, 2, 0, -2},
+      {14, 4, 0, -2}, {23, 4, 0, -2}, {8, 2, 0, -2}, {2, 2, 0, -2},
+      {14, 2, 0, -4}, {23, 2, 0, -4}, {8, 0, 0, -4}, {2, 0, 0, -4},
+      {15, -2, 0, -4}, {21, -2, 0, -4}, {8, -2, 0, -2}, {2, -2, 0, -2},
+      {15, -4, 0, -2}, {21, -4, 0, -2}, {9, -2, 0, -2}, {0, -2, 0, -2},
+      {15, -2, 0, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* quad1 */
+    {UINT64_C(0x0000995bfb995bfb), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 1, -0.333333343},
+     {-0.5, 0.5, -0.833333254},
+     2.67207789, 2.96497107,
+     {{14, 2, 0, 0}, {23, 2, 0, 0}, {9, 2, 0, -2}, {4, 2, 2, -2},
+      {23, 4, 2, -2}, {13, 4, 2, -2}, {16, 2, 2, -2}, {3, 2, 4, -2},
+      {13, 2, 4, 0}, {20, 2, 4, 0}, {10, 0, 4, 0}, {3, 0, 4, 0}, {12, -2, 4, 0},
+      {22, -2, 4, 0}, {10, -2, 4, -2}, {6, -2, 2, -2}, {22, -4, 2, -2},
+      {15, -4, 2, -2}, {17, -2, 2, -2}, {0, -2, 0, -2}, {15, -2, 0, 0},
+      {21, -2, 0, 0}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* quad2 */
+    {UINT64_C(0x0000895bf8895bf8), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 1, 0.833333313},
+     {-0.5, 0.5, 0.333333313},
+     3.34233832, 3.63523149,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {13, 4, 0, 2}, {17, 4, 2, 2}, {1, 4, 2, 4},
+      {8, 4, 2, 4}, {6, 4, 2, 2}, {23, 4, 4, 2}, {8, 2, 4, 2}, {2, 2, 4, 2},
+      {10, 0, 4, 0}, {3, 0, 4, 0}, {8, -2, 4, 2}, {2, -2, 4, 2}, {15, -4, 4, 2},
+      {16, -4, 2, 2}, {2, -4, 2, 4}, {11, -4, 2, 4}, {4, -4, 2, 2},
+      {22, -4, 0, 2}, {11, -2, 0, 2}, {1, -2, 0, 2}, {9, 0, 0, 0},
+      {0, 0, 0, 0}}},
+    /* glasses */
+    {UINT64_C(0x0000885bc8885bc8), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 1, 0.333333343},
+     {-0.5, 0.5, -0.166666672},
+     3.38935304, 3.68224621,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {4, 4, 2, 0}, {23, 6, 2, 0},
+      {13, 6, 2, 0}, {16, 4, 2, 0}, {3, 4, 4, 0}, {8, 2, 4, 2}, {2, 2, 4, 2},
+      {10, 0, 4, 0}, {3, 0, 4, 0}, {8, -2, 4, 2}, {2, -2, 4, 2}, {10, -4, 4, 0},
+      {6, -4, 2, 0}, {22, -6, 2, 0}, {15, -6, 2, 0}, {17, -4, 2, 0},
+      {0, -4, 0, 0}, {11, -2, 0, 2}, {1, -2, 0, 2}, {9, 0, 0, 0},
+      {0, 0, 0, 0}}},
+    /* em */
+    {UINT64_C(0x0000881b08881b08), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 0.333333343, 1},
+     {-0.5, -0.166666672, 0.5},
+     3.51087403, 3.8037672,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {1, 4, 2, 2}, {13, 6, 2, 2},
+      {20, 6, 2, 2}, {10, 4, 2, 2}, {2, 4, 0, 4}, {10, 2, 0, 2}, {3, 2, 0, 2},
+      {8, 0, 0, 4}, {2, 0, 0, 4}, {10, -2, 0, 2}, {3, -2, 0, 2}, {8, -4, 0, 4},
+      {3, -4, 2, 2}, {12, -6, 2, 2}, {22, -6, 2, 2}, {11, -4, 2, 2},
+      {0, -4, 0, 0}, {11, -2, 0, 2}, {1, -2, 0, 2}, {9, 0, 0, 0},
+      {0, 0, 0, 0}}},
+    /* quad3 */
+    {UINT64_C(0x0000841b0c841b0c), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1, 1.16666663},
+     {-0.5, -1.5, 0.666666746},
+     3.58421946, 3.87711263,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {17, 4, 0, 2}, {5, 4, -2, 4},
+      {20, 6, -2, 4}, {14, 6, -2, 4}, {18, 4, -2, 4}, {6, 4, -4, 2},
+      {18, 2, -2, 2}, {2, 2, -4, 2}, {10, 0, -4, 0}, {3, 0, -4, 0},
+      {8, -2, -4, 2}, {7, -2, -2, 2}, {16, -4, -4, 2}, {7, -4, -2, 4},
+      {21, -6, -2, 4}, {12, -6, -2, 4}, {19, -4, -2, 4}, {4, -4, 0, 2},
+      {19, -2, -2, 2}, {1, -2, 0, 2}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* vee */
+    {UINT64_C(0x0000801b00801b00), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1, 0},
+     {-0.5, -1.5, -0.5},
+     3.66514659, 3.95804,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {14, 6, -4, 0}, {23, 6, -4, 0}, {8, 4, -4, 0}, {3, 4, -2, -2},
+      {8, 2, -2, 0}, {3, 2, 0, -2}, {8, 0, 0, 0}, {2, 0, 0, 0}, {10, -2, 0, -2},
+      {2, -2, -2, 0}, {10, -4, -2, -2}, {2, -4, -4, 0}, {15, -6, -4, 0},
+      {21, -6, -4, 0}, {9, -4, -4, 0}, {1, -4, -2, 2}, {9, -2, -2, 0},
+      {1, -2, 0, 2}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* square */
+    {UINT64_C(0x0000805bc0805bc0), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -2, 0.666666687},
+     {-0.5, -2.5, 0.166666627},
+     3.38935304, 3.68224621,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {5, 4, -4, 2},
+      {20, 6, -4, 2}, {14, 6, -4, 2}, {18, 4, -4, 2}, {2, 4, -6, 2},
+      {10, 2, -6, 0}, {2, 2, -8, 2}, {10, 0, -8, 0}, {3, 0, -8, 0},
+      {8, -2, -8, 2}, {3, -2, -6, 0}, {8, -4, -6, 2}, {7, -4, -4, 2},
+      {21, -6, -4, 2}, {12, -6, -4, 2}, {19, -4, -4, 2}, {1, -4, -2, 2},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* eagle */
+    {UINT64_C(0x0000905bc3905bc3), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -2, -0.5},
+     {-0.5, -2.5, -1},
+     3.44571948, 3.73861289,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {14, 2, -2, -2}, {19, 2, -4, -2},
+      {0, 2, -4, -4}, {10, 2, -4, -4}, {7, 2, -4, -2}, {20, 2, -6, -2},
+      {15, 0, -6, 0}, {20, 2, -8, 0}, {10, 0, -8, 0}, {3, 0, -8, 0},
+      {12, -2, -8, 0}, {23, 0, -6, 0}, {12, -2, -6, -2}, {18, -2, -4, -2},
+      {3, -2, -4, -4}, {9, -2, -4, -4}, {5, -2, -4, -2}, {21, -2, -2, -2},
+      {13, 0, -2, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* volcano */
+    {UINT64_C(0x0000935bd3935bd3), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -2, 0},
+     {-0.5, -2.5, -0.5},
+     3.30518293, 3.59807611,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {11, 2, -2, 0}, {5, 2, -4, 0},
+      {20, 4, -4, 0}, {14, 4, -4, 0}, {18, 2, -4, 0}, {2, 2, -6, 0},
+      {15, 0, -6, 0}, {20, 2, -8, 0}, {10, 0, -8, 0}, {3, 0, -8, 0},
+      {12, -2, -8, 0}, {23, 0, -6, 0}, {8, -2, -6, 0}, {7, -2, -4, 0},
+      {21, -4, -4, 0}, {12, -4, -4, 0}, {19, -2, -4, 0}, {1, -2, -2, 0},
+      {13, 0, -2, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* saddle */
+    {UINT64_C(0x0000931b13931b13), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1, -1},
+     {-0.5, -1.5, -1.5},
+     2.88655615, 3.17944956,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {11, 2, -2, 0}, {0, 2, -4, -2},
+      {14, 4, -4, -2}, {23, 4, -4, -2}, {8, 2, -4, -2}, {3, 2, -2, -4},
+      {12, 0, -2, -4}, {23, 2, 0, -4}, {8, 0, 0, -4}, {2, 0, 0, -4},
+      {15, -2, 0, -4}, {20, 0, -2, -4}, {10, -2, -2, -4}, {2, -2, -4, -2},
+      {15, -4, -4, -2}, {21, -4, -4, -2}, {9, -2, -4, -2}, {1, -2, -2, 0},
+      {13, 0, -2, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* c3d */
+    {UINT64_C(0x0000810830810830), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1, -1},
+     {-0.5, -1.5, -1.5},
+     2.88655615, 3.17944956,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {14, 4, -2, 0}, {22, 2, -4, 0},
+      {14, 4, -4, -2}, {23, 4, -4, -2}, {12, 2, -4, -4}, {23, 4, -2, -4},
+      {8, 2, -2, -4}, {3, 2, 0, -6}, {8, 0, 0, -4}, {2, 0, 0, -4},
+      {10, -2, 0, -6}, {2, -2, -2, -4}, {15, -4, -2, -4}, {20, -2, -4, -4},
+      {15, -4, -4, -2}, {21, -4, -4, -2}, {13, -2, -4, 0}, {21, -4, -2, 0},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* block */
+    {UINT64_C(0x0000e420e6ee6ca0), {1, 1, 270}, MODEL_CYCLIC,
+     {0.333333343, -1, 1},
+     {-0.166666672, -1.5, 0.5},
+     2.49440765, 2.78730083,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {3, 2, -2, 0},
+      {8, 0, -2, 2}, {7, 0, 0, 2}, {17, 0, 0, 2}, {0, 0, -2, 2}, {10, 0, -2, 2},
+      {6, 0, -4, 2}, {19, 0, -4, 2}, {0, 0, -4, 0}, {10, 0, -4, 0},
+      {7, 0, -4, 2}, {17, 0, -4, 2}, {1, 0, -4, 4}, {9, 2, -4, 2},
+      {1, 2, -2, 4}, {8, 2, -2, 4}, {3, 2, 0, 2}, {8, 0, 0, 4}, {6, 0, 0, 2},
+      {19, 0, 0, 2}, {0, 0, 0, 0}}},
+    /* duck */
+    {UINT64_C(0x0000190a23922899), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.45833337, 0.666666687, 1.04166663},
+     {0.958333373, 0.166666627, 0.541666746},
+     2.88416505, 3.17705846,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {9, 2, 0, 2}, {0, 2, 0, 2}, {11, 4, 0, 4},
+      {1, 4, 0, 4}, {8, 4, 0, 4}, {3, 4, 2, 2}, {9, 4, 2, 2}, {1, 4, 4, 4},
+      {12, 4, 4, 2}, {22, 4, 4, 2}, {10, 4, 4, 0}, {2, 4, 2, 2}, {11, 4, 2, 2},
+      {0, 4, 0, 0}, {10, 4, 0, 0}, {3, 4, 0, 0}, {8, 2, 0, 2}, {3, 2, 2, 0},
+      {13, 2, 2, 2}, {20, 2, 2, 2}, {10, 0, 2, 2}, {2, 0, 0, 4}}},
+    /* prayer */
+    {UINT64_C(0x000095df01b0177f), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -0.333333343, 0.75},
+     {-0.5, -0.833333254, 0.25},
+     3.29044008, 3.58333325,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {0, 2, -2, -2}, {15, 2, -2, 0},
+      {16, 2, -4, 0}, {3, 2, -2, 0}, {13, 2, -2, 2}, {21, 0, 0, 2},
+      {13, 2, 0, 4}, {21, 0, 2, 4}, {8, 0, 2, 6}, {2, 0, 2, 6}, {14, 0, 2, 4},
+      {22, -2, 0, 4}, {14, 0, 0, 2}, {22, -2, -2, 2}, {10, -2, -2, 0},
+      {6, -2, -4, 0}, {23, -2, -2, 0}, {9, -2, -2, -2}, {5, -2, -2, 0},
+      {21, -2, 0, 0}, {9, 0, 0, 0}, {0, 0, 0, 0}}},
+    /* giraffe */
+    {UINT64_C(0x000056d236fc06c0), {1, 1, 90}, MODEL_CYCLIC,
+     {0, 0.166666672, 1},
+     {-0.5, -0.333333343, 0.5},
+     3.75305128, 4.04594469,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {5, 4, -4, 2},
+      {16, 4, -4, 2}, {3, 4, -2, 2}, {8, 2, -2, 4}, {3, 2, 0, 2}, {8, 0, 0, 4},
+      {7, 0, 2, 4}, {21, -2, 2, 4}, {8, -2, 2, 6}, {2, -2, 2, 6},
+      {14, -2, 2, 4}, {19, -2, 0, 4}, {4, -2, 2, 2}, {18, -2, 2, 2},
+      {6, -2, 0, 0}, {23, -2, 2, 0}, {9, -2, 2, -2}, {0, -2, 2, -2},
+      {15, -2, 2, 0}, {17, 0, 2, 0}, {0, 0, 0, 0}}},
+    /* tie fighter */
+    {UINT64_C(0x00000d1bf5873976), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.666666687, 0, 0.5},
+     {-1.16666675, -0.5, 0},
+     3.0758853, 3.36877847,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {21, -2, 0, 2}, {9, 0, 0, 2}, {5, 0, 0, 4},
+      {16, 0, 0, 4}, {2, 0, 0, 6}, {10, -2, 0, 4}, {6, -2, -2, 4},
+      {23, -2, 0, 4}, {12, -4, 0, 2}, {22, -4, 0, 2}, {11, -2, 0, 2},
+      {4, -2, 0, 0}, {23, 0, 0, 0}, {9, 0, 0, -2}, {4, 0, 2, -2},
+      {18, 0, 2, -2}, {2, 0, 0, -2}, {10, -2, 0, -4}, {7, -2, 0, -2},
+      {21, -4, 0, -2}, {13, -2, 0, 0}, {21, -4, 2, 0}}},
+    /* Strong Arms */
+    {UINT64_C(0x00002820cfbcc20a), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.625, 1.25, -1.125},
+     {1.125, 0.75, -1.625},
+     4.30832195, 4.60121489,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {8, -2, 0, 2}, {3, -2, 2, 0}, {9, -2, 2, 0},
+      {1, -2, 4, 2}, {9, 0, 4, 0}, {4, 0, 6, 0}, {19, 2, 4, 0}, {0, 2, 4, -2},
+      {14, 4, 4, -2}, {23, 4, 4, -2}, {9, 4, 4, -4}, {4, 4, 6, -4},
+      {19, 6, 4, -4}, {0, 6, 4, -6}, {11, 8, 4, -4}, {0, 8, 2, -6},
+      {10, 8, 2, -6}, {2, 8, 0, -4}, {10, 6, 0, -6}, {3, 6, 0, -6},
+      {9, 6, 0, -6}, {1, 6, 2, -4}}},
+    /* cool looking gegl */
+    {UINT64_C(0x000002d28812830a), {1, 0, -1}, MODEL_ACYCLIC,
+     {-2.66666675, 0.0833333358, -0.333333343},
+     {-3.16666675, -0.416666687, -0.833333254},
+     4.15614033, 4.44903374,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {8, -2, 0, 2}, {3, -2, 2, 0}, {12, -4, 2, 0},
+      {23, -2, 4, 0}, {12, -4, 4, -2}, {22, -4, 4, -2}, {15, -4, 4, -2},
+      {20, -2, 2, -2}, {10, -4, 2, -2}, {2, -4, 0, 0}, {10, -6, 0, -2},
+      {3, -6, 0, -2}, {8, -8, 0, 0}, {2, -8, 0, 0}, {11, -8, 0, 0},
+      {0, -8, -2, -2}, {15, -8, -2, 0}, {16, -8, -4, 0}, {6, -8, -4, 0},
+      {18, -10, -2, 0}, {6, -10, -4, -2}, {18, -12, -2, -2}}},
+    /* knuckledusters */
+    {UINT64_C(0x0000328a3ca28e00), {1, 1, 180}, MODEL_CYCLIC,
+     {0.5, -1.5, 0.5},
+     {0, -2, 0},
+     2.94317484, 3.23606801,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {10, 4, -4, 0}, {6, 4, -6, 0}, {18, 2, -4, 0}, {7, 2, -4, 0},
+      {17, 2, -4, 0}, {5, 2, -6, 2}, {16, 2, -6, 2}, {6, 2, -6, 2},
+      {18, 0, -4, 2}, {3, 0, -4, 0}, {12, -2, -4, 0}, {23, 0, -2, 0},
+      {13, 0, -2, 0}, {20, 0, -2, 0}, {15, -2, -2, 2}, {21, -2, -2, 2},
+      {12, -2, -2, 2}, {23, 0, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+#ifndef WIN32
+    /* k's turd */
+    {UINT64_C(0x00002dededededef), {1, 0, -1}, MODEL_ACYCLIC,
+     {1, -3, 0},
+     {0.5, -3.5, -0.5},
+     3.30518293, 3.59807611,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {5, 2, -2, 0}, {20, 4, -2, 0},
+      {10, 2, -2, 0}, {6, 2, -4, 0}, {19, 2, -4, 0}, {0, 2, -4, -2},
+      {15, 2, -4, 0}, {16, 2, -6, 0}, {6, 2, -6, 0}, {22, 0, -6, 0},
+      {11, 2, -6, 0}, {5, 2, -8, 0}, {16, 2, -8, 0}, {2, 2, -8, 2},
+      {14, 2, -8, 0}, {19, 2, -10, 0}, {5, 2, -10, 0}, {20, 4, -10, 0},
+      {10, 2, -10, 0}, {6, 2, -12, 0}, {19, 2, -12, 0}, {4, 2, -10, -2}}},
+#endif
+    /* lightsabre */
+    {UINT64_C(0x0000000000002800), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.25, 1.5, 0.5},
+     {-0.75, 1, 0},
+     7.95710659, 8.25,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {11, 6, -4, 2}, {1, 6, -4, 2}, {8, 6, -4, 2}, {3, 6, -2, 0},
+      {8, 4, -2, 2}, {3, 4, 0, 0}, {8, 2, 0, 2}, {3, 2, 2, 0}, {8, 0, 2, 2},
+      {3, 0, 4, 0}, {8, -2, 4, 2}, {3, -2, 6, 0}, {8, -4, 6, 2}, {3, -4, 8, 0},
+      {8, -6, 8, 2}, {3, -6, 10, 0}, {8, -8, 10, 2}, {3, -8, 12, 0},
+      {8, -10, 12, 2}, {3, -10, 14, 0}}},
+    /* not a stairway */
+    {UINT64_C(0x00001371d371d371), {1, 0, -1}, MODEL_ACYCLIC,
+     {3.25, -1.875, -0.375},
+     {2.75, -2.375, -0.875},
+     4.64014006, 4.93303299,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {11, 2, -2, 4}, {4, 2, -2, 2},
+      {23, 4, -2, 2}, {12, 2, -2, 0}, {19, 4, -2, 0}, {0, 4, -2, -2},
+      {15, 4, -2, 0}, {20, 6, -4, 0}, {11, 6, -4, 2}, {4, 6, -4, 0},
+      {23, 8, -4, 0}, {12, 6, -4, -2}, {19, 8, -4, -2}, {0, 8, -4, -4},
+      {15, 8, -4, -2}, {20, 10, -6, -2}, {11, 10, -6, 0}, {4, 10, -6, -2},
+      {23, 12, -6, -2}, {12, 10, -6, -4}, {19, 12, -6, -4}, {4, 12, -4, -6}}},
+    /* not very good (but accurate) gegl */
+    {UINT64_C(0x000022887284a028), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.54166663, 2.125, 0.833333313},
+     {1.04166663, 1.625, 0.333333313},
+     3.85673213, 4.1496253,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {8, 0, 2, 2},
+      {3, 0, 4, 0}, {9, 0, 4, 0}, {0, 0, 4, 0}, {11, 2, 4, 2}, {4, 2, 4, 0},
+      {19, 4, 2, 0}, {5, 4, 2, 0}, {16, 4, 2, 0}, {7, 4, 4, 2}, {21, 2, 4, 2},
+      {9, 4, 4, 2}, {1, 4, 6, 4}, {8, 4, 6, 4}, {3, 4, 8, 2}, {9, 4, 8, 2},
+      {0, 4, 8, 2}, {11, 6, 8, 4}, {1, 6, 8, 4}, {9, 8, 8, 2}}},
+    /* box */
+    {UINT64_C(0x0000000200800200), {1, 1, 180}, MODEL_CYCLIC,
+     {-0.5, -2.5, 0.5},
+     {-1, -3, 0},
+     3.86938453, 4.1622777,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {10, 4, -4, 0}, {2, 4, -6, 2}, {10, 2, -6, 0}, {2, 2, -8, 2},
+      {10, 0, -8, 0}, {2, 0, -10, 2}, {10, -2, -10, 0}, {3, -2, -10, 0},
+      {8, -4, -10, 2}, {3, -4, -8, 0}, {8, -6, -8, 2}, {3, -6, -6, 0},
+      {9, -6, -6, 0}, {1, -6, -4, 2}, {9, -4, -4, 0}, {1, -4, -2, 2},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* kissy box */
+    {UINT64_C(0x0000200200800202), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.58333337, -2.5, 0.5},
+     {1.08333337, -3, 0},
+     3.94854879, 4.24144173,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {2, -2, -4, 2},
+      {11, -2, -4, 2}, {0, -2, -6, 0}, {11, 0, -6, 2}, {0, 0, -8, 0},
+      {11, 2, -8, 2}, {0, 2, -10, 0}, {11, 4, -10, 2}, {1, 4, -10, 2},
+      {9, 6, -10, 0}, {1, 6, -8, 2}, {9, 8, -8, 0}, {1, 8, -6, 2},
+      {8, 8, -6, 2}, {3, 8, -4, 0}, {8, 6, -4, 2}, {3, 6, -2, 0}, {8, 4, -2, 2},
+      {3, 4, 0, 0}, {9, 4, 0, 0}, {1, 4, 2, 2}}},
+#ifndef WIN32
+    /* erect penis */
+    {UINT64_C(0x00000000c0a020a2), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.91666663, 0.5, 1.33333337},
+     {1.41666663, 0, 0.833333373},
+     6.27798843, 6.57088184,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {11, 0, -2, 2}, {1, 0, -2, 2},
+      {9, 2, -2, 0}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {8, 0, 2, 2},
+      {3, 0, 4, 0}, {9, 0, 4, 0}, {0, 0, 4, 0}, {11, 2, 4, 2}, {0, 2, 2, 0},
+      {11, 4, 2, 2}, {5, 4, 0, 2}, {17, 6, 2, 2}, {5, 6, 0, 4}, {17, 8, 2, 4},
+      {5, 8, 0, 6}, {17, 10, 2, 6}, {5, 10, 0, 8}, {17, 12, 2, 8},
+      {5, 12, 0, 10}}},
+    /* flaccid penis */
+    {UINT64_C(0x00000002c0a020a2), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.583333313, 0.5, 1.33333337},
+     {0.0833333731, 0, 0.833333373},
+     4.49762821, 4.79052162,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {11, 0, -2, 2}, {1, 0, -2, 2},
+      {9, 2, -2, 0}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {8, 0, 2, 2},
+      {3, 0, 4, 0}, {9, 0, 4, 0}, {0, 0, 4, 0}, {11, 2, 4, 2}, {0, 2, 2, 0},
+      {11, 4, 2, 2}, {5, 4, 0, 2}, {16, 4, 0, 2}, {7, 4, 2, 4}, {16, 2, 0, 4},
+      {7, 2, 2, 6}, {16, 0, 0, 6}, {7, 0, 2, 8}, {16, -2, 0, 8},
+      {7, -2, 2, 10}}},
+    /* vagina */
+    {UINT64_C(0x00003b9910108303), {1, 1, 0}, MODEL_CYCLIC,
+     {-1, -0.666666687, -0.5},
+     {-1.5, -1.16666675, -1},
+     3.75305128, 4.04594469,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {14, 2, -2, -2}, {22, 0, -4, -2},
+      {10, 0, -4, -4}, {2, 0, -6, -2}, {10, -2, -6, -4}, {3, -2, -6, -4},
+      {8, -4, -6, -2}, {3, -4, -4, -4}, {13, -4, -4, -2}, {21, -6, -2, -2},
+      {13, -4, -2, 0}, {21, -6, 0, 0}, {9, -4, 0, 0}, {1, -4, 2, 2},
+      {12, -4, 2, 0}, {22, -4, 2, 0}, {11, -2, 2, 0}, {1, -2, 2, 0},
+      {13, 0, 2, 0}, {20, 0, 2, 0}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+#endif
+    /* mask */
+    {UINT64_C(0x0000008222082f9c), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.79166663, -0.0416666679, 0.583333313},
+     {1.29166663, -0.541666627, 0.0833333731},
+     3.34694576, 3.63983917,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {21, 2, 0, 2}, {12, 2, 0, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {9, 2, 2, 0}, {1, 2, 4, 2}, {9, 4, 4, 0}, {0, 4, 4, 0},
+      {11, 6, 4, 2}, {0, 6, 2, 0}, {10, 6, 2, 0}, {2, 6, 0, 2}, {11, 6, 0, 2},
+      {0, 6, -2, 0}, {10, 6, -2, 0}, {2, 6, -4, 2}, {10, 4, -4, 0},
+      {3, 4, -4, 0}, {8, 2, -4, 2}, {3, 2, -2, 0}, {8, 0, -2, 2},
+      {3, 0, 0, 0}}},
+    /* poles or columns or something */
+    {UINT64_C(0x000010280740a01d), {1, 0, -1}, MODEL_ACYCLIC,
+     {-1.54166663, -0.458333343, 2},
+     {-2.04166651, -0.958333254, 1.5},
+     3.24090624, 3.53379941,
+     {{15, 0, 0, 2}, {16, 0, -2, 2}, {3, 0, 0, 2}, {8, -2, 0, 4}, {3, -2, 2, 2},
+      {8, -4, 2, 4}, {2, -4, 2, 4}, {11, -4, 2, 4}, {0, -4, 0, 2},
+      {11, -2, 0, 4}, {0, -2, -2, 2}, {15, -2, -2, 4}, {16, -2, -4, 4},
+      {3, -2, -2, 4}, {8, -4, -2, 6}, {3, -4, 0, 4}, {8, -6, 0, 6},
+      {2, -6, 0, 6}, {11, -6, 0, 6}, {0, -6, -2, 4}, {11, -4, -2, 6},
+      {0, -4, -4, 4}, {15, -4, -4, 6}, {20, -2, -6, 6}}},
+    /* crooked v */
+    {UINT64_C(0x000000280440a004), {1, 1, 90}, MODEL_CYCLIC,
+     {0.5, 0, -1},
+     {0, -0.5, -1.5},
+     4.09827185, 4.39116478,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {19, 4, -2, 0}, {4, 4, 0, -2},
+      {19, 6, -2, -2}, {4, 6, 0, -4}, {18, 6, 0, -4}, {7, 6, 0, -4},
+      {16, 4, -2, -4}, {7, 4, 0, -2}, {16, 2, -2, -2}, {3, 2, 0, -2},
+      {8, 0, 0, 0}, {6, 0, 0, -2}, {18, -2, 2, -2}, {6, -2, 0, -4},
+      {18, -4, 2, -4}, {7, -4, 2, -4}, {17, -4, 2, -4}, {5, -4, 0, -2},
+      {17, -2, 2, -2}, {5, -2, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* dog leg */
+    {UINT64_C(0x000000a00c40a004), {1, 1, 270}, MODEL_CYCLIC,
+     {0.5, 0, 0},
+     {0, -0.5, -0.5},
+     4.64411068, 4.93700409,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {19, 4, -2, 0}, {4, 4, 0, -2},
+      {19, 6, -2, -2}, {4, 6, 0, -4}, {18, 6, 0, -4}, {7, 6, 0, -4},
+      {16, 4, -2, -4}, {7, 4, 0, -2}, {16, 2, -2, -2}, {3, 2, 0, -2},
+      {8, 0, 0, 0}, {7, 0, 2, 0}, {16, -2, 0, 0}, {7, -2, 2, 2}, {16, -4, 0, 2},
+      {7, -4, 2, 4}, {17, -4, 2, 4}, {4, -4, 2, 4}, {19, -2, 0, 4},
+      {4, -2, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* scrubby */
+    {UINT64_C(0x0000090d00d00400), {1, 0, -1}, MODEL_ACYCLIC,
+     {3.375, -3.29166675, -1},
+     {2.875, -3.79166675, -1.5},
+     4.98601198, 5.27890491,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {11, 6, -4, 2}, {4, 6, -4, 0}, {19, 8, -6, 0}, {4, 8, -4, -2},
+      {19, 10, -6, -2}, {4, 10, -4, -4}, {22, 10, -6, -4}, {10, 10, -6, -6},
+      {2, 10, -8, -4}, {10, 8, -8, -6}, {2, 8, -10, -4}, {10, 6, -10, -6},
+      {7, 6, -10, -4}, {21, 4, -10, -4}, {13, 6, -10, -2}, {21, 4, -8, -2},
+      {9, 6, -8, -2}, {0, 6, -8, -2}, {11, 8, -8, 0}, {0, 8, -10, -2}}},
+    /* voltron's eyes */
+    {UINT64_C(0x00000c71209304e0), {1, 1, 180}, MODEL_CYCLIC,
+     {-1.16666663, -1.83333337, 0.166666672},
+     {-1.66666663, -2.33333302, -0.333333343},
+     3.70710659, 4,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {6, 2, -4, 0},
+      {18, 0, -2, 0}, {2, 0, -4, 0}, {10, -2, -4, -2}, {2, -2, -6, 0},
+      {15, -4, -6, 0}, {20, -2, -8, 0}, {10, -4, -8, 0}, {3, -4, -8, 0},
+      {8, -6, -8, 2}, {3, -6, -6, 0}, {9, -6, -6, 0}, {1, -6, -4, 2},
+      {12, -6, -4, 0}, {23, -4, -2, 0}, {9, -4, -2, -2}, {5, -4, -2, 0},
+      {17, -2, 0, 0}, {1, -2, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* flying toaster */
+    {UINT64_C(0x000020a328ca3282), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.791666687, 0.25, -0.0416666679},
+     {-1.29166651, -0.25, -0.541666627},
+     2.71317387, 3.00606704,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {3, -2, -2, 0},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {13, 0, 0, 2}, {21, -2, 2, 2},
+      {12, -2, 2, 2}, {22, -2, 2, 2}, {14, 0, 2, 0}, {19, 0, 0, 0},
+      {4, 0, 2, -2}, {18, 0, 2, -2}, {7, 0, 2, -2}, {16, -2, 0, -2},
+      {2, -2, 0, 0}, {10, -4, 0, -2}, {3, -4, 0, -2}, {9, -4, 0, -2},
+      {1, -4, 2, 0}, {9, -2, 2, -2}, {0, -2, 2, -2}, {11, 0, 2, 0}}},
+    /* dubbya */
+    {UINT64_C(0x000020a3280a3282), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.541666687, 0.5, -0.0416666679},
+     {-1.04166675, 0, -0.541666627},
+     2.99004459, 3.28293777,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {3, -2, -2, 0},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {13, 0, 0, 2}, {21, -2, 2, 2},
+      {12, -2, 2, 2}, {22, -2, 2, 2}, {14, 0, 2, 0}, {22, -2, 0, 0},
+      {14, 0, 0, -2}, {23, 0, 0, -2}, {13, 0, 0, -2}, {21, -2, 2, -2},
+      {8, -2, 2, 0}, {3, -2, 4, -2}, {9, -2, 4, -2}, {0, -2, 4, -2},
+      {11, 0, 4, 0}, {0, 0, 2, -2}, {10, 0, 2, -2}, {2, 0, 0, 0}}},
+    /* tap handle */
+    {UINT64_C(0x000020a3284a3282), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.291666657, 0.25, -0.0416666679},
+     {-0.791666746, -0.25, -0.541666627},
+     2.93928933, 3.23218274,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {3, -2, -2, 0},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {13, 0, 0, 2}, {21, -2, 2, 2},
+      {12, -2, 2, 2}, {22, -2, 2, 2}, {14, 0, 2, 0}, {18, -2, 2, 0},
+      {6, -2, 0, -2}, {19, -2, 0, -2}, {5, -2, 0, -2}, {17, 0, 2, -2},
+      {1, 0, 2, 0}, {9, 2, 2, -2}, {0, 2, 2, -2}, {10, 2, 2, -2}, {2, 2, 0, 0},
+      {10, 0, 0, -2}, {3, 0, 0, -2}, {8, -2, 0, 0}}},
+    /* wingnut */
+    {UINT64_C(0x000020a3288a3282), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.541666687, 0, -0.0416666679},
+     {-1.04166675, -0.5, -0.541666627},
+     2.85849524, 3.15138841,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {3, -2, -2, 0},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {13, 0, 0, 2}, {21, -2, 2, 2},
+      {12, -2, 2, 2}, {22, -2, 2, 2}, {14, 0, 2, 0}, {23, 0, 2, 0},
+      {12, -2, 2, -2}, {22, -2, 2, -2}, {15, -2, 2, -2}, {20, 0, 0, -2},
+      {11, 0, 0, 0}, {0, 0, -2, -2}, {10, 0, -2, -2}, {3, 0, -2, -2},
+      {8, -2, -2, 0}, {3, -2, 0, -2}, {9, -2, 0, -2}, {1, -2, 2, 0}}},
+    /* tight twist */
+    {UINT64_C(0x0000304737b73443), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.125, -0.0416666679, -1.66666663},
+     {-0.375, -0.541666627, -2.16666651},
+     2.9532454, 3.24613857,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {14, 2, -2, -2}, {18, 0, -2, -2},
+      {6, 0, -4, -4}, {23, 0, -2, -4}, {9, 0, -2, -6}, {1, 0, 0, -4},
+      {13, 2, 0, -4}, {16, 0, 0, -4}, {2, 0, 0, -2}, {11, 0, 0, -2},
+      {5, 0, -2, -2}, {21, 0, 0, -2}, {8, 0, 0, 0}, {3, 0, 2, -2},
+      {12, -2, 2, -2}, {19, 0, 2, -2}, {4, 0, 4, -4}, {22, 0, 2, -4},
+      {14, 2, 2, -6}, {22, 0, 0, -6}, {10, 0, 0, -8}, {2, 0, -2, -6}}},
+    /* double helix */
+    {UINT64_C(0x00000cccb7333333), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.0416666679, -3.70833325, 0},
+     {-0.458333313, -4.20833302, -0.5},
+     3.98635554, 4.27924871,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {10, 0, -2, -2}, {2, 0, -4, 0},
+      {15, -2, -4, 0}, {20, 0, -6, 0}, {11, 0, -6, 2}, {0, 0, -8, 0},
+      {14, 2, -8, 0}, {22, 0, -10, 0}, {10, 0, -10, -2}, {2, 0, -12, 0},
+      {15, -2, -12, 0}, {17, 0, -12, 0}, {1, 0, -12, 2}, {8, 0, -12, 2},
+      {3, 0, -10, 0}, {12, -2, -10, 0}, {23, 0, -8, 0}, {9, 0, -8, -2},
+      {1, 0, -6, 0}, {13, 2, -6, 0}, {21, 0, -4, 0}, {13, 2, -4, 2}}},
+    /* toadstool */
+    {UINT64_C(0x000027bf5df9c1cd), {1, 1, 90}, MODEL_CYCLIC,
+     {0.583333313, 0.416666657, 1.33333337},
+     {0.0833333731, -0.0833333135, 0.833333373},
+     2.8382256, 3.13111877,
+     {{15, 0, 0, 2}, {16, 0, -2, 2}, {7, 0, 0, 4}, {21, -2, 0, 4}, {9, 0, 0, 4},
+      {1, 0, 2, 6}, {9, 2, 2, 4}, {4, 2, 4, 4}, {22, 2, 2, 4}, {15, 2, 2, 4},
+      {16, 2, 0, 4}, {2, 2, 0, 6}, {14, 2, 0, 4}, {19, 2, -2, 4}, {1, 2, 0, 4},
+      {12, 2, 0, 2}, {18, 2, 2, 2}, {3, 2, 2, 0}, {12, 0, 2, 0}, {22, 0, 2, 0},
+      {10, 0, 2, -2}, {7, 0, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* AlanH2 */
+    {UINT64_C(0x0000375f5df9c1cd), {1, 1, 270}, MODEL_CYCLIC,
+     {0.541666687, 0.458333343, 1.58333337},
+     {0.0416666269, -0.0416666865, 1.08333337},
+     2.39344907, 2.68634224,
+     {{15, 0, 0, 2}, {16, 0, -2, 2}, {7, 0, 0, 4}, {21, -2, 0, 4}, {9, 0, 0, 4},
+      {1, 0, 2, 6}, {9, 2, 2, 4}, {4, 2, 4, 4}, {22, 2, 2, 4}, {15, 2, 2, 4},
+      {16, 2, 0, 4}, {2, 2, 0, 6}, {14, 2, 0, 4}, {19, 2, -2, 4}, {1, 2, 0, 4},
+      {12, 2, 0, 2}, {18, 2, 2, 2}, {3, 2, 2, 0}, {13, 2, 2, 2}, {16, 0, 2, 2},
+      {2, 0, 2, 4}, {14, 0, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* AlanH3 */
+    {UINT64_C(0x00002d9f5df9c1cd), {1, 1, 270}, MODEL_CYCLIC,
+     {0.583333313, 0.416666657, 1.58333337},
+     {0.0833333731, -0.0833333135, 1.08333337},
+     2.39653468, 2.68942809,
+     {{15, 0, 0, 2}, {16, 0, -2, 2}, {7, 0, 0, 4}, {21, -2, 0, 4}, {9, 0, 0, 4},
+      {1, 0, 2, 6}, {9, 2, 2, 4}, {4, 2, 4, 4}, {22, 2, 2, 4}, {15, 2, 2, 4},
+      {16, 2, 0, 4}, {2, 2, 0, 6}, {14, 2, 0, 4}, {19, 2, -2, 4}, {1, 2, 0, 4},
+      {12, 2, 0, 2}, {18, 2, 2, 2}, {3, 2, 2, 0}, {13, 2, 2, 2}, {20, 2, 2, 2},
+      {10, 0, 2, 2}, {6, 0, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* AlanH4 */
+    {UINT64_C(0x000002dc748dc760), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -0.416666657, 1.33333337},
+     {-0.5, -0.916666746, 0.833333373},
+     2.81693816, 3.10983157,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {7, 2, -2, 2},
+      {21, 0, -2, 2}, {9, 2, -2, 2}, {1, 2, 0, 4}, {13, 4, 0, 4}, {16, 2, 0, 4},
+      {2, 2, 0, 6}, {10, 0, 0, 4}, {3, 0, 0, 4}, {8, -2, 0, 6}, {6, -2, 0, 4},
+      {22, -4, 0, 4}, {11, -2, 0, 4}, {0, -2, -2, 2}, {14, 0, -2, 2},
+      {18, -2, -2, 2}, {3, -2, -2, 0}, {9, -2, -2, 0}, {1, -2, 0, 2},
+      {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Alien */
+    {UINT64_C(0x0000285f528de0b7), {1, 1, 0}, MODEL_CYCLIC,
+     {0.5, 0.5, -0.5},
+     {0, 0, -1},
+     2.43915749, 2.7320509,
+     {{14, 2, 0, 0}, {18, 0, 0, 0}, {3, 0, 0, -2}, {9, 0, 0, -2}, {1, 0, 2, 0},
+      {9, 2, 2, -2}, {0, 2, 2, -2}, {14, 4, 2, -2}, {18, 2, 2, -2},
+      {3, 2, 2, -4}, {8, 0, 2, -2}, {2, 0, 2, -2}, {11, 0, 2, -2},
+      {0, 0, 0, -4}, {15, 0, 0, -2}, {17, 2, 0, -2}, {1, 2, 0, 0},
+      {13, 4, 0, 0}, {16, 2, 0, 0}, {3, 2, 2, 0}, {8, 0, 2, 2}, {2, 0, 2, 2},
+      {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Angel */
+    {UINT64_C(0x00001c1e57dd7f9c), {1, 1, 0}, MODEL_CYCLIC,
+     {0.833333313, 1.08333337, 0.916666687},
+     {0.333333313, 0.583333254, 0.416666687},
+     2.81858349, 3.11147666,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {21, 2, 0, 2}, {12, 2, 0, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {12, 0, 2, 0}, {19, 2, 2, 0}, {1, 2, 4, 0}, {13, 4, 4, 0},
+      {16, 2, 4, 0}, {2, 2, 4, 2}, {15, 0, 4, 2}, {17, 2, 4, 2}, {0, 2, 2, 2},
+      {15, 2, 2, 4}, {21, 2, 2, 4}, {8, 2, 2, 6}, {6, 2, 2, 4}, {18, 0, 4, 4},
+      {6, 0, 2, 2}, {22, -2, 2, 2}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* AnotherFigure */
+    {UINT64_C(0x000009f9c8797839), {1, 1, 0}, MODEL_CYCLIC,
+     {-0.833333313, 0.333333343, 1},
+     {-1.33333349, -0.166666672, 0.5},
+     2.54800034, 2.84089351,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {8, 0, 0, 4}, {3, 0, 2, 2}, {8, -2, 2, 4},
+      {2, -2, 2, 4}, {15, -4, 2, 4}, {17, -2, 2, 4}, {0, -2, 0, 4},
+      {10, -2, 0, 4}, {6, -2, -2, 4}, {23, -2, 0, 4}, {12, -4, 0, 2},
+      {22, -4, 0, 2}, {14, -2, 0, 0}, {19, -2, -2, 0}, {1, -2, 0, 0},
+      {8, -2, 0, 0}, {7, -2, 2, 0}, {21, -4, 2, 0}, {9, -2, 2, 0},
+      {0, -2, 2, 0}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Ball */
+    {UINT64_C(0x000037dd77dd77dd), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.5, -0.5, 0.5},
+     {-1, -1, 0},
+     2.12132025, 2.41421366,
+     {{15, 0, 0, 2}, {16, 0, -2, 2}, {3, 0, 0, 2}, {12, -2, 0, 2},
+      {18, -2, 2, 2}, {2, -2, 0, 2}, {15, -4, 0, 2}, {17, -2, 0, 2},
+      {0, -2, -2, 2}, {14, 0, -2, 2}, {18, -2, -2, 2}, {3, -2, -2, 0},
+      {12, -4, -2, 0}, {19, -2, -2, 0}, {0, -2, -2, -2}, {15, -2, -2, 0},
+      {17, 0, -2, 0}, {1, 0, -2, 2}, {12, 0, -2, 0}, {18, 0, 0, 0},
+      {3, 0, 0, -2}, {13, 0, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Basket */
+    {UINT64_C(0x0000116d1e51cf3c), {1, 1, 270}, MODEL_CYCLIC,
+     {0.166666672, -1, 1.5},
+     {-0.333333343, -1.5, 1},
+     2.62920046, 2.92209387,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {20, 4, -2, 2}, {15, 2, -2, 4},
+      {16, 2, -4, 4}, {2, 2, -4, 6}, {10, 0, -4, 4}, {6, 0, -6, 4},
+      {23, 0, -4, 4}, {12, -2, -4, 2}, {19, 0, -4, 2}, {1, 0, -2, 2},
+      {8, 0, -2, 2}, {7, 0, 0, 2}, {20, 0, -2, 2}, {15, -2, -2, 4},
+      {17, 0, -2, 4}, {1, 0, -2, 6}, {8, 0, -2, 6}, {6, 0, -2, 4},
+      {23, 0, 0, 4}, {12, -2, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Beetle */
+    {UINT64_C(0x00003b4f75df7536), {1, 1, 90}, MODEL_CYCLIC,
+     {-1, 0.5, 1},
+     {-1.5, 0, 0.5},
+     2.57793546, 2.87082863,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {21, -2, 0, 2}, {13, 0, 0, 4},
+      {16, -2, 0, 4}, {3, -2, 2, 4}, {12, -4, 2, 4}, {19, -2, 2, 4},
+      {0, -2, 2, 2}, {14, 0, 2, 2}, {18, -2, 2, 2}, {3, -2, 2, 0},
+      {13, -2, 2, 2}, {16, -4, 2, 2}, {2, -4, 2, 4}, {14, -4, 2, 2},
+      {19, -4, 0, 2}, {0, -4, 0, 0}, {11, -2, 0, 2}, {4, -2, 0, 0},
+      {23, 0, 0, 0}, {13, 0, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* bone */
+    {UINT64_C(0x00002b28c0004a1a), {1, 0, -1}, MODEL_ACYCLIC,
+     {-2.70833325, 0.5, -2.20833325},
+     {-3.20833325, 0, -2.70833325},
+     5.13750982, 5.43040323,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {13, 0, 0, 2}, {21, -2, 2, 2},
+      {12, -2, 2, 2}, {22, -2, 2, 2}, {14, 0, 2, 0}, {18, -2, 2, 0},
+      {6, -2, 0, -2}, {18, -4, 2, -2}, {6, -4, 0, -4}, {18, -6, 2, -4},
+      {6, -6, 0, -6}, {18, -8, 2, -6}, {6, -8, 0, -8}, {22, -10, 0, -8},
+      {14, -8, 0, -10}, {23, -8, 0, -10}, {13, -8, 0, -10}, {21, -10, 2, -10},
+      {8, -10, 2, -8}, {2, -10, 2, -8}, {11, -10, 2, -8}, {0, -10, 0, -10}}},
+    /* Bow */
+    {UINT64_C(0x00003dd5fdd5fdd5), {1, 1, 270}, MODEL_CYCLIC,
+     {-0.25, -0.25, 0.25},
+     {-0.75, -0.75, -0.25},
+     3.19457531, 3.48746848,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {0, 2, -2, 2}, {14, 4, -2, 2},
+      {18, 2, -2, 2}, {3, 2, -2, 0}, {12, 0, -2, 0}, {18, 0, 0, 0},
+      {2, 0, -2, 0}, {14, 0, -2, -2}, {18, -2, -2, -2}, {3, -2, -2, -4},
+      {13, -2, -2, -2}, {17, -2, 0, -2}, {1, -2, 0, 0}, {13, 0, 0, 0},
+      {16, -2, 0, 0}, {3, -2, 2, 0}, {13, -2, 2, 2}, {17, -2, 4, 2},
+      {0, -2, 2, 2}, {14, 0, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* bra */
+    {UINT64_C(0x000015f75fd5f75f), {1, 1, 270}, MODEL_CYCLIC,
+     {-0.5, 0, 0.5},
+     {-1, -0.5, 0},
+     3.57938814, 3.87228131,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {1, 2, 0, 0}, {12, 2, 0, -2},
+      {18, 2, 2, -2}, {2, 2, 0, -2}, {15, 0, 0, -2}, {16, 0, -2, -2},
+      {3, 0, 0, -2}, {13, 0, 0, 0}, {16, -2, 0, 0}, {2, -2, 0, 2},
+      {15, -4, 0, 2}, {16, -4, -2, 2}, {3, -4, 0, 2}, {13, -4, 0, 4},
+      {17, -4, 2, 4}, {0, -4, 0, 4}, {14, -2, 0, 4}, {19, -2, -2, 4},
+      {1, -2, 0, 4}, {12, -2, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* bronchosaurus */
+    {UINT64_C(0x0000200002882288), {1, 0, -1}, MODEL_ACYCLIC,
+     {2, -3, 0.5},
+     {1.5, -3.5, 0},
+     5.85492182, 6.14781523,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {10, 4, 0, 0},
+      {2, 4, -2, 2}, {11, 4, -2, 2}, {0, 4, -4, 0}, {11, 6, -4, 2},
+      {1, 6, -4, 2}, {9, 8, -4, 0}, {0, 8, -4, 0}, {10, 8, -4, 0},
+      {2, 8, -6, 2}, {10, 6, -6, 0}, {2, 6, -8, 2}, {10, 4, -8, 0},
+      {2, 4, -10, 2}, {10, 2, -10, 0}, {2, 2, -12, 2}, {10, 0, -12, 0},
+      {2, 0, -14, 2}, {11, 0, -14, 2}, {0, 0, -16, 0}}},
+    /* Cactus */
+    {UINT64_C(0x0000026c1b81b286), {1, 1, 270}, MODEL_CYCLIC,
+     {-1.08333337, 0, 1.08333337},
+     {-1.58333337, -0.5, 0.583333254},
+     2.46699953, 2.7598927,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {16, -2, -2, 2}, {6, -2, -2, 2},
+      {19, -2, -2, 2}, {4, -2, 0, 0}, {23, 0, 0, 0}, {13, 0, 0, 0},
+      {16, -2, 0, 0}, {7, -2, 2, 2}, {16, -4, 0, 2}, {6, -4, 0, 2},
+      {22, -6, 0, 2}, {15, -6, 0, 2}, {17, -4, 0, 2}, {5, -4, -2, 4},
+      {17, -2, 0, 4}, {1, -2, 0, 6}, {8, -2, 0, 6}, {6, -2, 0, 4},
+      {19, -2, 0, 4}, {4, -2, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Camel */
+    {UINT64_C(0x000010eced9ecee3), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1.66666663, -0.333333343},
+     {-0.5, -2.16666651, -0.833333254},
+     3.08174109, 3.37463427,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {15, 0, -2, 0}, {16, 0, -4, 0},
+      {6, 0, -4, 0}, {22, -2, -4, 0}, {14, 0, -4, -2}, {19, 0, -6, -2},
+      {5, 0, -6, -2}, {20, 2, -6, -2}, {10, 0, -6, -2}, {3, 0, -6, -2},
+      {13, 0, -6, 0}, {17, 0, -4, 0}, {4, 0, -4, 0}, {23, 2, -4, 0},
+      {12, 0, -4, -2}, {18, 0, -2, -2}, {7, 0, -2, -2}, {21, -2, -2, -2},
+      {13, 0, -2, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Candlestick */
+    {UINT64_C(0x00003b1b19bb1b19), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 0.333333343, 2},
+     {-0.5, -0.166666672, 1.5},
+     2.67207789, 2.96497107,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {9, 2, 0, 2}, {1, 2, 2, 4}, {13, 4, 2, 4},
+      {20, 4, 2, 4}, {10, 2, 2, 4}, {2, 2, 0, 6}, {15, 0, 0, 6}, {21, 0, 0, 6},
+      {8, 0, 0, 8}, {2, 0, 0, 8}, {14, 0, 0, 6}, {23, 0, 0, 6}, {8, -2, 0, 6},
+      {3, -2, 2, 4}, {12, -4, 2, 4}, {22, -4, 2, 4}, {11, -2, 2, 4},
+      {0, -2, 0, 2}, {14, 0, 0, 2}, {23, 0, 0, 2}, {9, 0, 0, 0},
+      {1, 0, 2, 2}}},
+    /* Cat */
+    {UINT64_C(0x000000028a28ca28), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.33333325, 0.5, -0.333333343},
+     {1.83333325, 0, -0.833333254},
+     4.36618996, 4.65908289,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {9, 2, 2, 0},
+      {0, 2, 2, 0}, {11, 4, 2, 2}, {5, 4, 0, 2}, {17, 6, 2, 2}, {4, 6, 2, 2},
+      {18, 6, 2, 2}, {6, 6, 0, 0}, {19, 6, 0, 0}, {5, 6, 0, 0}, {17, 8, 2, 0},
+      {4, 8, 2, 0}, {18, 8, 2, 0}, {6, 8, 0, -2}, {18, 6, 2, -2}, {6, 6, 0, -4},
+      {18, 4, 2, -4}, {6, 4, 0, -6}, {18, 2, 2, -6}, {6, 2, 0, -8}}},
+    /* Cave */
+    {UINT64_C(0x0000027e5f9ca183), {1, 1, 90}, MODEL_CYCLIC,
+     {0.208333328, 0.208333328, -0.916666687},
+     {-0.291666657, -0.291666657, -1.41666651},
+     2.53569913, 2.82859254,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {14, 2, -2, -2}, {23, 2, -2, -2},
+      {8, 0, -2, -2}, {3, 0, 0, -4}, {9, 0, 0, -4}, {0, 0, 0, -4},
+      {11, 2, 0, -2}, {5, 2, -2, -2}, {21, 2, 0, -2}, {12, 2, 0, -2},
+      {18, 2, 2, -2}, {3, 2, 2, -4}, {13, 2, 2, -2}, {16, 0, 2, -2},
+      {6, 0, 2, -2}, {22, -2, 2, -2}, {10, -2, 2, -4}, {7, -2, 2, -2},
+      {17, -2, 2, -2}, {5, -2, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Chains */
+    {UINT64_C(0x00000be5820be582), {1, 1, 0}, MODEL_CYCLIC,
+     {-2, 0, 0.666666687},
+     {-2.5, -0.5, 0.166666627},
+     3.2620585, 3.55495167,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {3, -2, -2, 0},
+      {13, -2, -2, 2}, {16, -4, -2, 2}, {6, -4, -2, 2}, {22, -6, -2, 2},
+      {10, -6, -2, 0}, {3, -6, -2, 0}, {8, -8, -2, 2}, {3, -8, 0, 0},
+      {9, -8, 0, 0}, {1, -8, 2, 2}, {9, -6, 2, 0}, {0, -6, 2, 0},
+      {15, -6, 2, 2}, {17, -4, 2, 2}, {4, -4, 2, 2}, {23, -2, 2, 2},
+      {9, -2, 2, 0}, {0, -2, 2, 0}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Chair */
+    {UINT64_C(0x000017428a2837f7), {1, 1, 90}, MODEL_CYCLIC,
+     {-1, 0.0833333358, -0.0833333358},
+     {-1.5, -0.416666687, -0.583333373},
+     2.46699953, 2.7598927,
+     {{14, 2, 0, 0}, {18, 0, 0, 0}, {3, 0, 0, -2}, {12, -2, 0, -2},
+      {18, -2, 2, -2}, {2, -2, 0, -2}, {15, -4, 0, -2}, {20, -2, -2, -2},
+      {15, -4, -2, 0}, {21, -4, -2, 0}, {12, -4, -2, 0}, {23, -2, 0, 0},
+      {13, -2, 0, 0}, {20, -2, 0, 0}, {15, -4, 0, 2}, {21, -4, 0, 2},
+      {12, -4, 0, 2}, {23, -2, 2, 2}, {12, -4, 2, 0}, {19, -2, 2, 0},
+      {0, -2, 2, -2}, {15, -2, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Chick */
+    {UINT64_C(0x000015bb95bf99bf), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1.5, 0},
+     {-0.5, -2, -0.5},
+     2.82842708, 3.12132025,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {0, 2, -2, -2}, {10, 2, -2, -2},
+      {7, 2, -2, 0}, {17, 2, -2, 0}, {0, 2, -4, 0}, {10, 2, -4, 0},
+      {6, 2, -6, 0}, {22, 0, -6, 0}, {10, 0, -6, -2}, {3, 0, -6, -2},
+      {13, 0, -6, 0}, {16, -2, -6, 0}, {3, -2, -4, 0}, {9, -2, -4, 0},
+      {4, -2, -2, 0}, {18, -2, -2, 0}, {3, -2, -2, -2}, {9, -2, -2, -2},
+      {5, -2, -2, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Clockwise */
+    {UINT64_C(0x00003fffffffffff), {1, 0, -1}, MODEL_ACYCLIC,
+     {4.33333349, -4, -3.66666675},
+     {3.83333349, -4.5, -4.16666698},
+     7.36334896, 7.65624237,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {0, 2, -2, -2}, {14, 4, -2, -2},
+      {19, 4, -4, -2}, {0, 4, -4, -4}, {14, 6, -4, -4}, {19, 6, -6, -4},
+      {0, 6, -6, -6}, {14, 8, -6, -6}, {19, 8, -8, -6}, {0, 8, -8, -8},
+      {14, 10, -8, -8}, {19, 10, -10, -8}, {0, 10, -10, -10},
+      {14, 12, -10, -10}, {19, 12, -12, -10}, {0, 12, -12, -12},
+      {14, 14, -12, -12}, {19, 14, -14, -12}, {0, 14, -14, -14},
+      {14, 16, -14, -14}, {19, 16, -16, -14}, {4, 16, -14, -16}}},
+    /* cobra */
+    {UINT64_C(0x00003083455df75c), {1, 0, -1}, MODEL_ACYCLIC,
+     {3.04166675, 0.416666657, 0.291666657},
+     {2.54166675, -0.0833333135, -0.208333313},
+     3.9362061, 4.22909927,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {21, 2, 0, 2}, {9, 4, 0, 2}, {4, 4, 2, 2},
+      {22, 4, 0, 2}, {10, 4, 0, 0}, {6, 4, -2, 0}, {23, 4, 0, 0}, {9, 4, 0, -2},
+      {5, 4, 0, 0}, {21, 4, 2, 0}, {9, 6, 2, 0}, {5, 6, 2, 2}, {17, 8, 4, 2},
+      {0, 8, 2, 2}, {14, 10, 2, 2}, {22, 8, 0, 2}, {14, 10, 0, 0},
+      {23, 10, 0, 0}, {12, 8, 0, -2}, {23, 10, 2, -2}, {9, 10, 2, -4},
+      {1, 10, 4, -2}}},
+    /* Cobra3 */
+    {UINT64_C(0x00001020108ca284), {1, 0, -1}, MODEL_ACYCLIC,
+     {3.91666675, 0.666666687, 0.166666672},
+     {3.41666675, 0.166666627, -0.333333343},
+     5.34166861, 5.63456202,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {19, 4, -2, 0}, {5, 4, -2, 0},
+      {16, 4, -2, 0}, {7, 4, 0, 2}, {17, 4, 0, 2}, {4, 4, 0, 2}, {19, 6, -2, 2},
+      {0, 6, -2, 0}, {11, 8, -2, 2}, {1, 8, -2, 2}, {9, 10, -2, 0},
+      {1, 10, 0, 2}, {12, 10, 0, 0}, {23, 12, 2, 0}, {12, 10, 2, -2},
+      {23, 12, 4, -2}, {13, 12, 4, -2}, {21, 10, 6, -2}, {13, 12, 6, 0},
+      {21, 10, 8, 0}, {9, 12, 8, 0}, {1, 12, 10, 2}}},
+    /* Compact1 */
+    {UINT64_C(0x000024286e66e420), {1, 1, 270}, MODEL_CYCLIC,
+     {0.333333343, -1, 1},
+     {-0.166666672, -1.5, 0.5},
+     2.49440765, 2.78730083,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {2, 2, -4, 2},
+      {10, 0, -4, 0}, {7, 0, -4, 2}, {17, 0, -4, 2}, {1, 0, -4, 4},
+      {8, 0, -4, 4}, {6, 0, -4, 2}, {19, 0, -4, 2}, {1, 0, -2, 2},
+      {8, 0, -2, 2}, {7, 0, 0, 2}, {17, 0, 0, 2}, {0, 0, -2, 2}, {11, 2, -2, 4},
+      {1, 2, -2, 4}, {8, 2, -2, 4}, {3, 2, 0, 2}, {8, 0, 0, 4}, {6, 0, 0, 2},
+      {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Compact2 */
+    {UINT64_C(0x000000e6ec1b2839), {1, 1, 0}, MODEL_CYCLIC,
+     {-1, 1, 1},
+     {-1.5, 0.5, 0.5},
+     2.88655615, 3.17944956,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {8, 0, 0, 4}, {3, 0, 2, 2}, {8, -2, 2, 4},
+      {2, -2, 2, 4}, {11, -2, 2, 4}, {0, -2, 0, 2}, {14, 0, 0, 2},
+      {23, 0, 0, 2}, {8, -2, 0, 2}, {3, -2, 2, 0}, {8, -4, 2, 2}, {7, -4, 4, 2},
+      {17, -4, 4, 2}, {1, -4, 4, 4}, {8, -4, 4, 4}, {6, -4, 4, 2},
+      {19, -4, 4, 2}, {0, -4, 4, 0}, {11, -2, 4, 2}, {0, -2, 2, 0},
+      {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Compact3 */
+    {UINT64_C(0x0000239288a39288), {1, 1, 180}, MODEL_CYCLIC,
+     {1, -0.333333343, 0},
+     {0.5, -0.833333254, -0.5},
+     2.49440765, 2.78730083,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {10, 4, 0, 0},
+      {2, 4, -2, 2}, {14, 4, -2, 0}, {23, 4, -2, 0}, {9, 4, -2, -2},
+      {1, 4, 0, 0}, {8, 4, 0, 0}, {2, 4, 0, 0}, {10, 2, 0, -2}, {3, 2, 0, -2},
+      {8, 0, 0, 0}, {2, 0, 0, 0}, {11, 0, 0, 0}, {0, 0, -2, -2}, {15, 0, -2, 0},
+      {21, 0, -2, 0}, {8, 0, -2, 2}, {3, 0, 0, 0}, {9, 0, 0, 0},
+      {1, 0, 2, 2}}},
+    /* Compact4 */
+    {UINT64_C(0x0000020a26e2820e), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.333333343, 0, -1},
+     {-0.833333254, -0.5, -1.5},
+     2.49440765, 2.78730083,
+     {{10, 0, 0, 0}, {6, 0, -2, 0}, {18, -2, 0, 0}, {6, -2, -2, -2},
+      {19, -2, -2, -2}, {4, -2, 0, -4}, {19, 0, -2, -4}, {5, 0, -2, -4},
+      {16, 0, -2, -4}, {7, 0, 0, -2}, {17, 0, 0, -2}, {1, 0, 0, 0},
+      {8, 0, 0, 0}, {6, 0, 0, -2}, {19, 0, 0, -2}, {4, 0, 2, -4},
+      {18, 0, 2, -4}, {7, 0, 2, -4}, {16, -2, 0, -4}, {7, -2, 2, -2},
+      {17, -2, 2, -2}, {5, -2, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Compact5 */
+    {UINT64_C(0x00001bb39bb99b91), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -0.666666687, 0},
+     {-0.5, -1.16666675, -0.5},
+     2.49440765, 2.78730083,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {10, 0, -2, 2}, {3, 0, -2, 2},
+      {12, -2, -2, 2}, {22, -2, -2, 2}, {11, 0, -2, 2}, {1, 0, -2, 2},
+      {12, 0, -2, 0}, {22, 0, -2, 0}, {10, 0, -2, -2}, {3, 0, -2, -2},
+      {12, -2, -2, -2}, {22, -2, -2, -2}, {11, 0, -2, -2}, {1, 0, -2, -2},
+      {13, 2, -2, -2}, {21, 0, 0, -2}, {8, 0, 0, 0}, {2, 0, 0, 0},
+      {15, -2, 0, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Contact */
+    {UINT64_C(0x00002e0bed6f6582), {1, 1, 90}, MODEL_CYCLIC,
+     {-1.16666663, -0.333333343, 0},
+     {-1.66666663, -0.833333254, -0.5},
+     2.72094774, 3.01384115,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {3, -2, -2, 0},
+      {13, -2, -2, 2}, {16, -4, -2, 2}, {6, -4, -2, 2}, {23, -4, 0, 2},
+      {9, -4, 0, 0}, {4, -4, 2, 0}, {18, -4, 2, 0}, {2, -4, 0, 0},
+      {14, -4, 0, -2}, {19, -4, -2, -2}, {5, -4, -2, -2}, {20, -2, -2, -2},
+      {11, -2, -2, 0}, {1, -2, -2, 0}, {9, 0, -2, -2}, {1, 0, 0, 0},
+      {8, 0, 0, 0}, {7, 0, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Contact2 */
+    {UINT64_C(0x000018f94b98f94b), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 1, -0.5},
+     {-0.5, 0.5, -1},
+     2.57793546, 2.87082863,
+     {{14, 2, 0, 0}, {23, 2, 0, 0}, {12, 0, 0, -2}, {19, 2, 0, -2},
+      {1, 2, 2, -2}, {8, 2, 2, -2}, {7, 2, 4, -2}, {21, 0, 4, -2},
+      {13, 2, 4, 0}, {20, 2, 4, 0}, {10, 0, 4, 0}, {3, 0, 4, 0}, {12, -2, 4, 0},
+      {22, -2, 4, 0}, {14, 0, 4, -2}, {18, -2, 4, -2}, {2, -2, 2, -2},
+      {11, -2, 2, -2}, {5, -2, 0, -2}, {20, 0, 0, -2}, {15, -2, 0, 0},
+      {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Cook */
+    {UINT64_C(0x000023364a19cca0), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.833333313, -1.08333337, 0.5},
+     {-1.33333349, -1.58333337, 0},
+     3.21404147, 3.50693464,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {3, 2, -2, 0},
+      {8, 0, -2, 2}, {7, 0, 0, 2}, {16, -2, -2, 2}, {2, -2, -2, 4},
+      {14, -2, -2, 2}, {23, -2, -2, 2}, {8, -4, -2, 2}, {3, -4, 0, 0},
+      {9, -4, 0, 0}, {0, -4, 0, 0}, {11, -2, 0, 2}, {4, -2, 0, 0},
+      {18, -2, 0, 0}, {2, -2, -2, 0}, {15, -4, -2, 0}, {20, -2, -4, 0},
+      {11, -2, -4, 2}, {0, -2, -6, 0}, {10, -2, -6, 0}, {2, -2, -8, 2}}},
+    /* Counterclockwise */
+    {UINT64_C(0x0000155555555555), {1, 0, -1}, MODEL_ACYCLIC,
+     {4.33333349, -4, 4.66666651},
+     {3.83333349, -4.5, 4.16666651},
+     7.36334896, 7.65624189,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {0, 2, -2, 2}, {15, 2, -2, 4},
+      {17, 4, -2, 4}, {0, 4, -4, 4}, {15, 4, -4, 6}, {17, 6, -4, 6},
+      {0, 6, -6, 6}, {15, 6, -6, 8}, {17, 8, -6, 8}, {0, 8, -8, 8},
+      {15, 8, -8, 10}, {17, 10, -8, 10}, {0, 10, -10, 10}, {15, 10, -10, 12},
+      {17, 12, -10, 12}, {0, 12, -12, 12}, {15, 12, -12, 14}, {17, 14, -12, 14},
+      {0, 14, -14, 14}, {15, 14, -14, 16}, {17, 16, -14, 16},
+      {5, 16, -16, 18}}},
+    /* Cradle */
+    {UINT64_C(0x0000305f2df75d85), {1, 1, 270}, MODEL_CYCLIC,
+     {0.583333313, 0.833333313, 2.16666675},
+     {0.0833333731, 0.333333313, 1.66666651},
+     2.8431077, 3.13600111,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {5, 2, -2, 4}, {16, 2, -2, 4}, {3, 2, 0, 4},
+      {12, 0, 0, 4}, {19, 2, 0, 4}, {1, 2, 2, 4}, {13, 4, 2, 4}, {16, 2, 2, 4},
+      {2, 2, 2, 6}, {15, 0, 2, 6}, {17, 2, 2, 6}, {1, 2, 2, 8}, {8, 2, 2, 8},
+      {3, 2, 4, 6}, {12, 0, 4, 6}, {18, 0, 6, 6}, {2, 0, 4, 6}, {14, 0, 4, 4},
+      {22, -2, 2, 4}, {14, 0, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Crankshaft */
+    {UINT64_C(0x0000380e61e58a28), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.95833337, 0.583333313, 0.125},
+     {1.45833337, 0.0833333731, -0.375},
+     2.69229484, 2.98518825,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {9, 2, 2, 0},
+      {0, 2, 2, 0}, {11, 4, 2, 2}, {1, 4, 2, 2}, {12, 4, 2, 0}, {19, 6, 2, 0},
+      {5, 6, 2, 0}, {20, 8, 2, 0}, {10, 6, 2, 0}, {2, 6, 0, 2}, {11, 6, 0, 2},
+      {4, 6, 0, 0}, {18, 6, 0, 0}, {3, 6, 0, -2}, {8, 4, 0, 0}, {3, 4, 2, -2},
+      {8, 2, 2, 0}, {2, 2, 2, 0}, {15, 0, 2, 0}, {20, 2, 0, 0}}},
+    /* Cross */
+    {UINT64_C(0x0000222880a02288), {1, 1, 180}, MODEL_CYCLIC,
+     {1.33333337, -1.33333337, 0.5},
+     {0.833333373, -1.83333337, 0},
+     3.77123594, 4.06412935,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {10, 4, 0, 0},
+      {2, 4, -2, 2}, {11, 4, -2, 2}, {0, 4, -4, 0}, {11, 6, -4, 2},
+      {0, 6, -6, 0}, {10, 6, -6, 0}, {3, 6, -6, 0}, {8, 4, -6, 2},
+      {3, 4, -4, 0}, {8, 2, -4, 2}, {2, 2, -4, 2}, {10, 0, -4, 0},
+      {3, 0, -4, 0}, {9, 0, -4, 0}, {1, 0, -2, 2}, {8, 0, -2, 2}, {3, 0, 0, 0},
+      {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Cross2 */
+    {UINT64_C(0x00000a04a0ca04a0), {1, 1, 270}, MODEL_CYCLIC,
+     {0, 0, 0},
+     {-0.5, -0.5, -0.5},
+     2.88655615, 3.17944956,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {3, 2, -2, 0},
+      {8, 0, -2, 2}, {6, 0, -2, 0}, {18, -2, 0, 0}, {6, -2, -2, -2},
+      {19, -2, -2, -2}, {5, -2, -2, -2}, {17, 0, 0, -2}, {1, 0, 0, 0},
+      {9, 2, 0, -2}, {1, 2, 2, 0}, {8, 2, 2, 0}, {2, 2, 2, 0}, {10, 0, 2, -2},
+      {7, 0, 2, 0}, {16, -2, 0, 0}, {7, -2, 2, 2}, {17, -2, 2, 2},
+      {4, -2, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Cross3 */
+    {UINT64_C(0x00000a04a0ca04a0), {1, 1, 270}, MODEL_CYCLIC,
+     {0, 0, 0},
+     {-0.5, -0.5, -0.5},
+     2.88655615, 3.17944956,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {3, 2, -2, 0},
+      {8, 0, -2, 2}, {6, 0, -2, 0}, {18, -2, 0, 0}, {6, -2, -2, -2},
+      {19, -2, -2, -2}, {5, -2, -2, -2}, {17, 0, 0, -2}, {1, 0, 0, 0},
+      {9, 2, 0, -2}, {1, 2, 2, 0}, {8, 2, 2, 0}, {2, 2, 2, 0}, {10, 0, 2, -2},
+      {7, 0, 2, 0}, {16, -2, 0, 0}, {7, -2, 2, 2}, {17, -2, 2, 2},
+      {4, -2, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* CrossVersion1 */
+    {UINT64_C(0x00002d9ee39bb9b2), {1, 1, 270}, MODEL_CYCLIC,
+     {0.5, -0.25, 1},
+     {0, -0.75, 0.5},
+     2.52713418, 2.82002759,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {15, -2, -2, 2}, {21, -2, -2, 2},
+      {9, 0, -2, 2}, {0, 0, -2, 2}, {14, 2, -2, 2}, {23, 2, -2, 2},
+      {9, 2, -2, 0}, {0, 2, -2, 0}, {15, 2, -2, 2}, {21, 2, -2, 2},
+      {8, 2, -2, 4}, {3, 2, 0, 2}, {9, 2, 0, 2}, {4, 2, 2, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {13, 2, 2, 2}, {20, 2, 2, 2}, {10, 0, 2, 2}, {6, 0, 0, 2},
+      {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* CrossVersion2 */
+    {UINT64_C(0x00003651e5be7167), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1.33333337, 0.666666687},
+     {-0.5, -1.83333337, 0.166666627},
+     2.78208995, 3.07498336,
+     {{14, 2, 0, 0}, {18, 0, 0, 0}, {7, 0, 0, 0}, {20, 0, -2, 0},
+      {10, -2, -2, 0}, {2, -2, -4, 2}, {15, -4, -4, 2}, {17, -2, -4, 2},
+      {4, -2, -4, 2}, {23, 0, -4, 2}, {9, 0, -4, 0}, {0, 0, -4, 0},
+      {15, 0, -4, 2}, {17, 2, -4, 2}, {4, 2, -4, 2}, {23, 4, -4, 2},
+      {8, 2, -4, 2}, {3, 2, -2, 0}, {13, 2, -2, 2}, {16, 0, -2, 2},
+      {6, 0, -2, 2}, {23, 0, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Crown */
+    {UINT64_C(0x0000084321c84321), {1, 1, 270}, MODEL_CYCLIC,
+     {-1.5, -1.5, 0.833333313},
+     {-2, -2, 0.333333313},
+     3.55510807, 3.84800124,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {14, 2, -2, 2}, {22, 0, -4, 2},
+      {10, 0, -4, 0}, {2, 0, -6, 2}, {10, -2, -6, 0}, {7, -2, -6, 2},
+      {16, -4, -8, 2}, {6, -4, -8, 2}, {18, -6, -6, 2}, {3, -6, -6, 0},
+      {13, -6, -6, 2}, {21, -8, -4, 2}, {12, -8, -4, 2}, {23, -6, -2, 2},
+      {9, -6, -2, 0}, {1, -6, 0, 2}, {9, -4, 0, 0}, {5, -4, 0, 2},
+      {17, -2, 2, 2}, {4, -2, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* DNAStrand */
+    {UINT64_C(0x00003bbbbbbbbbbb), {1, 0, -1}, MODEL_ACYCLIC,
+     {3.25, 0, -2.75},
+     {2.75, -0.5, -3.25},
+     4.99371386, 5.28660727,
+     {{14, 2, 0, 0}, {23, 2, 0, 0}, {9, 2, 0, -2}, {0, 2, 0, -2},
+      {14, 4, 0, -2}, {23, 4, 0, -2}, {9, 4, 0, -4}, {0, 4, 0, -4},
+      {14, 6, 0, -4}, {23, 6, 0, -4}, {9, 6, 0, -6}, {0, 6, 0, -6},
+      {14, 8, 0, -6}, {23, 8, 0, -6}, {9, 8, 0, -8}, {0, 8, 0, -8},
+      {14, 10, 0, -8}, {23, 10, 0, -8}, {9, 10, 0, -10}, {0, 10, 0, -10},
+      {14, 12, 0, -10}, {23, 12, 0, -10}, {9, 12, 0, -12}, {1, 12, 2, -10}}},
+    /* Diamond */
+    {UINT64_C(0x000010c1bdd6c10c), {1, 1, 0}, MODEL_CYCLIC,
+     {1, 1, 2.25},
+     {0.5, 0.5, 1.75},
+     3.06560206, 3.35849524,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {17, 4, 0, 2}, {5, 4, -2, 4}, {21, 4, 0, 4},
+      {13, 6, 0, 6}, {21, 4, 2, 6}, {8, 4, 2, 8}, {2, 4, 2, 8}, {14, 4, 2, 6},
+      {18, 2, 2, 6}, {3, 2, 2, 4}, {13, 2, 2, 6}, {17, 2, 4, 6}, {1, 2, 4, 8},
+      {8, 2, 4, 8}, {6, 2, 4, 6}, {18, 0, 6, 6}, {6, 0, 4, 4}, {22, -2, 4, 4},
+      {14, 0, 4, 2}, {22, -2, 2, 2}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Dog */
+    {UINT64_C(0x0000345dfd77d5df), {1, 1, 0}, MODEL_CYCLIC,
+     {0.75, 1.04166663, 0.0416666679},
+     {0.25, 0.541666746, -0.458333313},
+     2.90163922, 3.19453216,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {1, 2, 0, 0}, {13, 4, 0, 0}, {16, 2, 0, 0},
+      {3, 2, 2, 0}, {13, 2, 2, 2}, {17, 2, 4, 2}, {1, 2, 4, 4}, {12, 2, 4, 2},
+      {18, 2, 6, 2}, {2, 2, 4, 2}, {14, 2, 4, 0}, {19, 2, 2, 0}, {0, 2, 2, -2},
+      {14, 4, 2, -2}, {18, 2, 2, -2}, {3, 2, 2, -4}, {13, 2, 2, -2},
+      {16, 0, 2, -2}, {7, 0, 4, 0}, {20, 0, 2, 0}, {11, 0, 2, 2},
+      {0, 0, 0, 0}}},
+    /* DogFace */
+    {UINT64_C(0x000020a3d8a2d4a0), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.958333313, 0.166666672, 0.125},
+     {0.458333313, -0.333333343, -0.375},
+     2.4992578, 2.79215097,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {3, 2, -2, 0},
+      {8, 0, -2, 2}, {6, 0, -2, 0}, {23, 0, 0, 0}, {9, 0, 0, -2}, {0, 0, 0, -2},
+      {11, 2, 0, 0}, {1, 2, 0, 0}, {8, 2, 0, 0}, {3, 2, 2, -2}, {9, 2, 2, -2},
+      {5, 2, 2, 0}, {20, 4, 2, 0}, {11, 4, 2, 2}, {0, 4, 0, 0}, {10, 4, 0, 0},
+      {3, 4, 0, 0}, {8, 2, 0, 2}, {3, 2, 2, 0}, {9, 2, 2, 0}, {1, 2, 4, 2}}},
+    /* DoublePeak */
+    {UINT64_C(0x0000367c85ed9c20), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.291666657, -1.125, 0.583333313},
+     {-0.791666746, -1.625, 0.0833333731},
+     2.73383808, 3.02673101,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {2, 2, -4, 2},
+      {10, 0, -4, 0}, {6, 0, -6, 0}, {23, 0, -4, 0}, {13, 0, -4, 0},
+      {16, -2, -4, 0}, {2, -2, -4, 2}, {11, -2, -4, 2}, {5, -2, -6, 2},
+      {21, -2, -4, 2}, {9, 0, -4, 2}, {1, 0, -2, 4}, {8, 0, -2, 4},
+      {3, 0, 0, 2}, {12, -2, 0, 2}, {18, -2, 2, 2}, {2, -2, 0, 2},
+      {11, -2, 0, 2}, {4, -2, 0, 0}, {23, 0, 0, 0}, {12, -2, 0, -2}}},
+    /* DoubleRoof */
+    {UINT64_C(0x0000396d17dd77d4), {1, 1, 90}, MODEL_CYCLIC,
+     {0.416666657, -0.5, -0.416666657},
+     {-0.0833333135, -1, -0.916666746},
+     2.344347, 2.63724041,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {22, 2, -2, 0}, {10, 2, -2, -2},
+      {6, 2, -4, -2}, {23, 2, -2, -2}, {9, 2, -2, -4}, {5, 2, -2, -2},
+      {21, 2, 0, -2}, {8, 2, 0, 0}, {6, 2, 0, -2}, {22, 0, 0, -2},
+      {10, 0, 0, -4}, {7, 0, 0, -2}, {20, 0, -2, -2}, {15, -2, -2, 0},
+      {17, 0, -2, 0}, {1, 0, -2, 2}, {8, 0, -2, 2}, {6, 0, -2, 0},
+      {23, 0, 0, 0}, {13, 0, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* txoboggan */
+    {UINT64_C(0x0000200e402806c0), {1, 1, 180}, MODEL_CYCLIC,
+     {1, -1, 1},
+     {0.5, -1.5, 0.5},
+     2.88655615, 3.17944956,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {5, 4, -4, 2},
+      {16, 4, -4, 2}, {3, 4, -2, 2}, {8, 2, -2, 4}, {3, 2, 0, 2}, {8, 0, 0, 4},
+      {2, 0, 0, 4}, {11, 0, 0, 4}, {0, 0, -2, 2}, {11, 2, -2, 4}, {0, 2, -4, 2},
+      {11, 4, -4, 4}, {4, 4, -4, 2}, {18, 4, -4, 2}, {3, 4, -4, 0},
+      {8, 2, -4, 2}, {3, 2, -2, 0}, {8, 0, -2, 2}, {3, 0, 0, 0}, {9, 0, 0, 0},
+      {1, 0, 2, 2}}},
+    /* Doubled */
+    {UINT64_C(0x000019ed991d9ed9), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.458333343, 1.29166663, 0.25},
+     {-0.0416666865, 0.791666627, -0.25},
+     2.89212513, 3.1850183,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {9, 2, 0, 2}, {4, 2, 2, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {13, 2, 2, 2}, {20, 2, 2, 2}, {10, 0, 2, 2}, {6, 0, 0, 2},
+      {23, 0, 2, 2}, {12, -2, 2, 0}, {19, 0, 2, 0}, {5, 0, 2, 0}, {21, 0, 4, 0},
+      {12, 0, 4, 0}, {19, 2, 4, 0}, {0, 2, 4, -2}, {10, 2, 4, -2},
+      {6, 2, 2, -2}, {23, 2, 4, -2}, {13, 2, 4, -2}, {16, 0, 4, -2},
+      {7, 0, 6, 0}}},
+    /* Doubled1 */
+    {UINT64_C(0x000019ed93319ed9), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.458333343, -0.583333313, 2.125},
+     {-0.0416666865, -1.08333325, 1.625},
+     3.34957504, 3.64246821,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {9, 2, 0, 2}, {4, 2, 2, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {13, 2, 2, 2}, {20, 2, 2, 2}, {10, 0, 2, 2}, {2, 0, 0, 4},
+      {15, -2, 0, 4}, {20, 0, -2, 4}, {11, 0, -2, 6}, {0, 0, -4, 4},
+      {15, 0, -4, 6}, {21, 0, -4, 6}, {9, 2, -4, 6}, {4, 2, -2, 6},
+      {18, 2, -2, 6}, {3, 2, -2, 4}, {13, 2, -2, 6}, {20, 2, -2, 6},
+      {10, 0, -2, 6}, {2, 0, -4, 8}}},
+    /* Doubled2 */
+    {UINT64_C(0x000019ed97359ed9), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.458333343, 1.04166663, 2.66666675},
+     {-0.0416666865, 0.541666746, 2.16666675},
+     3.36660242, 3.65949583,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {9, 2, 0, 2}, {4, 2, 2, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {13, 2, 2, 2}, {20, 2, 2, 2}, {10, 0, 2, 2}, {7, 0, 2, 4},
+      {21, -2, 2, 4}, {13, 0, 2, 6}, {17, 0, 4, 6}, {0, 0, 2, 6}, {15, 0, 2, 8},
+      {21, 0, 2, 8}, {9, 2, 2, 8}, {4, 2, 4, 8}, {18, 2, 4, 8}, {3, 2, 4, 6},
+      {13, 2, 4, 8}, {20, 2, 4, 8}, {10, 0, 4, 8}, {2, 0, 2, 10}}},
+    /* DumblingSpoon */
+    {UINT64_C(0x00000030d0d0400a), {1, 1, 0}, MODEL_CYCLIC,
+     {-2.16666675, 2.16666675, -0.0833333358},
+     {-2.66666675, 1.66666651, -0.583333373},
+     4.52319145, 4.81608391,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {8, -2, 0, 2}, {3, -2, 2, 0}, {8, -4, 2, 2},
+      {3, -4, 4, 0}, {8, -6, 4, 2}, {6, -6, 4, 0}, {18, -8, 6, 0},
+      {6, -8, 4, -2}, {23, -8, 6, -2}, {9, -8, 6, -4}, {1, -8, 8, -2},
+      {9, -6, 8, -4}, {5, -6, 8, -2}, {20, -4, 8, -2}, {15, -6, 8, 0},
+      {20, -4, 6, 0}, {11, -4, 6, 2}, {0, -4, 4, 0}, {11, -2, 4, 2},
+      {0, -2, 2, 0}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Embrace */
+    {UINT64_C(0x000009b866ec9b82), {1, 1, 0}, MODEL_CYCLIC,
+     {-0.583333313, 0, -0.25},
+     {-1.08333325, -0.5, -0.75},
+     2.61833096, 2.91122413,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {3, -2, -2, 0},
+      {12, -4, -2, 0}, {22, -4, -2, 0}, {11, -2, -2, 0}, {1, -2, -2, 0},
+      {9, 0, -2, -2}, {4, 0, 0, -2}, {18, 0, 0, -2}, {3, 0, 0, -4},
+      {9, 0, 0, -4}, {5, 0, 0, -2}, {16, 0, 0, -2}, {3, 0, 2, -2},
+      {8, -2, 2, 0}, {2, -2, 2, 0}, {15, -4, 2, 0}, {21, -4, 2, 0},
+      {9, -2, 2, 0}, {0, -2, 2, 0}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* EndlessBelt */
+    {UINT64_C(0x000034767478d01c), {1, 1, 180}, MODEL_CYCLIC,
+     {0.416666657, 0.5, 2},
+     {-0.0833333135, 0, 1.5},
+     2.81034493, 3.10323834,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {21, 2, 0, 2}, {13, 4, 0, 4}, {21, 2, 2, 4},
+      {13, 4, 2, 6}, {16, 2, 2, 6}, {2, 2, 2, 8}, {10, 0, 2, 6}, {3, 0, 2, 6},
+      {12, -2, 2, 6}, {19, 0, 2, 6}, {4, 0, 4, 4}, {22, 0, 2, 4}, {10, 0, 2, 2},
+      {7, 0, 2, 4}, {17, 0, 2, 4}, {0, 0, 0, 4}, {14, 2, 0, 4}, {18, 0, 0, 4},
+      {6, 0, -2, 2}, {23, 0, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Entrance */
+    {UINT64_C(0x0000357dd5fdd7f5), {1, 1, 270}, MODEL_CYCLIC,
+     {0.75, 0.75, 2.25},
+     {0.25, 0.25, 1.75},
+     3.19457531, 3.48746848,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {1, 2, 0, 4}, {13, 4, 0, 4}, {17, 4, 2, 4},
+      {0, 4, 0, 4}, {15, 4, 0, 6}, {16, 4, -2, 6}, {3, 4, 0, 6}, {12, 2, 0, 6},
+      {18, 2, 2, 6}, {3, 2, 2, 4}, {13, 2, 2, 6}, {16, 0, 2, 6}, {3, 0, 4, 6},
+      {12, -2, 4, 6}, {19, 0, 4, 6}, {0, 0, 4, 4}, {14, 2, 4, 4}, {18, 0, 4, 4},
+      {2, 0, 2, 4}, {14, 0, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Esthetic */
+    {UINT64_C(0x00003e71b99b93e5), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.20833337, 0.416666657, -0.0416666679},
+     {0.708333254, -0.0833333135, -0.541666627},
+     2.63551283, 2.928406,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {4, 2, 0, 2}, {23, 4, 0, 2}, {9, 4, 0, 0},
+      {1, 4, 2, 2}, {12, 4, 2, 0}, {22, 4, 2, 0}, {10, 4, 2, -2}, {3, 4, 2, -2},
+      {13, 4, 2, 0}, {20, 4, 2, 0}, {10, 2, 2, 0}, {3, 2, 2, 0}, {12, 0, 2, 0},
+      {22, 0, 2, 0}, {11, 2, 2, 0}, {0, 2, 0, -2}, {14, 4, 0, -2},
+      {18, 2, 0, -2}, {7, 2, 0, -2}, {21, 0, 0, -2}, {8, 0, 0, 0},
+      {3, 0, 2, -2}}},
+    /* Explosion */
+    {UINT64_C(0x000015df577f5dff), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.25, -0.25, -0.5},
+     {-0.75, -0.75, -1},
+     3.07881498, 3.37170815,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {0, 2, -2, -2}, {14, 4, -2, -2},
+      {18, 2, -2, -2}, {3, 2, -2, -4}, {13, 2, -2, -2}, {16, 0, -2, -2},
+      {2, 0, -2, 0}, {15, -2, -2, 0}, {16, -2, -4, 0}, {3, -2, -2, 0},
+      {12, -4, -2, 0}, {19, -2, -2, 0}, {1, -2, 0, 0}, {12, -2, 0, -2},
+      {18, -2, 2, -2}, {3, -2, 2, -4}, {13, -2, 2, -2}, {17, -2, 4, -2},
+      {0, -2, 2, -2}, {15, -2, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* F-ZeroXCar */
+    {UINT64_C(0x0000367b41c1e5df), {1, 1, 180}, MODEL_CYCLIC,
+     {0.583333313, -0.0416666679, 0.0416666679},
+     {0.0833333731, -0.541666627, -0.458333313},
+     2.58071733, 2.87361073,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {1, 2, 0, 0}, {13, 4, 0, 0}, {16, 2, 0, 0},
+      {3, 2, 2, 0}, {9, 2, 2, 0}, {4, 2, 4, 0}, {22, 2, 2, 0}, {14, 4, 2, -2},
+      {22, 2, 0, -2}, {10, 2, 0, -4}, {7, 2, 0, -2}, {16, 0, -2, -2},
+      {7, 0, 0, 0}, {20, 0, -2, 0}, {11, 0, -2, 2}, {1, 0, -2, 2},
+      {13, 2, -2, 2}, {16, 0, -2, 2}, {6, 0, -2, 2}, {23, 0, 0, 2},
+      {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Face */
+    {UINT64_C(0x00003b6667be59ec), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.625, -0.25, -0.0416666679},
+     {0.125, -0.75, -0.541666627},
+     2.69579005, 2.98868322,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {16, 2, -2, 2}, {2, 2, -2, 4},
+      {14, 2, -2, 2}, {23, 2, -2, 2}, {8, 0, -2, 2}, {6, 0, -2, 0},
+      {19, 0, -2, 0}, {0, 0, -2, -2}, {14, 2, -2, -2}, {23, 2, -2, -2},
+      {9, 2, -2, -4}, {5, 2, -2, -2}, {16, 2, -2, -2}, {3, 2, 0, -2},
+      {9, 2, 0, -2}, {5, 2, 0, 0}, {16, 2, 0, 0}, {3, 2, 2, 0}, {12, 0, 2, 0},
+      {22, 0, 2, 0}, {10, 0, 2, -2}, {2, 0, 0, 0}}},
+    /* FaserGun */
+    {UINT64_C(0x000023eced9eced0), {1, 1, 180}, MODEL_CYCLIC,
+     {0.833333313, -1.66666663, 0.5},
+     {0.333333313, -2.16666651, 0},
+     3.25116277, 3.54405618,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {15, 2, -2, 2}, {16, 2, -4, 2},
+      {6, 2, -4, 2}, {22, 0, -4, 2}, {14, 2, -4, 0}, {19, 2, -6, 0},
+      {5, 2, -6, 0}, {20, 4, -6, 0}, {10, 2, -6, 0}, {3, 2, -6, 0},
+      {13, 2, -6, 2}, {17, 2, -4, 2}, {4, 2, -4, 2}, {23, 4, -4, 2},
+      {12, 2, -4, 0}, {18, 2, -2, 0}, {7, 2, -2, 0}, {21, 0, -2, 0},
+      {8, 0, -2, 2}, {3, 0, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* FelixW */
+    {UINT64_C(0x000004b341b0d18c), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.45833337, -0.583333313, -1.125},
+     {0.958333373, -1.08333325, -1.625},
+     3.53246307, 3.82535648,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {17, 4, 0, 2}, {4, 4, 0, 2}, {22, 4, -2, 2},
+      {14, 6, -2, 0}, {18, 4, -2, 0}, {3, 4, -2, -2}, {8, 2, -2, 0},
+      {3, 2, 0, -2}, {12, 0, 0, -2}, {22, 0, 0, -2}, {11, 2, 0, -2},
+      {0, 2, -2, -4}, {11, 4, -2, -2}, {4, 4, -2, -4}, {23, 6, -2, -4},
+      {12, 4, -2, -6}, {18, 4, 0, -6}, {7, 4, 0, -6}, {16, 2, -2, -6},
+      {3, 2, 0, -6}, {8, 0, 0, -4}, {3, 0, 2, -6}}},
+    /* Flamingo */
+    {UINT64_C(0x000020167b658008), {1, 0, -1}, MODEL_ACYCLIC,
+     {4.58333349, 1.75, 0.5},
+     {4.08333349, 1.25, 0},
+     5.36930704, 5.66220045,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {1, 4, 2, 2}, {9, 6, 2, 0},
+      {1, 6, 4, 2}, {9, 8, 4, 0}, {0, 8, 4, 0}, {15, 8, 4, 2}, {17, 10, 4, 2},
+      {4, 10, 4, 2}, {22, 10, 2, 2}, {10, 10, 2, 0}, {3, 10, 2, 0},
+      {12, 8, 2, 0}, {19, 10, 2, 0}, {5, 10, 2, 0}, {21, 10, 4, 0},
+      {9, 12, 4, 0}, {1, 12, 6, 2}, {9, 14, 6, 0}, {1, 14, 8, 2}, {8, 14, 8, 2},
+      {3, 14, 10, 0}}},
+    /* FlatOnTheTop */
+    {UINT64_C(0x0000208336f9ce28), {1, 1, 180}, MODEL_CYCLIC,
+     {1.41666663, 0.416666657, 0.5},
+     {0.916666627, -0.0833333135, 0},
+     2.83169818, 3.12459135,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {9, 2, 2, 0},
+      {4, 2, 4, 0}, {19, 4, 2, 0}, {0, 4, 2, -2}, {15, 4, 2, 0}, {21, 4, 2, 0},
+      {8, 4, 2, 2}, {7, 4, 4, 2}, {17, 4, 4, 2}, {0, 4, 2, 2}, {14, 6, 2, 2},
+      {22, 4, 0, 2}, {10, 4, 0, 0}, {2, 4, -2, 2}, {10, 2, -2, 0},
+      {3, 2, -2, 0}, {8, 0, -2, 2}, {3, 0, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Fly */
+    {UINT64_C(0x00003b666eed98e4), {1, 1, 180}, MODEL_CYCLIC,
+     {-0.416666657, 0.333333343, 0},
+     {-0.916666746, -0.166666672, -0.5},
+     2.8560729, 3.14896631,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {18, 2, 0, 0}, {3, 2, 0, -2}, {8, 0, 0, 0},
+      {2, 0, 0, 0}, {14, 0, 0, -2}, {23, 0, 0, -2}, {8, -2, 0, -2},
+      {7, -2, 2, -2}, {17, -2, 2, -2}, {1, -2, 2, 0}, {8, -2, 2, 0},
+      {7, -2, 4, 0}, {17, -2, 4, 0}, {0, -2, 2, 0}, {10, -2, 2, 0},
+      {7, -2, 2, 2}, {17, -2, 2, 2}, {0, -2, 0, 2}, {14, 0, 0, 2},
+      {23, 0, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Fountain */
+    {UINT64_C(0x00002ed6f5bd9bdd), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.916666687, 0, 0.0833333358},
+     {-1.41666651, -0.5, -0.416666687},
+     2.77202559, 3.06491852,
+     {{15, 0, 0, 2}, {16, 0, -2, 2}, {3, 0, 0, 2}, {12, -2, 0, 2},
+      {18, -2, 2, 2}, {7, -2, 2, 2}, {20, -2, 0, 2}, {14, -2, 0, 2},
+      {18, -4, 0, 2}, {3, -4, 0, 0}, {12, -6, 0, 0}, {22, -6, 0, 0},
+      {11, -4, 0, 0}, {4, -4, 0, -2}, {23, -2, 0, -2}, {9, -2, 0, -4},
+      {0, -2, 0, -4}, {15, -2, 0, -2}, {17, 0, 0, -2}, {1, 0, 0, 0},
+      {8, 0, 0, 0}, {7, 0, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Frog */
+    {UINT64_C(0x00003df1b31b99f5), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.20833337, 1.04166663, 1.16666663},
+     {0.708333254, 0.541666746, 0.666666746},
+     2.88416505, 3.1770587,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {1, 2, 0, 4}, {13, 4, 0, 4}, {16, 2, 0, 4},
+      {6, 2, 0, 4}, {23, 2, 2, 4}, {13, 2, 2, 4}, {17, 2, 4, 4}, {4, 2, 4, 4},
+      {22, 2, 2, 4}, {14, 4, 2, 2}, {19, 4, 0, 2}, {4, 4, 2, 0}, {23, 6, 2, 0},
+      {13, 6, 2, 0}, {16, 4, 2, 0}, {7, 4, 4, 2}, {21, 2, 4, 2}, {8, 2, 4, 4},
+      {6, 2, 4, 2}, {22, 0, 4, 2}, {10, 0, 4, 0}, {2, 0, 2, 2}}},
+    /* Frog2 */
+    {UINT64_C(0x0000335b41b0dbd1), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.291666657, -1.33333337, 2.125},
+     {-0.208333313, -1.83333337, 1.625},
+     3.13166285, 3.42455602,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {10, 0, -2, 2}, {6, 0, -4, 2},
+      {22, -2, -4, 2}, {15, -2, -4, 2}, {17, 0, -4, 2}, {1, 0, -4, 4},
+      {9, 2, -4, 2}, {1, 2, -2, 4}, {13, 4, -2, 4}, {20, 4, -2, 4},
+      {10, 2, -2, 4}, {2, 2, -4, 6}, {10, 0, -4, 4}, {7, 0, -4, 6},
+      {21, -2, -4, 6}, {12, -2, -4, 6}, {19, 0, -4, 6}, {1, 0, -2, 6},
+      {13, 2, -2, 6}, {21, 0, 0, 6}, {8, 0, 0, 8}, {3, 0, 2, 6}}},
+    /* Furby */
+    {UINT64_C(0x00002086c828a392), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.208333328, 0.166666672, -0.0416666679},
+     {-0.708333373, -0.333333343, -0.541666627},
+     2.52999377, 2.82288694,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {14, 0, -2, 0}, {23, 0, -2, 0},
+      {9, 0, -2, -2}, {1, 0, 0, 0}, {8, 0, 0, 0}, {2, 0, 0, 0}, {10, -2, 0, -2},
+      {3, -2, 0, -2}, {9, -2, 0, -2}, {1, -2, 2, 0}, {9, 0, 2, -2},
+      {0, 0, 2, -2}, {11, 2, 2, 0}, {5, 2, 0, 0}, {16, 2, 0, 0}, {3, 2, 2, 0},
+      {8, 0, 2, 2}, {2, 0, 2, 2}, {10, -2, 2, 0}, {2, -2, 0, 2}, {11, -2, 0, 2},
+      {0, -2, -2, 0}}},
+    /* Gate */
+    {UINT64_C(0x00000a3be5928c20), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.25, -1, 0.5},
+     {-0.75, -1.5, 0},
+     2.90084791, 3.19374108,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {2, 2, -4, 2},
+      {10, 0, -4, 0}, {6, 0, -6, 0}, {18, -2, -4, 0}, {7, -2, -4, 0},
+      {17, -2, -4, 0}, {5, -2, -6, 2}, {21, -2, -4, 2}, {12, -2, -4, 2},
+      {19, 0, -4, 2}, {1, 0, -2, 2}, {8, 0, -2, 2}, {7, 0, 0, 2},
+      {21, -2, 0, 2}, {12, -2, 0, 2}, {18, -2, 2, 2}, {6, -2, 0, 0},
+      {19, -2, 0, 0}, {5, -2, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Ghost */
+    {UINT64_C(0x0000343436fd77d5), {1, 1, 180}, MODEL_CYCLIC,
+     {1.08333337, -0.0833333358, 1.16666663},
+     {0.583333254, -0.583333373, 0.666666746},
+     2.81858325, 3.11147666,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {0, 2, -2, 2}, {14, 4, -2, 2},
+      {19, 4, -4, 2}, {1, 4, -2, 2}, {13, 6, -2, 2}, {16, 4, -2, 2},
+      {3, 4, 0, 2}, {12, 2, 0, 2}, {18, 2, 2, 2}, {3, 2, 2, 0}, {9, 2, 2, 0},
+      {5, 2, 2, 2}, {20, 4, 2, 2}, {15, 2, 2, 4}, {20, 4, 0, 4}, {10, 2, 0, 4},
+      {6, 2, -2, 4}, {18, 0, 0, 4}, {6, 0, -2, 2}, {23, 0, 0, 2}, {9, 0, 0, 0},
+      {1, 0, 2, 2}}},
+    /* Globus */
+    {UINT64_C(0x0000072df75df587), {1, 1, 0}, MODEL_CYCLIC,
+     {-0.333333343, 0.666666687, -0.916666687},
+     {-0.833333254, 0.166666627, -1.41666651},
+     2.72267127, 3.01556444,
+     {{14, 2, 0, 0}, {18, 0, 0, 0}, {6, 0, -2, -2}, {19, 0, -2, -2},
+      {1, 0, 0, -2}, {12, 0, 0, -4}, {18, 0, 2, -4}, {3, 0, 2, -6},
+      {13, 0, 2, -4}, {17, 0, 4, -4}, {0, 0, 2, -4}, {15, 0, 2, -2},
+      {16, 0, 0, -2}, {3, 0, 2, -2}, {12, -2, 2, -2}, {18, -2, 4, -2},
+      {2, -2, 2, -2}, {15, -4, 2, -2}, {21, -4, 2, -2}, {13, -2, 2, 0},
+      {17, -2, 4, 0}, {0, -2, 2, 0}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Grotto */
+    {UINT64_C(0x00003726c01b874a), {1, 1, 0}, MODEL_CYCLIC,
+     {-0.125, 0.125, -0.5},
+     {-0.625, -0.375, -1},
+     3.05896783, 3.351861,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {8, -2, 0, 2}, {6, -2, 0, 0}, {22, -4, 0, 0},
+      {11, -2, 0, 0}, {0, -2, -2, -2}, {10, -2, -2, -2}, {6, -2, -4, -2},
+      {19, -2, -4, -2}, {1, -2, -2, -2}, {9, 0, -2, -4}, {1, 0, 0, -2},
+      {9, 2, 0, -4}, {1, 2, 2, -2}, {13, 4, 2, -2}, {20, 4, 2, -2},
+      {10, 2, 2, -2}, {3, 2, 2, -2}, {8, 0, 2, 0}, {7, 0, 4, 0}, {20, 0, 2, 0},
+      {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* H */
+    {UINT64_C(0x00000a00a18a00a2), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.75, 0.5, 0.25},
+     {0.25, 0, -0.25},
+     3.07881498, 3.37170815,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {11, 0, -2, 2}, {1, 0, -2, 2},
+      {9, 2, -2, 0}, {1, 2, 0, 2}, {9, 4, 0, 0}, {1, 4, 2, 2}, {8, 4, 2, 2},
+      {2, 4, 2, 2}, {10, 2, 2, 0}, {3, 2, 2, 0}, {13, 2, 2, 2}, {21, 0, 4, 2},
+      {12, 0, 4, 2}, {22, 0, 4, 2}, {14, 2, 4, 0}, {22, 0, 2, 0},
+      {14, 2, 2, -2}, {22, 0, 0, -2}, {15, 0, 0, -2}, {21, 0, 0, -2},
+      {13, 2, 0, 0}, {21, 0, 2, 0}}},
+    /* HeadOfDevil */
+    {UINT64_C(0x000001ef967b1b32), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1.25, 0.5},
+     {-0.5, -1.75, 0},
+     2.52713418, 2.82002759,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {15, -2, -2, 2}, {20, 0, -4, 2},
+      {11, 0, -4, 4}, {1, 0, -4, 4}, {12, 0, -4, 2}, {23, 2, -2, 2},
+      {9, 2, -2, 0}, {0, 2, -2, 0}, {14, 4, -2, 0}, {18, 2, -2, 0},
+      {7, 2, -2, 0}, {20, 2, -4, 0}, {10, 0, -4, 0}, {3, 0, -4, 0},
+      {12, -2, -4, 0}, {18, -2, -2, 0}, {7, -2, -2, 0}, {21, -4, -2, 0},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Heart */
+    {UINT64_C(0x0000102ed48f6603), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -2, -0.916666687},
+     {-0.5, -2.5, -1.41666651},
+     3.62377357, 3.91666651,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {14, 2, -2, -2}, {22, 0, -4, -2},
+      {15, 0, -4, -2}, {17, 2, -4, -2}, {4, 2, -4, -2}, {22, 2, -6, -2},
+      {10, 2, -6, -4}, {6, 2, -8, -4}, {18, 0, -6, -4}, {7, 0, -6, -4},
+      {16, -2, -8, -4}, {3, -2, -6, -4}, {13, -2, -6, -2}, {17, -2, -4, -2},
+      {4, -2, -4, -2}, {23, 0, -4, -2}, {13, 0, -4, -2}, {21, -2, -2, -2},
+      {13, 0, -2, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Heart2 */
+    {UINT64_C(0x0000083300801108), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 1.66666663, 0},
+     {-0.5, 1.16666663, -0.5},
+     3.62734294, 3.92023611,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {1, 4, 2, 2}, {12, 4, 2, 0},
+      {23, 6, 4, 0}, {8, 4, 4, 0}, {3, 4, 6, -2}, {8, 2, 6, 0}, {3, 2, 8, -2},
+      {8, 0, 8, 0}, {2, 0, 8, 0}, {10, -2, 8, -2}, {2, -2, 6, 0},
+      {10, -4, 6, -2}, {2, -4, 4, 0}, {15, -6, 4, 0}, {20, -4, 2, 0},
+      {11, -4, 2, 2}, {0, -4, 0, 0}, {11, -2, 0, 2}, {1, -2, 0, 2},
+      {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Hexagon */
+    {UINT64_C(0x00000100c100c100), {1, 1, 270}, MODEL_CYCLIC,
+     {0.333333343, -1.66666663, 2.33333325},
+     {-0.166666672, -2.16666651, 1.83333325},
+     3.66514659, 3.95804,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {15, 4, -4, 2}, {20, 6, -6, 2}, {15, 4, -6, 4}, {16, 4, -8, 4},
+      {7, 4, -6, 6}, {16, 2, -8, 6}, {7, 2, -6, 8}, {16, 0, -8, 8},
+      {3, 0, -6, 8}, {8, -2, -6, 10}, {3, -2, -4, 8}, {12, -4, -4, 8},
+      {23, -2, -2, 8}, {12, -4, -2, 6}, {23, -2, 0, 6}, {12, -4, 0, 4},
+      {19, -2, 0, 4}, {4, -2, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* HoleInTheMiddle1 */
+    {UINT64_C(0x0000336f9cd1e5b4), {1, 1, 90}, MODEL_CYCLIC,
+     {0.5, 0.5, -0.5},
+     {0, 0, -1},
+     2.43915749, 2.7320509,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {23, 4, 0, 0}, {13, 4, 0, 0}, {16, 2, 0, 0},
+      {3, 2, 2, 0}, {9, 2, 2, 0}, {4, 2, 4, 0}, {22, 2, 2, 0}, {14, 4, 2, -2},
+      {18, 2, 2, -2}, {3, 2, 2, -4}, {8, 0, 2, -2}, {7, 0, 4, -2},
+      {20, 0, 2, -2}, {14, 0, 2, -2}, {19, 0, 0, -2}, {0, 0, 0, -4},
+      {10, 0, 0, -4}, {7, 0, 0, -2}, {21, -2, 0, -2}, {13, 0, 0, 0},
+      {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* HoleInTheMiddle2 */
+    {UINT64_C(0x0000336f34736f34), {1, 1, 90}, MODEL_CYCLIC,
+     {0.5, 0.5, -0.5},
+     {0, 0, -1},
+     2.43915749, 2.7320509,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {23, 4, 0, 0}, {12, 2, 0, -2},
+      {18, 2, 2, -2}, {3, 2, 2, -4}, {9, 2, 2, -4}, {5, 2, 2, -2},
+      {20, 4, 2, -2}, {15, 2, 2, 0}, {16, 2, 0, 0}, {3, 2, 2, 0}, {8, 0, 2, 2},
+      {6, 0, 2, 0}, {22, -2, 2, 0}, {14, 0, 2, -2}, {19, 0, 0, -2},
+      {0, 0, 0, -4}, {10, 0, 0, -4}, {7, 0, 0, -2}, {21, -2, 0, -2},
+      {13, 0, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* HouseBoat */
+    {UINT64_C(0x00002d9b936fe56f), {1, 1, 270}, MODEL_CYCLIC,
+     {1, 0.333333343, 1},
+     {0.5, -0.166666672, 0.5},
+     2.49440765, 2.78730083,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {5, 2, -2, 0}, {21, 2, 0, 0}, {9, 4, 0, 0},
+      {5, 4, 0, 2}, {16, 4, 0, 2}, {2, 4, 0, 4}, {15, 2, 0, 4}, {16, 2, -2, 4},
+      {6, 2, -2, 4}, {23, 2, 0, 4}, {9, 2, 0, 2}, {1, 2, 2, 4}, {12, 2, 2, 2},
+      {22, 2, 2, 2}, {10, 2, 2, 0}, {3, 2, 2, 0}, {13, 2, 2, 2}, {20, 2, 2, 2},
+      {10, 0, 2, 2}, {6, 0, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* HouseByHouse */
+    {UINT64_C(0x00003bb999bbb999), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 0, 2},
+     {-0.5, -0.5, 1.5},
+     2.36541915, 2.65831232,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {9, 2, 0, 2}, {0, 2, 0, 2}, {15, 2, 0, 4},
+      {21, 2, 0, 4}, {8, 2, 0, 6}, {2, 2, 0, 6}, {15, 0, 0, 6}, {21, 0, 0, 6},
+      {8, 0, 0, 8}, {2, 0, 0, 8}, {14, 0, 0, 6}, {23, 0, 0, 6}, {8, -2, 0, 6},
+      {2, -2, 0, 6}, {14, -2, 0, 4}, {23, -2, 0, 4}, {9, -2, 0, 2},
+      {0, -2, 0, 2}, {14, 0, 0, 2}, {23, 0, 0, 2}, {9, 0, 0, 0},
+      {1, 0, 2, 2}}},
+    /* Infinity */
+    {UINT64_C(0x000017d7d557d7d5), {1, 1, 90}, MODEL_CYCLIC,
+     {0.5, 0.5, 0.5},
+     {0, 0, 0},
+     3.53553391, 3.82842708,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {0, 2, -2, 2}, {14, 4, -2, 2},
+      {19, 4, -4, 2}, {1, 4, -2, 2}, {12, 4, -2, 0}, {18, 4, 0, 0},
+      {3, 4, 0, -2}, {13, 4, 0, 0}, {16, 2, 0, 0}, {3, 2, 2, 0}, {13, 2, 2, 2},
+      {16, 0, 2, 2}, {3, 0, 4, 2}, {12, -2, 4, 2}, {18, -2, 6, 2},
+      {2, -2, 4, 2}, {14, -2, 4, 0}, {19, -2, 2, 0}, {0, -2, 2, -2},
+      {15, -2, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Integral */
+    {UINT64_C(0x0000177d557dd7ff), {1, 1, 270}, MODEL_CYCLIC,
+     {0.5, -0.5, -0.5},
+     {0, -1, -1},
+     3.53553391, 3.82842708,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {0, 2, -2, -2}, {14, 4, -2, -2},
+      {19, 4, -4, -2}, {1, 4, -2, -2}, {12, 4, -2, -4}, {18, 4, 0, -4},
+      {2, 4, -2, -4}, {15, 2, -2, -4}, {16, 2, -4, -4}, {3, 2, -2, -4},
+      {13, 2, -2, -2}, {16, 0, -2, -2}, {3, 0, 0, -2}, {13, 0, 0, 0},
+      {16, -2, 0, 0}, {2, -2, 0, 2}, {15, -4, 0, 2}, {17, -2, 0, 2},
+      {1, -2, 0, 4}, {12, -2, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Iron */
+    {UINT64_C(0x00003306c390ce00), {1, 1, 180}, MODEL_CYCLIC,
+     {0.583333313, -1.41666663, 0.5},
+     {0.0833333731, -1.91666663, 0},
+     2.90874767, 3.20164084,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {10, 4, -4, 0}, {6, 4, -6, 0}, {18, 2, -4, 0}, {3, 2, -4, -2},
+      {8, 0, -4, 0}, {3, 0, -2, -2}, {13, 0, -2, 0}, {20, 0, -2, 0},
+      {11, 0, -2, 2}, {0, 0, -4, 0}, {11, 2, -4, 2}, {5, 2, -6, 2},
+      {16, 2, -6, 2}, {3, 2, -4, 2}, {8, 0, -4, 4}, {3, 0, -2, 2},
+      {12, -2, -2, 2}, {23, 0, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* just squares */
+    {UINT64_C(0x000017b99f97b99f), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 0, -1},
+     {-0.5, -0.5, -1.5},
+     2.36541915, 2.65831232,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {1, 2, 0, 0}, {8, 2, 0, 0}, {6, 2, 0, -2},
+      {19, 2, 0, -2}, {0, 2, 0, -4}, {10, 2, 0, -4}, {6, 2, -2, -4},
+      {23, 2, 0, -4}, {8, 0, 0, -4}, {2, 0, 0, -4}, {15, -2, 0, -4},
+      {16, -2, -2, -4}, {3, -2, 0, -4}, {9, -2, 0, -4}, {5, -2, 0, -2},
+      {16, -2, 0, -2}, {2, -2, 0, 0}, {11, -2, 0, 0}, {5, -2, -2, 0},
+      {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Kink */
+    {UINT64_C(0x00000a2281b0a228), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.625, 1, 1.04166663},
+     {0.125, 0.5, 0.541666746},
+     2.52618003, 2.81907344,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {9, 2, 2, 0},
+      {1, 2, 4, 2}, {8, 2, 4, 2}, {2, 2, 4, 2}, {10, 0, 4, 0}, {2, 0, 2, 2},
+      {15, -2, 2, 2}, {21, -2, 2, 2}, {9, 0, 2, 2}, {1, 0, 4, 4}, {9, 2, 4, 2},
+      {0, 2, 4, 2}, {10, 2, 4, 2}, {2, 2, 2, 4}, {11, 2, 2, 4}, {0, 2, 0, 2},
+      {10, 2, 0, 2}, {3, 2, 0, 2}, {8, 0, 0, 4}, {3, 0, 2, 2}}},
+    /* Knot */
+    {UINT64_C(0x00001fb37bd67465), {1, 1, 270}, MODEL_CYCLIC,
+     {0.0833333358, -0.75, 1.08333337},
+     {-0.416666687, -1.25, 0.583333254},
+     2.96019125, 3.25308442,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {4, 2, 0, 2}, {22, 2, -2, 2},
+      {14, 4, -2, 0}, {18, 2, -2, 0}, {3, 2, -2, -2}, {13, 2, -2, 0},
+      {20, 2, -2, 0}, {10, 0, -2, 0}, {7, 0, -2, 2}, {21, -2, -2, 2},
+      {8, -2, -2, 4}, {2, -2, -2, 4}, {15, -4, -2, 4}, {17, -2, -2, 4},
+      {1, -2, -2, 6}, {9, 0, -2, 4}, {4, 0, 0, 4}, {18, 0, 0, 4}, {3, 0, 0, 2},
+      {12, -2, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Leaf */
+    {UINT64_C(0x000006c6cc204428), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.5, 0, 0},
+     {-1, -0.5, -0.5},
+     2.82842708, 3.12132025,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {8, 0, 2, 2},
+      {6, 0, 2, 0}, {18, -2, 4, 0}, {2, -2, 2, 0}, {10, -4, 2, -2},
+      {2, -4, 0, 0}, {11, -4, 0, 0}, {0, -4, -2, -2}, {11, -2, -2, 0},
+      {5, -2, -4, 0}, {17, 0, -2, 0}, {1, 0, -2, 2}, {8, 0, -2, 2},
+      {6, 0, -2, 0}, {18, -2, 0, 0}, {3, -2, 0, -2}, {9, -2, 0, -2},
+      {5, -2, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* LeftAsRight */
+    {UINT64_C(0x00001b71e5be71db), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.375, 1.04166663, 0.583333313},
+     {-0.875, 0.541666746, 0.0833333731},
+     2.82433105, 3.11722445,
+     {{14, 2, 0, 0}, {23, 2, 0, 0}, {8, 0, 0, 0}, {7, 0, 2, 0}, {20, 0, 0, 0},
+      {15, -2, 0, 2}, {16, -2, -2, 2}, {3, -2, 0, 2}, {9, -2, 0, 2},
+      {4, -2, 2, 2}, {23, 0, 2, 2}, {13, 0, 2, 2}, {16, -2, 2, 2},
+      {3, -2, 4, 2}, {9, -2, 4, 2}, {4, -2, 6, 2}, {22, -2, 4, 2},
+      {14, 0, 4, 0}, {19, 0, 2, 0}, {1, 0, 4, 0}, {13, 2, 4, 0}, {20, 2, 4, 0},
+      {10, 0, 4, 0}, {2, 0, 2, 2}}},
+    /* Long-necked */
+    {UINT64_C(0x00000a1b9923b992), {1, 1, 180}, MODEL_CYCLIC,
+     {-1, 0, 0.166666672},
+     {-1.5, -0.5, -0.333333343},
+     2.42304516, 2.71593833,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {14, 0, -2, 0}, {23, 0, -2, 0},
+      {8, -2, -2, 0}, {2, -2, -2, 0}, {15, -4, -2, 0}, {21, -4, -2, 0},
+      {8, -4, -2, 2}, {3, -4, 0, 0}, {9, -4, 0, 0}, {1, -4, 2, 2},
+      {12, -4, 2, 0}, {22, -4, 2, 0}, {11, -2, 2, 0}, {1, -2, 2, 0},
+      {13, 0, 2, 0}, {20, 0, 2, 0}, {10, -2, 2, 0}, {2, -2, 0, 2},
+      {11, -2, 0, 2}, {1, -2, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* lunar module */
+    {UINT64_C(0x000011cdbdd77dd6), {1, 1, 270}, MODEL_CYCLIC,
+     {0.5, -0.5, 1.5},
+     {0, -1, 1},
+     2.43915749, 2.7320509,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {20, 0, -2, 2}, {11, 0, -2, 4},
+      {4, 0, -2, 2}, {23, 2, -2, 2}, {9, 2, -2, 0}, {5, 2, -2, 2},
+      {20, 4, -2, 2}, {10, 2, -2, 2}, {7, 2, -2, 4}, {21, 0, -2, 4},
+      {9, 2, -2, 4}, {4, 2, 0, 4}, {23, 4, 0, 4}, {13, 4, 0, 4}, {16, 2, 0, 4},
+      {2, 2, 0, 6}, {10, 0, 0, 4}, {6, 0, -2, 4}, {23, 0, 0, 4}, {12, -2, 0, 2},
+      {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* magnifying glass */
+    {UINT64_C(0x0000023281b0a120), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1.83333337, 0.5},
+     {-0.5, -2.33333302, 0},
+     3.09341049, 3.38630319,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {2, 2, -4, 2},
+      {14, 2, -4, 0}, {22, 0, -6, 0}, {15, 0, -6, 0}, {21, 0, -6, 0},
+      {13, 2, -6, 2}, {21, 0, -4, 2}, {8, 0, -4, 4}, {2, 0, -4, 4},
+      {14, 0, -4, 2}, {22, -2, -6, 2}, {14, 0, -6, 0}, {23, 0, -6, 0},
+      {13, 0, -6, 0}, {21, -2, -4, 0}, {8, -2, -4, 2}, {3, -2, -2, 0},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Mask */
+    {UINT64_C(0x000011ce20891cc0), {1, 1, 0}, MODEL_CYCLIC,
+     {1.41666663, 0.416666657, 0.75},
+     {0.916666627, -0.0833333135, 0.25},
+     3.63565397, 3.92854738,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {5, 4, -4, 2},
+      {17, 6, -2, 2}, {1, 6, -2, 4}, {12, 6, -2, 2}, {23, 8, 0, 2},
+      {8, 6, 0, 2}, {2, 6, 0, 2}, {10, 4, 0, 0}, {3, 4, 0, 0}, {8, 2, 0, 2},
+      {3, 2, 2, 0}, {9, 2, 2, 0}, {1, 2, 4, 2}, {8, 2, 4, 2}, {7, 2, 6, 2},
+      {16, 0, 4, 2}, {2, 0, 4, 4}, {14, 0, 4, 2}, {22, -2, 2, 2}, {11, 0, 2, 2},
+      {0, 0, 0, 0}}},
+    /* Microscope */
+    {UINT64_C(0x000028a181b0b20a), {1, 1, 0}, MODEL_CYCLIC,
+     {0, 1.16666663, 1},
+     {-0.5, 0.666666746, 0.5},
+     2.51757026, 2.81046367,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {8, -2, 0, 2}, {3, -2, 2, 0}, {9, -2, 2, 0},
+      {1, -2, 4, 2}, {13, 0, 4, 2}, {20, 0, 4, 2}, {15, -2, 4, 4},
+      {20, 0, 2, 4}, {11, 0, 2, 6}, {1, 0, 2, 6}, {12, 0, 2, 4}, {23, 2, 4, 4},
+      {12, 0, 4, 2}, {22, 0, 4, 2}, {11, 2, 4, 2}, {0, 2, 2, 0}, {10, 2, 2, 0},
+      {3, 2, 2, 0}, {8, 0, 2, 2}, {2, 0, 2, 2}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Mirror */
+    {UINT64_C(0x00000a3b420d0a1e), {1, 1, 270}, MODEL_CYCLIC,
+     {-0.166666672, 0.0833333358, 0.166666672},
+     {-0.666666627, -0.416666687, -0.333333343},
+     2.63821197, 2.93110514,
+     {{10, 0, 0, 0}, {6, 0, -2, 0}, {23, 0, 0, 0}, {12, -2, 0, -2},
+      {22, -2, 0, -2}, {15, -2, 0, -2}, {20, 0, -2, -2}, {15, -2, -2, 0},
+      {17, 0, -2, 0}, {1, 0, -2, 2}, {9, 2, -2, 0}, {1, 2, 0, 2}, {8, 2, 0, 2},
+      {3, 2, 2, 0}, {8, 0, 2, 2}, {6, 0, 2, 0}, {22, -2, 2, 0}, {15, -2, 2, 0},
+      {16, -2, 0, 0}, {7, -2, 2, 2}, {17, -2, 2, 2}, {4, -2, 2, 2},
+      {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* MissPiggy */
+    {UINT64_C(0x000033e45bd6f394), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.0416666679, -0.833333313, 0.0416666679},
+     {-0.541666627, -1.33333349, -0.458333313},
+     2.47192502, 2.76481819,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {22, 2, -2, 0}, {15, 2, -2, 0},
+      {16, 2, -4, 0}, {7, 2, -2, 2}, {21, 0, -2, 2}, {8, 0, -2, 4},
+      {2, 0, -2, 4}, {14, 0, -2, 2}, {18, -2, -2, 2}, {3, -2, -2, 0},
+      {12, -4, -2, 0}, {22, -4, -2, 0}, {11, -2, -2, 0}, {4, -2, -2, -2},
+      {19, 0, -4, -2}, {1, 0, -2, -2}, {8, 0, -2, -2}, {7, 0, 0, -2},
+      {21, -2, 0, -2}, {13, 0, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Mole */
+    {UINT64_C(0x00001bc476392dcc), {1, 1, 90}, MODEL_CYCLIC,
+     {1.16666663, 1, 0.833333313},
+     {0.666666746, 0.5, 0.333333313},
+     2.89926457, 3.19215775,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {17, 4, 0, 2}, {1, 4, 0, 4}, {12, 4, 0, 2},
+      {18, 4, 2, 2}, {7, 4, 2, 2}, {16, 2, 0, 2}, {3, 2, 2, 2}, {9, 2, 2, 2},
+      {4, 2, 4, 2}, {19, 4, 2, 2}, {5, 4, 2, 2}, {21, 4, 4, 2}, {8, 4, 4, 4},
+      {6, 4, 4, 2}, {18, 2, 6, 2}, {2, 2, 4, 2}, {10, 0, 4, 0}, {6, 0, 2, 0},
+      {22, -2, 2, 0}, {15, -2, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Monk */
+    {UINT64_C(0x0000177dca3284a1), {1, 1, 270}, MODEL_CYCLIC,
+     {-0.166666672, -0.416666657, 0.166666672},
+     {-0.666666627, -0.916666746, -0.333333343},
+     3.06560206, 3.35849524,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {14, 2, -2, 2}, {23, 2, -2, 2},
+      {12, 0, -2, 0}, {19, 2, -2, 0}, {4, 2, 0, -2}, {18, 2, 0, -2},
+      {7, 2, 0, -2}, {16, 0, -2, -2}, {2, 0, -2, 0}, {10, -2, -2, -2},
+      {3, -2, -2, -2}, {9, -2, -2, -2}, {1, -2, 0, 0}, {13, 0, 0, 0},
+      {16, -2, 0, 0}, {2, -2, 0, 2}, {15, -4, 0, 2}, {17, -2, 0, 2},
+      {1, -2, 0, 4}, {12, -2, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Mountain */
+    {UINT64_C(0x00000dbe71936f9c), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.16666675, 0.5, 1},
+     {1.66666651, 0, 0.5},
+     3.09341025, 3.3863039,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {21, 2, 0, 2}, {12, 2, 0, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {9, 2, 2, 0}, {5, 2, 2, 2}, {20, 4, 2, 2}, {15, 2, 2, 4},
+      {17, 4, 2, 4}, {4, 4, 2, 4}, {22, 4, 0, 4}, {14, 6, 0, 2}, {19, 6, -2, 2},
+      {1, 6, 0, 2}, {8, 6, 0, 2}, {7, 6, 2, 2}, {21, 4, 2, 2}, {12, 4, 2, 2},
+      {19, 6, 2, 2}, {0, 6, 2, 0}, {11, 8, 2, 2}, {0, 8, 0, 0}}},
+    /* mountains */
+    {UINT64_C(0x000008ed99bbb648), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.29166663, 0.583333313, -0.0416666679},
+     {0.791666627, 0.0833333731, -0.541666627},
+     2.66765523, 2.9605484,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {5, 4, 0, 2}, {16, 4, 0, 2},
+      {3, 4, 2, 2}, {12, 2, 2, 2}, {22, 2, 2, 2}, {10, 2, 2, 0}, {3, 2, 2, 0},
+      {12, 0, 2, 0}, {22, 0, 2, 0}, {11, 2, 2, 0}, {1, 2, 2, 0}, {12, 2, 2, -2},
+      {22, 2, 2, -2}, {11, 4, 2, -2}, {5, 4, 0, -2}, {16, 4, 0, -2},
+      {2, 4, 0, 0}, {10, 2, 0, -2}, {3, 2, 0, -2}, {8, 0, 0, 0},
+      {3, 0, 2, -2}}},
+    /* MouseWithoutTail */
+    {UINT64_C(0x00000a3281b0a128), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 1, 0.5},
+     {-0.5, 0.5, 0},
+     2.82842708, 3.12132025,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {13, 2, 2, 2},
+      {21, 0, 4, 2}, {12, 0, 4, 2}, {22, 0, 4, 2}, {14, 2, 4, 0}, {22, 0, 2, 0},
+      {10, 0, 2, -2}, {3, 0, 2, -2}, {13, 0, 2, 0}, {21, -2, 4, 0},
+      {13, 0, 4, 2}, {20, 0, 4, 2}, {14, 0, 4, 2}, {22, -2, 2, 2},
+      {10, -2, 2, 0}, {2, -2, 0, 2}, {11, -2, 0, 2}, {1, -2, 0, 2},
+      {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* mushroom */
+    {UINT64_C(0x00002128c90dbdd6), {1, 1, 270}, MODEL_CYCLIC,
+     {0.333333343, -0.375, 1.625},
+     {-0.166666672, -0.875, 1.125},
+     3.36398983, 3.656883,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {20, 0, -2, 2}, {11, 0, -2, 4},
+      {4, 0, -2, 2}, {23, 2, -2, 2}, {9, 2, -2, 0}, {0, 2, -2, 0},
+      {15, 2, -2, 2}, {16, 2, -4, 2}, {7, 2, -2, 4}, {16, 0, -4, 4},
+      {3, 0, -2, 4}, {9, 0, -2, 4}, {1, 0, 0, 6}, {13, 2, 0, 6}, {21, 0, 2, 6},
+      {12, 0, 2, 6}, {22, 0, 2, 6}, {14, 2, 2, 4}, {18, 0, 2, 4}, {6, 0, 0, 2},
+      {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* necklace */
+    {UINT64_C(0x0000030300801010), {1, 0, -1}, MODEL_ACYCLIC,
+     {-1.08333337, -2.5, 1.66666663},
+     {-1.58333337, -3, 1.16666663},
+     4.22393131, 4.51682472,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {15, 2, -2, 2}, {20, 4, -4, 2},
+      {15, 2, -4, 4}, {20, 4, -6, 4}, {10, 2, -6, 4}, {2, 2, -8, 6},
+      {10, 0, -8, 4}, {2, 0, -10, 6}, {10, -2, -10, 4}, {3, -2, -10, 4},
+      {8, -4, -10, 6}, {3, -4, -8, 4}, {8, -6, -8, 6}, {3, -6, -6, 4},
+      {12, -8, -6, 4}, {23, -6, -4, 4}, {12, -8, -4, 2}, {23, -6, -2, 2},
+      {9, -6, -2, 0}, {1, -6, 0, 2}, {9, -4, 0, 0}, {1, -4, 2, 2}}},
+    /* NestledAgainst */
+    {UINT64_C(0x000015df9c6cbd61), {1, 1, 180}, MODEL_CYCLIC,
+     {-0.75, -1.25, 0.666666687},
+     {-1.25, -1.75, 0.166666627},
+     2.8641367, 3.15702987,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {14, 2, -2, 2}, {18, 0, -2, 2},
+      {2, 0, -4, 2}, {15, -2, -4, 2}, {16, -2, -6, 2}, {6, -2, -6, 2},
+      {18, -4, -4, 2}, {3, -4, -4, 0}, {9, -4, -4, 0}, {5, -4, -4, 2},
+      {17, -2, -2, 2}, {1, -2, -2, 4}, {12, -2, -2, 2}, {22, -2, -2, 2},
+      {10, -2, -2, 0}, {6, -2, -4, 0}, {23, -2, -2, 0}, {9, -2, -2, -2},
+      {5, -2, -2, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* NoClue */
+    {UINT64_C(0x000006fce5be456c), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.291666657, -1.125, 1.91666663},
+     {-0.208333313, -1.625, 1.41666663},
+     3.11008525, 3.40297842,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {16, 2, -2, 2}, {3, 2, 0, 2}, {13, 2, 0, 4},
+      {16, 0, 0, 4}, {7, 0, 2, 6}, {20, 0, 0, 6}, {14, 0, 0, 6}, {19, 0, -2, 6},
+      {0, 0, -2, 4}, {10, 0, -2, 4}, {7, 0, -2, 6}, {20, 0, -4, 6},
+      {14, 0, -4, 6}, {19, 0, -6, 6}, {4, 0, -4, 4}, {23, 2, -4, 4},
+      {9, 2, -4, 2}, {4, 2, -2, 2}, {18, 2, -2, 2}, {2, 2, -4, 2},
+      {10, 0, -4, 0}, {2, 0, -6, 2}}},
+    /* Noname */
+    {UINT64_C(0x00001ee6ca2823b9), {1, 1, 180}, MODEL_CYCLIC,
+     {-0.166666672, -0.833333313, 0.833333313},
+     {-0.666666627, -1.33333349, 0.333333313},
+     2.53284883, 2.82574201,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {8, 0, 0, 4}, {2, 0, 0, 4}, {15, -2, 0, 4},
+      {20, 0, -2, 4}, {14, 0, -2, 4}, {22, -2, -4, 4}, {14, 0, -4, 2},
+      {23, 0, -4, 2}, {13, 0, -4, 2}, {21, -2, -2, 2}, {12, -2, -2, 2},
+      {22, -2, -2, 2}, {14, 0, -2, 0}, {19, 0, -4, 0}, {5, 0, -4, 0},
+      {21, 0, -2, 0}, {12, 0, -2, 0}, {18, 0, 0, 0}, {7, 0, 0, 0},
+      {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Obelisk */
+    {UINT64_C(0x0000009bbb666e02), {1, 1, 180}, MODEL_CYCLIC,
+     {-1.16666663, -1.16666663, 1.08333337},
+     {-1.66666663, -1.66666663, 0.583333254},
+     3.13524032, 3.42813373,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {2, -2, -4, 2},
+      {11, -2, -4, 2}, {5, -2, -6, 2}, {16, -2, -6, 2}, {3, -2, -4, 2},
+      {9, -2, -4, 2}, {5, -2, -4, 4}, {16, -2, -4, 4}, {3, -2, -2, 4},
+      {12, -4, -2, 4}, {22, -4, -2, 4}, {10, -4, -2, 2}, {3, -4, -2, 2},
+      {12, -6, -2, 2}, {22, -6, -2, 2}, {11, -4, -2, 2}, {1, -4, -2, 2},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Ostrich */
+    {UINT64_C(0x000020028ca284a0), {1, 0, -1}, MODEL_ACYCLIC,
+     {-1.08333337, -1, 0.5},
+     {-1.58333337, -1.5, 0},
+     3.55144787, 3.84434128,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {3, 2, -2, 0},
+      {8, 0, -2, 2}, {6, 0, -2, 0}, {18, -2, 0, 0}, {7, -2, 0, 0},
+      {17, -2, 0, 0}, {5, -2, -2, 2}, {16, -2, -2, 2}, {6, -2, -2, 2},
+      {18, -4, 0, 2}, {3, -4, 0, 0}, {8, -6, 0, 2}, {2, -6, 0, 2},
+      {11, -6, 0, 2}, {0, -6, -2, 0}, {11, -4, -2, 2}, {0, -4, -4, 0},
+      {11, -2, -4, 2}, {0, -2, -6, 0}, {10, -2, -6, 0}, {2, -2, -8, 2}}},
+    /* Ostrich2 */
+    {UINT64_C(0x00000822d77dd58a), {1, 0, -1}, MODEL_ACYCLIC,
+     {-2.41666675, -0.333333343, 0.5},
+     {-2.91666675, -0.833333254, 0},
+     3.90106797, 4.19396114,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {8, -2, 0, 2}, {2, -2, 0, 2}, {14, -2, 0, 0},
+      {18, -4, 0, 0}, {2, -4, -2, 0}, {15, -6, -2, 0}, {17, -4, -2, 0},
+      {1, -4, -2, 2}, {13, -2, -2, 2}, {16, -4, -2, 2}, {2, -4, -2, 4},
+      {14, -4, -2, 2}, {18, -6, -2, 2}, {3, -6, -2, 0}, {9, -6, -2, 0},
+      {1, -6, 0, 2}, {8, -6, 0, 2}, {3, -6, 2, 0}, {8, -8, 2, 2}, {2, -8, 2, 2},
+      {10, -10, 2, 0}, {2, -10, 0, 2}}},
+    /* pair of glasses */
+    {UINT64_C(0x000008208c848208), {1, 0, -1}, MODEL_ACYCLIC,
+     {-1.08333337, 1.08333337, 0.583333313},
+     {-1.58333337, 0.583333254, 0.0833333731},
+     4.33856678, 4.63145971,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {1, 4, 2, 2}, {8, 4, 2, 2},
+      {3, 4, 4, 0}, {8, 2, 4, 2}, {2, 2, 4, 2}, {10, 0, 4, 0}, {7, 0, 4, 2},
+      {16, -2, 2, 2}, {6, -2, 2, 2}, {18, -4, 4, 2}, {3, -4, 4, 0},
+      {8, -6, 4, 2}, {2, -6, 4, 2}, {10, -8, 4, 0}, {2, -8, 2, 2},
+      {11, -8, 2, 2}, {0, -8, 0, 0}, {11, -6, 0, 2}, {1, -6, 0, 2},
+      {9, -4, 0, 0}, {1, -4, 2, 2}}},
+    /* Parrot */
+    {UINT64_C(0x000021c6ccce4f00), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.75, -3, 0.5},
+     {2.25, -3.5, 0},
+     4.07051277, 4.36340618,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {14, 6, -4, 0}, {19, 6, -6, 0}, {4, 6, -4, -2}, {22, 6, -6, -2},
+      {15, 6, -6, -2}, {16, 6, -8, -2}, {7, 6, -6, 0}, {21, 4, -6, 0},
+      {13, 6, -6, 2}, {17, 6, -4, 2}, {5, 6, -6, 4}, {20, 8, -6, 4},
+      {14, 8, -6, 4}, {18, 6, -6, 4}, {6, 6, -8, 2}, {22, 4, -8, 2},
+      {11, 6, -8, 2}, {0, 6, -10, 0}, {10, 6, -10, 0}, {2, 6, -12, 2}}},
+#ifndef WIN32
+    /* Penis */
+    {UINT64_C(0x0000292881b08a3a), {1, 0, -1}, MODEL_ACYCLIC,
+     {-1.08333337, 0.833333313, 0.833333313},
+     {-1.58333337, 0.333333313, 0.333333313},
+     3.13524055, 3.42813373,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {12, -2, 0, 0}, {23, 0, 2, 0}, {13, 0, 2, 0},
+      {20, 0, 2, 0}, {15, -2, 2, 2}, {21, -2, 2, 2}, {13, 0, 2, 4},
+      {21, -2, 4, 4}, {8, -2, 4, 6}, {2, -2, 4, 6}, {14, -2, 4, 4},
+      {22, -4, 2, 4}, {14, -2, 2, 2}, {23, -2, 2, 2}, {12, -4, 2, 0},
+      {22, -4, 2, 0}, {15, -4, 2, 0}, {20, -2, 0, 0}, {10, -4, 0, 0},
+      {3, -4, 0, 0}, {9, -4, 0, 0}, {1, -4, 2, 2}}},
+#endif
+    /* PictureCommingSoon */
+    {UINT64_C(0x00003c7bed9ef9c5), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -0.5, 2},
+     {-0.5, -1, 1.5},
+     2.57793546, 2.87082863,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {5, 2, -2, 4}, {20, 4, -2, 4},
+      {10, 2, -2, 4}, {3, 2, -2, 4}, {12, 0, -2, 4}, {18, 0, 0, 4},
+      {7, 0, 0, 4}, {21, -2, 0, 4}, {9, 0, 0, 4}, {0, 0, 0, 4}, {15, 0, 0, 6},
+      {16, 0, -2, 6}, {6, 0, -2, 6}, {22, -2, -2, 6}, {10, -2, -2, 4},
+      {3, -2, -2, 4}, {12, -4, -2, 4}, {19, -2, -2, 4}, {4, -2, 0, 2},
+      {23, 0, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Pitti */
+    {UINT64_C(0x0000382081b08209), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 1, 1},
+     {-0.5, 0.5, 0.5},
+     2.36541915, 2.65831232,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {13, 2, 0, 4}, {21, 0, 2, 4}, {12, 0, 2, 4},
+      {23, 2, 4, 4}, {12, 0, 4, 2}, {22, 0, 4, 2}, {14, 2, 4, 0}, {22, 0, 2, 0},
+      {10, 0, 2, -2}, {3, 0, 2, -2}, {13, 0, 2, 0}, {21, -2, 4, 0},
+      {13, 0, 4, 2}, {20, 0, 4, 2}, {15, -2, 4, 4}, {20, 0, 2, 4},
+      {14, 0, 2, 4}, {22, -2, 0, 4}, {14, 0, 0, 2}, {23, 0, 0, 2}, {9, 0, 0, 0},
+      {1, 0, 2, 2}}},
+    /* Plait */
+    {UINT64_C(0x00001fffff755555), {1, 1, 270}, MODEL_CYCLIC,
+     {1.5, -1.5, 2.5},
+     {1, -2, 2},
+     4.17120838, 4.46410179,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {0, 2, -2, 2}, {15, 2, -2, 4},
+      {17, 4, -2, 4}, {0, 4, -4, 4}, {15, 4, -4, 6}, {17, 6, -4, 6},
+      {0, 6, -6, 6}, {15, 6, -6, 8}, {16, 6, -8, 8}, {3, 6, -6, 8},
+      {12, 4, -6, 8}, {18, 4, -4, 8}, {3, 4, -4, 6}, {12, 2, -4, 6},
+      {18, 2, -2, 6}, {3, 2, -2, 4}, {12, 0, -2, 4}, {18, 0, 0, 4},
+      {3, 0, 0, 2}, {12, -2, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Platform */
+    {UINT64_C(0x000036f9c628200b), {1, 1, 0}, MODEL_CYCLIC,
+     {0.5, 1.41666663, -0.583333313},
+     {0, 0.916666627, -1.08333325},
+     2.9831903, 3.27608347,
+     {{14, 2, 0, 0}, {23, 2, 0, 0}, {12, 0, 0, -2}, {23, 2, 2, -2},
+      {12, 0, 2, -4}, {23, 2, 4, -4}, {13, 2, 4, -4}, {21, 0, 6, -4},
+      {13, 2, 6, -2}, {20, 2, 6, -2}, {14, 2, 6, -2}, {22, 0, 4, -2},
+      {15, 0, 4, -2}, {17, 2, 4, -2}, {5, 2, 2, 0}, {20, 4, 2, 0},
+      {10, 2, 2, 0}, {3, 2, 2, 0}, {12, 0, 2, 0}, {18, 0, 4, 0}, {7, 0, 4, 0},
+      {20, 0, 2, 0}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* PodRacer */
+    {UINT64_C(0x000018428796cb88), {1, 1, 180}, MODEL_CYCLIC,
+     {1, 0.166666672, -0.583333313},
+     {0.5, -0.333333343, -1.08333325},
+     2.71576858, 3.00866175,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {14, 6, 0, 0},
+      {23, 6, 0, 0}, {12, 4, 0, -2}, {18, 4, 2, -2}, {7, 4, 2, -2},
+      {20, 4, 0, -2}, {10, 2, 0, -2}, {3, 2, 0, -2}, {12, 0, 0, -2},
+      {19, 2, 0, -2}, {4, 2, 2, -4}, {18, 2, 2, -4}, {7, 2, 2, -4},
+      {16, 0, 0, -4}, {7, 0, 2, -2}, {20, 0, 0, -2}, {15, -2, 0, 0},
+      {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Prawn */
+    {UINT64_C(0x000018928390a38b), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.458333343, -0.333333343, -2.20833325},
+     {-0.0416666865, -0.833333254, -2.70833325},
+     3.42088342, 3.71377659,
+     {{14, 2, 0, 0}, {23, 2, 0, 0}, {12, 0, 0, -2}, {22, 0, 0, -2},
+      {10, 0, 0, -4}, {2, 0, -2, -2}, {11, 0, -2, -2}, {1, 0, -2, -2},
+      {9, 2, -2, -4}, {1, 2, 0, -2}, {12, 2, 0, -4}, {22, 2, 0, -4},
+      {10, 2, 0, -6}, {2, 2, -2, -4}, {10, 0, -2, -6}, {3, 0, -2, -6},
+      {9, 0, -2, -6}, {1, 0, 0, -4}, {12, 0, 0, -6}, {22, 0, 0, -6},
+      {14, 2, 0, -8}, {23, 2, 0, -8}, {8, 0, 0, -8}, {3, 0, 2, -10}}},
+    /* Propeller */
+    {UINT64_C(0x000034c074c074c0), {1, 1, 90}, MODEL_CYCLIC,
+     {1.33333337, -1.66666663, -0.333333343},
+     {0.833333373, -2.16666651, -0.833333254},
+     3.66514659, 3.95804,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {5, 4, -4, 2},
+      {17, 6, -2, 2}, {0, 6, -4, 2}, {14, 8, -4, 2}, {18, 6, -4, 2},
+      {6, 6, -6, 0}, {18, 4, -4, 0}, {6, 4, -6, -2}, {22, 2, -6, -2},
+      {14, 4, -6, -4}, {18, 2, -6, -4}, {3, 2, -6, -6}, {13, 2, -6, -4},
+      {21, 0, -4, -4}, {13, 2, -4, -2}, {21, 0, -2, -2}, {8, 0, -2, 0},
+      {3, 0, 0, -2}, {13, 0, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Pyramid */
+    {UINT64_C(0x00001fe578e4e4e4), {1, 1, 180}, MODEL_CYCLIC,
+     {0.333333343, -0.25, -1},
+     {-0.166666672, -0.75, -1.5},
+     2.62377357, 2.91666675,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {18, 2, 0, 0}, {3, 2, 0, -2}, {8, 0, 0, 0},
+      {6, 0, 0, -2}, {19, 0, 0, -2}, {0, 0, 0, -4}, {11, 2, 0, -2},
+      {4, 2, 0, -4}, {18, 2, 0, -4}, {3, 2, 0, -6}, {8, 0, 0, -4},
+      {2, 0, 0, -4}, {15, -2, 0, -4}, {17, 0, 0, -4}, {0, 0, -2, -4},
+      {15, 0, -2, -2}, {21, 0, -2, -2}, {8, 0, -2, 0}, {7, 0, 0, 0},
+      {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* QuarterbackTiltedAndReadyToHut */
+    {UINT64_C(0x00002176748dedf2), {1, 0, -1}, MODEL_ACYCLIC,
+     {-1.20833337, -0.916666687, 2.125},
+     {-1.70833337, -1.41666651, 1.625},
+     3.31784844, 3.61074162,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {15, -2, -2, 2}, {16, -2, -4, 2},
+      {3, -2, -2, 2}, {12, -4, -2, 2}, {22, -4, -2, 2}, {10, -4, -2, 0},
+      {7, -4, -2, 2}, {21, -6, -2, 2}, {13, -4, -2, 4}, {20, -4, -2, 4},
+      {15, -6, -2, 6}, {17, -4, -2, 6}, {1, -4, -2, 8}, {12, -4, -2, 6},
+      {22, -4, -2, 6}, {11, -2, -2, 6}, {5, -2, -4, 6}, {21, -2, -2, 6},
+      {9, 0, -2, 6}, {1, 0, 0, 8}, {8, 0, 0, 8}, {3, 0, 2, 6}}},
+    /* Ra */
+    {UINT64_C(0x0000177dd45df756), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.833333313, -2, 0.5},
+     {-1.33333349, -2.5, 0},
+     2.71403909, 3.0069325,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {20, 0, -2, 2}, {10, -2, -2, 2},
+      {6, -2, -4, 2}, {23, -2, -2, 2}, {9, -2, -2, 0}, {4, -2, 0, 0},
+      {22, -2, -2, 0}, {10, -2, -2, -2}, {7, -2, -2, 0}, {20, -2, -4, 0},
+      {15, -4, -4, 2}, {17, -2, -4, 2}, {0, -2, -6, 2}, {14, 0, -6, 2},
+      {18, -2, -6, 2}, {3, -2, -6, 0}, {12, -4, -6, 0}, {19, -2, -6, 0},
+      {0, -2, -6, -2}, {15, -2, -6, 0}, {17, 0, -6, 0}, {5, 0, -8, 2}}},
+    /* Rattlesnake */
+    {UINT64_C(0x00003ffe34445111), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.58333337, -3.45833325, 0.625},
+     {1.08333337, -3.95833325, 0.125},
+     4.28122282, 4.57411623,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {10, 0, -2, 2}, {2, 0, -4, 4},
+      {14, 0, -4, 2}, {22, -2, -6, 2}, {11, 0, -6, 2}, {4, 0, -6, 0},
+      {19, 2, -8, 0}, {1, 2, -6, 0}, {9, 4, -6, -2}, {5, 4, -6, 0},
+      {17, 6, -4, 0}, {0, 6, -6, 0}, {14, 8, -6, 0}, {22, 6, -8, 0},
+      {15, 6, -8, 0}, {16, 6, -10, 0}, {2, 6, -10, 2}, {15, 4, -10, 2},
+      {16, 4, -12, 2}, {2, 4, -12, 4}, {15, 2, -12, 4}, {20, 4, -14, 4}}},
+    /* Revelation */
+    {UINT64_C(0x0000209fd7d5e080), {1, 1, 0}, MODEL_CYCLIC,
+     {1.41666663, 0.416666657, 1},
+     {0.916666627, -0.0833333135, 0.5},
+     3.03746223, 3.33035541,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {1, 4, -2, 2},
+      {9, 6, -2, 0}, {1, 6, 0, 2}, {8, 6, 0, 2}, {7, 6, 2, 2}, {20, 6, 0, 2},
+      {10, 4, 0, 2}, {7, 4, 0, 4}, {21, 2, 0, 4}, {8, 2, 0, 6}, {6, 2, 0, 4},
+      {23, 2, 2, 4}, {9, 2, 2, 2}, {4, 2, 4, 2}, {23, 4, 4, 2}, {8, 2, 4, 2},
+      {2, 2, 4, 2}, {10, 0, 4, 0}, {2, 0, 2, 2}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Revolution1 */
+    {UINT64_C(0x00003e48e5be48e5), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -0.166666672, 0},
+     {-0.5, -0.666666627, -0.5},
+     2.85445666, 3.14734983,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {4, 2, 0, 2}, {23, 4, 0, 2}, {12, 2, 0, 0},
+      {22, 2, 0, 0}, {14, 4, 0, -2}, {18, 2, 0, -2}, {7, 2, 0, -2},
+      {21, 0, 0, -2}, {8, 0, 0, 0}, {2, 0, 0, 0}, {14, 0, 0, -2},
+      {18, -2, 0, -2}, {7, -2, 0, -2}, {21, -4, 0, -2}, {13, -2, 0, 0},
+      {20, -2, 0, 0}, {15, -4, 0, 2}, {17, -2, 0, 2}, {4, -2, 0, 2},
+      {23, 0, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Ribbon */
+    {UINT64_C(0x0000177e288a25df), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 0.833333313, 0.25},
+     {-0.5, 0.333333313, -0.25},
+     2.96327114, 3.25616455,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {1, 2, 0, 0}, {13, 4, 0, 0}, {16, 2, 0, 0},
+      {3, 2, 2, 0}, {9, 2, 2, 0}, {1, 2, 4, 2}, {8, 2, 4, 2}, {2, 2, 4, 2},
+      {10, 0, 4, 0}, {3, 0, 4, 0}, {8, -2, 4, 2}, {2, -2, 4, 2}, {11, -2, 4, 2},
+      {0, -2, 2, 0}, {10, -2, 2, 0}, {6, -2, 0, 0}, {22, -4, 0, 0},
+      {11, -2, 0, 0}, {5, -2, -2, 0}, {21, -2, 0, 0}, {9, 0, 0, 0},
+      {1, 0, 2, 2}}},
+    /* Rocket */
+    {UINT64_C(0x0000139131b13393), {1, 1, 180}, MODEL_CYCLIC,
+     {0, 0.166666672, 0.333333343},
+     {-0.5, -0.333333343, -0.166666672},
+     3.36333632, 3.6562295,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {11, 2, -2, 0}, {1, 2, -2, 0},
+      {13, 4, -2, 0}, {21, 2, 0, 0}, {8, 2, 0, 2}, {3, 2, 2, 0}, {13, 2, 2, 2},
+      {21, 0, 4, 2}, {8, 0, 4, 4}, {2, 0, 4, 4}, {14, 0, 4, 2}, {22, -2, 2, 2},
+      {10, -2, 2, 0}, {2, -2, 0, 2}, {14, -2, 0, 0}, {22, -4, -2, 0},
+      {11, -2, -2, 0}, {1, -2, -2, 0}, {13, 0, -2, 0}, {21, -2, 0, 0},
+      {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Roofed */
+    {UINT64_C(0x00003218e4b218e4), {1, 1, 180}, MODEL_CYCLIC,
+     {0.166666672, -1, 0},
+     {-0.333333343, -1.5, -0.5},
+     2.42304516, 2.71593833,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {18, 2, 0, 0}, {3, 2, 0, -2}, {8, 0, 0, 0},
+      {2, 0, 0, 0}, {14, 0, 0, -2}, {22, -2, -2, -2}, {15, -2, -2, -2},
+      {20, 0, -4, -2}, {11, 0, -4, 0}, {1, 0, -4, 0}, {9, 2, -4, -2},
+      {5, 2, -4, 0}, {16, 2, -4, 0}, {2, 2, -4, 2}, {10, 0, -4, 0},
+      {3, 0, -4, 0}, {13, 0, -4, 2}, {21, -2, -2, 2}, {12, -2, -2, 2},
+      {23, 0, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Roofs */
+    {UINT64_C(0x00002939bb99b93a), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.708333313, 0.666666687, 1.04166663},
+     {-1.20833325, 0.166666627, 0.541666746},
+     2.63010359, 2.922997,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {12, -2, 0, 0}, {23, 0, 2, 0}, {8, -2, 2, 0},
+      {2, -2, 2, 0}, {15, -4, 2, 0}, {21, -4, 2, 0}, {9, -2, 2, 0},
+      {0, -2, 2, 0}, {15, -2, 2, 2}, {21, -2, 2, 2}, {8, -2, 2, 4},
+      {2, -2, 2, 4}, {15, -4, 2, 4}, {21, -4, 2, 4}, {9, -2, 2, 4},
+      {0, -2, 2, 4}, {14, 0, 2, 4}, {22, -2, 0, 4}, {11, 0, 0, 4}, {1, 0, 0, 4},
+      {8, 0, 0, 4}, {3, 0, 2, 2}}},
+    /* RowHouses */
+    {UINT64_C(0x00001b99bb99bb9b), {1, 0, -1}, MODEL_ACYCLIC,
+     {-2.16666675, 0, 0},
+     {-2.66666675, -0.5, -0.5},
+     3.46593118, 3.75882435,
+     {{14, 2, 0, 0}, {23, 2, 0, 0}, {8, 0, 0, 0}, {2, 0, 0, 0}, {15, -2, 0, 0},
+      {21, -2, 0, 0}, {8, -2, 0, 2}, {2, -2, 0, 2}, {14, -2, 0, 0},
+      {23, -2, 0, 0}, {8, -4, 0, 0}, {2, -4, 0, 0}, {15, -6, 0, 0},
+      {21, -6, 0, 0}, {8, -6, 0, 2}, {2, -6, 0, 2}, {14, -6, 0, 0},
+      {23, -6, 0, 0}, {8, -8, 0, 0}, {2, -8, 0, 0}, {15, -10, 0, 0},
+      {21, -10, 0, 0}, {9, -8, 0, 0}, {1, -8, 2, 2}}},
+    /* Sculpture */
+    {UINT64_C(0x00001d807609d027), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.833333313, 0.5, 0.833333313},
+     {-1.33333349, 0, 0.333333313},
+     2.84148145, 3.13437486,
+     {{14, 2, 0, 0}, {18, 0, 0, 0}, {7, 0, 0, 0}, {16, -2, -2, 0},
+      {7, -2, 0, 2}, {16, -4, -2, 2}, {3, -4, 0, 2}, {12, -6, 0, 2},
+      {19, -4, 0, 2}, {5, -4, 0, 2}, {17, -2, 2, 2}, {5, -2, 0, 4},
+      {16, -2, 0, 4}, {3, -2, 2, 4}, {12, -4, 2, 4}, {19, -2, 2, 4},
+      {4, -2, 4, 2}, {19, 0, 2, 2}, {4, 0, 4, 0}, {18, 0, 4, 0}, {2, 0, 2, 0},
+      {15, -2, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Seal */
+    {UINT64_C(0x0000128795393f95), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.458333343, -1.33333337, -0.0416666679},
+     {-0.0416666865, -1.83333337, -0.541666627},
+     3.13738441, 3.43027759,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {0, 2, -2, 2}, {10, 2, -2, 2},
+      {6, 2, -4, 2}, {22, 0, -4, 2}, {10, 0, -4, 0}, {2, 0, -6, 2},
+      {14, 0, -6, 0}, {23, 0, -6, 0}, {9, 0, -6, -2}, {1, 0, -4, 0},
+      {12, 0, -4, -2}, {19, 2, -4, -2}, {1, 2, -2, -2}, {8, 2, -2, -2},
+      {7, 2, 0, -2}, {20, 2, -2, -2}, {15, 0, -2, 0}, {21, 0, -2, 0},
+      {12, 0, -2, 0}, {23, 2, 0, 0}, {8, 0, 0, 0}, {3, 0, 2, -2}}},
+    /* Seal2 */
+    {UINT64_C(0x000003436fbf754b), {1, 1, 90}, MODEL_CYCLIC,
+     {0.125, 0.0833333358, -1.125},
+     {-0.375, -0.416666687, -1.625},
+     3.11297345, 3.40586662,
+     {{14, 2, 0, 0}, {23, 2, 0, 0}, {12, 0, 0, -2}, {19, 2, 0, -2},
+      {1, 2, 2, -2}, {12, 2, 2, -4}, {18, 2, 4, -4}, {2, 2, 2, -4},
+      {15, 0, 2, -4}, {16, 0, 0, -4}, {2, 0, 0, -2}, {11, 0, 0, -2},
+      {5, 0, -2, -2}, {20, 2, -2, -2}, {14, 2, -2, -2}, {18, 0, -2, -2},
+      {3, 0, -2, -4}, {8, -2, -2, -2}, {3, -2, 0, -4}, {13, -2, 0, -2},
+      {17, -2, 2, -2}, {5, -2, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Sheep */
+    {UINT64_C(0x00001d55dffdd7d7), {1, 1, 270}, MODEL_CYCLIC,
+     {0, -1, 0.5},
+     {-0.5, -1.5, 0},
+     3.05231476, 3.34520793,
+     {{14, 2, 0, 0}, {18, 0, 0, 0}, {2, 0, -2, 0}, {15, -2, -2, 0},
+      {16, -2, -4, 0}, {3, -2, -2, 0}, {13, -2, -2, 2}, {17, -2, 0, 2},
+      {0, -2, -2, 2}, {14, 0, -2, 2}, {19, 0, -4, 2}, {0, 0, -4, 0},
+      {14, 2, -4, 0}, {19, 2, -6, 0}, {1, 2, -4, 0}, {13, 4, -4, 0},
+      {16, 2, -4, 0}, {3, 2, -2, 0}, {13, 2, -2, 2}, {16, 0, -2, 2},
+      {3, 0, 0, 2}, {12, -2, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Shelter */
+    {UINT64_C(0x00003008200d77dd), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.5, -1, 0},
+     {-1, -1.5, -0.5},
+     3.62258267, 3.91547585,
+     {{15, 0, 0, 2}, {16, 0, -2, 2}, {3, 0, 0, 2}, {12, -2, 0, 2},
+      {18, -2, 2, 2}, {2, -2, 0, 2}, {15, -4, 0, 2}, {17, -2, 0, 2},
+      {0, -2, -2, 2}, {14, 0, -2, 2}, {22, -2, -4, 2}, {14, 0, -4, 0},
+      {22, -2, -6, 0}, {14, 0, -6, -2}, {23, 0, -6, -2}, {12, -2, -6, -4},
+      {23, 0, -4, -4}, {13, 0, -4, -4}, {21, -2, -2, -4}, {13, 0, -2, -2},
+      {21, -2, 0, -2}, {13, 0, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Ship */
+    {UINT64_C(0x00002846c47fe55e), {1, 1, 0}, MODEL_CYCLIC,
+     {0.166666672, 1, -0.0833333358},
+     {-0.333333343, 0.5, -0.583333373},
+     3.12951374, 3.42240691,
+     {{10, 0, 0, 0}, {6, 0, -2, 0}, {23, 0, 0, 0}, {8, -2, 0, 0},
+      {6, -2, 0, -2}, {23, -2, 2, -2}, {13, -2, 2, -2}, {17, -2, 4, -2},
+      {1, -2, 4, 0}, {13, 0, 4, 0}, {17, 0, 6, 0}, {0, 0, 4, 0}, {11, 2, 4, 2},
+      {4, 2, 4, 0}, {19, 4, 2, 0}, {0, 4, 2, -2}, {10, 4, 2, -2}, {7, 4, 2, 0},
+      {16, 2, 0, 0}, {3, 2, 2, 0}, {8, 0, 2, 2}, {2, 0, 2, 2}, {11, 0, 2, 2},
+      {0, 0, 0, 0}}},
+    /* Shpongle */
+    {UINT64_C(0x00000dcdcdcdcdcd), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.25, 0, 2.75},
+     {0.75, -0.5, 2.25},
+     3.13094664, 3.42384005,
+     {{15, 0, 0, 2}, {16, 0, -2, 2}, {7, 0, 0, 4}, {21, -2, 0, 4}, {9, 0, 0, 4},
+      {4, 0, 2, 4}, {19, 2, 0, 4}, {0, 2, 0, 2}, {15, 2, 0, 4}, {16, 2, -2, 4},
+      {7, 2, 0, 6}, {21, 0, 0, 6}, {9, 2, 0, 6}, {4, 2, 2, 6}, {19, 4, 0, 6},
+      {0, 4, 0, 4}, {15, 4, 0, 6}, {16, 4, -2, 6}, {7, 4, 0, 8}, {21, 2, 0, 8},
+      {9, 4, 0, 8}, {4, 4, 2, 8}, {19, 6, 0, 8}, {4, 6, 2, 6}}},
+    /* Slide */
+    {UINT64_C(0x00001dc1e08274dd), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.708333313, 0.416666657, -0.0416666679},
+     {-1.20833325, -0.0833333135, -0.541666627},
+     2.86976314, 3.16265655,
+     {{15, 0, 0, 2}, {16, 0, -2, 2}, {3, 0, 0, 2}, {12, -2, 0, 2},
+      {23, 0, 2, 2}, {8, -2, 2, 2}, {7, -2, 4, 2}, {20, -2, 2, 2},
+      {14, -2, 2, 2}, {22, -4, 0, 2}, {14, -2, 0, 0}, {23, -2, 0, 0},
+      {12, -4, 0, -2}, {23, -2, 2, -2}, {13, -2, 2, -2}, {17, -2, 4, -2},
+      {0, -2, 2, -2}, {11, 0, 2, 0}, {0, 0, 0, -2}, {14, 2, 0, -2},
+      {18, 0, 0, -2}, {3, 0, 0, -4}, {13, 0, 0, -2}, {21, -2, 2, -2}}},
+    /* SmallShip */
+    {UINT64_C(0x0000134734d34734), {1, 1, 270}, MODEL_CYCLIC,
+     {-0.5, 0, 0.5},
+     {-1, -0.5, 0},
+     3.57938814, 3.87228131,
+     {{11, 2, 0, 2}, {4, 2, 0, 0}, {23, 4, 0, 0}, {12, 2, 0, -2},
+      {18, 2, 2, -2}, {2, 2, 0, -2}, {10, 0, 0, -4}, {7, 0, 0, -2},
+      {21, -2, 0, -2}, {13, 0, 0, 0}, {16, -2, 0, 0}, {2, -2, 0, 2},
+      {10, -4, 0, 0}, {7, -4, 0, 2}, {21, -6, 0, 2}, {13, -4, 0, 4},
+      {17, -4, 2, 4}, {0, -4, 0, 4}, {11, -2, 0, 6}, {4, -2, 0, 4},
+      {23, 0, 0, 4}, {12, -2, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* SnakeReadyToStrike */
+    {UINT64_C(0x0000100804ccd111), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.95833325, -2.16666675, 0.875},
+     {2.45833325, -2.66666675, 0.375},
+     5.48153257, 5.77442598,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {10, 0, -2, 2}, {2, 0, -4, 4},
+      {14, 0, -4, 2}, {22, -2, -6, 2}, {11, 0, -6, 2}, {5, 0, -8, 2},
+      {17, 2, -6, 2}, {1, 2, -6, 4}, {9, 4, -6, 2}, {4, 4, -4, 2},
+      {19, 6, -6, 2}, {1, 6, -4, 2}, {9, 8, -4, 0}, {1, 8, -2, 2},
+      {9, 10, -2, 0}, {0, 10, -2, 0}, {11, 12, -2, 2}, {0, 12, -4, 0},
+      {11, 14, -4, 2}, {0, 14, -6, 0}, {15, 14, -6, 2}, {20, 16, -8, 2}}},
+    /* Snakes14 */
+    {UINT64_C(0x0000343989b0372f), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.41666663, -0.0416666679, -1.54166663},
+     {0.916666627, -0.541666627, -2.04166651},
+     3.08100986, 3.37390304,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {5, 2, -2, 0}, {17, 4, 0, 0}, {1, 4, 0, 2},
+      {12, 4, 0, 0}, {18, 4, 2, 0}, {6, 4, 0, -2}, {18, 2, 2, -2},
+      {6, 2, 0, -4}, {22, 0, 0, -4}, {15, 0, 0, -4}, {17, 2, 0, -4},
+      {4, 2, 0, -4}, {19, 4, -2, -4}, {5, 4, -2, -4}, {21, 4, 0, -4},
+      {12, 4, 0, -4}, {18, 4, 2, -4}, {6, 4, 0, -6}, {18, 2, 2, -6},
+      {2, 2, 0, -6}, {15, 0, 0, -6}, {20, 2, -2, -6}}},
+    /* Snakes15 */
+    {UINT64_C(0x0000380e61e58a28), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.95833337, 0.583333313, 0.125},
+     {1.45833337, 0.0833333731, -0.375},
+     2.69229484, 2.98518825,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {9, 2, 2, 0},
+      {0, 2, 2, 0}, {11, 4, 2, 2}, {1, 4, 2, 2}, {12, 4, 2, 0}, {19, 6, 2, 0},
+      {5, 6, 2, 0}, {20, 8, 2, 0}, {10, 6, 2, 0}, {2, 6, 0, 2}, {11, 6, 0, 2},
+      {4, 6, 0, 0}, {18, 6, 0, 0}, {3, 6, 0, -2}, {8, 4, 0, 0}, {3, 4, 2, -2},
+      {8, 2, 2, 0}, {2, 2, 2, 0}, {15, 0, 2, 0}, {20, 2, 0, 0}}},
+    /* Snakes18 */
+    {UINT64_C(0x000020a39b3b399a), {1, 0, -1}, MODEL_ACYCLIC,
+     {-1.08333337, 0, 0.5},
+     {-1.58333337, -0.5, 0},
+     2.36751175, 2.66040492,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {13, 0, 0, 2}, {20, 0, 0, 2}, {10, -2, 0, 2},
+      {3, -2, 0, 2}, {12, -4, 0, 2}, {23, -2, 2, 2}, {9, -2, 2, 0},
+      {0, -2, 2, 0}, {14, 0, 2, 0}, {22, -2, 0, 0}, {10, -2, 0, -2},
+      {3, -2, 0, -2}, {13, -2, 0, 0}, {20, -2, 0, 0}, {11, -2, 0, 2},
+      {0, -2, -2, 0}, {10, -2, -2, 0}, {3, -2, -2, 0}, {8, -4, -2, 2},
+      {3, -4, 0, 0}, {9, -4, 0, 0}, {1, -4, 2, 2}}},
+    /* Snowflake */
+    {UINT64_C(0x00003fd57fd57fd5), {1, 1, 90}, MODEL_CYCLIC,
+     {0.5, -1.5, -0.5},
+     {0, -2, -1},
+     3.15659642, 3.44948983,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {0, 2, -2, 2}, {14, 4, -2, 2},
+      {19, 4, -4, 2}, {0, 4, -4, 0}, {14, 6, -4, 0}, {18, 4, -4, 0},
+      {2, 4, -6, 0}, {14, 4, -6, -2}, {18, 2, -6, -2}, {3, 2, -6, -4},
+      {12, 0, -6, -4}, {18, 0, -4, -4}, {3, 0, -4, -6}, {13, 0, -4, -4},
+      {16, -2, -4, -4}, {3, -2, -2, -4}, {13, -2, -2, -2}, {17, -2, 0, -2},
+      {1, -2, 0, 0}, {13, 0, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Snowman */
+    {UINT64_C(0x00000a280a280a28), {1, 0, -1}, MODEL_ACYCLIC,
+     {3.25, 0.5, 0.5},
+     {2.75, 0, 0},
+     3.95710683, 4.25,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {9, 2, 2, 0},
+      {0, 2, 2, 0}, {11, 4, 2, 2}, {0, 4, 0, 0}, {11, 6, 0, 2}, {1, 6, 0, 2},
+      {8, 6, 0, 2}, {3, 6, 2, 0}, {9, 6, 2, 0}, {0, 6, 2, 0}, {11, 8, 2, 2},
+      {0, 8, 0, 0}, {11, 10, 0, 2}, {1, 10, 0, 2}, {8, 10, 0, 2}, {3, 10, 2, 0},
+      {9, 10, 2, 0}, {0, 10, 2, 0}, {11, 12, 2, 2}, {0, 12, 0, 0}}},
+    /* Source */
+    {UINT64_C(0x00002f75bdd6e48e), {1, 1, 90}, MODEL_CYCLIC,
+     {-1, 0, -0.416666657},
+     {-1.5, -0.5, -0.916666746},
+     2.62377357, 2.91666651,
+     {{10, 0, 0, 0}, {6, 0, -2, 0}, {18, -2, 0, 0}, {7, -2, 0, 0},
+      {16, -4, -2, 0}, {3, -4, 0, 0}, {9, -4, 0, 0}, {4, -4, 2, 0},
+      {18, -4, 2, 0}, {2, -4, 0, 0}, {14, -4, 0, -2}, {19, -4, -2, -2},
+      {1, -4, 0, -2}, {13, -2, 0, -2}, {17, -2, 2, -2}, {4, -2, 2, -2},
+      {22, -2, 0, -2}, {11, 0, 0, -2}, {5, 0, -2, -2}, {21, 0, 0, -2},
+      {8, 0, 0, 0}, {7, 0, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Spaceship */
+    {UINT64_C(0x00002bbb67b99efa), {1, 0, -1}, MODEL_ACYCLIC,
+     {-1.08333337, 0.416666657, 0.916666687},
+     {-1.58333337, -0.0833333135, 0.416666687},
+     2.58349514, 2.87638855,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {12, -2, 0, 0}, {18, -2, 2, 0},
+      {7, -2, 2, 0}, {21, -4, 2, 0}, {9, -2, 2, 0}, {0, -2, 2, 0},
+      {15, -2, 2, 2}, {21, -2, 2, 2}, {8, -2, 2, 4}, {2, -2, 2, 4},
+      {15, -4, 2, 4}, {17, -2, 2, 4}, {4, -2, 2, 4}, {22, -2, 0, 4},
+      {10, -2, 0, 2}, {3, -2, 0, 2}, {12, -4, 0, 2}, {22, -4, 0, 2},
+      {10, -4, 0, 0}, {3, -4, 0, 0}, {9, -4, 0, 0}, {1, -4, 2, 2}}},
+    /* Spaceship2 */
+    {UINT64_C(0x000029648e4a399a), {1, 0, -1}, MODEL_ACYCLIC,
+     {-1.08333337, 0.416666657, 0.916666687},
+     {-1.58333337, -0.0833333135, 0.416666687},
+     2.58349514, 2.87638855,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {13, 0, 0, 2}, {20, 0, 0, 2}, {10, -2, 0, 2},
+      {3, -2, 0, 2}, {12, -4, 0, 2}, {23, -2, 2, 2}, {13, -2, 2, 2},
+      {20, -2, 2, 2}, {15, -4, 2, 4}, {17, -2, 2, 4}, {4, -2, 2, 4},
+      {23, 0, 2, 4}, {12, -2, 2, 2}, {22, -2, 2, 2}, {14, 0, 2, 0},
+      {18, -2, 2, 0}, {7, -2, 2, 0}, {20, -2, 0, 0}, {10, -4, 0, 0},
+      {3, -4, 0, 0}, {9, -4, 0, 0}, {1, -4, 2, 2}}},
+    /* Speedboat */
+    {UINT64_C(0x000030e430810e41), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -0.416666657, 1.16666663},
+     {-0.5, -0.916666746, 0.666666746},
+     2.98776221, 3.28065515,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {15, 0, -2, 4}, {17, 2, -2, 4},
+      {4, 2, -2, 4}, {23, 4, -2, 4}, {12, 2, -2, 2}, {23, 4, 0, 2},
+      {8, 2, 0, 2}, {3, 2, 2, 0}, {8, 0, 2, 2}, {2, 0, 2, 2}, {10, -2, 2, 0},
+      {2, -2, 0, 2}, {15, -4, 0, 2}, {20, -2, -2, 2}, {15, -4, -2, 4},
+      {17, -2, -2, 4}, {4, -2, -2, 4}, {23, 0, -2, 4}, {12, -2, -2, 2},
+      {23, 0, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Speedboat2 */
+    {UINT64_C(0x00001b27d5393f5e), {1, 1, 0}, MODEL_CYCLIC,
+     {-0.916666687, 0.666666687, 1},
+     {-1.41666651, 0.166666627, 0.5},
+     3.18057704, 3.47347045,
+     {{10, 0, 0, 0}, {6, 0, -2, 0}, {23, 0, 0, 0}, {8, -2, 0, 0}, {7, -2, 2, 0},
+      {21, -4, 2, 0}, {8, -4, 2, 2}, {3, -4, 4, 0}, {13, -4, 4, 2},
+      {20, -4, 4, 2}, {11, -4, 4, 4}, {0, -4, 2, 2}, {15, -4, 2, 4},
+      {17, -2, 2, 4}, {0, -2, 0, 4}, {14, 0, 0, 4}, {19, 0, -2, 4},
+      {1, 0, 0, 4}, {8, 0, 0, 4}, {3, 0, 2, 2}, {12, -2, 2, 2}, {22, -2, 2, 2},
+      {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Spider */
+    {UINT64_C(0x000010de32849d0f), {1, 1, 90}, MODEL_CYCLIC,
+     {0.625, 0.625, -0.916666687},
+     {0.125, 0.125, -1.41666651},
+     2.970186, 3.26307917,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {4, 2, 0, -2}, {19, 4, -2, -2},
+      {1, 4, 0, -2}, {13, 6, 0, -2}, {16, 4, 0, -2}, {6, 4, 0, -2},
+      {18, 2, 2, -2}, {2, 2, 0, -2}, {10, 0, 0, -4}, {3, 0, 0, -4},
+      {9, 0, 0, -4}, {1, 0, 2, -2}, {13, 2, 2, -2}, {21, 0, 4, -2},
+      {12, 0, 4, -2}, {18, 0, 6, -2}, {2, 0, 4, -2}, {15, -2, 4, -2},
+      {20, 0, 2, -2}, {15, -2, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Spitzbergen */
+    {UINT64_C(0x000005e396f927c6), {1, 1, 270}, MODEL_CYCLIC,
+     {-0.5, 0, 1.58333337},
+     {-1, -0.5, 1.08333337},
+     2.72955036, 3.02244353,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {16, -2, -2, 2}, {2, -2, -2, 4},
+      {15, -4, -2, 4}, {17, -2, -2, 4}, {4, -2, -2, 4}, {19, 0, -4, 4},
+      {1, 0, -2, 4}, {8, 0, -2, 4}, {7, 0, 0, 4}, {21, -2, 0, 4},
+      {12, -2, 0, 4}, {19, 0, 0, 4}, {1, 0, 2, 4}, {8, 0, 2, 4}, {7, 0, 4, 4},
+      {16, -2, 2, 4}, {6, -2, 2, 4}, {22, -4, 2, 4}, {11, -2, 2, 4},
+      {4, -2, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Square */
+    {UINT64_C(0x000003e50f943e50), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.375, 1.04166663, 0.75},
+     {1.875, 0.541666746, 0.25},
+     3.62912583, 3.922019,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {15, 2, -2, 2}, {17, 4, -2, 2},
+      {4, 4, -2, 2}, {23, 6, -2, 2}, {9, 6, -2, 0}, {1, 6, 0, 2}, {9, 8, 0, 0},
+      {5, 8, 0, 2}, {21, 8, 2, 2}, {12, 8, 2, 2}, {18, 8, 4, 2}, {3, 8, 4, 0},
+      {8, 6, 4, 2}, {3, 6, 6, 0}, {13, 6, 6, 2}, {16, 4, 6, 2}, {6, 4, 6, 2},
+      {22, 2, 6, 2}, {10, 2, 6, 0}, {2, 2, 4, 2}, {10, 0, 4, 0},
+      {2, 0, 2, 2}}},
+    /* SquareHole */
+    {UINT64_C(0x0000220a20822822), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.16666675, -1, 0.5},
+     {1.66666651, -1.5, 0},
+     3.48099279, 3.77388644,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {11, 0, -2, 2}, {0, 0, -4, 0},
+      {11, 2, -4, 2}, {1, 2, -4, 2}, {8, 2, -4, 2}, {3, 2, -2, 0},
+      {9, 2, -2, 0}, {1, 2, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {11, 6, 0, 2},
+      {0, 6, -2, 0}, {10, 6, -2, 0}, {2, 6, -4, 2}, {11, 6, -4, 2},
+      {1, 6, -4, 2}, {9, 8, -4, 0}, {1, 8, -2, 2}, {8, 8, -2, 2}, {3, 8, 0, 0},
+      {9, 8, 0, 0}, {1, 8, 2, 2}}},
+    /* Stage */
+    {UINT64_C(0x00000ed9d9eded93), {1, 1, 90}, MODEL_CYCLIC,
+     {0.291666657, 0.291666657, -0.666666687},
+     {-0.208333313, -0.208333313, -1.16666675},
+     2.87457466, 3.16746783,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {11, 2, -2, 0}, {1, 2, -2, 0},
+      {12, 2, -2, -2}, {18, 2, 0, -2}, {7, 2, 0, -2}, {21, 0, 0, -2},
+      {9, 2, 0, -2}, {4, 2, 2, -2}, {18, 2, 2, -2}, {3, 2, 2, -4},
+      {13, 2, 2, -2}, {20, 2, 2, -2}, {10, 0, 2, -2}, {6, 0, 0, -2},
+      {23, 0, 2, -2}, {13, 0, 2, -2}, {16, -2, 2, -2}, {2, -2, 2, 0},
+      {11, -2, 2, 0}, {5, -2, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Stairs */
+    {UINT64_C(0x0000088888888888), {1, 0, -1}, MODEL_ACYCLIC,
+     {6.5, 0, 0.5},
+     {6, -0.5, 0},
+     6.72790384, 7.02079725,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {11, 6, 0, 2},
+      {1, 6, 0, 2}, {9, 8, 0, 0}, {0, 8, 0, 0}, {11, 10, 0, 2}, {1, 10, 0, 2},
+      {9, 12, 0, 0}, {0, 12, 0, 0}, {11, 14, 0, 2}, {1, 14, 0, 2},
+      {9, 16, 0, 0}, {0, 16, 0, 0}, {11, 18, 0, 2}, {1, 18, 0, 2},
+      {9, 20, 0, 0}, {0, 20, 0, 0}, {11, 22, 0, 2}, {1, 22, 0, 2},
+      {9, 24, 0, 0}, {1, 24, 2, 2}}},
+    /* Stairs2 */
+    {UINT64_C(0x0000082888882888), {1, 1, 180}, MODEL_CYCLIC,
+     {0.5, 0.5, 0.5},
+     {0, 0, 0},
+     3.86938453, 4.1622777,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {11, 6, 0, 2},
+      {1, 6, 0, 2}, {8, 6, 0, 2}, {3, 6, 2, 0}, {8, 4, 2, 2}, {2, 4, 2, 2},
+      {10, 2, 2, 0}, {3, 2, 2, 0}, {8, 0, 2, 2}, {2, 0, 2, 2}, {10, -2, 2, 0},
+      {3, -2, 2, 0}, {8, -4, 2, 2}, {2, -4, 2, 2}, {11, -4, 2, 2},
+      {0, -4, 0, 0}, {11, -2, 0, 2}, {1, -2, 0, 2}, {9, 0, 0, 0},
+      {1, 0, 2, 2}}},
+    /* Straight */
+    {UINT64_C(0x0000000000000000), {1, 0, -1}, MODEL_ACYCLIC,
+     {6.5, -6, 0.5},
+     {6, -6.5, 0},
+     8.84651661, 9.13941002,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {11, 6, -4, 2}, {0, 6, -6, 0}, {11, 8, -6, 2}, {0, 8, -8, 0},
+      {11, 10, -8, 2}, {0, 10, -10, 0}, {11, 12, -10, 2}, {0, 12, -12, 0},
+      {11, 14, -12, 2}, {0, 14, -14, 0}, {11, 16, -14, 2}, {0, 16, -16, 0},
+      {11, 18, -16, 2}, {0, 18, -18, 0}, {11, 20, -18, 2}, {0, 20, -20, 0},
+      {11, 22, -20, 2}, {0, 22, -22, 0}, {11, 24, -22, 2}, {0, 24, -24, 0}}},
+    /* Swan */
+    {UINT64_C(0x0000366ed9ee6588), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.75, -0.833333313, 0.5},
+     {2.25, -1.33333349, 0},
+     2.98166418, 3.27455735,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {15, 4, 0, 2},
+      {17, 6, 0, 2}, {4, 6, 0, 2}, {22, 6, -2, 2}, {15, 6, -2, 2},
+      {16, 6, -4, 2}, {6, 6, -4, 2}, {22, 4, -4, 2}, {11, 6, -4, 2},
+      {1, 6, -4, 2}, {12, 6, -4, 0}, {18, 6, -2, 0}, {7, 6, -2, 0},
+      {21, 4, -2, 0}, {12, 4, -2, 0}, {19, 6, -2, 0}, {5, 6, -2, 0},
+      {21, 6, 0, 0}, {8, 6, 0, 2}, {3, 6, 2, 0}}},
+    /* Swan2 */
+    {UINT64_C(0x00002800bf75dfe2), {1, 0, -1}, MODEL_ACYCLIC,
+     {2, -1.83333337, 0.5},
+     {1.5, -2.33333302, 0},
+     4.45247412, 4.74536753,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {11, 0, -2, 2}, {5, 0, -4, 2},
+      {20, 2, -4, 2}, {11, 2, -4, 4}, {4, 2, -4, 2}, {23, 4, -4, 2},
+      {8, 2, -4, 2}, {6, 2, -4, 0}, {22, 0, -4, 0}, {11, 2, -4, 0},
+      {5, 2, -6, 0}, {20, 4, -6, 0}, {11, 4, -6, 2}, {1, 4, -6, 2},
+      {9, 6, -6, 0}, {1, 6, -4, 2}, {9, 8, -4, 0}, {1, 8, -2, 2},
+      {9, 10, -2, 0}, {0, 10, -2, 0}, {10, 10, -2, 0}, {2, 10, -4, 2}}},
+    /* Swan3 */
+    {UINT64_C(0x00003306c390cc0a), {1, 0, -1}, MODEL_ACYCLIC,
+     {-3.08333325, 0.416666657, 0.5},
+     {-3.58333325, -0.0833333135, 0},
+     4.40583038, 4.69872332,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {8, -2, 0, 2}, {3, -2, 2, 0}, {8, -4, 2, 2},
+      {7, -4, 4, 2}, {16, -6, 2, 2}, {2, -6, 2, 4}, {10, -8, 2, 2},
+      {2, -8, 0, 4}, {14, -8, 0, 2}, {23, -8, 0, 2}, {9, -8, 0, 0},
+      {1, -8, 2, 2}, {9, -6, 2, 0}, {4, -6, 4, 0}, {18, -6, 4, 0},
+      {2, -6, 2, 0}, {10, -8, 2, -2}, {2, -8, 0, 0}, {15, -10, 0, 0},
+      {20, -8, -2, 0}, {11, -8, -2, 2}, {0, -8, -4, 0}}},
+    /* Symbol */
+    {UINT64_C(0x0000358a2f758a2f), {1, 1, 90}, MODEL_CYCLIC,
+     {1, -0.25, -1},
+     {0.5, -0.75, -1.5},
+     2.95710683, 3.25,
+     {{14, 2, 0, 0}, {19, 2, -2, 0}, {5, 2, -2, 0}, {17, 4, 0, 0}, {4, 4, 0, 0},
+      {18, 4, 0, 0}, {6, 4, -2, -2}, {19, 4, -2, -2}, {1, 4, 0, -2},
+      {12, 4, 0, -4}, {18, 4, 2, -4}, {2, 4, 0, -4}, {15, 2, 0, -4},
+      {16, 2, -2, -4}, {6, 2, -2, -4}, {18, 0, 0, -4}, {7, 0, 0, -4},
+      {17, 0, 0, -4}, {5, 0, -2, -2}, {16, 0, -2, -2}, {3, 0, 0, -2},
+      {13, 0, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Symmetry */
+    {UINT64_C(0x0000137371b1d1d3), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1, 0.5},
+     {-0.5, -1.5, 0},
+     2.57793546, 2.87082863,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {11, 2, -2, 0}, {5, 2, -4, 0},
+      {21, 2, -2, 0}, {13, 4, -2, 2}, {16, 2, -2, 2}, {2, 2, -2, 4},
+      {14, 2, -2, 2}, {22, 0, -4, 2}, {10, 0, -4, 0}, {3, 0, -4, 0},
+      {13, 0, -4, 2}, {21, -2, -2, 2}, {8, -2, -2, 4}, {6, -2, -2, 2},
+      {22, -4, -2, 2}, {14, -2, -2, 0}, {19, -2, -4, 0}, {1, -2, -2, 0},
+      {13, 0, -2, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* Symmetry2 */
+    {UINT64_C(0x00001b96f96e4258), {1, 1, 0}, MODEL_CYCLIC,
+     {1.5, 0.833333313, 0.833333313},
+     {1, 0.333333313, 0.333333313},
+     2.91819, 3.21108317,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {12, 2, 0, 0}, {19, 4, 0, 0}, {5, 4, 0, 0},
+      {17, 6, 2, 0}, {5, 6, 0, 2}, {21, 6, 2, 2}, {12, 6, 2, 2}, {18, 6, 4, 2},
+      {7, 6, 4, 2}, {20, 6, 2, 2}, {10, 4, 2, 2}, {3, 4, 2, 2}, {12, 2, 2, 2},
+      {18, 2, 4, 2}, {7, 2, 4, 2}, {20, 2, 2, 2}, {10, 0, 2, 2}, {3, 0, 2, 2},
+      {12, -2, 2, 2}, {22, -2, 2, 2}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* TableFireworks */
+    {UINT64_C(0x00002c7bf9cdbf9c), {1, 1, 90}, MODEL_CYCLIC,
+     {1.16666663, 0.416666657, 0},
+     {0.666666746, -0.0833333135, -0.5},
+     2.49634933, 2.78924251,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {21, 2, 0, 2}, {12, 2, 0, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {12, 0, 2, 0}, {22, 0, 2, 0}, {11, 2, 2, 0}, {5, 2, 0, 0},
+      {17, 4, 2, 0}, {1, 4, 2, 2}, {12, 4, 2, 0}, {22, 4, 2, 0}, {10, 4, 2, -2},
+      {6, 4, 0, -2}, {22, 2, 0, -2}, {15, 2, 0, -2}, {16, 2, -2, -2},
+      {3, 2, 0, -2}, {8, 0, 0, 0}, {7, 0, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Tapering */
+    {UINT64_C(0x000001eca3928670), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1.25, 0.5},
+     {-0.5, -1.75, 0},
+     2.52713418, 2.82002759,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {14, 4, -2, 0}, {18, 2, -2, 0},
+      {7, 2, -2, 0}, {20, 2, -4, 0}, {15, 0, -4, 2}, {21, 0, -4, 2},
+      {12, 0, -4, 2}, {23, 2, -2, 2}, {8, 0, -2, 2}, {2, 0, -2, 2},
+      {15, -2, -2, 2}, {20, 0, -4, 2}, {14, 0, -4, 2}, {23, 0, -4, 2},
+      {12, -2, -4, 0}, {18, -2, -2, 0}, {7, -2, -2, 0}, {21, -4, -2, 0},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* TaperingTurned */
+    {UINT64_C(0x000001eca3128670), {1, 0, -1}, MODEL_ACYCLIC,
+     {0, -0.583333313, 0.5},
+     {-0.5, -1.08333325, 0},
+     3.07148361, 3.36437678,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {14, 4, -2, 0}, {18, 2, -2, 0},
+      {7, 2, -2, 0}, {20, 2, -4, 0}, {15, 0, -4, 2}, {21, 0, -4, 2},
+      {12, 0, -4, 2}, {23, 2, -2, 2}, {8, 0, -2, 2}, {3, 0, 0, 0},
+      {12, -2, 0, 0}, {23, 0, 2, 0}, {13, 0, 2, 0}, {20, 0, 2, 0},
+      {15, -2, 2, 2}, {16, -2, 0, 2}, {6, -2, 0, 2}, {22, -4, 0, 2},
+      {11, -2, 0, 2}, {0, -2, -2, 0}, {11, 0, -2, 2}, {0, 0, -4, 0}}},
+    /* TeaLightStick */
+    {UINT64_C(0x00002f5bd6f5b4a3), {1, 1, 90}, MODEL_CYCLIC,
+     {0.166666672, -1, 0},
+     {-0.333333343, -1.5, -0.5},
+     2.42304516, 2.71593833,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {15, 0, -2, 0}, {21, 0, -2, 0},
+      {13, 2, -2, 2}, {16, 0, -2, 2}, {2, 0, -2, 4}, {11, 0, -2, 4},
+      {4, 0, -2, 2}, {22, 0, -4, 2}, {10, 0, -4, 0}, {6, 0, -6, 0},
+      {19, 0, -6, 0}, {1, 0, -4, 0}, {12, 0, -4, -2}, {18, 0, -2, -2},
+      {3, 0, -2, -4}, {9, 0, -2, -4}, {5, 0, -2, -2}, {21, 0, 0, -2},
+      {8, 0, 0, 0}, {7, 0, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* thighmaster */
+    {UINT64_C(0x000001c1c341c1c3), {1, 1, 90}, MODEL_CYCLIC,
+     {0.5, 0.5, -0.666666687},
+     {0, 0, -1.16666675},
+     3.09341025, 3.38630366,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {14, 2, -2, -2}, {19, 2, -4, -2},
+      {1, 2, -2, -2}, {9, 4, -2, -4}, {1, 4, 0, -2}, {13, 6, 0, -2},
+      {16, 4, 0, -2}, {7, 4, 2, 0}, {16, 2, 0, 0}, {3, 2, 2, 0}, {12, 0, 2, 0},
+      {23, 2, 4, 0}, {12, 0, 4, -2}, {18, 0, 6, -2}, {2, 0, 4, -2},
+      {10, -2, 4, -4}, {2, -2, 2, -2}, {15, -4, 2, -2}, {17, -2, 2, -2},
+      {5, -2, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Terraces */
+    {UINT64_C(0x00001efb57f659c7), {1, 1, 0}, MODEL_CYCLIC,
+     {0.5, 0.458333343, -0.458333343},
+     {0, -0.0416666865, -0.958333254},
+     3.17425227, 3.4671452,
+     {{14, 2, 0, 0}, {18, 0, 0, 0}, {6, 0, -2, -2}, {22, -2, -2, -2},
+      {11, 0, -2, -2}, {1, 0, -2, -2}, {12, 0, -2, -4}, {19, 2, -2, -4},
+      {5, 2, -2, -4}, {21, 2, 0, -4}, {8, 2, 0, -2}, {7, 2, 2, -2},
+      {21, 0, 2, -2}, {9, 2, 2, -2}, {5, 2, 2, 0}, {21, 2, 4, 0}, {8, 2, 4, 2},
+      {2, 2, 4, 2}, {15, 0, 4, 2}, {16, 0, 2, 2}, {6, 0, 2, 2}, {22, -2, 2, 2},
+      {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Terrier */
+    {UINT64_C(0x00000028822808a2), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.75, -0.333333343, 0.5},
+     {2.25, -0.833333254, 0},
+     4.16016483, 4.45305824,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {11, 0, -2, 2}, {1, 0, -2, 2},
+      {9, 2, -2, 0}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {11, 6, -4, 2}, {1, 6, -4, 2}, {8, 6, -4, 2}, {3, 6, -2, 0},
+      {9, 6, -2, 0}, {1, 6, 0, 2}, {9, 8, 0, 0}, {0, 8, 0, 0}, {11, 10, 0, 2},
+      {1, 10, 0, 2}, {8, 10, 0, 2}, {3, 10, 2, 0}, {8, 8, 2, 2}, {3, 8, 4, 0},
+      {8, 6, 4, 2}, {3, 6, 6, 0}}},
+    /* Three-Legged */
+    {UINT64_C(0x0000134e448ce4d3), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -1.5, 0},
+     {-0.5, -2, -0.5},
+     3.44571948, 3.73861289,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {11, 2, -2, 0}, {5, 2, -4, 0},
+      {17, 4, -2, 0}, {0, 4, -4, 0}, {10, 4, -4, 0}, {6, 4, -6, 0},
+      {18, 2, -4, 0}, {3, 2, -4, -2}, {8, 0, -4, 0}, {2, 0, -4, 0},
+      {10, -2, -4, -2}, {7, -2, -4, 0}, {16, -4, -6, 0}, {3, -4, -4, 0},
+      {9, -4, -4, 0}, {4, -4, -2, 0}, {19, -2, -4, 0}, {1, -2, -2, 0},
+      {13, 0, -2, 0}, {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* ThreePeaks */
+    {UINT64_C(0x0000106e65bee6c3), {1, 1, 180}, MODEL_CYCLIC,
+     {0, -0.666666687, -0.666666687},
+     {-0.5, -1.16666675, -1.16666675},
+     2.61469388, 2.90758729,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {14, 2, -2, -2}, {19, 2, -4, -2},
+      {5, 2, -4, -2}, {21, 2, -2, -2}, {12, 2, -2, -2}, {18, 2, 0, -2},
+      {7, 2, 0, -2}, {21, 0, 0, -2}, {8, 0, 0, 0}, {2, 0, 0, 0}, {14, 0, 0, -2},
+      {18, -2, 0, -2}, {7, -2, 0, -2}, {20, -2, -2, -2}, {14, -2, -2, -2},
+      {19, -2, -4, -2}, {5, -2, -4, -2}, {21, -2, -2, -2}, {13, 0, -2, 0},
+      {21, -2, 0, 0}, {9, 0, 0, 0}, {1, 0, 2, 2}}},
+    /* ToTheFront */
+    {UINT64_C(0x0000123494a1e578), {1, 1, 270}, MODEL_CYCLIC,
+     {0.75, 0.333333343, 2},
+     {0.25, -0.166666672, 1.5},
+     2.6667695, 2.95966268,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {13, 4, 0, 2}, {16, 2, 0, 2}, {3, 2, 2, 2},
+      {13, 2, 2, 4}, {20, 2, 2, 4}, {11, 2, 2, 6}, {4, 2, 2, 4}, {19, 4, 0, 4},
+      {5, 4, 0, 4}, {16, 4, 0, 4}, {7, 4, 2, 6}, {20, 4, 0, 6}, {10, 2, 0, 6},
+      {3, 2, 0, 6}, {8, 0, 0, 8}, {6, 0, 0, 6}, {22, -2, 0, 6}, {14, 0, 0, 4},
+      {23, 0, 0, 4}, {12, -2, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Top */
+    {UINT64_C(0x00000bee5df9c196), {1, 1, 0}, MODEL_CYCLIC,
+     {-1.41666663, -0.416666657, 0.666666687},
+     {-1.91666663, -0.916666746, 0.166666627},
+     2.83822536, 3.13111877,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {20, 0, -2, 2}, {14, 0, -2, 2},
+      {18, -2, -2, 2}, {6, -2, -4, 0}, {18, -4, -2, 0}, {3, -4, -2, -2},
+      {13, -4, -2, 0}, {20, -4, -2, 0}, {11, -4, -2, 2}, {5, -4, -4, 2},
+      {21, -4, -2, 2}, {8, -4, -2, 4}, {6, -4, -2, 2}, {23, -4, 0, 2},
+      {13, -4, 0, 2}, {17, -4, 2, 2}, {4, -4, 2, 2}, {23, -2, 2, 2},
+      {9, -2, 2, 0}, {0, -2, 2, 0}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Transport */
+    {UINT64_C(0x000000828a28a282), {1, 1, 0}, MODEL_CYCLIC,
+     {-1.5, 0.5, 0.5},
+     {-2, 0, 0},
+     2.94317484, 3.23606801,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {3, -2, -2, 0},
+      {9, -2, -2, 0}, {1, -2, 0, 2}, {8, -2, 0, 2}, {2, -2, 0, 2},
+      {10, -4, 0, 0}, {3, -4, 0, 0}, {9, -4, 0, 0}, {1, -4, 2, 2},
+      {8, -4, 2, 2}, {2, -4, 2, 2}, {10, -6, 2, 0}, {3, -6, 2, 0},
+      {9, -6, 2, 0}, {1, -6, 4, 2}, {9, -4, 4, 0}, {0, -4, 4, 0},
+      {11, -2, 4, 2}, {0, -2, 2, 0}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Triangle */
+    {UINT64_C(0x0000300070007000), {1, 1, 90}, MODEL_CYCLIC,
+     {1, -2, -1},
+     {0.5, -2.5, -1.5},
+     3.98582602, 4.27871943,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {11, 6, -4, 2}, {0, 6, -6, 0}, {14, 8, -6, 0}, {18, 6, -6, 0},
+      {6, 6, -8, -2}, {18, 4, -6, -2}, {6, 4, -8, -4}, {18, 2, -6, -4},
+      {6, 2, -8, -6}, {18, 0, -6, -6}, {3, 0, -6, -8}, {13, 0, -6, -6},
+      {21, -2, -4, -6}, {13, 0, -4, -4}, {21, -2, -2, -4}, {13, 0, -2, -2},
+      {21, -2, 0, -2}, {13, 0, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Tripple */
+    {UINT64_C(0x00002e662e62ee62), {1, 1, 0}, MODEL_CYCLIC,
+     {0, 0, -0.666666687},
+     {-0.5, -0.5, -1.16666675},
+     2.67207789, 2.96497107,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {11, 0, -2, 2}, {4, 0, -2, 0},
+      {18, 0, -2, 0}, {3, 0, -2, -2}, {9, 0, -2, -2}, {4, 0, 0, -2},
+      {18, 0, 0, -2}, {6, 0, -2, -4}, {19, 0, -2, -4}, {1, 0, 0, -4},
+      {8, 0, 0, -4}, {7, 0, 2, -4}, {17, 0, 2, -4}, {5, 0, 0, -2},
+      {16, 0, 0, -2}, {3, 0, 2, -2}, {9, 0, 2, -2}, {5, 0, 2, 0}, {16, 0, 2, 0},
+      {2, 0, 2, 2}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Twins */
+    {UINT64_C(0x0000023b660bb648), {1, 1, 0}, MODEL_CYCLIC,
+     {0.416666657, 1.41666663, 0.75},
+     {-0.0833333135, 0.916666627, 0.25},
+     3.10357428, 3.39646745,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {5, 4, 0, 2}, {16, 4, 0, 2},
+      {3, 4, 2, 2}, {12, 2, 2, 2}, {22, 2, 2, 2}, {10, 2, 2, 0}, {3, 2, 2, 0},
+      {8, 0, 2, 2}, {3, 0, 4, 0}, {9, 0, 4, 0}, {5, 0, 4, 2}, {16, 0, 4, 2},
+      {3, 0, 6, 2}, {12, -2, 6, 2}, {22, -2, 6, 2}, {10, -2, 6, 0},
+      {2, -2, 4, 2}, {11, -2, 4, 2}, {0, -2, 2, 0}, {11, 0, 2, 2},
+      {0, 0, 0, 0}}},
+    /* TwoSlants */
+    {UINT64_C(0x00002c1b99ec8a08), {1, 1, 270}, MODEL_CYCLIC,
+     {0.833333313, 1.16666663, 0.833333313},
+     {0.333333313, 0.666666746, 0.333333313},
+     2.53284883, 2.82574201,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {1, 4, 2, 2}, {8, 4, 2, 2},
+      {2, 4, 2, 2}, {10, 2, 2, 0}, {3, 2, 2, 0}, {8, 0, 2, 2}, {7, 0, 4, 2},
+      {17, 0, 4, 2}, {1, 0, 4, 4}, {12, 0, 4, 2}, {22, 0, 4, 2}, {11, 2, 4, 2},
+      {1, 2, 4, 2}, {13, 4, 4, 2}, {20, 4, 4, 2}, {10, 2, 4, 2}, {2, 2, 2, 4},
+      {10, 0, 2, 2}, {6, 0, 0, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* TwoWings */
+    {UINT64_C(0x0000071b128a28c6), {1, 1, 270}, MODEL_CYCLIC,
+     {-1.66666663, 0.333333343, 1.16666663},
+     {-2.16666651, -0.166666672, 0.666666746},
+     3.12233639, 3.41522956,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {16, -2, -2, 2}, {2, -2, -2, 4},
+      {10, -4, -2, 2}, {3, -4, -2, 2}, {9, -4, -2, 2}, {1, -4, 0, 4},
+      {8, -4, 0, 4}, {2, -4, 0, 4}, {10, -6, 0, 2}, {3, -6, 0, 2},
+      {9, -6, 0, 2}, {1, -6, 2, 4}, {12, -6, 2, 2}, {23, -4, 4, 2},
+      {9, -4, 4, 0}, {0, -4, 4, 0}, {15, -4, 4, 2}, {20, -2, 2, 2},
+      {11, -2, 2, 4}, {4, -2, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* UFO */
+    {UINT64_C(0x0000177dd595df75), {1, 0, -1}, MODEL_ACYCLIC,
+     {2.16666675, 0.5, 1.16666663},
+     {1.66666651, 0, 0.666666746},
+     3.13381004, 3.42670369,
+     {{15, 0, 0, 2}, {17, 2, 0, 2}, {1, 2, 0, 4}, {12, 2, 0, 2}, {18, 2, 2, 2},
+      {3, 2, 2, 0}, {13, 2, 2, 2}, {17, 2, 4, 2}, {0, 2, 2, 2}, {15, 2, 2, 4},
+      {17, 4, 2, 4}, {4, 4, 2, 4}, {22, 4, 0, 4}, {11, 6, 0, 4}, {4, 6, 0, 2},
+      {23, 8, 0, 2}, {8, 6, 0, 2}, {7, 6, 2, 2}, {21, 4, 2, 2}, {9, 6, 2, 2},
+      {4, 6, 4, 2}, {22, 6, 2, 2}, {11, 8, 2, 2}, {0, 8, 0, 0}}},
+    /* USS Enterprise */
+    {UINT64_C(0x00000e67287287b9), {1, 1, 0}, MODEL_CYCLIC,
+     {-0.625, 0.375, 1.91666663},
+     {-1.125, -0.125, 1.41666663},
+     2.83741069, 3.13030386,
+     {{15, 0, 0, 2}, {21, 0, 0, 2}, {8, 0, 0, 4}, {2, 0, 0, 4}, {15, -2, 0, 4},
+      {17, 0, 0, 4}, {5, 0, -2, 6}, {16, 0, -2, 6}, {6, 0, -2, 6},
+      {18, -2, 0, 6}, {3, -2, 0, 4}, {13, -2, 0, 6}, {21, -4, 2, 6},
+      {12, -4, 2, 6}, {22, -4, 2, 6}, {14, -2, 2, 4}, {19, -2, 0, 4},
+      {1, -2, 2, 4}, {8, -2, 2, 4}, {6, -2, 2, 2}, {19, -2, 2, 2},
+      {0, -2, 2, 0}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* UpAndDown */
+    {UINT64_C(0x00000b98888b9888), {1, 1, 180}, MODEL_CYCLIC,
+     {1, 0, 0},
+     {0.5, -0.5, -0.5},
+     3.30518293, 3.59807611,
+     {{11, 2, 0, 2}, {1, 2, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {11, 6, 0, 2},
+      {1, 6, 0, 2}, {12, 6, 0, 0}, {22, 6, 0, 0}, {10, 6, 0, -2}, {3, 6, 0, -2},
+      {8, 4, 0, 0}, {2, 4, 0, 0}, {10, 2, 0, -2}, {3, 2, 0, -2}, {8, 0, 0, 0},
+      {2, 0, 0, 0}, {10, -2, 0, -2}, {3, -2, 0, -2}, {13, -2, 0, 0},
+      {20, -2, 0, 0}, {11, -2, 0, 2}, {1, -2, 0, 2}, {9, 0, 0, 0},
+      {1, 0, 2, 2}}},
+    /* Upright */
+    {UINT64_C(0x000005df8390977c), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.208333328, -1, -0.0416666679},
+     {-0.291666657, -1.5, -0.541666627},
+     3.04415727, 3.33705068,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {20, 4, -2, 2}, {10, 2, -2, 2},
+      {6, 2, -4, 2}, {23, 2, -2, 2}, {8, 0, -2, 2}, {2, 0, -2, 2},
+      {10, -2, -2, 0}, {2, -2, -4, 2}, {14, -2, -4, 0}, {23, -2, -4, 0},
+      {9, -2, -4, -2}, {1, -2, -2, 0}, {9, 0, -2, -2}, {0, 0, -2, -2},
+      {14, 2, -2, -2}, {19, 2, -4, -2}, {1, 2, -2, -2}, {13, 4, -2, -2},
+      {16, 2, -2, -2}, {3, 2, 0, -2}, {8, 0, 0, 0}, {3, 0, 2, -2}}},
+    /* Upside-down */
+    {UINT64_C(0x000020285f97ca02), {1, 0, -1}, MODEL_ACYCLIC,
+     {-0.291666657, -1.16666663, -1.125},
+     {-0.791666746, -1.66666663, -1.625},
+     3.13166285, 3.42455602,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {10, -2, -2, 0}, {2, -2, -4, 2},
+      {11, -2, -4, 2}, {1, -2, -4, 2}, {9, 0, -4, 0}, {4, 0, -2, 0},
+      {23, 2, -2, 0}, {8, 0, -2, 0}, {6, 0, -2, -2}, {19, 0, -2, -2},
+      {0, 0, -2, -4}, {14, 2, -2, -4}, {18, 0, -2, -4}, {2, 0, -4, -4},
+      {10, -2, -4, -6}, {3, -2, -4, -6}, {9, -2, -4, -6}, {1, -2, -2, -4},
+      {9, 0, -2, -6}, {1, 0, 0, -4}, {8, 0, 0, -4}, {3, 0, 2, -6}}},
+    /* Valley */
+    {UINT64_C(0x000006e6748dee6c), {1, 0, -1}, MODEL_ACYCLIC,
+     {0.875, 0.416666657, 2.125},
+     {0.375, -0.0833333135, 1.625},
+     2.69579005, 2.98868322,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {16, 2, -2, 2}, {3, 2, 0, 2}, {9, 2, 0, 2},
+      {4, 2, 2, 2}, {18, 2, 2, 2}, {3, 2, 2, 0}, {13, 2, 2, 2}, {17, 2, 4, 2},
+      {5, 2, 2, 4}, {16, 2, 2, 4}, {7, 2, 4, 6}, {20, 2, 2, 6}, {11, 2, 2, 8},
+      {4, 2, 2, 6}, {18, 2, 2, 6}, {2, 2, 0, 6}, {11, 2, 0, 6}, {5, 2, -2, 6},
+      {16, 2, -2, 6}, {3, 2, 0, 6}, {8, 0, 0, 8}, {3, 0, 2, 6}}},
+    /* Viaduct */
+    {UINT64_C(0x00000b982cf3826e), {1, 1, 0}, MODEL_CYCLIC,
+     {-0.583333313, 0.416666657, 0.5},
+     {-1.08333325, -0.0833333135, 0},
+     2.4431622, 2.73605561,
+     {{10, 0, 0, 0}, {6, 0, -2, 0}, {19, 0, -2, 0}, {1, 0, 0, 0}, {8, 0, 0, 0},
+      {3, 0, 2, -2}, {8, -2, 2, 0}, {2, -2, 2, 0}, {15, -4, 2, 0},
+      {20, -2, 0, 0}, {11, -2, 0, 2}, {5, -2, -2, 2}, {17, 0, 0, 2},
+      {1, 0, 0, 4}, {8, 0, 0, 4}, {3, 0, 2, 2}, {8, -2, 2, 4}, {2, -2, 2, 4},
+      {14, -2, 2, 2}, {23, -2, 2, 2}, {9, -2, 2, 0}, {0, -2, 2, 0},
+      {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* View */
+    {UINT64_C(0x00001b906f5b0e6c), {1, 1, 0}, MODEL_CYCLIC,
+     {0.958333313, 0.958333313, 0.666666687},
+     {0.458333313, 0.458333313, 0.166666627},
+     2.71490431, 3.00779724,
+     {{11, 2, 0, 2}, {5, 2, -2, 2}, {16, 2, -2, 2}, {3, 2, 0, 2}, {9, 2, 0, 2},
+      {4, 2, 2, 2}, {19, 4, 0, 2}, {4, 4, 2, 0}, {23, 6, 2, 0}, {13, 6, 2, 0},
+      {16, 4, 2, 0}, {3, 4, 4, 0}, {12, 2, 4, 0}, {18, 2, 6, 0}, {7, 2, 6, 0},
+      {20, 2, 4, 0}, {15, 0, 4, 2}, {20, 2, 2, 2}, {10, 0, 2, 2}, {3, 0, 2, 2},
+      {12, -2, 2, 2}, {22, -2, 2, 2}, {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* Waterfall */
+    {UINT64_C(0x000031b1b1b1b1b1), {1, 0, -1}, MODEL_ACYCLIC,
+     {3.25, -0.5, 1},
+     {2.75, -1, 0.5},
+     4.14403868, 4.43693161,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {11, 2, -2, 4}, {1, 2, -2, 4},
+      {12, 2, -2, 2}, {23, 4, 0, 2}, {9, 4, 0, 0}, {0, 4, 0, 0}, {15, 4, 0, 2},
+      {20, 6, -2, 2}, {11, 6, -2, 4}, {1, 6, -2, 4}, {12, 6, -2, 2},
+      {23, 8, 0, 2}, {9, 8, 0, 0}, {0, 8, 0, 0}, {15, 8, 0, 2}, {20, 10, -2, 2},
+      {11, 10, -2, 4}, {1, 10, -2, 4}, {12, 10, -2, 2}, {23, 12, 0, 2},
+      {9, 12, 0, 0}, {1, 12, 2, 2}}},
+    /* windwheel */
+    {UINT64_C(0x00000be4be4be4be), {1, 1, 90}, MODEL_CYCLIC,
+     {-1.5, -0.5, 0.166666672},
+     {-2, -1, -0.333333343},
+     2.96788335, 3.26077676,
+     {{10, 0, 0, 0}, {6, 0, -2, 0}, {22, -2, -2, 0}, {15, -2, -2, 0},
+      {20, 0, -4, 0}, {10, -2, -4, 0}, {3, -2, -4, 0}, {12, -4, -4, 0},
+      {18, -4, -2, 0}, {7, -4, -2, 0}, {16, -6, -4, 0}, {3, -6, -2, 0},
+      {9, -6, -2, 0}, {4, -6, 0, 0}, {23, -4, 0, 0}, {13, -4, 0, 0},
+      {21, -6, 2, 0}, {9, -4, 2, 0}, {0, -4, 2, 0}, {14, -2, 2, 0},
+      {19, -2, 0, 0}, {5, -2, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Window */
+    {UINT64_C(0x00000028882220a2), {1, 1, 0}, MODEL_CYCLIC,
+     {-0.166666672, 1.33333337, 0.5},
+     {-0.666666627, 0.833333373, 0},
+     3.89126873, 4.18416214,
+     {{10, 0, 0, 0}, {2, 0, -2, 2}, {11, 0, -2, 2}, {1, 0, -2, 2},
+      {9, 2, -2, 0}, {1, 2, 0, 2}, {8, 2, 0, 2}, {3, 2, 2, 0}, {9, 2, 2, 0},
+      {1, 2, 4, 2}, {8, 2, 4, 2}, {3, 2, 6, 0}, {8, 0, 6, 2}, {2, 0, 6, 2},
+      {10, -2, 6, 0}, {3, -2, 6, 0}, {8, -4, 6, 2}, {2, -4, 6, 2},
+      {11, -4, 6, 2}, {0, -4, 4, 0}, {11, -2, 4, 2}, {0, -2, 2, 0},
+      {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* WindowToTheWorld */
+    {UINT64_C(0x0000082086c82086), {1, 1, 270}, MODEL_CYCLIC,
+     {-1, 0, 0},
+     {-1.5, -0.5, -0.5},
+     2.36541915, 2.65831232,
+     {{10, 0, 0, 0}, {7, 0, 0, 2}, {16, -2, -2, 2}, {6, -2, -2, 2},
+      {18, -4, 0, 2}, {6, -4, -2, 0}, {19, -4, -2, 0}, {4, -4, 0, -2},
+      {19, -2, -2, -2}, {5, -2, -2, -2}, {17, 0, 0, -2}, {1, 0, 0, 0},
+      {8, 0, 0, 0}, {6, 0, 0, -2}, {18, -2, 2, -2}, {7, -2, 2, -2},
+      {16, -4, 0, -2}, {7, -4, 2, 0}, {17, -4, 2, 0}, {5, -4, 0, 2},
+      {17, -2, 2, 2}, {4, -2, 2, 2}, {19, 0, 0, 2}, {4, 0, 2, 0}}},
+    /* Windshield */
+    {UINT64_C(0x00002286f92396ca), {1, 1, 0}, MODEL_CYCLIC,
+     {-0.583333313, 1, 1.25},
+     {-1.08333325, 0.5, 0.75},
+     2.7036314, 2.99652481,
+     {{10, 0, 0, 0}, {3, 0, 0, 0}, {8, -2, 0, 2}, {7, -2, 2, 2}, {17, -2, 2, 2},
+      {0, -2, 0, 2}, {15, -2, 0, 4}, {21, -2, 0, 4}, {8, -2, 0, 6},
+      {3, -2, 2, 4}, {9, -2, 2, 4}, {1, -2, 4, 6}, {12, -2, 4, 4},
+      {22, -2, 4, 4}, {10, -2, 4, 2}, {6, -2, 2, 2}, {19, -2, 2, 2},
+      {1, -2, 4, 2}, {9, 0, 4, 0}, {0, 0, 4, 0}, {10, 0, 4, 0}, {2, 0, 2, 2},
+      {11, 0, 2, 2}, {0, 0, 0, 0}}},
+    /* WingNut */
+    {UINT64_C(0x0000002fed9efe00), {1, 0, -1}, MODEL_ACYCLIC,
+     {1.08333337, -2.75, 0},
+     {0.583333254, -3.25, -0.5},
+     3.84070611, 4.13359928,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {11, 4, -2, 2}, {0, 4, -4, 0},
+      {10, 4, -4, 0}, {6, 4, -6, 0}, {22, 2, -6, 0}, {10, 2, -6, -2},
+      {3, 2, -6, -2}, {12, 0, -6, -2}, {19, 2, -6, -2}, {5, 2, -6, -2},
+      {21, 2, -4, -2}, {8, 2, -4, 0}, {2, 2, -4, 0}, {15, 0, -4, 0},
+      {16, 0, -6, 0}, {2, 0, -6, 2}, {11, 0, -6, 2}, {0, 0, -8, 0},
+      {11, 2, -8, 2}, {0, 2, -10, 0}, {11, 4, -10, 2}, {0, 4, -12, 0}}},
+    /* Wings2 */
+    {UINT64_C(0x000008e675f7b923), {1, 1, 90}, MODEL_CYCLIC,
+     {-0.958333313, -0.958333313, 0.0833333358},
+     {-1.45833349, -1.45833349, -0.416666687},
+     2.86976337, 3.16265655,
+     {{14, 2, 0, 0}, {22, 0, -2, 0}, {15, 0, -2, 0}, {20, 2, -4, 0},
+      {10, 0, -4, 0}, {3, 0, -4, 0}, {12, -2, -4, 0}, {22, -2, -4, 0},
+      {10, -2, -4, -2}, {7, -2, -4, 0}, {21, -4, -4, 0}, {8, -4, -4, 2},
+      {6, -4, -4, 0}, {23, -4, -2, 0}, {9, -4, -2, -2}, {5, -4, -2, 0},
+      {16, -4, -2, 0}, {3, -4, 0, 0}, {9, -4, 0, 0}, {4, -4, 2, 0},
+      {19, -2, 0, 0}, {5, -2, 0, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* WithoutName */
+    {UINT64_C(0x000025be26e25bee), {1, 1, 90}, MODEL_CYCLIC,
+     {0.0833333358, 0, -1.41666663},
+     {-0.416666687, -0.5, -1.91666663},
+     2.92759228, 3.22048569,
+     {{10, 0, 0, 0}, {6, 0, -2, 0}, {19, 0, -2, 0}, {0, 0, -2, -2},
+      {14, 2, -2, -2}, {23, 2, -2, -2}, {8, 0, -2, -2}, {6, 0, -2, -4},
+      {19, 0, -2, -4}, {4, 0, 0, -6}, {18, 0, 0, -6}, {3, 0, 0, -8},
+      {9, 0, 0, -8}, {5, 0, 0, -6}, {16, 0, 0, -6}, {7, 0, 2, -4},
+      {17, 0, 2, -4}, {1, 0, 2, -2}, {13, 2, 2, -2}, {20, 2, 2, -2},
+      {10, 0, 2, -2}, {7, 0, 2, 0}, {17, 0, 2, 0}, {5, 0, 0, 2}}},
+    /* Wolf */
+    {UINT64_C(0x0000202808a208a0), {1, 0, -1}, MODEL_ACYCLIC,
+     {-1.66666663, -2.33333325, 0.5},
+     {-2.16666651, -2.83333325, 0},
+     4.36618948, 4.65908289,
+     {{11, 2, 0, 2}, {0, 2, -2, 0}, {10, 2, -2, 0}, {3, 2, -2, 0},
+      {8, 0, -2, 2}, {2, 0, -2, 2}, {10, -2, -2, 0}, {2, -2, -4, 2},
+      {11, -2, -4, 2}, {0, -2, -6, 0}, {10, -2, -6, 0}, {3, -2, -6, 0},
+      {8, -4, -6, 2}, {2, -4, -6, 2}, {10, -6, -6, 0}, {2, -6, -8, 2},
+      {10, -8, -8, 0}, {3, -8, -8, 0}, {9, -8, -8, 0}, {1, -8, -6, 2},
+      {9, -6, -6, 0}, {1, -6, -4, 2}, {8, -6, -4, 2}, {3, -6, -2, 0}}},
+    /* X */
+    {UINT64_C(0x000002d6d28dbd81), {1, 1, 270}, MODEL_CYCLIC,
+     {0.208333328, 0.208333328, 1.91666663},
+     {-0.291666657, -0.291666657, 1.41666663},
+     2.53569913, 2.82859254,
+     {{15, 0, 0, 2}, {20, 2, -2, 2}, {15, 0, -2, 4}, {21, 0, -2, 4},
+      {9, 2, -2, 4}, {4, 2, 0, 4}, {23, 4, 0, 4}, {13, 4, 0, 4}, {16, 2, 0, 4},
+      {2, 2, 0, 6}, {10, 0, 0, 4}, {3, 0, 0, 4}, {9, 0, 0, 4}, {1, 0, 2, 6},
+      {12, 0, 2, 4}, {18, 0, 4, 4}, {7, 0, 4, 4}, {20, 0, 2, 4}, {10, -2, 2, 4},
+      {6, -2, 0, 4}, {19, -2, 0, 4}, {4, -2, 2, 2}, {19, 0, 0, 2},
+      {4, 0, 2, 0}}},
+};
+
+const struct model_key builtin_keys[] = {
+    {UINT64_C(0x0000000000000000), BUILTIN_0},
+    {UINT64_C(0x0000000000000000), BUILTIN_229},
+    {UINT64_C(0x0000000000002800), BUILTIN_51},
+#ifndef WIN32
+    {UINT64_C(0x00000000c0a020a2), BUILTIN_56},
+#endif
+    {UINT64_C(0x0000000200800200), BUILTIN_54},
+    {UINT64_C(0x000000028a28ca28), BUILTIN_5},
+    {UINT64_C(0x000000028a28ca28), BUILTIN_88},
+#ifndef WIN32
+    {UINT64_C(0x00000002c0a020a2), BUILTIN_57},
+#endif
+    {UINT64_C(0x0000001b00801b00), BUILTIN_36},
+    {UINT64_C(0x000000280440a004), BUILTIN_61},
+    {UINT64_C(0x00000028822808a2), BUILTIN_242},
+    {UINT64_C(0x00000028882220a2), BUILTIN_263},
+    {UINT64_C(0x0000002fed9efe00), BUILTIN_266},
+    {UINT64_C(0x00000030d0d0400a), BUILTIN_123},
+    {UINT64_C(0x0000005bc0805bc0), BUILTIN_37},
+    {UINT64_C(0x0000008222082f9c), BUILTIN_59},
+    {UINT64_C(0x000000828a28a282), BUILTIN_247},
+    {UINT64_C(0x0000009bbb666e02), BUILTIN_178},
+    {UINT64_C(0x000000a00c40a004), BUILTIN_62},
+    {UINT64_C(0x000000a02288a228), BUILTIN_20},
+    {UINT64_C(0x000000e6ec1b2839), BUILTIN_97},
+    {UINT64_C(0x00000100c100c100), BUILTIN_16},
+    {UINT64_C(0x00000100c100c100), BUILTIN_148},
+    {UINT64_C(0x0000010830810830), BUILTIN_41},
+    {UINT64_C(0x000001c1c341c1c3), BUILTIN_240},
+    {UINT64_C(0x000001eca3128670), BUILTIN_238},
+    {UINT64_C(0x000001eca3928670), BUILTIN_237},
+    {UINT64_C(0x000001ef967b1b32), BUILTIN_145},
+    {UINT64_C(0x0000020a26e2820e), BUILTIN_99},
+    {UINT64_C(0x0000023281b0a120), BUILTIN_163},
+    {UINT64_C(0x0000023b660bb648), BUILTIN_250},
+    {UINT64_C(0x0000026c1b81b286), BUILTIN_85},
+    {UINT64_C(0x0000027e5f9ca183), BUILTIN_89},
+    {UINT64_C(0x000002d28812830a), BUILTIN_48},
+    {UINT64_C(0x000002d6d28dbd81), BUILTIN_270},
+    {UINT64_C(0x000002dc748dc760), BUILTIN_74},
+    {UINT64_C(0x0000030300801010), BUILTIN_174},
+    {UINT64_C(0x000003436fbf754b), BUILTIN_204},
+    {UINT64_C(0x000003e50f943e50), BUILTIN_224},
+    {UINT64_C(0x0000041b0c841b0c), BUILTIN_35},
+    {UINT64_C(0x000004b341b0d18c), BUILTIN_132},
+    {UINT64_C(0x000004d0c4d0c4d0), BUILTIN_17},
+    {UINT64_C(0x000005df8390977c), BUILTIN_256},
+    {UINT64_C(0x000005e396f927c6), BUILTIN_223},
+    {UINT64_C(0x000006c6cc204428), BUILTIN_159},
+    {UINT64_C(0x000006e6748dee6c), BUILTIN_258},
+    {UINT64_C(0x000006fce5be456c), BUILTIN_176},
+    {UINT64_C(0x0000071b128a28c6), BUILTIN_252},
+    {UINT64_C(0x0000072df75df587), BUILTIN_142},
+    {UINT64_C(0x000007b67bc0a288), BUILTIN_28},
+    {UINT64_C(0x0000081b08881b08), BUILTIN_34},
+    {UINT64_C(0x0000082086c82086), BUILTIN_264},
+    {UINT64_C(0x000008208c848208), BUILTIN_181},
+    {UINT64_C(0x00000822d77dd58a), BUILTIN_180},
+    {UINT64_C(0x0000082888882888), BUILTIN_228},
+    {UINT64_C(0x0000083300801108), BUILTIN_147},
+    {UINT64_C(0x0000084321c84321), BUILTIN_112},
+    {UINT64_C(0x0000085bc8885bc8), BUILTIN_33},
+    {UINT64_C(0x0000088888888888), BUILTIN_227},
+    {UINT64_C(0x000008e675f7b923), BUILTIN_267},
+    {UINT64_C(0x000008ed99bbb648), BUILTIN_171},
+    {UINT64_C(0x0000090d00d00400), BUILTIN_63},
+    {UINT64_C(0x0000095bf8895bf8), BUILTIN_32},
+    {UINT64_C(0x000009b866ec9b82), BUILTIN_124},
+    {UINT64_C(0x000009f9c8797839), BUILTIN_77},
+    {UINT64_C(0x00000a00a18a00a2), BUILTIN_144},
+    {UINT64_C(0x00000a04a0ca04a0), BUILTIN_108},
+    {UINT64_C(0x00000a04a0ca04a0), BUILTIN_109},
+    {UINT64_C(0x00000a1b9923b992), BUILTIN_161},
+    {UINT64_C(0x00000a2281b0a228), BUILTIN_157},
+    {UINT64_C(0x00000a280a280a28), BUILTIN_216},
+    {UINT64_C(0x00000a3281b0a128), BUILTIN_172},
+    {UINT64_C(0x00000a3b420d0a1e), BUILTIN_166},
+    {UINT64_C(0x00000a3be5928c20), BUILTIN_140},
+    {UINT64_C(0x00000b982cf3826e), BUILTIN_259},
+    {UINT64_C(0x00000b98888b9888), BUILTIN_255},
+    {UINT64_C(0x00000be4be4be4be), BUILTIN_262},
+    {UINT64_C(0x00000be5820be582), BUILTIN_90},
+    {UINT64_C(0x00000bee5df9c196), BUILTIN_246},
+    {UINT64_C(0x00000c71209304e0), BUILTIN_64},
+    {UINT64_C(0x00000cccb7333333), BUILTIN_70},
+    {UINT64_C(0x00000d1bf5873976), BUILTIN_46},
+    {UINT64_C(0x00000dbe71936f9c), BUILTIN_170},
+    {UINT64_C(0x00000dc04dc04dc0), BUILTIN_3},
+    {UINT64_C(0x00000dcdcdcdcdcd), BUILTIN_208},
+    {UINT64_C(0x00000e67287287b9), BUILTIN_254},
+    {UINT64_C(0x00000ed9d9eded93), BUILTIN_226},
+    {UINT64_C(0x00001000d000d000), BUILTIN_18},
+    {UINT64_C(0x0000100804ccd111), BUILTIN_211},
+    {UINT64_C(0x00001020108ca284), BUILTIN_95},
+    {UINT64_C(0x000010280740a01d), BUILTIN_60},
+    {UINT64_C(0x0000102ed48f6603), BUILTIN_146},
+    {UINT64_C(0x0000105bc3905bc3), BUILTIN_38},
+    {UINT64_C(0x0000106e65bee6c3), BUILTIN_244},
+    {UINT64_C(0x000010c1bdd6c10c), BUILTIN_114},
+    {UINT64_C(0x000010de32849d0f), BUILTIN_222},
+    {UINT64_C(0x000010eced9ecee3), BUILTIN_86},
+    {UINT64_C(0x0000116d1e51cf3c), BUILTIN_79},
+    {UINT64_C(0x000011cdbdd77dd6), BUILTIN_162},
+    {UINT64_C(0x000011ce20891cc0), BUILTIN_164},
+    {UINT64_C(0x0000123494a1e578), BUILTIN_245},
+    {UINT64_C(0x0000128795393f95), BUILTIN_203},
+    {UINT64_C(0x0000131b13931b13), BUILTIN_40},
+    {UINT64_C(0x0000134734d34734), BUILTIN_210},
+    {UINT64_C(0x0000134e448ce4d3), BUILTIN_243},
+    {UINT64_C(0x0000135bd3935bd3), BUILTIN_39},
+    {UINT64_C(0x00001371d371d371), BUILTIN_52},
+    {UINT64_C(0x0000137371b1d1d3), BUILTIN_234},
+    {UINT64_C(0x0000139131b13393), BUILTIN_198},
+    {UINT64_C(0x0000155555555555), BUILTIN_104},
+    {UINT64_C(0x000015bb95bf99bf), BUILTIN_92},
+    {UINT64_C(0x000015df01b0177f), BUILTIN_44},
+    {UINT64_C(0x000015df577f5dff), BUILTIN_128},
+    {UINT64_C(0x000015df7555df75), BUILTIN_7},
+    {UINT64_C(0x000015df9c6cbd61), BUILTIN_175},
+    {UINT64_C(0x000015f75fd5f75f), BUILTIN_83},
+    {UINT64_C(0x000015ff55ff55ff), BUILTIN_2},
+    {UINT64_C(0x000016d236fc06c0), BUILTIN_45},
+    {UINT64_C(0x000016f96f96f96f), BUILTIN_11},
+    {UINT64_C(0x000017428a2837f7), BUILTIN_91},
+    {UINT64_C(0x000017539139bb5f), BUILTIN_25},
+    {UINT64_C(0x00001767ded767de), BUILTIN_15},
+    {UINT64_C(0x0000177d557dd7ff), BUILTIN_154},
+    {UINT64_C(0x0000177dca3284a1), BUILTIN_169},
+    {UINT64_C(0x0000177dd45df756), BUILTIN_193},
+    {UINT64_C(0x0000177dd595df75), BUILTIN_253},
+    {UINT64_C(0x0000177e288a25df), BUILTIN_197},
+    {UINT64_C(0x000017b99f97b99f), BUILTIN_156},
+    {UINT64_C(0x000017d7d557d7d5), BUILTIN_153},
+    {UINT64_C(0x000017f57f57f57f), BUILTIN_8},
+    {UINT64_C(0x000017f757f757f7), BUILTIN_12},
+    {UINT64_C(0x00001826e091460b), BUILTIN_14},
+    {UINT64_C(0x000018428796cb88), BUILTIN_188},
+    {UINT64_C(0x000018928390a38b), BUILTIN_189},
+    {UINT64_C(0x000018f94b98f94b), BUILTIN_102},
+    {UINT64_C(0x0000190a23922899), BUILTIN_43},
+    {UINT64_C(0x0000195bfb995bfb), BUILTIN_31},
+    {UINT64_C(0x0000199bbb999bbb), BUILTIN_30},
+    {UINT64_C(0x000019ed93319ed9), BUILTIN_121},
+    {UINT64_C(0x000019ed97359ed9), BUILTIN_122},
+    {UINT64_C(0x000019ed991d9ed9), BUILTIN_120},
+    {UINT64_C(0x00001b27d5393f5e), BUILTIN_221},
+    {UINT64_C(0x00001b71e5be71db), BUILTIN_160},
+    {UINT64_C(0x00001b906f5b0e6c), BUILTIN_260},
+    {UINT64_C(0x00001b96f96e4258), BUILTIN_235},
+    {UINT64_C(0x00001b99bb99bb9b), BUILTIN_201},
+    {UINT64_C(0x00001bb39bb99b91), BUILTIN_100},
+    {UINT64_C(0x00001bc476392dcc), BUILTIN_168},
+    {UINT64_C(0x00001c1e57dd7f9c), BUILTIN_76},
+    {UINT64_C(0x00001d55dffdd7d7), BUILTIN_205},
+    {UINT64_C(0x00001d807609d027), BUILTIN_202},
+    {UINT64_C(0x00001dc1e08274dd), BUILTIN_209},
+    {UINT64_C(0x00001df75f5df75f), BUILTIN_1},
+    {UINT64_C(0x00001ed9ec0ed9ed), BUILTIN_29},
+    {UINT64_C(0x00001ee6ca2823b9), BUILTIN_177},
+    {UINT64_C(0x00001efb57f659c7), BUILTIN_241},
+    {UINT64_C(0x00001f9539128797), BUILTIN_23},
+    {UINT64_C(0x00001fb37bd67465), BUILTIN_158},
+    {UINT64_C(0x00001fe578e4e4e4), BUILTIN_191},
+    {UINT64_C(0x00001fffff755555), BUILTIN_186},
+    {UINT64_C(0x0000200002882288), BUILTIN_84},
+    {UINT64_C(0x0000200200800202), BUILTIN_55},
+    {UINT64_C(0x000020028ca284a0), BUILTIN_179},
+    {UINT64_C(0x0000200e402806c0), BUILTIN_119},
+    {UINT64_C(0x000020167b658008), BUILTIN_133},
+    {UINT64_C(0x0000202808a208a0), BUILTIN_269},
+    {UINT64_C(0x000020285f97ca02), BUILTIN_257},
+    {UINT64_C(0x0000203ed9ef8008), BUILTIN_4},
+    {UINT64_C(0x0000206c001b099e), BUILTIN_21},
+    {UINT64_C(0x0000208336f9ce28), BUILTIN_134},
+    {UINT64_C(0x00002086c828a392), BUILTIN_139},
+    {UINT64_C(0x0000209fd7d5e080), BUILTIN_195},
+    {UINT64_C(0x000020a3280a3282), BUILTIN_66},
+    {UINT64_C(0x000020a3284a3282), BUILTIN_67},
+    {UINT64_C(0x000020a3288a3282), BUILTIN_68},
+    {UINT64_C(0x000020a328ca3282), BUILTIN_65},
+    {UINT64_C(0x000020a39b3b399a), BUILTIN_214},
+    {UINT64_C(0x000020a3d8a2d4a0), BUILTIN_116},
+    {UINT64_C(0x0000211eca3b44a0), BUILTIN_6},
+    {UINT64_C(0x00002128c90dbdd6), BUILTIN_173},
+    {UINT64_C(0x00002176748dedf2), BUILTIN_192},
+    {UINT64_C(0x000021c6ccce4f00), BUILTIN_22},
+    {UINT64_C(0x000021c6ccce4f00), BUILTIN_182},
+    {UINT64_C(0x0000220a20822822), BUILTIN_225},
+    {UINT64_C(0x0000222222222222), BUILTIN_9},
+    {UINT64_C(0x0000222880a02288), BUILTIN_107},
+    {UINT64_C(0x00002286f92396ca), BUILTIN_265},
+    {UINT64_C(0x000022880a208a00), BUILTIN_24},
+    {UINT64_C(0x000022887284a028), BUILTIN_53},
+    {UINT64_C(0x000023364a19cca0), BUILTIN_103},
+    {UINT64_C(0x0000239288a39288), BUILTIN_98},
+    {UINT64_C(0x000023eced9eced0), BUILTIN_131},
+    {UINT64_C(0x00002420e6ee6ca0), BUILTIN_42},
+    {UINT64_C(0x000024286e66e420), BUILTIN_96},
+    {UINT64_C(0x000025be26e25bee), BUILTIN_268},
+    {UINT64_C(0x0000266666666666), BUILTIN_10},
+    {UINT64_C(0x000027bf5df9c1cd), BUILTIN_71},
+    {UINT64_C(0x00002800bf75dfe2), BUILTIN_231},
+    {UINT64_C(0x00002820cfbcc20a), BUILTIN_47},
+    {UINT64_C(0x00002846c47fe55e), BUILTIN_207},
+    {UINT64_C(0x0000285f528de0b7), BUILTIN_75},
+    {UINT64_C(0x000028a181b0b20a), BUILTIN_165},
+#ifndef WIN32
+    {UINT64_C(0x0000292881b08a3a), BUILTIN_183},
+#endif
+    {UINT64_C(0x00002939bb99b93a), BUILTIN_200},
+    {UINT64_C(0x000029648e4a399a), BUILTIN_219},
+    {UINT64_C(0x00002b28c0004a1a), BUILTIN_81},
+    {UINT64_C(0x00002bbb67b99efa), BUILTIN_218},
+    {UINT64_C(0x00002c1b99ec8a08), BUILTIN_251},
+    {UINT64_C(0x00002c7bf9cdbf9c), BUILTIN_236},
+    {UINT64_C(0x00002d9b936fe56f), BUILTIN_151},
+    {UINT64_C(0x00002d9ee39bb9b2), BUILTIN_110},
+    {UINT64_C(0x00002d9f5df9c1cd), BUILTIN_73},
+#ifndef WIN32
+    {UINT64_C(0x00002dededededef), BUILTIN_50},
+#endif
+    {UINT64_C(0x00002e0bed6f6582), BUILTIN_101},
+    {UINT64_C(0x00002e662e62ee62), BUILTIN_249},
+    {UINT64_C(0x00002ed6f5bd9bdd), BUILTIN_136},
+    {UINT64_C(0x00002f5bd6f5b4a3), BUILTIN_239},
+    {UINT64_C(0x00002f75bdd6e48e), BUILTIN_217},
+    {UINT64_C(0x0000300070007000), BUILTIN_248},
+    {UINT64_C(0x00003008200d77dd), BUILTIN_206},
+    {UINT64_C(0x0000304737b73443), BUILTIN_69},
+    {UINT64_C(0x0000305f2df75d85), BUILTIN_105},
+    {UINT64_C(0x00003083455df75c), BUILTIN_94},
+    {UINT64_C(0x000030e430810e41), BUILTIN_220},
+    {UINT64_C(0x000031b1b1b1b1b1), BUILTIN_261},
+    {UINT64_C(0x00003218e4b218e4), BUILTIN_199},
+    {UINT64_C(0x0000328a3ca28e00), BUILTIN_49},
+    {UINT64_C(0x00003306c390cc0a), BUILTIN_232},
+    {UINT64_C(0x00003306c390ce00), BUILTIN_155},
+    {UINT64_C(0x0000335b41b0dbd1), BUILTIN_138},
+    {UINT64_C(0x0000336f34736f34), BUILTIN_150},
+    {UINT64_C(0x0000336f9cd1e5b4), BUILTIN_149},
+    {UINT64_C(0x000033e45bd6f394), BUILTIN_167},
+    {UINT64_C(0x0000343436fd77d5), BUILTIN_141},
+    {UINT64_C(0x0000343989b0372f), BUILTIN_212},
+    {UINT64_C(0x0000345dfd77d5df), BUILTIN_115},
+    {UINT64_C(0x000034767478d01c), BUILTIN_125},
+    {UINT64_C(0x000034c074c074c0), BUILTIN_190},
+    {UINT64_C(0x0000357dd5fdd7f5), BUILTIN_126},
+    {UINT64_C(0x0000358a2f758a2f), BUILTIN_233},
+    {UINT64_C(0x00003651e5be7167), BUILTIN_111},
+    {UINT64_C(0x0000366ed9ee6588), BUILTIN_230},
+    {UINT64_C(0x0000367b41c1e5df), BUILTIN_129},
+    {UINT64_C(0x0000367c85ed9c20), BUILTIN_117},
+    {UINT64_C(0x000036f9c628200b), BUILTIN_187},
+    {UINT64_C(0x00003726c01b874a), BUILTIN_143},
+    {UINT64_C(0x0000375f5df9c1cd), BUILTIN_72},
+    {UINT64_C(0x000037dd77dd77dd), BUILTIN_78},
+    {UINT64_C(0x0000380e61e58a28), BUILTIN_106},
+    {UINT64_C(0x0000380e61e58a28), BUILTIN_213},
+    {UINT64_C(0x0000382081b08209), BUILTIN_185},
+    {UINT64_C(0x0000396d17dd77d4), BUILTIN_118},
+    {UINT64_C(0x00003b1b19bb1b19), BUILTIN_87},
+    {UINT64_C(0x00003b4f75df7536), BUILTIN_80},
+    {UINT64_C(0x00003b6667be59ec), BUILTIN_130},
+    {UINT64_C(0x00003b666eed98e4), BUILTIN_135},
+#ifndef WIN32
+    {UINT64_C(0x00003b9910108303), BUILTIN_58},
+#endif
+    {UINT64_C(0x00003bb999bbb999), BUILTIN_152},
+    {UINT64_C(0x00003bbbbbbbbbbb), BUILTIN_113},
+    {UINT64_C(0x00003c7bed9ef9c5), BUILTIN_184},
+    {UINT64_C(0x00003dd40d0c0f75), BUILTIN_26},
+    {UINT64_C(0x00003dd483908f75), BUILTIN_27},
+    {UINT64_C(0x00003dd5fdd5fdd5), BUILTIN_82},
+    {UINT64_C(0x00003df1b31b99f5), BUILTIN_137},
+    {UINT64_C(0x00003e48e5be48e5), BUILTIN_196},
+    {UINT64_C(0x00003e4be4be4be4), BUILTIN_19},
+    {UINT64_C(0x00003e71b99b93e5), BUILTIN_127},
+    {UINT64_C(0x00003f7565df9c1c), BUILTIN_13},
+    {UINT64_C(0x00003fd57fd57fd5), BUILTIN_215},
+    {UINT64_C(0x00003ffe34445111), BUILTIN_194},
+    {UINT64_C(0x00003fffffffffff), BUILTIN_93},
+};
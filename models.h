@@ -0,0 +1,69 @@
+/* models.h - the built in models, and what is known about each of them
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_MODELS_H
+#define GLSNAKE_MODELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "geometry.h"
+#include "shape.h"
+
+/* models.c is generated from data/models.glsnake by glsnake-convert -f c,
+ * so nothing about the built in models has to be worked out at run time. */
+
+/* the colour a model is given, unless -altcolour; glsnake numbers its
+ * colours the same way */
+#define MODEL_CYCLIC 0
+#define MODEL_ACYCLIC 1
+#define MODEL_INVALID 2
+
+/* Whether a shape is legal or cyclic doesn't depend on its last joint, so
+ * shapes are looked up by their packed form without it. */
+#define MODEL_KEY(packed) ((packed) & ~((uint64_t)3 << (2 * (NODE_COUNT - 1))))
+
+struct model_info {
+  uint64_t packed;
+  struct snake_metrics metrics;
+  unsigned char colour;
+  /* Bounds the snake: with explode e, the centre node_transforms and
+   * snake_centre give is centre + e * centre_explode, and no part of any
+   * node is further from it than radius + e * radius_explode. */
+  float centre[3], centre_explode[3];
+  float radius, radius_explode;
+  /* where m[1] to m[NODE_COUNT] of node_transforms go */
+  struct node_place node[NODE_COUNT];
+};
+
+struct model_key {
+  uint64_t key;
+  int index;
+};
+
+extern struct model_s builtin_model[];
+extern const struct model_info builtin_info[];
+/* sorted by key, so that a shape can be found with bsearch */
+extern const struct model_key builtin_keys[];
+extern const size_t builtin_models;
+
+#endif /* GLSNAKE_MODELS_H */
@@ -0,0 +1,285 @@
+/* perf.c - where each frame's time goes, for the HUD and -benchmark
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/* Everything lives in fixed arrays: the latest frames in a ring for the
+ * HUD, and a histogram of every frame time for -benchmark, so that nothing
+ * is allocated while frames are being timed. */
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef HAVE_GETTIMEOFDAY
+#include <sys/time.h>
+#endif
+
+#include "perf.h"
+#ifdef GLSNAKE_GL_COUNT
+#include "glcount.h"
+#endif
+
+/* how deeply phases can nest */
+#define PERF_DEPTH 8
+/* frame times are counted in buckets this many milliseconds wide, up to
+ * HISTOGRAM_BUCKETS of them; longer frames go in the last */
+#define HISTOGRAM_WIDTH 0.1
+#define HISTOGRAM_BUCKETS 1000
+
+const char *const perf_phase_name[PERF_PHASES] = {"idle", "kinematics",
+                                                  "draw", "swap"};
+const char *const perf_counter_name[PERF_COUNTERS] = {"legality_checks",
+                                                      "morphs"};
+const char *const perf_gpu_phase_name[PERF_GPU_PHASES] = {"clear", "nodes",
+                                                          "title"};
+
+int perf_enabled;
+
+static struct perf_frame history[PERF_FRAMES];
+static int history_count, history_next;
+static struct perf_frame current;
+static double frame_start;
+
+/* the phases running now, innermost last */
+static struct {
+  enum perf_phase phase;
+  double start;
+  /* time spent in phases inside this one */
+  double nested;
+} stack[PERF_DEPTH];
+static int depth;
+
+/* every frame since perf_enable */
+static unsigned long histogram[HISTOGRAM_BUCKETS + 1];
+static unsigned long total_frames;
+static double total_start, total_time, total_max;
+static double total_phase[PERF_PHASES];
+static unsigned long total_count[PERF_COUNTERS];
+static unsigned long total_gpu_frames;
+static double total_gpu[PERF_GPU_PHASES];
+
+double perf_now(void) {
+#if defined(WIN32)
+  static LARGE_INTEGER frequency;
+  LARGE_INTEGER now;
+
+  if (!frequency.QuadPart) QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&now);
+  return (double)now.QuadPart / frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec / 1e9;
+#elif defined(HAVE_GETTIMEOFDAY)
+  struct timeval now;
+
+#ifdef GETTIMEOFDAY_TWO_ARGS
+  gettimeofday(&now, NULL);
+#else
+  gettimeofday(&now);
+#endif
+  return now.tv_sec + now.tv_usec / 1e6;
+#else
+  return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+void perf_enable(int on) {
+  if (on && !perf_enabled) {
+    memset(&current, 0, sizeof(current));
+    memset(histogram, 0, sizeof(histogram));
+    memset(total_phase, 0, sizeof(total_phase));
+    memset(total_count, 0, sizeof(total_count));
+    memset(total_gpu, 0, sizeof(total_gpu));
+    total_gpu_frames = 0;
+    history_count = history_next = 0;
+    total_frames = 0;
+    total_time = total_max = 0.0;
+    depth = 0;
+    frame_start = total_start = perf_now();
+#ifdef GLSNAKE_GL_COUNT
+    glcount_reset();
+#endif
+  }
+  perf_enabled = on;
+}
+
+void perf_begin(enum perf_phase phase) {
+  if (depth == PERF_DEPTH) return;
+  stack[depth].phase = phase;
+  stack[depth].nested = 0.0;
+  stack[depth].start = perf_now();
+  depth++;
+}
+
+void perf_end(enum perf_phase phase) {
+  double now = perf_now();
+
+  /* close anything left open inside this phase too */
+  while (depth > 0) {
+    double elapsed = now - stack[--depth].start;
+
+    current.phase[stack[depth].phase] +=
+        (float)((elapsed - stack[depth].nested) * 1000.0);
+    if (depth > 0) stack[depth - 1].nested += elapsed;
+    if (stack[depth].phase == phase) break;
+  }
+}
+
+void perf_count(enum perf_counter counter) {
+  if (perf_enabled && current.count[counter] < 0xffff)
+    current.count[counter]++;
+}
+
+void perf_gpu(enum perf_gpu_phase phase, double ms) {
+  if (!perf_enabled) return;
+  current.gpu[phase] += (float)ms;
+  current.gpu_timed = 1;
+}
+
+void perf_frame_end(void) {
+  double now;
+  int i, bucket;
+
+  if (!perf_enabled) return;
+  now = perf_now();
+  current.total = (float)((now - frame_start) * 1000.0);
+  frame_start = now;
+
+  history[history_next] = current;
+  history_next = (history_next + 1) % PERF_FRAMES;
+  if (history_count < PERF_FRAMES) history_count++;
+
+  bucket = (int)(current.total / HISTOGRAM_WIDTH);
+  histogram[bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS]++;
+  total_frames++;
+  total_time += current.total;
+  if (current.total > total_max) total_max = current.total;
+  for (i = 0; i < PERF_PHASES; i++) total_phase[i] += current.phase[i];
+  for (i = 0; i < PERF_COUNTERS; i++) total_count[i] += current.count[i];
+  if (current.gpu_timed) {
+    total_gpu_frames++;
+    for (i = 0; i < PERF_GPU_PHASES; i++) total_gpu[i] += current.gpu[i];
+  }
+
+  memset(&current, 0, sizeof(current));
+#ifdef GLSNAKE_GL_COUNT
+  glcount_frame_end();
+#endif
+}
+
+int perf_history(const struct perf_frame **frames, int *first) {
+  *frames = history;
+  *first = (history_next - history_count + PERF_FRAMES) % PERF_FRAMES;
+  return history_count;
+}
+
+static int compare_floats(const void *a, const void *b) {
+  float x = *(const float *)a, y = *(const float *)b;
+
+  return x < y ? -1 : x > y ? 1 : 0;
+}
+
+void perf_summarise(struct perf_summary *summary) {
+  static float sorted[PERF_FRAMES];
+  int i, k;
+
+  memset(summary, 0, sizeof(*summary));
+  summary->frames = history_count;
+  if (!history_count) return;
+
+  for (i = 0; i < history_count; i++) {
+    const struct perf_frame *f = &history[i];
+
+    sorted[i] = f->total;
+    summary->seconds += f->total / 1000.0;
+    for (k = 0; k < PERF_PHASES; k++) summary->phase[k] += f->phase[k];
+    for (k = 0; k < PERF_COUNTERS; k++) summary->rate[k] += f->count[k];
+    if (f->gpu_timed) {
+      summary->gpu_frames++;
+      for (k = 0; k < PERF_GPU_PHASES; k++) summary->gpu[k] += f->gpu[k];
+    }
+  }
+  qsort(sorted, (size_t)history_count, sizeof(float), compare_floats);
+
+  summary->mean = summary->seconds * 1000.0 / history_count;
+  summary->p50 = sorted[history_count / 2];
+  summary->p99 = sorted[history_count * 99 / 100];
+  summary->max = sorted[history_count - 1];
+  for (k = 0; k < PERF_PHASES; k++) summary->phase[k] /= history_count;
+  for (k = 0; k < PERF_COUNTERS; k++)
+    if (summary->seconds > 0.0) summary->rate[k] /= summary->seconds;
+  if (summary->gpu_frames)
+    for (k = 0; k < PERF_GPU_PHASES; k++)
+      summary->gpu[k] /= summary->gpu_frames;
+}
+
+/* the frame time below which a fraction of all frames fall, to the width
+ * of a bucket */
+static double percentile(double fraction) {
+  unsigned long seen = 0, want = (unsigned long)(fraction * total_frames);
+  int i;
+
+  for (i = 0; i < HISTOGRAM_BUCKETS; i++)
+    if ((seen += histogram[i]) > want) return (i + 1) * HISTOGRAM_WIDTH;
+  return total_max;
+}
+
+void perf_write_json(FILE *fp) {
+  double seconds = perf_now() - total_start;
+  int i;
+
+  fprintf(fp, "{\n  \"frames\": %lu,\n  \"seconds\": %.3f,\n", total_frames,
+          seconds);
+  fprintf(fp, "  \"fps\": %.2f,\n",
+          seconds > 0.0 ? total_frames / seconds : 0.0);
+  fprintf(fp,
+          "  \"frame_ms\": {\"mean\": %.3f, \"p50\": %.1f, \"p99\": %.1f, "
+          "\"max\": %.3f},\n",
+          total_frames ? total_time / total_frames : 0.0, percentile(0.5),
+          percentile(0.99), total_max);
+  fprintf(fp, "  \"phase_ms\": {");
+  for (i = 0; i < PERF_PHASES; i++)
+    fprintf(fp, "%s\"%s\": %.3f", i ? ", " : "", perf_phase_name[i],
+            total_frames ? total_phase[i] / total_frames : 0.0);
+  fprintf(fp, "},\n  \"gpu_ms\": ");
+  if (total_gpu_frames) {
+    fprintf(fp, "{");
+    for (i = 0; i < PERF_GPU_PHASES; i++)
+      fprintf(fp, "%s\"%s\": %.3f", i ? ", " : "", perf_gpu_phase_name[i],
+              total_gpu[i] / total_gpu_frames);
+    fprintf(fp, "}");
+  } else {
+    /* no timer queries */
+    fprintf(fp, "null");
+  }
+  fprintf(fp, ",\n  \"counters\": {");
+  for (i = 0; i < PERF_COUNTERS; i++)
+    fprintf(fp, "%s\"%s\": %lu", i ? ", " : "", perf_counter_name[i],
+            total_count[i]);
+  fprintf(fp, "}");
+#ifdef GLSNAKE_GL_COUNT
+  glcount_write_json(fp);
+#endif
+  fprintf(fp, "\n}\n");
+}
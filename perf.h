@@ -0,0 +1,119 @@
+/* perf.h - where each frame's time goes, for the HUD and -benchmark
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef GLSNAKE_PERF_H
+#define GLSNAKE_PERF_H
+
+#include <stdio.h>
+
+/* Phases nest, and each is charged only the time not spent in the phases
+ * inside it, so a frame's phases add up to no more than the frame. */
+enum perf_phase {
+  PERF_IDLE,
+  PERF_KINEMATICS,
+  PERF_DRAW,
+  PERF_SWAP,
+  PERF_PHASES
+};
+
+enum perf_counter {
+  PERF_LEGALITY_CHECKS,
+  PERF_MORPHS,
+  PERF_COUNTERS
+};
+
+/* Phases timed on the GPU by gputimer.c.  These can't nest. */
+enum perf_gpu_phase {
+  PERF_GPU_CLEAR,
+  PERF_GPU_NODES,
+  PERF_GPU_TITLE,
+  PERF_GPU_PHASES
+};
+
+extern const char *const perf_phase_name[PERF_PHASES];
+extern const char *const perf_counter_name[PERF_COUNTERS];
+extern const char *const perf_gpu_phase_name[PERF_GPU_PHASES];
+
+/* how many of the latest frames are kept */
+#define PERF_FRAMES 256
+
+struct perf_frame {
+  /* in milliseconds */
+  float total;
+  float phase[PERF_PHASES];
+  unsigned short count[PERF_COUNTERS];
+  float gpu[PERF_GPU_PHASES];
+  /* whether any GPU times came in during this frame */
+  unsigned char gpu_timed;
+};
+
+/* Timing costs a clock read per phase, so nothing is timed or counted
+ * unless something is looking. */
+extern int perf_enabled;
+
+#define PERF_BEGIN(p)                \
+  do {                               \
+    if (perf_enabled) perf_begin(p); \
+  } while (0)
+#define PERF_END(p)                \
+  do {                             \
+    if (perf_enabled) perf_end(p); \
+  } while (0)
+
+/* seconds, from some fixed point */
+double perf_now(void);
+
+void perf_enable(int on);
+void perf_begin(enum perf_phase phase);
+void perf_end(enum perf_phase phase);
+void perf_count(enum perf_counter counter);
+
+/* The GPU took ms over a phase.  GPU times come in a few frames late, and
+ * are charged to the frame they come in during, as only averages of them
+ * are kept. */
+void perf_gpu(enum perf_gpu_phase phase, double ms);
+
+/* The frame is on screen: start the next one. */
+void perf_frame_end(void);
+
+/* The latest frames, oldest first; returns how many there are. */
+int perf_history(const struct perf_frame **frames, int *first);
+
+struct perf_summary {
+  int frames;
+  double seconds;
+  /* frame times in milliseconds */
+  double mean, p50, p99, max;
+  double phase[PERF_PHASES];
+  /* per second */
+  double rate[PERF_COUNTERS];
+  /* averaged over the frames that had GPU times, if any did */
+  int gpu_frames;
+  double gpu[PERF_GPU_PHASES];
+};
+
+/* Sum up the latest frames, at most PERF_FRAMES of them. */
+void perf_summarise(struct perf_summary *summary);
+
+/* Write every frame since perf_enable as JSON, for -benchmark. */
+void perf_write_json(FILE *fp);
+
+#endif /* GLSNAKE_PERF_H */
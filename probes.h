@@ -0,0 +1,53 @@
+/* probes.h - static tracepoints for bpftrace, perf and SystemTap
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_PROBES_H
+#define GLSNAKE_PROBES_H
+
+/* Where <sys/sdt.h> is found, these become USDT probes in the "glsnake"
+ * provider: a nop each until a tracer attaches, so every build can be
+ * traced.  Elsewhere they are nothing at all, so arguments must not have
+ * side effects.  For example
+ *
+ *   bpftrace -e 'usdt:./glsnake:glsnake:morph__start { @[arg1] = count(); }'
+ *
+ * The probes are:
+ *   idle__tick(iter_msec)
+ *   morph__start(preset_index, morph_method, is_legal)
+ *     morph_method is -1 when jumping straight to the shape
+ *   morph__finish(preset_index)
+ *   display__frame(frame, morphing)
+ *   metrics(is_legal, is_cyclic, last_turn)
+ */
+
+#ifdef HAVE_SYS_SDT_H
+#include <sys/sdt.h>
+#define PROBE1(name, a) DTRACE_PROBE1(glsnake, name, a)
+#define PROBE2(name, a, b) DTRACE_PROBE2(glsnake, name, a, b)
+#define PROBE3(name, a, b, c) DTRACE_PROBE3(glsnake, name, a, b, c)
+#else
+#define PROBE1(name, a) ((void)0)
+#define PROBE2(name, a, b) ((void)0)
+#define PROBE3(name, a, b, c) ((void)0)
+#endif
+
+#endif /* GLSNAKE_PROBES_H */
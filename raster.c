@@ -0,0 +1,613 @@
+/* raster.c - a software renderer for the snake, for hosts without a GPU
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* The snake is transformed, lit and projected as glsnake's GL setup would,
+ * then each triangle is binned into the square tiles it touches, and the
+ * tiles are shared out between threads.  Each tile is drawn start to finish
+ * by one thread, clearing it first, so no locking is needed on the frame
+ * itself. */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "geometry.h"
+#include "raster.h"
+
+#define TILE_SIZE 64
+#define MAX_TRIANGLES (NODE_COUNT * SOLID_PRISM_TRIANGLES)
+#define MAX_THREADS 64
+
+/* Coverage and depth are worked out several pixels at a time with GCC's
+ * vector extensions where they are available, and a pixel at a time
+ * otherwise.  Comparisons give MASK_TRUE for each pixel that passes. */
+#ifdef __GNUC__
+#define LANES 4
+typedef float vfloat __attribute__((vector_size(LANES * sizeof(float))));
+typedef int vmask __attribute__((vector_size(LANES * sizeof(int))));
+#define SPLAT(f) ((vfloat){(f), (f), (f), (f)})
+#define SPLAT_MASK(i) ((vmask){(i), (i), (i), (i)})
+#define MASK_TRUE (-1)
+static const vfloat lane_centre = {0.5, 1.5, 2.5, 3.5};
+#else
+#define LANES 1
+typedef float vfloat;
+typedef int vmask;
+#define SPLAT(f) (f)
+#define SPLAT_MASK(i) (i)
+#define MASK_TRUE 1
+static const vfloat lane_centre = 0.5;
+#endif
+
+/* the lights gl_init sets up, both of which end up directional */
+static const float light_dir[2][3] = {{0.0, 10.0, 20.0}, {0.0, 20.0, -1.0}};
+#define AMBIENT 0.2
+#define SPECULAR 0.1
+#define SHININESS 20.0
+
+struct triangle {
+  /* Each edge runs from (ex, ey) by (edx, edy), always in the same direction
+   * whichever triangle it belongs to, so that triangles sharing an edge work
+   * out exactly the same edge function.  sign turns it positive inside this
+   * triangle, and pixel centres on the edge belong to the triangle for which
+   * tie is set. */
+  float ex[3], ey[3], edx[3], edy[3], sign[3];
+  int tie[3];
+  /* depth at (zx, zy), and how it changes across the screen */
+  float z, zx, zy, zdx, zdy;
+  /* 0 to 255, and alpha 0 to 1 */
+  float colour[4];
+  /* the opaque pixel, as it sits in memory */
+  int packed;
+  /* the pixels it may cover, top and right exclusive */
+  int x0, y0, x1, y1;
+};
+
+struct raster {
+  int width, height;
+  int tiles_x, tiles_y;
+  unsigned char *pixels;
+  float *depth;
+
+  unsigned char background[4];
+  int blend;
+
+  struct triangle tri[MAX_TRIANGLES];
+  int tri_count;
+
+  /* the triangles touching tile t are bin[bin_start[t]] up to
+   * bin[bin_start[t + 1]] */
+  int *bin_start;
+  int *bin;
+  int bin_size;
+  /* set for tiles that hold anything but the background */
+  unsigned char *dirty;
+
+  int threads;
+#ifdef HAVE_PTHREAD
+  pthread_t thread[MAX_THREADS];
+  pthread_mutex_t lock;
+  pthread_cond_t work, done;
+  /* bumped to set the workers going on a new frame */
+  unsigned long frame;
+  int next_tile;
+  int working;
+  int quit;
+#endif
+};
+
+static int tile_count(const struct raster *r) { return r->tiles_x * r->tiles_y; }
+
+static void draw_triangle(struct raster *r, const struct triangle *t, int x0,
+                          int y0, int x1, int y1) {
+  int x, y, k, l;
+
+  if (t->x0 > x0) x0 = t->x0;
+  if (t->y0 > y0) y0 = t->y0;
+  if (t->x1 < x1) x1 = t->x1;
+  if (t->y1 < y1) y1 = t->y1;
+
+  for (y = y0; y < y1; y++) {
+    float py = y + 0.5;
+    float row[3];
+    float zrow = t->z + t->zdy * (py - t->zy);
+
+    for (k = 0; k < 3; k++) row[k] = t->edx[k] * (py - t->ey[k]);
+
+    /* tiles start on a multiple of LANES, so each pixel is always worked
+     * out in the same lane */
+    for (x = x0 - x0 % LANES; x < x1; x += LANES) {
+      vfloat px = SPLAT((float)x) + lane_centre;
+      vmask inside = (px > SPLAT((float)x0)) & (px < SPLAT((float)x1));
+      int in[LANES], any = 0;
+      float z[LANES];
+      vfloat zv;
+
+      for (k = 0; k < 3; k++) {
+        vfloat e = SPLAT(row[k]) - SPLAT(t->edy[k]) * (px - SPLAT(t->ex[k]));
+        vfloat w = e * SPLAT(t->sign[k]);
+
+        inside &= (w > SPLAT(0.0)) | ((w == SPLAT(0.0)) & SPLAT_MASK(t->tie[k]));
+      }
+      memcpy(in, &inside, sizeof(in));
+      for (l = 0; l < LANES; l++) any |= in[l];
+      if (!any) continue;
+
+      zv = SPLAT(zrow) + SPLAT(t->zdx) * (px - SPLAT(t->zx));
+#if LANES > 1
+      /* opaque pixels that don't run off the end of the row are depth
+       * tested and written a vector at a time */
+      if (!r->blend && x + LANES <= r->width) {
+        size_t i = (size_t)y * r->width + x;
+        vfloat old;
+        vmask pass, pixel;
+
+        memcpy(&old, r->depth + i, sizeof(old));
+        pass = inside & (zv < old);
+        old = (vfloat)((pass & (vmask)zv) | (~pass & (vmask)old));
+        memcpy(r->depth + i, &old, sizeof(old));
+        memcpy(&pixel, r->pixels + 4 * i, sizeof(pixel));
+        pixel = (pass & SPLAT_MASK(t->packed)) | (~pass & pixel);
+        memcpy(r->pixels + 4 * i, &pixel, sizeof(pixel));
+        continue;
+      }
+#endif
+      memcpy(z, &zv, sizeof(z));
+      for (l = 0; l < LANES; l++) {
+        size_t i = (size_t)y * r->width + x + l;
+        unsigned char *p = r->pixels + 4 * i;
+
+        if (!in[l] || z[l] >= r->depth[i]) continue;
+        r->depth[i] = z[l];
+        if (r->blend) {
+          float a = t->colour[3];
+
+          p[0] = (unsigned char)(t->colour[0] * a + p[0] * (1.0 - a));
+          p[1] = (unsigned char)(t->colour[1] * a + p[1] * (1.0 - a));
+          p[2] = (unsigned char)(t->colour[2] * a + p[2] * (1.0 - a));
+          p[3] = (unsigned char)(255.0 * a + p[3] * (1.0 - a));
+        } else {
+          memcpy(p, &t->packed, 4);
+        }
+      }
+    }
+  }
+}
+
+static void draw_tile(struct raster *r, int tile) {
+  int x0 = (tile % r->tiles_x) * TILE_SIZE, y0 = (tile / r->tiles_x) * TILE_SIZE;
+  int x1 = x0 + TILE_SIZE, y1 = y0 + TILE_SIZE;
+  int empty = r->bin_start[tile] == r->bin_start[tile + 1];
+  int x, y, k;
+
+  /* most of a big frame is background, and needn't be touched at all */
+  if (empty && !r->dirty[tile]) return;
+
+  if (x1 > r->width) x1 = r->width;
+  if (y1 > r->height) y1 = r->height;
+
+  /* clear the first row, then copy it to the rest; nothing is depth tested
+   * in an empty tile */
+  for (x = x0; x < x1; x++) {
+    size_t i = (size_t)y0 * r->width + x;
+
+    memcpy(r->pixels + 4 * i, r->background, 4);
+    r->depth[i] = 1.0;
+  }
+  for (y = y0 + 1; y < y1; y++) {
+    size_t i = (size_t)y * r->width + x0, first = (size_t)y0 * r->width + x0;
+
+    memcpy(r->pixels + 4 * i, r->pixels + 4 * first, (size_t)(x1 - x0) * 4);
+    if (!empty)
+      memcpy(r->depth + i, r->depth + first,
+             (size_t)(x1 - x0) * sizeof(float));
+  }
+  r->dirty[tile] = !empty;
+
+  for (k = r->bin_start[tile]; k < r->bin_start[tile + 1]; k++)
+    draw_triangle(r, &r->tri[r->bin[k]], x0, y0, x1, y1);
+}
+
+#ifdef HAVE_PTHREAD
+/* Draw tiles until there are none left.  Called with the lock held. */
+static void draw_tiles(struct raster *r) {
+  r->working++;
+  while (r->next_tile < tile_count(r)) {
+    int tile = r->next_tile++;
+
+    pthread_mutex_unlock(&r->lock);
+    draw_tile(r, tile);
+    pthread_mutex_lock(&r->lock);
+  }
+  if (--r->working == 0) pthread_cond_broadcast(&r->done);
+}
+
+static void *raster_worker(void *arg) {
+  struct raster *r = arg;
+  unsigned long seen = 0;
+
+  pthread_mutex_lock(&r->lock);
+  for (;;) {
+    while (r->frame == seen && !r->quit) pthread_cond_wait(&r->work, &r->lock);
+    if (r->quit) break;
+    seen = r->frame;
+    draw_tiles(r);
+  }
+  pthread_mutex_unlock(&r->lock);
+  return NULL;
+}
+#endif
+
+struct raster *raster_new(int threads) {
+  struct raster *r = calloc(1, sizeof(struct raster));
+
+  if (!r) return NULL;
+
+#ifdef HAVE_PTHREAD
+  if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  if (threads > MAX_THREADS) threads = MAX_THREADS;
+  pthread_mutex_init(&r->lock, NULL);
+  pthread_cond_init(&r->work, NULL);
+  pthread_cond_init(&r->done, NULL);
+  /* the calling thread draws too */
+  for (r->threads = 1; r->threads < threads; r->threads++)
+    if (pthread_create(&r->thread[r->threads - 1], NULL, raster_worker, r))
+      break;
+#else
+  (void)threads;
+  r->threads = 1;
+#endif
+  return r;
+}
+
+void raster_free(struct raster *r) {
+#ifdef HAVE_PTHREAD
+  int i;
+
+  pthread_mutex_lock(&r->lock);
+  r->quit = 1;
+  pthread_cond_broadcast(&r->work);
+  pthread_mutex_unlock(&r->lock);
+  for (i = 0; i < r->threads - 1; i++) pthread_join(r->thread[i], NULL);
+  pthread_mutex_destroy(&r->lock);
+  pthread_cond_destroy(&r->work);
+  pthread_cond_destroy(&r->done);
+#endif
+  free(r->pixels);
+  free(r->depth);
+  free(r->bin_start);
+  free(r->bin);
+  free(r->dirty);
+  free(r);
+}
+
+int raster_resize(struct raster *r, int width, int height) {
+  unsigned char *pixels, *dirty;
+  float *depth;
+  int *bin_start;
+  int tiles_x = (width + TILE_SIZE - 1) / TILE_SIZE;
+  int tiles_y = (height + TILE_SIZE - 1) / TILE_SIZE;
+
+  if (width == r->width && height == r->height) return 0;
+
+  pixels = malloc((size_t)width * height * 4);
+  depth = malloc((size_t)width * height * sizeof(float));
+  bin_start = malloc((size_t)(tiles_x * tiles_y + 1) * sizeof(int));
+  dirty = malloc((size_t)tiles_x * tiles_y);
+  if (!pixels || !depth || !bin_start || !dirty) {
+    free(pixels);
+    free(depth);
+    free(bin_start);
+    free(dirty);
+    return -1;
+  }
+  free(r->pixels);
+  free(r->depth);
+  free(r->bin_start);
+  free(r->dirty);
+  r->pixels = pixels;
+  r->depth = depth;
+  r->bin_start = bin_start;
+  r->dirty = dirty;
+  r->width = width;
+  r->height = height;
+  r->tiles_x = tiles_x;
+  r->tiles_y = tiles_y;
+  memset(r->dirty, 1, (size_t)tiles_x * tiles_y);
+  return 0;
+}
+
+/* Set up the triangle with window coordinates v, or return 0 if it faces
+ * away or is off the screen. */
+static int setup_triangle(const struct raster *r, struct triangle *t,
+                          float v[3][3]) {
+  float area = (v[1][0] - v[0][0]) * (v[2][1] - v[0][1]) -
+               (v[2][0] - v[0][0]) * (v[1][1] - v[0][1]);
+  float minx, maxx, miny, maxy;
+  int k;
+
+  if (!(area > 0.0)) return 0;
+
+  minx = maxx = v[0][0];
+  miny = maxy = v[0][1];
+  for (k = 1; k < 3; k++) {
+    if (v[k][0] < minx) minx = v[k][0];
+    if (v[k][0] > maxx) maxx = v[k][0];
+    if (v[k][1] < miny) miny = v[k][1];
+    if (v[k][1] > maxy) maxy = v[k][1];
+  }
+  t->x0 = minx < 0.0 ? 0 : (int)minx;
+  t->y0 = miny < 0.0 ? 0 : (int)miny;
+  t->x1 = maxx >= r->width ? r->width : (int)maxx + 1;
+  t->y1 = maxy >= r->height ? r->height : (int)maxy + 1;
+  if (t->x0 >= t->x1 || t->y0 >= t->y1) return 0;
+
+  for (k = 0; k < 3; k++) {
+    const float *a = v[k], *b = v[(k + 1) % 3];
+
+    /* inside is to the left of a to b */
+    t->sign[k] = 1.0;
+    if (a[0] > b[0] || (a[0] == b[0] && a[1] > b[1])) {
+      const float *swap = a;
+
+      a = b;
+      b = swap;
+      t->sign[k] = -1.0;
+    }
+    t->ex[k] = a[0];
+    t->ey[k] = a[1];
+    t->edx[k] = b[0] - a[0];
+    t->edy[k] = b[1] - a[1];
+    t->tie[k] = t->sign[k] > 0.0 ? MASK_TRUE : 0;
+  }
+
+  t->z = v[0][2];
+  t->zx = v[0][0];
+  t->zy = v[0][1];
+  t->zdx = ((v[1][2] - v[0][2]) * (v[2][1] - v[0][1]) -
+            (v[2][2] - v[0][2]) * (v[1][1] - v[0][1])) / area;
+  t->zdy = ((v[2][2] - v[0][2]) * (v[1][0] - v[0][0]) -
+            (v[1][2] - v[0][2]) * (v[2][0] - v[0][0])) / area;
+  return 1;
+}
+
+/* Light a face with eye space normal n as GL would. */
+static void shade(const float n[3], const float colour[4], float out[4]) {
+  float light = AMBIENT, spec = 0.0;
+  int l, k;
+
+  for (l = 0; l < 2; l++) {
+    float len = sqrt(light_dir[l][0] * light_dir[l][0] +
+                     light_dir[l][1] * light_dir[l][1] +
+                     light_dir[l][2] * light_dir[l][2]);
+    float d = (n[0] * light_dir[l][0] + n[1] * light_dir[l][1] +
+               n[2] * light_dir[l][2]) / len;
+
+    if (d > 0.0) {
+      /* half way between the light and a viewer looking down -z */
+      float h[3], hlen, s;
+
+      h[0] = light_dir[l][0] / len;
+      h[1] = light_dir[l][1] / len;
+      h[2] = light_dir[l][2] / len + 1.0;
+      hlen = sqrt(h[0] * h[0] + h[1] * h[1] + h[2] * h[2]);
+      s = (n[0] * h[0] + n[1] * h[1] + n[2] * h[2]) / hlen;
+      light += d;
+      if (s > 0.0) spec += SPECULAR * pow(s, SHININESS);
+    }
+  }
+  for (k = 0; k < 3; k++) {
+    float c = colour[k] * light + spec;
+
+    out[k] = 255.0 * (c > 1.0 ? 1.0 : c);
+  }
+  out[3] = colour[3];
+}
+
+static void sort_nodes(const struct raster_scene *scene, int order[NODE_COUNT]) {
+  static const float centre[3] = {1.0 / 3.0, 1.0 / 3.0, 0.5};
+  const float *mv = scene->modelview;
+  float depth[NODE_COUNT];
+  int i, j;
+
+  for (i = 0; i < NODE_COUNT; i++) {
+    float p[3];
+    int node = i;
+
+    matrix_transform(scene->m[i], centre, p);
+    depth[i] = mv[2] * (p[0] - scene->com[0]) + mv[6] * (p[1] - scene->com[1]) +
+               mv[10] * (p[2] - scene->com[2]);
+    for (j = i; j > 0 && depth[order[j - 1]] > depth[node]; j--)
+      order[j] = order[j - 1];
+    order[j] = node;
+  }
+}
+
+/* Transform, light and cull the triangles of every node. */
+static void setup_scene(struct raster *r, const struct raster_scene *scene) {
+  float mvp[16];
+  int order[NODE_COUNT];
+  int i, k, f;
+
+  matrix_multiply(mvp, scene->projection, scene->modelview);
+
+  if (scene->order)
+    memcpy(order, scene->order, sizeof(order));
+  else if (scene->blend)
+    sort_nodes(scene, order);
+  else
+    for (i = 0; i < NODE_COUNT; i++) order[i] = i;
+
+  r->tri_count = 0;
+  for (i = 0; i < NODE_COUNT; i++) {
+    int node = order[i];
+    const float *m = scene->m[node];
+    float win[SOLID_PRISM_VERTICES][3];
+    int visible[SOLID_PRISM_VERTICES];
+
+    for (k = 0; k < SOLID_PRISM_VERTICES; k++) {
+      float p[3], w;
+
+      matrix_transform(m, solid_prism_v[k], p);
+      p[0] -= scene->com[0];
+      p[1] -= scene->com[1];
+      p[2] -= scene->com[2];
+      w = mvp[3] * p[0] + mvp[7] * p[1] + mvp[11] * p[2] + mvp[15];
+      /* anything behind the near plane is dropped rather than clipped; the
+       * snake never gets that close */
+      visible[k] = w > 1e-3;
+      if (!visible[k]) continue;
+      matrix_transform(mvp, p, win[k]);
+      win[k][0] = (win[k][0] / w + 1.0) * 0.5 * r->width;
+      win[k][1] = (win[k][1] / w + 1.0) * 0.5 * r->height;
+      win[k][2] = (win[k][2] / w + 1.0) * 0.5;
+    }
+
+    for (f = 0; f < SOLID_PRISM_FACES; f++) {
+      const struct prism_face *face = &solid_prism_f[f];
+      float n[3], len, colour[4];
+      unsigned char opaque[4];
+
+      matrix_rotate(n, m, solid_prism_n[face->normal]);
+      matrix_rotate(n, scene->modelview, n);
+      len = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+      n[0] /= len;
+      n[1] /= len;
+      n[2] /= len;
+      shade(n, scene->colour[node], colour);
+      for (k = 0; k < 3; k++) opaque[k] = (unsigned char)colour[k];
+      opaque[3] = 255;
+
+      for (k = 1; k < face->count - 1; k++) {
+        struct triangle *t = &r->tri[r->tri_count];
+        float v[3][3];
+
+        if (!visible[face->v[0]] || !visible[face->v[k]] ||
+            !visible[face->v[k + 1]])
+          continue;
+        memcpy(v[0], win[face->v[0]], sizeof(v[0]));
+        memcpy(v[1], win[face->v[k]], sizeof(v[1]));
+        memcpy(v[2], win[face->v[k + 1]], sizeof(v[2]));
+        if (!setup_triangle(r, t, v)) continue;
+        memcpy(t->colour, colour, sizeof(colour));
+        memcpy(&t->packed, opaque, sizeof(t->packed));
+        r->tri_count++;
+      }
+    }
+  }
+}
+
+/* Sort the triangles into tiles, keeping them in drawing order.  Returns -1
+ * if out of memory. */
+static int bin_triangles(struct raster *r) {
+  int tiles = tile_count(r), total = 0, i, tx, ty;
+
+  memset(r->bin_start, 0, (size_t)(tiles + 1) * sizeof(int));
+  for (i = 0; i < r->tri_count; i++) {
+    const struct triangle *t = &r->tri[i];
+
+    for (ty = t->y0 / TILE_SIZE; ty <= (t->y1 - 1) / TILE_SIZE; ty++)
+      for (tx = t->x0 / TILE_SIZE; tx <= (t->x1 - 1) / TILE_SIZE; tx++)
+        r->bin_start[ty * r->tiles_x + tx + 1]++;
+  }
+  for (i = 0; i < tiles; i++) {
+    total += r->bin_start[i + 1];
+    r->bin_start[i + 1] = total;
+  }
+
+  if (total > r->bin_size) {
+    int *bin = realloc(r->bin, (size_t)total * sizeof(int));
+
+    if (!bin) return -1;
+    r->bin = bin;
+    r->bin_size = total;
+  }
+
+  /* fill each bin, using bin_start as the fill pointer, then put it back */
+  for (i = 0; i < r->tri_count; i++) {
+    const struct triangle *t = &r->tri[i];
+
+    for (ty = t->y0 / TILE_SIZE; ty <= (t->y1 - 1) / TILE_SIZE; ty++)
+      for (tx = t->x0 / TILE_SIZE; tx <= (t->x1 - 1) / TILE_SIZE; tx++)
+        r->bin[r->bin_start[ty * r->tiles_x + tx]++] = i;
+  }
+  for (i = tiles; i > 0; i--) r->bin_start[i] = r->bin_start[i - 1];
+  r->bin_start[0] = 0;
+  return 0;
+}
+
+void raster_draw(struct raster *r, const struct raster_scene *scene) {
+  int k;
+
+  if (!r->width || !r->height) return;
+
+  for (k = 0; k < 4; k++) {
+    float c = scene->background[k];
+    unsigned char b = (unsigned char)(255.0 * (c < 0.0 ? 0.0 : c > 1.0 ? 1.0 : c));
+
+    /* a new background has to be drawn everywhere */
+    if (b != r->background[k]) memset(r->dirty, 1, (size_t)tile_count(r));
+    r->background[k] = b;
+  }
+  r->blend = scene->blend;
+
+  setup_scene(r, scene);
+  if (bin_triangles(r)) {
+    /* out of memory: draw an empty frame rather than nothing at all */
+    r->tri_count = 0;
+    bin_triangles(r);
+  }
+
+#ifdef HAVE_PTHREAD
+  pthread_mutex_lock(&r->lock);
+  r->frame++;
+  r->next_tile = 0;
+  pthread_cond_broadcast(&r->work);
+  draw_tiles(r);
+  while (r->working) pthread_cond_wait(&r->done, &r->lock);
+  pthread_mutex_unlock(&r->lock);
+#else
+  for (k = 0; k < tile_count(r); k++) draw_tile(r, k);
+#endif
+}
+
+const unsigned char *raster_pixels(const struct raster *r) { return r->pixels; }
+
+int raster_write_ppm(const struct raster *r, FILE *fp) {
+  unsigned char *row = malloc((size_t)r->width * 3);
+  int x, y;
+
+  if (!row) return -1;
+  fprintf(fp, "P6\n%d %d\n255\n", r->width, r->height);
+  for (y = r->height - 1; y >= 0; y--) {
+    const unsigned char *p = r->pixels + (size_t)y * r->width * 4;
+
+    for (x = 0; x < r->width; x++, p += 4) memcpy(row + 3 * x, p, 3);
+    fwrite(row, 3, (size_t)r->width, fp);
+  }
+  free(row);
+  return ferror(fp) ? -1 : 0;
+}
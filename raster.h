@@ -0,0 +1,64 @@
+/* raster.h - a software renderer for the snake, for hosts without a GPU
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef GLSNAKE_RASTER_H
+#define GLSNAKE_RASTER_H
+
+#include <stdio.h>
+
+#include "shape.h"
+
+/* what to draw, lit and projected as glsnake's GL setup would */
+struct raster_scene {
+  /* where each node goes, from node_transforms */
+  float (*m)[16];
+  /* the centre of mass, which is moved to the origin */
+  float com[3];
+  /* the colour of each node */
+  const float (*colour)[4];
+  /* the order to draw the nodes in, or NULL to sort them farthest first */
+  const int *order;
+  float modelview[16];
+  float projection[16];
+  /* blend the nodes by their alpha, as glsnake's transparency does */
+  int blend;
+  float background[4];
+};
+
+struct raster;
+
+/* threads is how many threads to draw with, or 0 for one per processor.
+ * Returns NULL if out of memory. */
+struct raster *raster_new(int threads);
+void raster_free(struct raster *r);
+
+/* Size the frame; returns -1 if out of memory. */
+int raster_resize(struct raster *r, int width, int height);
+
+void raster_draw(struct raster *r, const struct raster_scene *scene);
+
+/* The frame as RGBA bytes, bottom row first, as glDrawPixels takes them. */
+const unsigned char *raster_pixels(const struct raster *r);
+
+/* Write the frame as a binary PPM; returns -1 on error. */
+int raster_write_ppm(const struct raster *r, FILE *fp);
+
+#endif /* GLSNAKE_RASTER_H */
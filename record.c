@@ -0,0 +1,150 @@
+/* record.c - recording a session's input and clock, and playing it back
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* Each event is its type's byte followed by its arguments as variable
+ * length integers, seven bits to a byte, signed ones zigzagged so that
+ * small negative numbers stay small.  Clock readings store the seconds as
+ * a difference from the last reading, so a typical tick takes four bytes. */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "record.h"
+
+#define RECORD_MAGIC "glsnake-record 1\n"
+
+static FILE *record_fp, *replay_fp;
+static long record_secs, replay_secs;
+
+/* how many arguments each type has */
+static int record_args(int type) {
+  switch (type) {
+    case RECORD_IDLE:
+      return 0;
+    case RECORD_CLOCK:
+    case RECORD_MOTION:
+    case RECORD_RESHAPE:
+      return 2;
+    case RECORD_KEY:
+    case RECORD_SPECIAL:
+      return 3;
+    case RECORD_MOUSE:
+      return 4;
+    default:
+      return -1;
+  }
+}
+
+static void put_unsigned(FILE *fp, unsigned long n) {
+  while (n >= 0x80) {
+    putc((int)(n & 0x7f) | 0x80, fp);
+    n >>= 7;
+  }
+  putc((int)n, fp);
+}
+
+static void put_signed(FILE *fp, long n) {
+  put_unsigned(fp, n < 0 ? ((unsigned long)~n << 1) | 1
+                         : (unsigned long)n << 1);
+}
+
+/* returns -1 at the end of the file */
+static int get_unsigned(FILE *fp, unsigned long *n) {
+  int c, shift = 0;
+
+  *n = 0;
+  do {
+    if ((c = getc(fp)) == EOF || shift >= (int)sizeof(*n) * 8) return -1;
+    *n |= (unsigned long)(c & 0x7f) << shift;
+    shift += 7;
+  } while (c & 0x80);
+  return 0;
+}
+
+static int get_signed(FILE *fp, long *n) {
+  unsigned long u;
+
+  if (get_unsigned(fp, &u)) return -1;
+  *n = u & 1 ? (long)~(u >> 1) : (long)(u >> 1);
+  return 0;
+}
+
+int record_create(const char *path, unsigned long seed) {
+  if (!(record_fp = fopen(path, "wb"))) return -1;
+  fputs(RECORD_MAGIC, record_fp);
+  put_unsigned(record_fp, seed);
+  record_secs = 0;
+  return 0;
+}
+
+void record_put(const struct record_event *event) {
+  int i, n = record_args(event->type);
+
+  if (!record_fp || n < 0) return;
+  putc(event->type, record_fp);
+  for (i = 0; i < n; i++) {
+    long arg = event->arg[i];
+
+    if (event->type == RECORD_CLOCK && i == 0) {
+      arg -= record_secs;
+      record_secs = event->arg[0];
+    }
+    put_signed(record_fp, arg);
+  }
+}
+
+void record_close(void) {
+  if (record_fp) fclose(record_fp);
+  record_fp = NULL;
+}
+
+int replay_open(const char *path, unsigned long *seed) {
+  char magic[sizeof(RECORD_MAGIC)];
+
+  if (!(replay_fp = fopen(path, "rb"))) return -1;
+  if (!fgets(magic, sizeof(magic), replay_fp) ||
+      strcmp(magic, RECORD_MAGIC) || get_unsigned(replay_fp, seed)) {
+    replay_close();
+    return -2;
+  }
+  replay_secs = 0;
+  return 0;
+}
+
+int replay_get(struct record_event *event) {
+  int i, n, type;
+
+  if (!replay_fp || (type = getc(replay_fp)) == EOF) return 0;
+  if ((n = record_args(type)) < 0) return -1;
+  event->type = (enum record_type)type;
+  for (i = 0; i < n; i++) {
+    if (get_signed(replay_fp, &event->arg[i])) return -1;
+    if (type == RECORD_CLOCK && i == 0)
+      event->arg[0] = replay_secs += event->arg[0];
+  }
+  return 1;
+}
+
+void replay_close(void) {
+  if (replay_fp) fclose(replay_fp);
+  replay_fp = NULL;
+}
@@ -0,0 +1,68 @@
+/* record.h - recording a session's input and clock, and playing it back
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_RECORD_H
+#define GLSNAKE_RECORD_H
+
+/* A recording is everything glsnake takes from outside: the random seed,
+ * every clock reading and every input event, in the order they happened.
+ * Played back in the same order, they reproduce the session exactly, at
+ * whatever speed it can be drawn. */
+
+enum record_type {
+  /* the start of each idle tick, before which the input since the last
+   * one is played back */
+  RECORD_IDLE = 'I',
+  /* seconds, milliseconds */
+  RECORD_CLOCK = 'C',
+  /* key, x, y */
+  RECORD_KEY = 'K',
+  RECORD_SPECIAL = 'S',
+  /* button, state, x, y */
+  RECORD_MOUSE = 'M',
+  /* x, y */
+  RECORD_MOTION = 'V',
+  /* width, height */
+  RECORD_RESHAPE = 'R'
+};
+
+#define RECORD_ARGS 4
+
+struct record_event {
+  enum record_type type;
+  long arg[RECORD_ARGS];
+};
+
+/* Start recording to path; returns -1 with errno set on failure. */
+int record_create(const char *path, unsigned long seed);
+void record_put(const struct record_event *event);
+void record_close(void);
+
+/* Open a recording to play back; returns -1 with errno set if it can't be
+ * read, or -2 if it isn't a recording. */
+int replay_open(const char *path, unsigned long *seed);
+/* Returns 1 with the next event, 0 at the end of the recording, or -1 if
+ * the recording is corrupt. */
+int replay_get(struct record_event *event);
+void replay_close(void);
+
+#endif /* GLSNAKE_RECORD_H */
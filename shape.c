@@ -0,0 +1,353 @@
+/* shape.c - snake shapes, their metrics, and the text and binary forms
+ * they are stored in
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include <ctype.h>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "shape.h"
+
+#define X_MASK 1
+#define Y_MASK 2
+#define Z_MASK 4
+
+#define GETSCALAR(vec, mask) ((vec) == (mask) ? 1 : ((vec) == -(mask) ? -1 : 0))
+
+/* Returns the new dst_dir for the given src_dir and dst_dir */
+static int cross_product(int src_dir, int dst_dir) {
+  return X_MASK * (GETSCALAR(src_dir, Y_MASK) * GETSCALAR(dst_dir, Z_MASK) -
+                   GETSCALAR(src_dir, Z_MASK) * GETSCALAR(dst_dir, Y_MASK)) +
+         Y_MASK * (GETSCALAR(src_dir, Z_MASK) * GETSCALAR(dst_dir, X_MASK) -
+                   GETSCALAR(src_dir, X_MASK) * GETSCALAR(dst_dir, Z_MASK)) +
+         Z_MASK * (GETSCALAR(src_dir, X_MASK) * GETSCALAR(dst_dir, Y_MASK) -
+                   GETSCALAR(src_dir, Y_MASK) * GETSCALAR(dst_dir, X_MASK));
+}
+
+/* Take step i of the walk: move into the next cell along and leave it in
+ * the direction angle turns to, putting the node in the cell if it fits. */
+static void walk_step(struct snake_walk *walk, int i, float angle) {
+  int prevSrcDir = -Y_MASK, prevDstDir = Z_MASK;
+  int srcDir, dstDir, x = 12, y = 12, z = 12;
+  signed char *cell;
+
+  if (i > 0) {
+    x = walk->step[i - 1].x;
+    y = walk->step[i - 1].y;
+    z = walk->step[i - 1].z;
+    prevSrcDir = walk->step[i - 1].src;
+    prevDstDir = walk->step[i - 1].dst;
+  }
+
+  /* establish new state vars */
+  srcDir = -prevDstDir;
+  x += GETSCALAR(prevDstDir, X_MASK);
+  y += GETSCALAR(prevDstDir, Y_MASK);
+  z += GETSCALAR(prevDstDir, Z_MASK);
+
+  switch ((int)angle) {
+    case (int)(ZERO):
+      dstDir = -prevSrcDir;
+      break;
+    case (int)(PIN):
+      dstDir = prevSrcDir;
+      break;
+    case (int)(RIGHT):
+    case (int)(LEFT):
+      dstDir = cross_product(prevSrcDir, prevDstDir);
+      if (fabs(angle - RIGHT) < FLT_EPSILON) dstDir = -dstDir;
+      break;
+    default:
+      /* Prevent spurious "might be used
+       * uninitialised" warnings when compiling
+       * with -O2 */
+      dstDir = 0;
+      break;
+  }
+
+  walk->step[i].x = (signed char)x;
+  walk->step[i].y = (signed char)y;
+  walk->step[i].z = (signed char)z;
+  walk->step[i].src = (signed char)srcDir;
+  walk->step[i].dst = (signed char)dstDir;
+  walk->step[i].clash = 0;
+  cell = &walk->lattice[x][y][z];
+  if (*cell == 0)
+    *cell = (signed char)(srcDir + dstDir);
+  else if (*cell + srcDir + dstDir == 0)
+    *cell = 8;
+  else {
+    walk->step[i].clash = 1;
+    walk->clashes++;
+  }
+}
+
+/* Take the node of step i back out of its cell. */
+static void walk_unstep(struct snake_walk *walk, int i) {
+  signed char *cell;
+
+  if (walk->step[i].clash) {
+    walk->clashes--;
+    return;
+  }
+  cell = &walk->lattice[walk->step[i].x][walk->step[i].y][walk->step[i].z];
+  /* a full cell holds the node that fits against this one */
+  *cell = *cell == 8 ? (signed char)-(walk->step[i].src + walk->step[i].dst)
+                     : 0;
+}
+
+static void walk_metrics(const struct snake_walk *walk,
+                         struct snake_metrics *metrics) {
+  int last = NODE_COUNT - 2, srcDir = walk->step[last].src;
+
+  metrics->is_legal = !walk->clashes;
+
+  /* determine if the snake is cyclic */
+  metrics->is_cyclic = (walk->step[last].dst == Y_MASK &&
+                        walk->step[last].x == 12 && walk->step[last].y == 11 &&
+                        walk->step[last].z == 12);
+
+  /* determine last_turn */
+  metrics->last_turn = -1;
+  if (metrics->is_cyclic) switch (srcDir) {
+      case -Z_MASK:
+        metrics->last_turn = ZERO;
+        break;
+      case Z_MASK:
+        metrics->last_turn = PIN;
+        break;
+      case X_MASK:
+        metrics->last_turn = LEFT;
+        break;
+      case -X_MASK:
+        metrics->last_turn = RIGHT;
+        break;
+    }
+}
+
+void snake_walk_start(struct snake_walk *walk,
+                      const struct glsnake_shape *shape,
+                      struct snake_metrics *metrics) {
+  int i;
+
+  memset(walk->lattice, 0, sizeof(walk->lattice));
+  memcpy(&walk->shape, shape, sizeof(walk->shape));
+  walk->clashes = 0;
+  /* trace path of snake - and keep record for is_legal */
+  for (i = 0; i < NODE_COUNT - 1; i++) walk_step(walk, i, shape->node[i]);
+  walk_metrics(walk, metrics);
+}
+
+void snake_walk_twist(struct snake_walk *walk, int joint, float angle,
+                      struct snake_metrics *metrics) {
+  int i;
+
+  /* the nodes before the joint stay where they are */
+  for (i = NODE_COUNT - 2; i >= joint; i--) walk_unstep(walk, i);
+  walk->shape.node[joint] = angle;
+  for (i = joint; i < NODE_COUNT - 1; i++)
+    walk_step(walk, i, walk->shape.node[i]);
+  walk_metrics(walk, metrics);
+}
+
+/* calculate orthogonal snake metrics.  This only touches its arguments, so
+ * it is safe to call from any thread. */
+void calc_snake_metrics_shape(const struct glsnake_shape *shape,
+                              struct snake_metrics *metrics) {
+  struct snake_walk walk;
+
+  snake_walk_start(&walk, shape, metrics);
+}
+
+/* Returns the number of quarter turns in angle, or -1 if it isn't a
+ * multiple of 90 degrees. */
+static int quarter_turns(float angle) {
+  int q = (int)(angle / 90.0 + 0.5);
+
+  if (q < 0 || q > 3 || fabs(angle - q * 90.0) > FLT_EPSILON * 360.0)
+    return -1;
+  return q;
+}
+
+/* Thomas Wolter's notation numbers every other prism from 1 to 12, and
+ * describes a twist by the prism, which of its faces (R or L) the joint is
+ * on, and the number of quarter turns.  The direction of a turn depends on
+ * which face it is read from.  This is the mapping from Andrew's
+ * format_convert.py, from Peter's VBScript before that. */
+static const float dirs_right[4] = {ZERO, RIGHT, PIN, LEFT};
+static const float dirs_left[4] = {ZERO, LEFT, PIN, RIGHT};
+
+static int parse_wolter(const char *p, struct glsnake_shape *shape) {
+  int i;
+
+  for (i = 0; i < NODE_COUNT; i++) shape->node[i] = ZERO;
+
+  for (;;) {
+    int node = 0, index, dir;
+    char side;
+
+    p += strspn(p, " \t\r-");
+    if (!*p) return 0;
+
+    if (!isdigit((unsigned char)*p)) return -1;
+    while (isdigit((unsigned char)*p)) {
+      node = node * 10 + (*p++ - '0');
+      if (node > NODE_COUNT) return -1;
+    }
+    side = (char)toupper((unsigned char)*p);
+    if (side != 'R' && side != 'L') return -1;
+    p++;
+    if (*p < '0' || *p > '3') return -1;
+    dir = *p++ - '0';
+    if (*p && !strchr(" \t\r-", *p)) return -1;
+
+    index = (side == 'R') ? node * 2 - 2 : node * 2 - 3;
+    /* format_convert.py would quietly wrap 1L round to the last joint */
+    if (index < 0 || index >= NODE_COUNT - 1) return -1;
+    shape->node[index] = (side == 'R') ? dirs_right[dir] : dirs_left[dir];
+  }
+}
+
+int parse_shape(const char *line, char *name, size_t name_len,
+                struct glsnake_shape *shape) {
+  const char *colon = strchr(line, ':');
+  int i = 0;
+
+  if (colon) {
+    size_t len = (size_t)(colon - line);
+
+    if (len >= name_len) len = name_len - 1;
+    memcpy(name, line, len);
+    name[len] = '\0';
+    line = colon + 1;
+  } else
+    name[0] = '\0';
+
+  line += strspn(line, " \t");
+  /* a name with no twists at all is the straight snake */
+  if (isdigit((unsigned char)*line) || (colon && !line[strspn(line, "\r\n")]))
+    return parse_wolter(line, shape);
+
+  for (; *line; line++) {
+    float angle;
+
+    switch (toupper((unsigned char)*line)) {
+      case 'Z':
+        angle = ZERO;
+        break;
+      case 'L':
+        angle = LEFT;
+        break;
+      case 'P':
+        angle = PIN;
+        break;
+      case 'R':
+        angle = RIGHT;
+        break;
+      case ' ':
+      case '\t':
+      case ',':
+      case '\r':
+      case '\n':
+        continue;
+      default:
+        return -1;
+    }
+    if (i == NODE_COUNT) return -1;
+    shape->node[i++] = angle;
+  }
+  if (i == 0) return -1;
+  while (i < NODE_COUNT) shape->node[i++] = ZERO;
+  return 0;
+}
+
+int format_shape(const struct glsnake_shape *shape, char *buf, size_t len) {
+  static const char turn[] = "ZLPR";
+  int i;
+
+  if (len < 2 * (NODE_COUNT - 1)) return -1;
+  for (i = 0; i < NODE_COUNT - 1; i++) {
+    int q = quarter_turns(shape->node[i]);
+
+    if (q < 0) return -1;
+    buf[2 * i] = turn[q];
+    buf[2 * i + 1] = ' ';
+  }
+  buf[2 * i - 1] = '\0';
+  return 0;
+}
+
+int format_wolter(const struct glsnake_shape *shape, char *buf, size_t len) {
+  size_t used = 0;
+  int i;
+
+  buf[0] = '\0';
+  for (i = 0; i < NODE_COUNT - 1; i++) {
+    int q = quarter_turns(shape->node[i]), dir, n;
+
+    if (q < 0) return -1;
+    if (q == 0) continue;
+    /* invert dirs_right or dirs_left */
+    for (dir = 1; dir < 4; dir++)
+      if ((i % 2 ? dirs_left : dirs_right)[dir] == (float)(q * 90)) break;
+    n = snprintf(buf + used, len - used, "%s%d%c%d", used ? "-" : "",
+                 i % 2 ? (i + 3) / 2 : (i + 2) / 2, i % 2 ? 'L' : 'R', dir);
+    if (n < 0 || (size_t)n >= len - used) return -1;
+    used += (size_t)n;
+  }
+  return 0;
+}
+
+int pack_shape(const struct glsnake_shape *shape, uint64_t *packed) {
+  int i;
+
+  *packed = 0;
+  for (i = 0; i < NODE_COUNT; i++) {
+    int q = quarter_turns(shape->node[i]);
+
+    if (q < 0) return -1;
+    *packed |= (uint64_t)q << (2 * i);
+  }
+  return 0;
+}
+
+void unpack_shape(uint64_t packed, struct glsnake_shape *shape) {
+  int i;
+
+  for (i = 0; i < NODE_COUNT; i++)
+    shape->node[i] = (float)(((packed >> (2 * i)) & 3) * 90);
+}
+
+uint64_t packed_from_bytes(const unsigned char bytes[8]) {
+  uint64_t packed = 0;
+  int i;
+
+  for (i = 7; i >= 0; i--) packed = (packed << 8) | bytes[i];
+  return packed;
+}
+
+void packed_to_bytes(uint64_t packed, unsigned char bytes[8]) {
+  int i;
+
+  for (i = 0; i < 8; i++) bytes[i] = (unsigned char)(packed >> (8 * i));
+}
@@ -0,0 +1,114 @@
+/* shape.h - snake shapes, their metrics, and the text and binary forms
+ * they are stored in
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef GLSNAKE_SHAPE_H
+#define GLSNAKE_SHAPE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* angles */
+#define ZERO 0.0
+#define LEFT 90.0
+#define PIN 180.0
+#define RIGHT 270.0
+
+#define NODE_COUNT 24
+
+/* longest name we keep for a model */
+#define MODEL_NAME_LENGTH 64
+
+struct glsnake_shape {
+  float node[NODE_COUNT];
+};
+
+struct model_s {
+  const char *name;
+  struct glsnake_shape shape;
+};
+
+/* calculated by calc_snake_metrics_shape
+ *  is_legal  = true if model does not pass through itself
+ *  is_cyclic = true if last node connects back to first node
+ *  last_turn = for cyclic snakes, specifes what the 24th turn would be
+ */
+struct snake_metrics {
+  int is_legal;
+  int is_cyclic;
+  float last_turn;
+};
+
+void calc_snake_metrics_shape(const struct glsnake_shape *shape,
+                              struct snake_metrics *metrics);
+
+/* The walk calc_snake_metrics_shape takes through a lattice of cells, each
+ * of which holds two nodes, kept so that twisting one joint only walks the
+ * nodes after it again and checks them against those before. */
+#define SNAKE_LATTICE 25
+
+struct snake_walk {
+  struct glsnake_shape shape;
+  /* 0 if empty, the sum of the directions its node enters and leaves by if
+   * it holds one, or 8 if it is full */
+  signed char lattice[SNAKE_LATTICE][SNAKE_LATTICE][SNAKE_LATTICE];
+  struct {
+    /* the cell each node after the first is in */
+    signed char x, y, z;
+    /* the directions it enters and leaves by */
+    signed char src, dst;
+    /* set if its cell was taken, so it wasn't put there */
+    signed char clash;
+  } step[NODE_COUNT - 1];
+  int clashes;
+};
+
+void snake_walk_start(struct snake_walk *walk,
+                      const struct glsnake_shape *shape,
+                      struct snake_metrics *metrics);
+/* Set one joint of the walk's shape to angle, and work out the metrics of
+ * the result. */
+void snake_walk_twist(struct snake_walk *walk, int joint, float angle,
+                      struct snake_metrics *metrics);
+
+/* Parse a model line: an optional "name:" followed by either up to
+ * NODE_COUNT of Z, L, P or R (the format printed by the 'd' key), or twists
+ * in Thomas Wolter's "node side direction" notation, e.g. 4R1-5L3.  Missing
+ * joints are straight, and name is left empty if there is no "name:".
+ * Returns 0 on success, -1 if the line is not a shape. */
+int parse_shape(const char *line, char *name, size_t name_len,
+                struct glsnake_shape *shape);
+
+/* Write the NODE_COUNT - 1 joints of shape as Z, L, P and R, or in Wolter
+ * notation.  Both return -1 if a joint is not a quarter turn or buf is too
+ * small. */
+int format_shape(const struct glsnake_shape *shape, char *buf, size_t len);
+int format_wolter(const struct glsnake_shape *shape, char *buf, size_t len);
+
+/* Shapes pack into 64 bits, two per joint counting quarter turns: 0 ZERO,
+ * 1 LEFT, 2 PIN, 3 RIGHT, starting from the least significant bits.  Stored
+ * on disk or in a stream they are little-endian. */
+int pack_shape(const struct glsnake_shape *shape, uint64_t *packed);
+void unpack_shape(uint64_t packed, struct glsnake_shape *shape);
+uint64_t packed_from_bytes(const unsigned char bytes[8]);
+void packed_to_bytes(uint64_t packed, unsigned char bytes[8]);
+
+#endif /* GLSNAKE_SHAPE_H */
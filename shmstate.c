@@ -0,0 +1,178 @@
+/* shmstate.c - the live snake, published in shared memory for other programs
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* The sequence lock follows Boehm's "Can seqlocks get along with
+ * programming language memory models?": the writer makes the count odd,
+ * fences, writes, and makes it even again with a release store; a reader
+ * loads it with acquire, reads, fences with acquire and checks it again. */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "shmstate.h"
+
+/* how many times shm_state_read tries before giving up on the writer */
+#define SHM_STATE_TRIES 100000
+
+static struct shm_state_segment *segment;
+
+/* Map the object open on fd, the right size for a segment; returns NULL
+ * with errno set on failure.  fd is closed either way. */
+static void *map_segment(int fd, int prot) {
+  void *map = mmap(NULL, sizeof(*segment), prot, MAP_SHARED, fd, 0);
+  int err = errno;
+
+  close(fd);
+  errno = err;
+  return map == MAP_FAILED ? NULL : map;
+}
+
+int shm_state_open(const char *name) {
+  struct stat st;
+  int fd, err;
+
+  if ((fd = shm_open(name, O_RDWR | O_CREAT, 0644)) < 0) return -1;
+  if (fstat(fd, &st) || ((size_t)st.st_size != sizeof(*segment) &&
+                         ftruncate(fd, (off_t)sizeof(*segment)))) {
+    err = errno;
+    close(fd);
+    errno = err;
+    return -1;
+  }
+  if (!(segment = map_segment(fd, PROT_READ | PROT_WRITE))) return -1;
+
+  if (memcmp(segment->magic, SHM_STATE_MAGIC, sizeof(SHM_STATE_MAGIC)) ||
+      segment->size != sizeof(*segment)) {
+    memset(segment, 0, sizeof(*segment));
+    memcpy(segment->magic, SHM_STATE_MAGIC, sizeof(SHM_STATE_MAGIC));
+    segment->size = sizeof(*segment);
+  } else if (segment->writer && segment->writer != (uint32_t)getpid() &&
+             !kill((pid_t)segment->writer, 0)) {
+    /* two writers would tear each other's frames */
+    munmap(segment, sizeof(*segment));
+    segment = NULL;
+    errno = EBUSY;
+    return -1;
+  }
+  /* a writer that died part way through a frame left the count odd */
+  if (segment->sequence & 1)
+    __atomic_store_n(&segment->sequence, segment->sequence + 1,
+                     __ATOMIC_RELEASE);
+  segment->writer = (uint32_t)getpid();
+  return 0;
+}
+
+void shm_state_close(void) {
+  if (!segment) return;
+  segment->writer = 0;
+  munmap(segment, sizeof(*segment));
+  segment = NULL;
+}
+
+struct glsnake_state *shm_state_begin(void) {
+  __atomic_store_n(&segment->sequence, segment->sequence + 1,
+                   __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  return &segment->state;
+}
+
+void shm_state_end(void) {
+  __atomic_store_n(&segment->sequence, segment->sequence + 1,
+                   __ATOMIC_RELEASE);
+}
+
+int shm_state_attach(struct shm_state_reader *reader, const char *name) {
+  struct stat st;
+  int fd;
+
+  memset(reader, 0, sizeof(*reader));
+  if ((fd = shm_open(name, O_RDONLY, 0)) < 0) return -1;
+  if (fstat(fd, &st)) {
+    int err = errno;
+
+    close(fd);
+    errno = err;
+    return -1;
+  }
+  if ((size_t)st.st_size < sizeof(*reader->segment)) {
+    close(fd);
+    return -2;
+  }
+  if (!(reader->segment = map_segment(fd, PROT_READ))) return -1;
+  if (memcmp(reader->segment->magic, SHM_STATE_MAGIC,
+             sizeof(SHM_STATE_MAGIC)) ||
+      reader->segment->size != sizeof(*reader->segment)) {
+    shm_state_detach(reader);
+    return -2;
+  }
+  reader->state = &reader->segment->state;
+  return 0;
+}
+
+void shm_state_detach(struct shm_state_reader *reader) {
+  if (reader->segment) {
+    /* munmap takes the mapping as it was given */
+    union {
+      const struct shm_state_segment *c;
+      void *v;
+    } map;
+
+    map.c = reader->segment;
+    munmap(map.v, sizeof(*reader->segment));
+  }
+  reader->segment = NULL;
+  reader->state = NULL;
+}
+
+unsigned shm_state_read_begin(const struct shm_state_reader *reader) {
+  return __atomic_load_n(&reader->segment->sequence, __ATOMIC_ACQUIRE);
+}
+
+int shm_state_read_retry(const struct shm_state_reader *reader,
+                         unsigned seq) {
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  return (seq & 1) ||
+         __atomic_load_n(&reader->segment->sequence, __ATOMIC_RELAXED) != seq;
+}
+
+int shm_state_read(const struct shm_state_reader *reader,
+                   struct glsnake_state *state) {
+  int tries;
+
+  for (tries = 0; tries < SHM_STATE_TRIES; tries++) {
+    unsigned seq = shm_state_read_begin(reader);
+
+    if (!(seq & 1)) {
+      memcpy(state, reader->state, sizeof(*state));
+      if (!shm_state_read_retry(reader, seq)) return 0;
+    }
+    /* let the writer finish, if it is waiting for this processor */
+    sched_yield();
+  }
+  return -1;
+}
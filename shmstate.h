@@ -0,0 +1,115 @@
+/* shmstate.h - the live snake, published in shared memory for other programs
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_SHMSTATE_H
+#define GLSNAKE_SHMSTATE_H
+
+#include <stdint.h>
+
+#include "shape.h"
+
+/* With -shm, glsnake writes the snake it has just drawn into a POSIX
+ * shared memory object every frame, and any number of other programs can
+ * map it and read it as it changes, without a system call or a copy.  It
+ * is guarded by a sequence lock: the count is odd while glsnake writes,
+ * and a reader that saw it change has to read again.  Everything is in the
+ * writer's byte order. */
+
+#define SHM_STATE_MAGIC "glsnake-state1"
+#define SHM_STATE_NAME_LENGTH 64
+
+struct glsnake_state {
+  uint64_t frame;
+  /* when the frame was drawn, in seconds on glsnake's monotonic clock */
+  double seconds;
+  /* each joint as drawn, part way through a morph too, and as it will be
+   * when the morph is done */
+  float joint[NODE_COUNT];
+  float target[NODE_COUNT];
+  /* as node_transforms and snake_centre work them out for joint */
+  float m[NODE_COUNT + 1][16];
+  float com[3];
+  float yspin, zspin, explode;
+  /* each node's colour as drawn */
+  float colour[NODE_COUNT][4];
+  /* as calc_snake_metrics_shape gives them for target */
+  int32_t is_legal, is_cyclic;
+  float last_turn;
+  /* the model being morphed to, or -1 if it isn't one */
+  int32_t preset_index;
+  int32_t morphing, paused;
+  /* the joint selected in interactive mode, or -1 */
+  int32_t selected;
+  char name[SHM_STATE_NAME_LENGTH];
+};
+
+struct shm_state_segment {
+  char magic[16];
+  /* sizeof(struct shm_state_segment), so that readers built against a
+   * different layout can tell */
+  uint32_t size;
+  /* glsnake's process id while it is writing, or 0 once it has quit */
+  uint32_t writer;
+  uint32_t sequence;
+  uint32_t reserved;
+  struct glsnake_state state;
+};
+
+/* For glsnake: create or take over the shared memory object name, which
+ * starts with a slash.  It is left in place when glsnake quits, so readers
+ * can stay mapped across restarts.  Returns -1 with errno set on failure. */
+int shm_state_open(const char *name);
+void shm_state_close(void);
+/* Write a frame into the state returned by begin, then call end. */
+struct glsnake_state *shm_state_begin(void);
+void shm_state_end(void);
+
+struct shm_state_reader {
+  const struct shm_state_segment *segment;
+  /* fields can be read straight from here between read_begin and a
+   * read_retry that returns 0 */
+  const struct glsnake_state *state;
+};
+
+/* Map name read only.  Returns -1 with errno set if it can't be opened, or
+ * -2 if it isn't glsnake's state or is a different layout. */
+int shm_state_attach(struct shm_state_reader *reader, const char *name);
+void shm_state_detach(struct shm_state_reader *reader);
+
+/* Read without copying:
+ *
+ *   do {
+ *     seq = shm_state_read_begin(reader);
+ *     ... read reader->state ...
+ *   } while (shm_state_read_retry(reader, seq));
+ *
+ * Nothing read can be trusted, even to be in range, until retry has said
+ * it was all from the same frame. */
+unsigned shm_state_read_begin(const struct shm_state_reader *reader);
+int shm_state_read_retry(const struct shm_state_reader *reader, unsigned seq);
+
+/* Copy a whole frame.  Returns -1 if glsnake seems to have died part way
+ * through writing one, so that none could be had. */
+int shm_state_read(const struct shm_state_reader *reader,
+                   struct glsnake_state *state);
+
+#endif /* GLSNAKE_SHMSTATE_H */
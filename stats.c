@@ -0,0 +1,174 @@
+/* stats.c - counters in a file, for monitoring many glsnakes at once
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "stats.h"
+
+/* Only glsnake writes, so a relaxed load and store is enough to add, and
+ * costs no more than a plain one. */
+#define STATS_SET(field, v) \
+  __atomic_store_n(&stats->field, (v), __ATOMIC_RELAXED)
+#define STATS_ADD(field, n) \
+  STATS_SET(field, __atomic_load_n(&stats->field, __ATOMIC_RELAXED) + (n))
+
+static struct glsnake_stats *stats;
+static char stats_path[1024];
+/* when the last frame went up, and the running average of the time
+ * between frames, in seconds */
+static double last_frame, usual;
+static double last_update;
+
+int stats_open(const char *dir) {
+  void *map;
+  int fd, err;
+
+  if ((size_t)snprintf(stats_path, sizeof(stats_path), "%s/%lu" STATS_SUFFIX,
+                       dir, (unsigned long)getpid()) >= sizeof(stats_path)) {
+    errno = ENAMETOOLONG;
+    return -1;
+  }
+  if ((fd = open(stats_path, O_RDWR | O_CREAT | O_TRUNC, 0644)) < 0)
+    return -1;
+  if (ftruncate(fd, (off_t)sizeof(*stats))) {
+    err = errno;
+    close(fd);
+    unlink(stats_path);
+    errno = err;
+    return -1;
+  }
+  map = mmap(NULL, sizeof(*stats), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  err = errno;
+  close(fd);
+  if (map == MAP_FAILED) {
+    unlink(stats_path);
+    errno = err;
+    return -1;
+  }
+  stats = map;
+  stats->size = sizeof(*stats);
+  stats->pid = (uint32_t)getpid();
+  stats->started = stats->updated = (uint64_t)time(NULL);
+  stats->preset = -1;
+  /* readers skip the file until the magic is there */
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  memcpy(stats->magic, STATS_MAGIC, sizeof(STATS_MAGIC));
+  return 0;
+}
+
+void stats_close(void) {
+  if (!stats) return;
+  munmap(stats, sizeof(*stats));
+  stats = NULL;
+  unlink(stats_path);
+}
+
+/* user and system time so far, in microseconds */
+static uint64_t cpu_usec(void) {
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage)) return 0;
+  return (uint64_t)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000 +
+         (uint64_t)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+void stats_frame(double seconds) {
+  double elapsed = seconds - last_frame;
+  long bucket;
+
+  if (!stats) return;
+  if (last_frame > 0.0) {
+    STATS_ADD(frames, 1);
+    STATS_ADD(frame_usec, (uint64_t)(elapsed * 1e6));
+    bucket = (long)(elapsed * 1e6 / STATS_BUCKET_USEC);
+    STATS_ADD(histogram[bucket < STATS_BUCKETS ? bucket : STATS_BUCKETS - 1],
+              1);
+    if (usual > 0.0 && elapsed > 1.5 * usual)
+      STATS_ADD(dropped, (uint64_t)(elapsed / usual + 0.5) - 1);
+    /* the average follows about the last sixteen frames, so it catches up
+     * if the frame rate changes for good */
+    usual = usual > 0.0 ? usual + (elapsed - usual) / 16 : elapsed;
+  }
+  last_frame = seconds;
+
+  /* reading the CPU time takes a system call, so only do it once a
+   * second */
+  if (seconds - last_update >= 1.0) {
+    last_update = seconds;
+    STATS_SET(cpu_usec, cpu_usec());
+    STATS_SET(updated, (uint64_t)time(NULL));
+  }
+}
+
+void stats_morph(int preset) {
+  if (!stats) return;
+  STATS_ADD(morphs, 1);
+  STATS_SET(preset, (int64_t)preset);
+}
+
+void stats_metrics(int hit) {
+  if (!stats) return;
+  if (hit)
+    STATS_ADD(metrics_hits, 1);
+  else
+    STATS_ADD(metrics_misses, 1);
+}
+
+int stats_read(const char *path, struct glsnake_stats *copy) {
+  ssize_t got;
+  int fd, err;
+
+  if ((fd = open(path, O_RDONLY)) < 0) return -1;
+  got = read(fd, copy, sizeof(*copy));
+  err = errno;
+  close(fd);
+  if (got < 0) {
+    errno = err;
+    return -1;
+  }
+  if (got != (ssize_t)sizeof(*copy) ||
+      memcmp(copy->magic, STATS_MAGIC, sizeof(STATS_MAGIC)) ||
+      copy->size != sizeof(*copy))
+    return -2;
+  return 0;
+}
+
+double stats_percentile(const uint64_t histogram[STATS_BUCKETS],
+                        double fraction) {
+  uint64_t total = 0, seen = 0, want;
+  int i;
+
+  for (i = 0; i < STATS_BUCKETS; i++) total += histogram[i];
+  if (!total) return 0.0;
+  want = (uint64_t)(fraction * (double)total);
+  for (i = 0; i < STATS_BUCKETS; i++)
+    if ((seen += histogram[i]) > want) break;
+  return (i + 1) * STATS_BUCKET_USEC / 1000.0;
+}
@@ -0,0 +1,90 @@
+/* stats.h - counters in a file, for monitoring many glsnakes at once
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_STATS_H
+#define GLSNAKE_STATS_H
+
+#include <stdint.h>
+
+/* With -stats dir, glsnake keeps a few counters in dir/PID.stats, mapped
+ * into memory, so that a monitoring agent can read them whenever it likes
+ * just by reading the file.  glsnake only ever stores to them, with
+ * relaxed atomics: each counter is always whole, but one read of the file
+ * may see some counters a frame ahead of others.  The file is removed
+ * when glsnake quits; one left by a glsnake that crashed names a process
+ * that is no longer running.  Everything is in the writer's byte order. */
+
+#define STATS_MAGIC "glsnake-stats1"
+#define STATS_SUFFIX ".stats"
+
+/* frame times are counted in buckets this many microseconds wide, up to
+ * STATS_BUCKETS of them; longer frames go in the last */
+#define STATS_BUCKET_USEC 250
+#define STATS_BUCKETS 256
+
+struct glsnake_stats {
+  char magic[16];
+  /* sizeof(struct glsnake_stats) */
+  uint32_t size;
+  uint32_t pid;
+  /* seconds since the epoch: when glsnake started, and when the counters
+   * were last brought up to date, which is about once a second */
+  uint64_t started, updated;
+  uint64_t frames;
+  uint64_t morphs;
+  /* the time between frames, summed, in microseconds */
+  uint64_t frame_usec;
+  /* Frames taking more than half as long again as usual are taken to have
+   * missed that many frames' worth.  "Usual" is a running average, so that
+   * this works at any frame rate. */
+  uint64_t dropped;
+  /* user and system time, in microseconds, as of updated */
+  uint64_t cpu_usec;
+  /* the model being shown, or -1 if it isn't one */
+  int64_t preset;
+  /* whether shapes that aren't built in were found in the cache of those
+   * seen lately, or had to be traced */
+  uint64_t metrics_hits, metrics_misses;
+  uint64_t histogram[STATS_BUCKETS];
+};
+
+/* For glsnake: create dir/PID.stats and start counting into it.  Returns
+ * -1 with errno set on failure. */
+int stats_open(const char *dir);
+void stats_close(void);
+
+/* Each does nothing unless stats_open has been called.  stats_frame is
+ * given the time in seconds the frame went up. */
+void stats_frame(double seconds);
+void stats_morph(int preset);
+void stats_metrics(int hit);
+
+/* For readers: read the counters in path, returning -1 with errno set if
+ * it can't be read or -2 if it isn't a stats file. */
+int stats_read(const char *path, struct glsnake_stats *stats);
+
+/* The frame time in milliseconds below which a fraction of the counted
+ * frames fall, to the width of a bucket. */
+double stats_percentile(const uint64_t histogram[STATS_BUCKETS],
+                        double fraction);
+
+#endif /* GLSNAKE_STATS_H */
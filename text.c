@@ -0,0 +1,237 @@
+/* text.c - lines of text drawn from a texture of glyphs
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/* Bitmap fonts are drawn a character at a time through glRasterPos and
+ * glBitmap, which many drivers do slowly.  Instead each glyph is drawn once
+ * into the back buffer and read back into an alpha texture, and a line of
+ * text becomes an array of textured quads, laid out once and drawn with a
+ * single call.  The glyphs are either on or off, so the alpha test cuts
+ * them out without any blending. */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <GL/glu.h>
+
+#include "text.h"
+
+#define TEXT_ROWS ((TEXT_GLYPHS + TEXT_COLUMNS - 1) / TEXT_COLUMNS)
+/* glyphs are drawn this far into their cell, as some start a little to the
+ * left of where they are put */
+#define TEXT_MARGIN(cell) ((cell) / 8)
+
+static int next_power_of_two(int n) {
+  int p = 1;
+
+  while (p < n) p *= 2;
+  return p;
+}
+
+int text_font_build(struct text_font *font, text_glyph_func draw, void *arg,
+                    const int advance[TEXT_GLYPHS], int height, int descent) {
+  GLint viewport[4];
+  unsigned char *alpha;
+  int cell = next_power_of_two(height);
+  int width = TEXT_COLUMNS * cell, rows = TEXT_ROWS * cell, i;
+
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  if (viewport[2] < width || viewport[3] < rows) return -1;
+
+  font->cell = cell;
+  font->texture_width = width;
+  font->texture_height = next_power_of_two(rows);
+  font->descent = descent;
+  memcpy(font->advance, advance, sizeof(font->advance));
+  if (!(alpha = calloc((size_t)font->texture_width, font->texture_height)))
+    return -1;
+
+  glPushAttrib((GLbitfield)GL_ENABLE_BIT | GL_TRANSFORM_BIT |
+               GL_COLOR_BUFFER_BIT | GL_CURRENT_BIT | GL_SCISSOR_BIT |
+               GL_TEXTURE_BIT);
+  glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+  glDisable(GL_LIGHTING);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_BLEND);
+  glDisable(GL_TEXTURE_2D);
+  glMatrixMode(GL_PROJECTION);
+  glPushMatrix();
+  glLoadIdentity();
+  glOrtho(0.0, viewport[2], 0.0, viewport[3], -1.0, 1.0);
+  glMatrixMode(GL_MODELVIEW);
+  glPushMatrix();
+  glLoadIdentity();
+
+  glEnable(GL_SCISSOR_TEST);
+  glScissor(viewport[0], viewport[1], width, rows);
+  glClearColor(0.0, 0.0, 0.0, 0.0);
+  glClear(GL_COLOR_BUFFER_BIT);
+  glColor4f(1.0, 1.0, 1.0, 1.0);
+  for (i = 0; i < TEXT_GLYPHS; i++) {
+    glRasterPos2i(i % TEXT_COLUMNS * cell + TEXT_MARGIN(cell),
+                  i / TEXT_COLUMNS * cell + descent);
+    draw(TEXT_FIRST + i, arg);
+  }
+
+  glReadBuffer(GL_BACK);
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glReadPixels(viewport[0], viewport[1], width, rows, GL_RED,
+               GL_UNSIGNED_BYTE, alpha);
+
+  glGenTextures(1, &font->texture);
+  glBindTexture(GL_TEXTURE_2D, font->texture);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, font->texture_width,
+               font->texture_height, 0, GL_ALPHA, GL_UNSIGNED_BYTE, alpha);
+  free(alpha);
+
+  glPopMatrix();
+  glMatrixMode(GL_PROJECTION);
+  glPopMatrix();
+  glPopClientAttrib();
+  glPopAttrib();
+  return 0;
+}
+
+void text_font_free(struct text_font *font) {
+  if (font->texture) glDeleteTextures(1, &font->texture);
+  font->texture = 0;
+}
+
+int text_plane_set(struct text_plane *plane) {
+  GLdouble modelview[16], projection[16], p[3][3];
+  GLint viewport[4];
+  int i;
+
+  glGetDoublev(GL_MODELVIEW_MATRIX, modelview);
+  glGetDoublev(GL_PROJECTION_MATRIX, projection);
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  /* where pixels (0, 0), (1, 0) and (0, 1) are */
+  for (i = 0; i < 3; i++)
+    if (!gluUnProject(viewport[0] + (i == 1), viewport[1] + (i == 2), 0.5,
+                      modelview, projection, viewport, &p[i][0], &p[i][1],
+                      &p[i][2]))
+      return -1;
+  for (i = 0; i < 3; i++) {
+    plane->origin[i] = (float)p[0][i];
+    plane->right[i] = (float)(p[1][i] - p[0][i]);
+    plane->up[i] = (float)(p[2][i] - p[0][i]);
+  }
+  return 0;
+}
+
+int text_width(const struct text_font *font, const char *s) {
+  int width = 0;
+
+  for (; *s; s++) {
+    int g = (unsigned char)*s - TEXT_FIRST;
+
+    width += font->advance[g < 0 || g >= TEXT_GLYPHS ? 0 : g];
+  }
+  return width;
+}
+
+/* one vertex as glInterleavedArrays takes GL_T2F_V3F */
+static float *corner(float *v, float s, float t, float x, float y,
+                     const struct text_plane *plane) {
+  int i;
+
+  *v++ = s;
+  *v++ = t;
+  if (!plane) {
+    *v++ = x;
+    *v++ = y;
+    *v++ = 0.0;
+    return v;
+  }
+  for (i = 0; i < 3; i++)
+    *v++ = plane->origin[i] + x * plane->right[i] + y * plane->up[i];
+  return v;
+}
+
+int text_line_set(struct text_line *line, const struct text_font *font,
+                  const char *s, float x, float y,
+                  const struct text_plane *plane) {
+  size_t len = strlen(s);
+  float ds = (float)font->cell / font->texture_width;
+  float dt = (float)font->cell / font->texture_height;
+  float *v;
+  int pen = 0;
+
+  if ((int)len > line->alloc) {
+    float *more = realloc(line->vertex, len * 4 * 5 * sizeof(float));
+
+    if (!more) return -1;
+    line->vertex = more;
+    line->alloc = (int)len;
+  }
+
+  y -= font->descent;
+  for (v = line->vertex; *s; s++) {
+    int g = (unsigned char)*s - TEXT_FIRST;
+    float s0, t0, x0;
+
+    if (g < 0 || g >= TEXT_GLYPHS) g = 0;
+    x0 = x + pen - TEXT_MARGIN(font->cell);
+    pen += font->advance[g];
+    /* nothing to draw for a space */
+    if (!g) continue;
+
+    s0 = g % TEXT_COLUMNS * ds;
+    t0 = g / TEXT_COLUMNS * dt;
+    v = corner(v, s0, t0, x0, y, plane);
+    v = corner(v, s0 + ds, t0, x0 + font->cell, y, plane);
+    v = corner(v, s0 + ds, t0 + dt, x0 + font->cell, y + font->cell, plane);
+    v = corner(v, s0, t0 + dt, x0, y + font->cell, plane);
+  }
+  line->count = (int)(v - line->vertex) / (4 * 5);
+  line->width = pen;
+  return 0;
+}
+
+void text_line_free(struct text_line *line) {
+  free(line->vertex);
+  line->vertex = NULL;
+  line->count = line->alloc = 0;
+}
+
+void text_line_draw(const struct text_font *font,
+                    const struct text_line *line) {
+  if (!line->count) return;
+
+  glPushAttrib((GLbitfield)GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT |
+               GL_TEXTURE_BIT);
+  glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+  glDisable(GL_LIGHTING);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_CULL_FACE);
+  glDisable(GL_BLEND);
+  glEnable(GL_TEXTURE_2D);
+  glBindTexture(GL_TEXTURE_2D, font->texture);
+  glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+  glEnable(GL_ALPHA_TEST);
+  glAlphaFunc(GL_GREATER, 0.5);
+  glInterleavedArrays(GL_T2F_V3F, 0, line->vertex);
+  glDrawArrays(GL_QUADS, 0, line->count * 4);
+  glPopClientAttrib();
+  glPopAttrib();
+}
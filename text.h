@@ -0,0 +1,100 @@
+/* text.h - lines of text drawn from a texture of glyphs
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef GLSNAKE_TEXT_H
+#define GLSNAKE_TEXT_H
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+#include <GL/gl.h>
+
+/* the printable ASCII characters; anything else is drawn as a space */
+#define TEXT_FIRST 32
+#define TEXT_LAST 126
+#define TEXT_GLYPHS (TEXT_LAST - TEXT_FIRST + 1)
+
+/* glyphs are laid out in the texture this many to a row */
+#define TEXT_COLUMNS 16
+
+struct text_font {
+  GLuint texture;
+  int texture_width, texture_height;
+  /* each glyph is captured in a cell this many pixels square */
+  int cell;
+  /* how far along the line each glyph moves */
+  int advance[TEXT_GLYPHS];
+  /* how far below the baseline glyphs reach */
+  int descent;
+};
+
+/* a line of text, ready to draw */
+struct text_line {
+  /* four vertices of s, t, x, y, z for each character */
+  float *vertex;
+  int count, alloc;
+  /* in pixels */
+  int width;
+};
+
+/* Where the pixels of the window are in the scene: pixel (x, y) is at
+ * origin + x * right + y * up.  Text laid out there is drawn with whatever
+ * matrices the scene is drawn with, so needs none of its own. */
+struct text_plane {
+  float origin[3], right[3], up[3];
+};
+
+/* Draws character c at the current raster position, as glutBitmapCharacter
+ * or an X font's display lists do. */
+typedef void (*text_glyph_func)(int c, void *arg);
+
+/* Capture every glyph of a bitmap font into a texture, by drawing each one
+ * into the back buffer with draw and reading it back.  advance gives the
+ * width of each glyph, height how tall the font is and descent how far
+ * below the baseline it reaches.  The back buffer is left a mess, so this
+ * is best done just before it is cleared.  Returns -1 if the viewport is
+ * too small to draw the glyphs in, or out of memory. */
+int text_font_build(struct text_font *font, text_glyph_func draw, void *arg,
+                    const int advance[TEXT_GLYPHS], int height, int descent);
+void text_font_free(struct text_font *font);
+
+/* Work out the plane of pixels for the current matrices and viewport,
+ * halfway into the depth range.  Returns -1 if the matrices can't be
+ * inverted. */
+int text_plane_set(struct text_plane *plane);
+
+/* How wide s is, in pixels. */
+int text_width(const struct text_font *font, const char *s);
+
+/* Lay out s from (x, y) on the baseline, in pixels, or in plane if it
+ * isn't NULL; returns -1 if out of memory. */
+int text_line_set(struct text_line *line, const struct text_font *font,
+                  const char *s, float x, float y,
+                  const struct text_plane *plane);
+void text_line_free(struct text_line *line);
+
+/* Draw lines in the current colour, with one pixel to a unit unless they
+ * were laid out in a plane.  Lighting and depth testing are turned off
+ * while they are drawn. */
+void text_line_draw(const struct text_font *font,
+                    const struct text_line *line);
+
+#endif /* GLSNAKE_TEXT_H */
@@ -0,0 +1,198 @@
+/* timeline.c - Chrome trace events of where the time goes, for -trace
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "perf.h"
+#include "timeline.h"
+
+/* how many events a thread can record before they are written out */
+#define TIMELINE_EVENTS 4096
+
+struct timeline_ring {
+  struct timeline_ring *next;
+  int tid;
+  const char *name;
+  int named;
+  /* set while the thread is recording into the ring */
+  int busy;
+  int count;
+  struct {
+    const char *name;
+    char phase;
+    double when;
+  } event[TIMELINE_EVENTS];
+};
+
+int timeline_enabled;
+
+static FILE *timeline_fp;
+static double timeline_start;
+static int timeline_written;
+static struct timeline_ring *rings;
+static int ring_count;
+
+#ifdef HAVE_PTHREAD
+static pthread_key_t ring_key;
+/* held while adding a ring and while writing to the file, never while
+ * recording */
+static pthread_mutex_t timeline_lock = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK() pthread_mutex_lock(&timeline_lock)
+#define UNLOCK() pthread_mutex_unlock(&timeline_lock)
+/* a thread marks its ring busy and then looks at timeline_enabled, while
+ * timeline_close clears timeline_enabled and then looks at the rings, so
+ * one always sees what the other did */
+#define STORE(v, x) __atomic_store_n(&(v), (x), __ATOMIC_SEQ_CST)
+#define LOAD(v) __atomic_load_n(&(v), __ATOMIC_SEQ_CST)
+#else
+static struct timeline_ring *ring_only;
+#define LOCK()
+#define UNLOCK()
+#define STORE(v, x) ((v) = (x))
+#define LOAD(v) (v)
+#endif
+
+int timeline_open(const char *path) {
+  if (!(timeline_fp = fopen(path, "w"))) return -1;
+#ifdef HAVE_PTHREAD
+  pthread_key_create(&ring_key, NULL);
+#endif
+  fprintf(timeline_fp, "{\"traceEvents\": [\n");
+  timeline_start = perf_now();
+  STORE(timeline_enabled, 1);
+  return 0;
+}
+
+/* the calling thread's ring, made on first use */
+static struct timeline_ring *timeline_ring(void) {
+  struct timeline_ring *ring;
+
+#ifdef HAVE_PTHREAD
+  ring = pthread_getspecific(ring_key);
+#else
+  ring = ring_only;
+#endif
+  if (ring) return ring;
+
+  if (!(ring = malloc(sizeof(*ring)))) return NULL;
+  ring->name = NULL;
+  ring->named = 0;
+  ring->busy = 0;
+  ring->count = 0;
+  LOCK();
+  ring->tid = ++ring_count;
+  ring->next = rings;
+  rings = ring;
+  UNLOCK();
+#ifdef HAVE_PTHREAD
+  pthread_setspecific(ring_key, ring);
+#else
+  ring_only = ring;
+#endif
+  return ring;
+}
+
+/* Write out a ring's events and empty it.  The lock must be held. */
+static void timeline_flush(struct timeline_ring *ring) {
+  int i;
+
+  /* too late: the file is finished */
+  if (!timeline_fp) {
+    ring->count = 0;
+    return;
+  }
+  if (ring->name && !ring->named) {
+    fprintf(timeline_fp,
+            "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+            "\"tid\": %d, \"args\": {\"name\": \"%s\"}}",
+            timeline_written++ ? ",\n" : "", ring->tid, ring->name);
+    ring->named = 1;
+  }
+  for (i = 0; i < ring->count; i++)
+    fprintf(timeline_fp,
+            "%s{\"name\": \"%s\", \"ph\": \"%c\", \"ts\": %.3f, \"pid\": 1, "
+            "\"tid\": %d}",
+            timeline_written++ ? ",\n" : "", ring->event[i].name,
+            ring->event[i].phase, ring->event[i].when * 1e6, ring->tid);
+  ring->count = 0;
+}
+
+void timeline_event(const char *name, char phase) {
+  struct timeline_ring *ring = timeline_ring();
+
+  if (!ring) return;
+  STORE(ring->busy, 1);
+  if (LOAD(timeline_enabled)) {
+    if (ring->count == TIMELINE_EVENTS) {
+      LOCK();
+      timeline_flush(ring);
+      UNLOCK();
+    }
+    ring->event[ring->count].name = name;
+    ring->event[ring->count].phase = phase;
+    ring->event[ring->count].when = perf_now() - timeline_start;
+    ring->count++;
+  }
+  STORE(ring->busy, 0);
+}
+
+void timeline_thread_name(const char *name) {
+  struct timeline_ring *ring;
+
+  if (LOAD(timeline_enabled) && (ring = timeline_ring())) {
+    LOCK();
+    ring->name = name;
+    UNLOCK();
+  }
+}
+
+/* Other threads may still be running.  Once timeline_enabled is cleared
+ * they record nothing more, so when each of their rings has been seen not
+ * busy it is safe to write out. */
+void timeline_close(void) {
+  struct timeline_ring *ring;
+
+  if (!timeline_fp) return;
+  STORE(timeline_enabled, 0);
+  LOCK();
+  for (ring = rings; ring; ring = ring->next) {
+#ifdef HAVE_PTHREAD
+    /* let it finish, and flush a full ring first if it has to */
+    while (LOAD(ring->busy)) {
+      UNLOCK();
+      sched_yield();
+      LOCK();
+    }
+#endif
+    timeline_flush(ring);
+  }
+  fprintf(timeline_fp, "\n]}\n");
+  fclose(timeline_fp);
+  timeline_fp = NULL;
+  UNLOCK();
+}
@@ -0,0 +1,65 @@
+/* timeline.h - Chrome trace events of where the time goes, for -trace
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_TIMELINE_H
+#define GLSNAKE_TIMELINE_H
+
+/* Each thread records into a ring of its own, so recording never takes a
+ * lock; a ring is written out when it fills and when the timeline is
+ * closed.  The file is in Chrome's trace event format, which Perfetto and
+ * chrome://tracing both read. */
+
+extern int timeline_enabled;
+
+/* other threads record too, so timeline_enabled is read atomically; this
+ * is only a quick look, and timeline_event looks again properly */
+#ifdef HAVE_PTHREAD
+#define TIMELINE_ENABLED() __atomic_load_n(&timeline_enabled, __ATOMIC_RELAXED)
+#else
+#define TIMELINE_ENABLED() timeline_enabled
+#endif
+
+/* names must be string constants, as only the pointer is kept */
+#define TIMELINE_BEGIN(name)                           \
+  do {                                                 \
+    if (TIMELINE_ENABLED()) timeline_event(name, 'B'); \
+  } while (0)
+#define TIMELINE_END(name)                             \
+  do {                                                 \
+    if (TIMELINE_ENABLED()) timeline_event(name, 'E'); \
+  } while (0)
+
+/* Start writing to path; returns -1 with errno set if it can't be opened. */
+int timeline_open(const char *path);
+
+/* phase is 'B' to begin or 'E' to end */
+void timeline_event(const char *name, char phase);
+
+/* Name the calling thread in the timeline. */
+void timeline_thread_name(const char *name);
+
+/* Stop recording, wait for any thread part way through recording an event
+ * to finish it, then write out every thread's events and finish the
+ * file. */
+void timeline_close(void);
+
+#endif /* GLSNAKE_TIMELINE_H */
@@ -0,0 +1,162 @@
+/* glsnake-control.c - drive a running glsnake through its -control socket
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* Sends the command given on the command line, or each line of standard
+ * input, to a glsnake started with -control, and prints what comes back.
+ * With -b it instead times that many pings, one after another, to show how
+ * long a command takes to be carried out and answered. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#define LINE_LENGTH 512
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: glsnake-control [-b pings] socket [command ...]\n"
+          "  -b  time this many pings instead\n"
+          "with no command, each line of standard input is sent in turn\n");
+  exit(2);
+}
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int connect_to(const char *path) {
+  struct sockaddr_un addr;
+  int fd;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    fprintf(stderr, "glsnake-control: %s: name too long\n", path);
+    exit(1);
+  }
+  strcpy(addr.sun_path, path);
+  if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0 ||
+      connect(fd, (struct sockaddr *)&addr, sizeof(addr))) {
+    perror(path);
+    exit(1);
+  }
+  return fd;
+}
+
+/* Send line and wait for the reply; returns 1 if it began "ok". */
+static int command(int fd, FILE *in, const char *line, char *reply) {
+  size_t len = strlen(line);
+
+  if (write(fd, line, len) != (ssize_t)len || write(fd, "\n", 1) != 1) {
+    perror("glsnake-control: write");
+    exit(1);
+  }
+  if (!fgets(reply, LINE_LENGTH, in)) {
+    fprintf(stderr, "glsnake-control: glsnake hung up\n");
+    exit(1);
+  }
+  return !strncmp(reply, "ok", 2);
+}
+
+static int compare_doubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+
+  return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static void benchmark(int fd, FILE *in, long pings) {
+  char reply[LINE_LENGTH];
+  double *rtt, start;
+  long i;
+
+  if (!(rtt = malloc((size_t)pings * sizeof(*rtt)))) {
+    fprintf(stderr, "glsnake-control: out of memory\n");
+    exit(1);
+  }
+  start = now();
+  for (i = 0; i < pings; i++) {
+    double sent = now();
+
+    command(fd, in, "ping", reply);
+    rtt[i] = (now() - sent) * 1e6;
+  }
+  printf("%ld pings in %.3f s\n", pings, now() - start);
+  qsort(rtt, (size_t)pings, sizeof(*rtt), compare_doubles);
+  printf("round trip us: min %.1f p50 %.1f p99 %.1f max %.1f\n", rtt[0],
+         rtt[pings / 2], rtt[pings * 99 / 100], rtt[pings - 1]);
+  free(rtt);
+}
+
+int main(int argc, char **argv) {
+  char line[LINE_LENGTH], reply[LINE_LENGTH];
+  long pings = 0;
+  int c, fd, ok = 1;
+  FILE *in;
+
+  while ((c = getopt(argc, argv, "b:")) != -1) {
+    switch (c) {
+      case 'b':
+        if ((pings = atol(optarg)) <= 0) usage();
+        break;
+      default:
+        usage();
+    }
+  }
+  if (optind >= argc) usage();
+
+  fd = connect_to(argv[optind++]);
+  if (!(in = fdopen(fd, "r"))) {
+    perror("fdopen");
+    return 1;
+  }
+
+  if (pings) {
+    benchmark(fd, in, pings);
+  } else if (optind < argc) {
+    /* the arguments make up one command */
+    line[0] = '\0';
+    for (; optind < argc; optind++) {
+      if (strlen(line) + strlen(argv[optind]) + 2 > sizeof(line)) usage();
+      if (line[0]) strcat(line, " ");
+      strcat(line, argv[optind]);
+    }
+    ok = command(fd, in, line, reply);
+    fputs(reply, stdout);
+  } else {
+    while (fgets(line, sizeof(line), stdin)) {
+      line[strcspn(line, "\r\n")] = '\0';
+      if (!line[0] || line[0] == '#') continue;
+      if (!command(fd, in, line, reply)) ok = 0;
+      fputs(reply, stdout);
+      fflush(stdout);
+    }
+  }
+  fclose(in);
+  return ok ? 0 : 1;
+}
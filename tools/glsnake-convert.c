@@ -0,0 +1,528 @@
+/* glsnake-convert.c - check and convert catalogues of snake models
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/* Reads model lines in either the glsnake format (Z, L, P and R) or Thomas
+ * Wolter's twist notation (4R1-5L3-...), checks that each one is a real
+ * snake, and writes them out again in a single canonical format.  -f c
+ * writes the C tables of models.c instead, with everything glsnake would
+ * otherwise work out about each model when it is shown. */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "geometry.h"
+#include "models.h"
+#include "shape.h"
+
+#define IO_BUFFER_SIZE (1 << 20)
+
+#ifndef M_SQRT1_2
+#define M_SQRT1_2 0.70710678118654752440
+#endif
+
+/* how deeply #if lines can nest in -f c input */
+#define CONDITION_DEPTH 8
+
+enum format { FORMAT_TEXT, FORMAT_WOLTER, FORMAT_BINARY, FORMAT_C };
+
+static enum format format = FORMAT_TEXT;
+static int keep_illegal = 0;
+static int round_trip = 0;
+static int verbose = 0;
+
+static unsigned long shapes, illegal, unparsed, mismatched;
+
+/* For -f c, every model is kept until the end, with the #if lines around
+ * it, which are passed through so that models can be left out of some
+ * builds. */
+struct c_model {
+  char name[MODEL_NAME_LENGTH];
+  struct glsnake_shape shape;
+  struct snake_metrics metrics;
+  int depth;
+  int condition[CONDITION_DEPTH];
+};
+
+static struct c_model *c_models;
+static size_t c_model_count, c_model_alloc;
+static char **conditions;
+static size_t condition_count;
+static int open_conditions[CONDITION_DEPTH], open_depth;
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: glsnake-convert [-f text|wolter|binary|c] [-k] [-r] [-v] "
+          "[-o output] [file...]\n"
+          "  -f  output format (default text); c writes models.c\n"
+          "  -k  keep models that intersect themselves\n"
+          "  -r  check every model survives conversion to each format and "
+          "back\n"
+          "  -v  print a summary when done\n"
+          "With no files, models are read from standard input.\n");
+  exit(2);
+}
+
+static int same_joints(const struct glsnake_shape *a,
+                       const struct glsnake_shape *b, int count) {
+  int i;
+
+  for (i = 0; i < count; i++)
+    if (a->node[i] != b->node[i]) return 0;
+  return 1;
+}
+
+/* Convert shape to each format and back, and complain if anything about it
+ * changes on the way. */
+static void check_round_trip(const char *where, const char *name,
+                             const struct glsnake_shape *shape) {
+  struct glsnake_shape back;
+  char buf[256], back_name[MODEL_NAME_LENGTH];
+  uint64_t packed;
+
+  /* give it a name, or the straight snake would be an empty line */
+  strcpy(buf, "x:");
+  if (format_shape(shape, buf + 2, sizeof(buf) - 2) ||
+      parse_shape(buf, back_name, sizeof(back_name), &back) ||
+      !same_joints(shape, &back, NODE_COUNT - 1)) {
+    fprintf(stderr, "%s: %s does not survive text conversion\n", where, name);
+    mismatched++;
+  }
+  if (format_wolter(shape, buf + 2, sizeof(buf) - 2) ||
+      parse_shape(buf, back_name, sizeof(back_name), &back) ||
+      !same_joints(shape, &back, NODE_COUNT - 1)) {
+    fprintf(stderr, "%s: %s does not survive Wolter conversion (%s)\n", where,
+            name, buf);
+    mismatched++;
+  }
+  if (pack_shape(shape, &packed)) {
+    fprintf(stderr, "%s: %s can't be packed\n", where, name);
+    mismatched++;
+  } else {
+    unsigned char bytes[8];
+
+    packed_to_bytes(packed, bytes);
+    unpack_shape(packed_from_bytes(bytes), &back);
+    if (!same_joints(shape, &back, NODE_COUNT)) {
+      fprintf(stderr, "%s: %s does not survive packing\n", where, name);
+      mismatched++;
+    }
+  }
+}
+
+static void write_shape(FILE *out, const char *name,
+                        const struct glsnake_shape *shape) {
+  char buf[256];
+  uint64_t packed;
+
+  switch (format) {
+    case FORMAT_BINARY: {
+      unsigned char bytes[8];
+
+      pack_shape(shape, &packed);
+      packed_to_bytes(packed, bytes);
+      fwrite(bytes, sizeof(bytes), 1, out);
+      return;
+    }
+    case FORMAT_WOLTER:
+      format_wolter(shape, buf, sizeof(buf));
+      break;
+    case FORMAT_TEXT:
+    case FORMAT_C:
+      format_shape(shape, buf, sizeof(buf));
+      break;
+  }
+  if (*name)
+    fprintf(out, "%s:\t%s\n", name, buf);
+  else
+    fprintf(out, "%s\n", buf);
+}
+
+static void *grow(void *p, size_t *alloc, size_t size) {
+  *alloc = *alloc ? *alloc * 2 : 256;
+  if (!(p = realloc(p, *alloc * size))) {
+    perror("glsnake-convert");
+    exit(1);
+  }
+  return p;
+}
+
+/* Keep track of #if, #ifdef, #ifndef and #endif lines; returns 0 if line
+ * is none of them, so just a comment. */
+static int condition_line(const char *where, const char *line) {
+  static size_t alloc;
+
+  if (!strncmp(line, "#endif", 6)) {
+    if (!open_depth) {
+      fprintf(stderr, "%s: #endif without #if\n", where);
+      exit(1);
+    }
+    open_depth--;
+    return 1;
+  }
+  if (!strncmp(line, "#el", 3)) {
+    fprintf(stderr, "%s: only #if and #endif can be used\n", where);
+    exit(1);
+  }
+  if (strncmp(line, "#if", 3)) return 0;
+  if (open_depth == CONDITION_DEPTH) {
+    fprintf(stderr, "%s: #if nested too deeply\n", where);
+    exit(1);
+  }
+  if (condition_count == alloc)
+    conditions = grow(conditions, &alloc, sizeof(char *));
+  if (!(conditions[condition_count] = malloc(strlen(line) + 1))) {
+    perror("glsnake-convert");
+    exit(1);
+  }
+  strcpy(conditions[condition_count], line);
+  open_conditions[open_depth++] = (int)condition_count++;
+  return 1;
+}
+
+static void c_model_add(const char *name, const struct glsnake_shape *shape,
+                        const struct snake_metrics *metrics) {
+  struct c_model *m;
+
+  if (c_model_count == c_model_alloc)
+    c_models = grow(c_models, &c_model_alloc, sizeof(struct c_model));
+  m = &c_models[c_model_count++];
+  strcpy(m->name, *name ? name : "(unnamed)");
+  memcpy(&m->shape, shape, sizeof(*shape));
+  memcpy(&m->metrics, metrics, sizeof(*metrics));
+  m->depth = open_depth;
+  memcpy(m->condition, open_conditions, sizeof(open_conditions));
+}
+
+static void convert(FILE *in, const char *path, FILE *out) {
+  char line[4096];
+  int lineno = 0;
+
+  while (fgets(line, sizeof(line), in)) {
+    char name[MODEL_NAME_LENGTH], where[1024];
+    struct glsnake_shape shape;
+    struct snake_metrics metrics;
+    char *p = line + strspn(line, " \t");
+
+    lineno++;
+    p[strcspn(p, "\r\n")] = '\0';
+    snprintf(where, sizeof(where), "%s:%d", path, lineno);
+    if (*p == '#' && format == FORMAT_C) condition_line(where, p);
+    if (*p == '#' || *p == '\0') continue;
+
+    if (parse_shape(p, name, sizeof(name), &shape)) {
+      fprintf(stderr, "%s: can't parse model\n", where);
+      unparsed++;
+      continue;
+    }
+    shapes++;
+
+    calc_snake_metrics_shape(&shape, &metrics);
+    if (!metrics.is_legal) {
+      illegal++;
+      if (!keep_illegal) {
+        fprintf(stderr, "%s: %s intersects itself\n", where, name);
+        continue;
+      }
+    }
+    if (round_trip)
+      check_round_trip(where, name, &shape);
+    else if (format == FORMAT_C)
+      c_model_add(name, &shape, &metrics);
+    else
+      write_shape(out, name, &shape);
+  }
+}
+
+/* Close and open #if lines to go from the conditions around one model to
+ * those around the next; either may be NULL, for none. */
+static void switch_conditions(FILE *out, const struct c_model *from,
+                              const struct c_model *to) {
+  int same = 0, i;
+
+  while (from && to && same < from->depth && same < to->depth &&
+         from->condition[same] == to->condition[same])
+    same++;
+  for (i = from ? from->depth : 0; i > same; i--) fprintf(out, "#endif\n");
+  for (i = same; to && i < to->depth; i++)
+    fprintf(out, "%s\n", conditions[to->condition[i]]);
+}
+
+/* Write the next of a list of words separated by commas, wrapped at 80
+ * columns with following lines indented to indent; column is how far along
+ * the current line is, and the last word leaves room for the end. */
+static int wrap(FILE *out, int column, int indent, int first, int last,
+                const char *word) {
+  int len = (int)strlen(word) + (first ? 0 : 2) + (last ? 4 : 1);
+
+  if (!first && column + len > 80) {
+    fprintf(out, ",\n%*s", indent, "");
+    column = indent;
+  } else if (!first) {
+    column += fprintf(out, ", ");
+  }
+  return column + fprintf(out, "%s", word);
+}
+
+static void write_float(char *buf, size_t len, double f) {
+  /* no negative zeros */
+  snprintf(buf, len, "%.9g", f + 0.0);
+  if (!strcmp(buf, "-0")) strcpy(buf, "0");
+}
+
+static double distance(const float a[3], const float b[3]) {
+  return sqrt((a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]) +
+              (a[2] - b[2]) * (a[2] - b[2]));
+}
+
+static void write_info(FILE *out, const struct c_model *cm) {
+  static const char *const colour_name[] = {"MODEL_CYCLIC", "MODEL_ACYCLIC",
+                                            "MODEL_INVALID"};
+  static const float middle[3] = {0.5, 0.5, 0.5};
+  float m0[NODE_COUNT + 1][16], m1[NODE_COUNT + 1][16];
+  float com0[3], com1[3];
+  double radius = 0.0, spread = 0.0;
+  char word[64], f[3][32];
+  uint64_t packed;
+  int colour, column, i;
+
+  /* everything moves in proportion to explode, so two are enough */
+  node_transforms(&cm->shape, 0.0, m0);
+  node_transforms(&cm->shape, 1.0, m1);
+  snake_centre(m0, com0);
+  snake_centre(m1, com1);
+  for (i = 1; i <= NODE_COUNT; i++) {
+    float p0[3], p1[3], d[3];
+    int k;
+
+    matrix_transform(m0[i], middle, p0);
+    matrix_transform(m1[i], middle, p1);
+    for (k = 0; k < 3; k++) d[k] = (p1[k] - com1[k]) - (p0[k] - com0[k]);
+    if (distance(p0, com0) > radius) radius = distance(p0, com0);
+    if (sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]) > spread)
+      spread = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+  }
+
+  pack_shape(&cm->shape, &packed);
+  colour = !cm->metrics.is_legal  ? MODEL_INVALID
+           : cm->metrics.is_cyclic ? MODEL_CYCLIC
+                                   : MODEL_ACYCLIC;
+  write_float(f[0], sizeof(f[0]), cm->metrics.last_turn);
+  fprintf(out, "    /* %s */\n", cm->name);
+  fprintf(out, "    {UINT64_C(0x%08lx%08lx), {%d, %d, %s}, %s,\n",
+          (unsigned long)(packed >> 32), (unsigned long)(packed & 0xffffffff),
+          cm->metrics.is_legal, cm->metrics.is_cyclic, f[0],
+          colour_name[colour]);
+  for (i = 0; i < 3; i++) write_float(f[i], sizeof(f[i]), com0[i]);
+  fprintf(out, "     {%s, %s, %s},\n", f[0], f[1], f[2]);
+  for (i = 0; i < 3; i++) write_float(f[i], sizeof(f[i]), com1[i] - com0[i]);
+  fprintf(out, "     {%s, %s, %s},\n", f[0], f[1], f[2]);
+  /* a node reaches this far past its middle, and one more for explode */
+  write_float(f[0], sizeof(f[0]), (float)(radius + M_SQRT1_2));
+  write_float(f[1], sizeof(f[1]), (float)(spread + 1.0));
+  fprintf(out, "     %s, %s,\n     {", f[0], f[1]);
+  column = 6;
+  for (i = 0; i < NODE_COUNT; i++) {
+    struct node_place place;
+
+    if (node_place(m0[i + 1], &place)) {
+      fprintf(stderr, "glsnake-convert: %s has joints glsnake can't place\n",
+              cm->name);
+      exit(1);
+    }
+    snprintf(word, sizeof(word), "{%d, %d, %d, %d}", place.rotation, place.x,
+             place.y, place.z);
+    column = wrap(out, column, 6, !i, i == NODE_COUNT - 1, word);
+  }
+  fprintf(out, "}},\n");
+}
+
+static int compare_keys(const void *a, const void *b) {
+  const struct model_key *x = a, *y = b;
+
+  if (x->key != y->key) return x->key < y->key ? -1 : 1;
+  return x->index - y->index;
+}
+
+/* Write models.c: the models as glsnake keeps them, what is known about
+ * each, and an index of them by shape. */
+static void write_c(FILE *out) {
+  static const char *const angle_name[] = {"ZERO", "LEFT", "PIN", "RIGHT"};
+  struct model_key *keys;
+  const struct c_model *prev = NULL;
+  size_t i;
+
+  if (open_depth) {
+    fprintf(stderr, "glsnake-convert: #if without #endif\n");
+    exit(1);
+  }
+  fprintf(out,
+          "/* models.c - the built in models, and what is known about each "
+          "of them\n"
+          " *\n"
+          " * Generated from data/models.glsnake by glsnake-convert -f c; "
+          "edit that\n"
+          " * instead. */\n\n"
+          "#include \"models.h\"\n\n"
+          "/* where each model is in builtin_model */\n"
+          "enum {\n");
+  for (i = 0; i < c_model_count; i++) {
+    switch_conditions(out, prev, &c_models[i]);
+    fprintf(out, "  BUILTIN_%lu,\n", (unsigned long)i);
+    prev = &c_models[i];
+  }
+  switch_conditions(out, prev, NULL);
+  fprintf(out, "  BUILTIN_MODELS\n};\n\n");
+
+  fprintf(out, "struct model_s builtin_model[] = {\n");
+  for (prev = NULL, i = 0; i < c_model_count; i++) {
+    const struct c_model *cm = &c_models[i];
+    char word[MODEL_NAME_LENGTH * 2 + 8], *w = word;
+    uint64_t packed;
+    const char *c;
+    int column, k;
+
+    switch_conditions(out, prev, cm);
+    prev = cm;
+    *w++ = '"';
+    for (c = cm->name; *c; c++) {
+      if (*c == '"' || *c == '\\') *w++ = '\\';
+      *w++ = *c;
+    }
+    strcpy(w, "\",");
+    fprintf(out, "    {%s\n     {{", word);
+    column = 7;
+    pack_shape(&cm->shape, &packed);
+    for (k = 0; k < NODE_COUNT; k++)
+      column = wrap(out, column, 7, !k, k == NODE_COUNT - 1,
+                    angle_name[(packed >> (2 * k)) & 3]);
+    fprintf(out, "}}},\n");
+  }
+  switch_conditions(out, prev, NULL);
+  fprintf(out, "};\n\nconst size_t builtin_models = BUILTIN_MODELS;\n\n");
+
+  fprintf(out, "const struct model_info builtin_info[] = {\n");
+  for (prev = NULL, i = 0; i < c_model_count; i++) {
+    switch_conditions(out, prev, &c_models[i]);
+    write_info(out, &c_models[i]);
+    prev = &c_models[i];
+  }
+  switch_conditions(out, prev, NULL);
+  fprintf(out, "};\n\n");
+
+  if (!(keys = malloc((c_model_count + 1) * sizeof(struct model_key)))) {
+    perror("glsnake-convert");
+    exit(1);
+  }
+  for (i = 0; i < c_model_count; i++) {
+    uint64_t packed;
+
+    pack_shape(&c_models[i].shape, &packed);
+    keys[i].key = MODEL_KEY(packed);
+    keys[i].index = (int)i;
+  }
+  qsort(keys, c_model_count, sizeof(struct model_key), compare_keys);
+  fprintf(out, "const struct model_key builtin_keys[] = {\n");
+  for (prev = NULL, i = 0; i < c_model_count; i++) {
+    const struct c_model *cm = &c_models[keys[i].index];
+
+    switch_conditions(out, prev, cm);
+    fprintf(out, "    {UINT64_C(0x%08lx%08lx), BUILTIN_%d},\n",
+            (unsigned long)(keys[i].key >> 32),
+            (unsigned long)(keys[i].key & 0xffffffff), keys[i].index);
+    prev = cm;
+  }
+  switch_conditions(out, prev, NULL);
+  fprintf(out, "};\n");
+  free(keys);
+}
+
+int main(int argc, char **argv) {
+  FILE *out = stdout;
+  int c;
+
+  while ((c = getopt(argc, argv, "f:kro:v")) != -1) {
+    switch (c) {
+      case 'f':
+        if (!strcmp(optarg, "text"))
+          format = FORMAT_TEXT;
+        else if (!strcmp(optarg, "wolter"))
+          format = FORMAT_WOLTER;
+        else if (!strcmp(optarg, "binary"))
+          format = FORMAT_BINARY;
+        else if (!strcmp(optarg, "c"))
+          format = FORMAT_C;
+        else
+          usage();
+        break;
+      case 'k':
+        keep_illegal = 1;
+        break;
+      case 'r':
+        round_trip = 1;
+        break;
+      case 'o':
+        if (!(out = fopen(optarg, "wb"))) {
+          perror(optarg);
+          return 1;
+        }
+        break;
+      case 'v':
+        verbose = 1;
+        break;
+      default:
+        usage();
+    }
+  }
+  /* nothing to read but a terminal: more likely wanting to know how */
+  if (optind == argc && isatty(0)) usage();
+  setvbuf(out, NULL, _IOFBF, IO_BUFFER_SIZE);
+
+  if (optind == argc) {
+    setvbuf(stdin, NULL, _IOFBF, IO_BUFFER_SIZE);
+    convert(stdin, "<stdin>", out);
+  }
+  for (; optind < argc; optind++) {
+    FILE *in = fopen(argv[optind], "r");
+
+    if (!in) {
+      perror(argv[optind]);
+      return 1;
+    }
+    setvbuf(in, NULL, _IOFBF, IO_BUFFER_SIZE);
+    convert(in, argv[optind], out);
+    fclose(in);
+  }
+
+  if (format == FORMAT_C && !round_trip) write_c(out);
+  if (fclose(out)) {
+    perror("glsnake-convert");
+    return 1;
+  }
+  if (verbose)
+    fprintf(stderr, "%lu models, %lu intersecting, %lu unparseable%s\n",
+            shapes, illegal, unparsed,
+            round_trip ? (mismatched ? ", round trip FAILED" : ", round trip ok")
+                       : "");
+  return (unparsed || mismatched) ? 1 : 0;
+}
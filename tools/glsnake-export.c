@@ -0,0 +1,406 @@
+/* glsnake-export.c - write every model of a catalogue out as a mesh
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/* Each model becomes one indexed triangle mesh made of the same bevelled
+ * prisms glsnake draws, with coincident vertices welded together.  The
+ * catalogue is read a line at a time and handed to a pool of worker
+ * threads through a short queue, so memory use doesn't grow with the size
+ * of the catalogue. */
+
+#include <ctype.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "geometry.h"
+#include "shape.h"
+
+#ifndef ATTRIBUTE_UNUSED
+#define ATTRIBUTE_UNUSED __attribute__((__unused__))
+#endif
+
+#define QUEUE_LENGTH 64
+#define MAX_THREADS 256
+
+#define MAX_VERTICES (NODE_COUNT * SOLID_PRISM_VERTICES)
+#define MAX_TRIANGLES (NODE_COUNT * SOLID_PRISM_TRIANGLES)
+#define WELD_HASH_SIZE 4096
+/* vertices closer than this are the same vertex */
+#define WELD_EPSILON 1e-4
+
+enum format { FORMAT_OBJ, FORMAT_STL, FORMAT_PLY };
+static const char *extension[] = {"obj", "stl", "ply"};
+
+static enum format format = FORMAT_OBJ;
+static float explode = 0.0;
+static const char *out_dir = ".";
+
+struct job {
+  unsigned long number;
+  char name[MODEL_NAME_LENGTH];
+  struct glsnake_shape shape;
+};
+
+static struct job queue[QUEUE_LENGTH];
+static int queue_start, queue_count, queue_closed;
+static pthread_mutex_t queue_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t queue_not_empty = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t queue_not_full = PTHREAD_COND_INITIALIZER;
+/* models that couldn't be read or written; the workers count them too, so
+ * only with queue_lock held */
+static int failures;
+
+static void count_failure(void) {
+  pthread_mutex_lock(&queue_lock);
+  failures++;
+  pthread_mutex_unlock(&queue_lock);
+}
+
+/* a set of points in which each distinct point appears once */
+struct weld {
+  float p[MAX_TRIANGLES * 3][3];
+  int count;
+  int hash[WELD_HASH_SIZE];
+};
+
+struct mesh {
+  struct weld vertices;
+  struct weld normals;
+  int tri[MAX_TRIANGLES][3];
+  int tri_normal[MAX_TRIANGLES];
+  int count;
+};
+
+static void weld_clear(struct weld *w) {
+  w->count = 0;
+  memset(w->hash, -1, sizeof(w->hash));
+}
+
+static int weld(struct weld *w, const float p[3]) {
+  long q[3];
+  unsigned long h;
+  int i;
+
+  for (i = 0; i < 3; i++) q[i] = lround(p[i] / WELD_EPSILON);
+  h = ((unsigned long)q[0] * 73856093UL) ^ ((unsigned long)q[1] * 19349663UL) ^
+      ((unsigned long)q[2] * 83492791UL);
+  for (i = (int)(h % WELD_HASH_SIZE); w->hash[i] >= 0;
+       i = (i + 1) % WELD_HASH_SIZE) {
+    const float *o = w->p[w->hash[i]];
+
+    if (lround(o[0] / WELD_EPSILON) == q[0] &&
+        lround(o[1] / WELD_EPSILON) == q[1] &&
+        lround(o[2] / WELD_EPSILON) == q[2])
+      return w->hash[i];
+  }
+  memcpy(w->p[w->count], p, sizeof(w->p[0]));
+  w->hash[i] = w->count;
+  return w->count++;
+}
+
+static void build_mesh(struct mesh *mesh, const struct glsnake_shape *shape) {
+  float m[NODE_COUNT + 1][16], com[3];
+  int i, f, k;
+
+  weld_clear(&mesh->vertices);
+  weld_clear(&mesh->normals);
+  mesh->count = 0;
+
+  node_transforms(shape, explode, m);
+  snake_centre(m, com);
+
+  for (i = 0; i < NODE_COUNT; i++) {
+    int index[SOLID_PRISM_VERTICES];
+
+    for (k = 0; k < SOLID_PRISM_VERTICES; k++) {
+      float p[3];
+
+      matrix_transform(m[i], solid_prism_v[k], p);
+      p[0] -= com[0];
+      p[1] -= com[1];
+      p[2] -= com[2];
+      index[k] = weld(&mesh->vertices, p);
+    }
+    for (f = 0; f < SOLID_PRISM_FACES; f++) {
+      const struct prism_face *face = &solid_prism_f[f];
+      float n[3], len;
+      int normal;
+
+      matrix_rotate(n, m[i], solid_prism_n[face->normal]);
+      len = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+      n[0] /= len;
+      n[1] /= len;
+      n[2] /= len;
+      normal = weld(&mesh->normals, n);
+
+      for (k = 1; k < face->count - 1; k++) {
+        mesh->tri[mesh->count][0] = index[face->v[0]];
+        mesh->tri[mesh->count][1] = index[face->v[k]];
+        mesh->tri[mesh->count][2] = index[face->v[k + 1]];
+        mesh->tri_normal[mesh->count] = normal;
+        mesh->count++;
+      }
+    }
+  }
+}
+
+static void write_obj(FILE *fp, const char *name, const struct mesh *mesh) {
+  int i;
+
+  fprintf(fp, "# glsnake model\no %s\n", name);
+  for (i = 0; i < mesh->vertices.count; i++)
+    fprintf(fp, "v %.6f %.6f %.6f\n", mesh->vertices.p[i][0],
+            mesh->vertices.p[i][1], mesh->vertices.p[i][2]);
+  for (i = 0; i < mesh->normals.count; i++)
+    fprintf(fp, "vn %.6f %.6f %.6f\n", mesh->normals.p[i][0],
+            mesh->normals.p[i][1], mesh->normals.p[i][2]);
+  for (i = 0; i < mesh->count; i++)
+    fprintf(fp, "f %d//%d %d//%d %d//%d\n", mesh->tri[i][0] + 1,
+            mesh->tri_normal[i] + 1, mesh->tri[i][1] + 1,
+            mesh->tri_normal[i] + 1, mesh->tri[i][2] + 1,
+            mesh->tri_normal[i] + 1);
+}
+
+static void write_le32(FILE *fp, uint32_t v) {
+  unsigned char b[4];
+
+  b[0] = (unsigned char)v;
+  b[1] = (unsigned char)(v >> 8);
+  b[2] = (unsigned char)(v >> 16);
+  b[3] = (unsigned char)(v >> 24);
+  fwrite(b, sizeof(b), 1, fp);
+}
+
+static void write_float(FILE *fp, float f) {
+  uint32_t v;
+
+  memcpy(&v, &f, sizeof(v));
+  write_le32(fp, v);
+}
+
+/* binary STL, which has no index, so the welding only tidies up rounding */
+static void write_stl(FILE *fp, const char *name, const struct mesh *mesh) {
+  char header[80];
+  int i, j, k;
+
+  memset(header, 0, sizeof(header));
+  snprintf(header, sizeof(header), "glsnake model %s", name);
+  fwrite(header, sizeof(header), 1, fp);
+  write_le32(fp, (uint32_t)mesh->count);
+  for (i = 0; i < mesh->count; i++) {
+    for (k = 0; k < 3; k++)
+      write_float(fp, mesh->normals.p[mesh->tri_normal[i]][k]);
+    for (j = 0; j < 3; j++)
+      for (k = 0; k < 3; k++)
+        write_float(fp, mesh->vertices.p[mesh->tri[i][j]][k]);
+    fputc(0, fp);
+    fputc(0, fp);
+  }
+}
+
+static void write_ply(FILE *fp, const char *name, const struct mesh *mesh) {
+  int i;
+
+  fprintf(fp,
+          "ply\nformat ascii 1.0\ncomment glsnake model %s\n"
+          "element vertex %d\nproperty float x\nproperty float y\n"
+          "property float z\nelement face %d\n"
+          "property list uchar int vertex_indices\nend_header\n",
+          name, mesh->vertices.count, mesh->count);
+  for (i = 0; i < mesh->vertices.count; i++)
+    fprintf(fp, "%.6f %.6f %.6f\n", mesh->vertices.p[i][0],
+            mesh->vertices.p[i][1], mesh->vertices.p[i][2]);
+  for (i = 0; i < mesh->count; i++)
+    fprintf(fp, "3 %d %d %d\n", mesh->tri[i][0], mesh->tri[i][1],
+            mesh->tri[i][2]);
+}
+
+static void export(struct mesh *mesh, const struct job *job) {
+  char path[4096], file_name[MODEL_NAME_LENGTH];
+  const char *p;
+  size_t len = 0;
+  FILE *fp;
+
+  for (p = job->name; *p && len < sizeof(file_name) - 1; p++)
+    file_name[len++] = (char)((isalnum((unsigned char)*p) || *p == '-') ? *p
+                                                                        : '_');
+  file_name[len] = '\0';
+  snprintf(path, sizeof(path), "%s/%06lu-%s.%s", out_dir, job->number,
+           len ? file_name : "unnamed", extension[format]);
+
+  build_mesh(mesh, &job->shape);
+
+  if (!(fp = fopen(path, "wb"))) {
+    perror(path);
+    count_failure();
+    return;
+  }
+  switch (format) {
+    case FORMAT_OBJ:
+      write_obj(fp, job->name, mesh);
+      break;
+    case FORMAT_STL:
+      write_stl(fp, job->name, mesh);
+      break;
+    case FORMAT_PLY:
+      write_ply(fp, job->name, mesh);
+      break;
+  }
+  if (fclose(fp)) {
+    perror(path);
+    count_failure();
+  }
+}
+
+static void *worker(void *arg ATTRIBUTE_UNUSED) {
+  struct mesh *mesh = malloc(sizeof(struct mesh));
+  struct job job;
+
+  if (!mesh) {
+    fprintf(stderr, "glsnake-export: out of memory\n");
+    exit(1);
+  }
+  for (;;) {
+    pthread_mutex_lock(&queue_lock);
+    while (!queue_count && !queue_closed)
+      pthread_cond_wait(&queue_not_empty, &queue_lock);
+    if (!queue_count) {
+      pthread_mutex_unlock(&queue_lock);
+      break;
+    }
+    memcpy(&job, &queue[queue_start], sizeof(job));
+    queue_start = (queue_start + 1) % QUEUE_LENGTH;
+    queue_count--;
+    pthread_cond_signal(&queue_not_full);
+    pthread_mutex_unlock(&queue_lock);
+
+    export(mesh, &job);
+  }
+  free(mesh);
+  return NULL;
+}
+
+static void queue_job(const struct job *job) {
+  pthread_mutex_lock(&queue_lock);
+  while (queue_count == QUEUE_LENGTH)
+    pthread_cond_wait(&queue_not_full, &queue_lock);
+  memcpy(&queue[(queue_start + queue_count) % QUEUE_LENGTH], job,
+         sizeof(*job));
+  queue_count++;
+  pthread_cond_signal(&queue_not_empty);
+  pthread_mutex_unlock(&queue_lock);
+}
+
+static void read_models(FILE *in, const char *path, unsigned long *number) {
+  char line[4096];
+  int lineno = 0;
+
+  while (fgets(line, sizeof(line), in)) {
+    struct snake_metrics metrics;
+    struct job job;
+    char *p = line + strspn(line, " \t");
+
+    lineno++;
+    p[strcspn(p, "\r\n")] = '\0';
+    if (*p == '#' || *p == '\0') continue;
+    if (parse_shape(p, job.name, sizeof(job.name), &job.shape)) {
+      fprintf(stderr, "%s:%d: can't parse model\n", path, lineno);
+      count_failure();
+      continue;
+    }
+    calc_snake_metrics_shape(&job.shape, &metrics);
+    if (!metrics.is_legal) {
+      fprintf(stderr, "%s:%d: %s intersects itself\n", path, lineno,
+              job.name);
+      count_failure();
+      continue;
+    }
+    job.number = (*number)++;
+    queue_job(&job);
+  }
+}
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: glsnake-export [-f obj|stl|ply] [-e explode] [-j threads] "
+          "[-o directory] [file...]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv) {
+  pthread_t threads[MAX_THREADS];
+  unsigned long number = 0;
+  long nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+  int c, i;
+
+  while ((c = getopt(argc, argv, "f:e:j:o:")) != -1) {
+    switch (c) {
+      case 'f':
+        for (i = 0; i < 3; i++)
+          if (!strcmp(optarg, extension[i])) format = (enum format)i;
+        if (strcmp(optarg, extension[format])) usage();
+        break;
+      case 'e':
+        explode = (float)atof(optarg);
+        break;
+      case 'j':
+        nthreads = atol(optarg);
+        break;
+      case 'o':
+        out_dir = optarg;
+        break;
+      default:
+        usage();
+    }
+  }
+  if (nthreads < 1) nthreads = 1;
+  if (nthreads > MAX_THREADS) nthreads = MAX_THREADS;
+
+  for (i = 0; i < nthreads; i++)
+    if (pthread_create(&threads[i], NULL, worker, NULL)) {
+      perror("pthread_create");
+      return 1;
+    }
+
+  if (optind == argc) read_models(stdin, "<stdin>", &number);
+  for (; optind < argc; optind++) {
+    FILE *in = fopen(argv[optind], "r");
+
+    if (!in) {
+      perror(argv[optind]);
+      count_failure();
+      continue;
+    }
+    read_models(in, argv[optind], &number);
+    fclose(in);
+  }
+
+  pthread_mutex_lock(&queue_lock);
+  queue_closed = 1;
+  pthread_cond_broadcast(&queue_not_empty);
+  pthread_mutex_unlock(&queue_lock);
+  for (i = 0; i < nthreads; i++) pthread_join(threads[i], NULL);
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,106 @@
+/* glsnake-joints.c - read back a joint log written by glsnake -joint-log
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* Prints frames of a joint log, one a line: the frame number, the spins
+ * about y and z and then each joint, in degrees.  Any frame can be had
+ * without reading those before it. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "jointlog.h"
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: glsnake-joints [-i] [-f frame] [-n frames] log\n"
+          "  -i  summarise the log instead\n"
+          "  -f  start from this frame (default the first)\n"
+          "  -n  print this many frames (default all)\n");
+  exit(2);
+}
+
+static void summarise(struct joint_log_reader *log, const char *path) {
+  unsigned long first, frames, logged = 0, gaps = 0, expected = 0;
+  long i;
+
+  for (i = 0; i < log->blocks; i++) {
+    if (joint_log_read_block(log, i, &first, &frames)) break;
+    if (i && first != expected) gaps++;
+    expected = first + frames;
+    logged += frames;
+  }
+  printf("%s: %lu frames in %ld blocks, %.2f bytes a frame, %lu gaps\n",
+         path, logged, log->blocks,
+         logged ? (double)log->blocks * JOINT_LOG_BLOCK / logged : 0.0, gaps);
+}
+
+int main(int argc, char **argv) {
+  struct joint_log_reader log;
+  unsigned long first, end, frame, count = 0;
+  int c, info = 0, from = 0, err;
+
+  while ((c = getopt(argc, argv, "if:n:")) != -1) {
+    switch (c) {
+      case 'i':
+        info = 1;
+        break;
+      case 'f':
+        frame = strtoul(optarg, NULL, 10);
+        from = 1;
+        break;
+      case 'n':
+        count = strtoul(optarg, NULL, 10);
+        break;
+      default:
+        usage();
+    }
+  }
+  if (optind != argc - 1) usage();
+
+  if ((err = joint_log_read_open(&log, argv[optind]))) {
+    if (err == -1)
+      perror(argv[optind]);
+    else
+      fprintf(stderr, "glsnake-joints: %s isn't a joint log\n", argv[optind]);
+    return 1;
+  }
+  if (info) {
+    summarise(&log, argv[optind]);
+  } else if (!joint_log_read_range(&log, &first, &end)) {
+    if (!from) frame = first;
+    if (count && frame + count < end) end = frame + count;
+    for (; frame < end; frame++) {
+      float value[JOINT_LOG_FIELDS];
+      int i;
+
+      /* frames dropped while logging */
+      if (joint_log_read_frame(&log, frame, value)) continue;
+      printf("%lu %.2f %.2f", frame, value[JOINT_LOG_JOINTS],
+             value[JOINT_LOG_JOINTS + 1]);
+      for (i = 0; i < JOINT_LOG_JOINTS; i++) printf(" %.2f", value[i]);
+      putchar('\n');
+    }
+  }
+  joint_log_read_close(&log);
+  return 0;
+}
@@ -0,0 +1,254 @@
+/* glsnake-render.c - draw models to image files without a GPU
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* Draws each model of a catalogue with the software renderer, as glsnake
+ * shows it when it first appears, and writes it out as a PPM.  With -r the
+ * models are ray traced instead, with soft shadows and ambient occlusion,
+ * for better looking stills.  With -b it instead spins the first model for
+ * a number of frames and reports how long each took, to compare against GL
+ * drivers. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "geometry.h"
+#include "raster.h"
+#include "shape.h"
+#include "trace.h"
+
+/* as in glsnake */
+#define EXPLODE 0.03
+#define ZOOM 25.0
+#define YSPIN 60.0
+#define ZSPIN -45.0
+#define YANGVEL 0.10
+#define ZANGVEL 0.14
+#define FRAME_MSEC 30
+
+static const float colour[2][2][4] = {
+    /* cyclic - green */
+    {{0.4, 0.8, 0.2, 0.6}, {1.0, 1.0, 1.0, 0.6}},
+    /* acyclic - blue */
+    {{0.3, 0.1, 0.9, 0.6}, {1.0, 1.0, 1.0, 0.6}}};
+
+static int width = 640, height = 480;
+static float explode = EXPLODE;
+static int transparent = 0;
+static const char *out_dir = ".";
+static int threads = 0;
+/* rays per pixel when ray tracing, or 0 to use the software renderer */
+static int trace_samples = 0;
+
+static struct raster *raster;
+static unsigned char *traced;
+
+static void render(const struct glsnake_shape *shape, float yspin, float zspin) {
+  float m[NODE_COUNT + 1][16], rot[16], look[16];
+  float node_colour[NODE_COUNT][4];
+  struct raster_scene scene;
+  struct snake_metrics metrics;
+  int i;
+
+  calc_snake_metrics_shape(shape, &metrics);
+  for (i = 0; i < NODE_COUNT; i++)
+    memcpy(node_colour[i], colour[metrics.is_cyclic ? 0 : 1][(i + 1) % 2],
+           sizeof(node_colour[i]));
+
+  node_transforms(shape, explode, m);
+  memset(&scene, 0, sizeof(scene));
+  scene.m = m;
+  snake_centre(m, scene.com);
+  scene.colour = (const float(*)[4])node_colour;
+  scene.blend = transparent;
+
+  matrix_rotation(scene.modelview, yspin, 0.0, 1.0, 0.0);
+  matrix_rotation(rot, zspin, 0.0, 0.0, 1.0);
+  matrix_multiply(scene.modelview, scene.modelview, rot);
+
+  /* gluPerspective then gluLookAt from 20 units down the z axis */
+  matrix_perspective(scene.projection, ZOOM, (float)width / height, 0.05,
+                     100.0);
+  matrix_identity(look);
+  look[14] = -20.0;
+  matrix_multiply(scene.projection, scene.projection, look);
+
+  if (trace_samples) {
+    struct trace_scene ts;
+
+    memset(&ts, 0, sizeof(ts));
+    ts.m = m;
+    memcpy(ts.com, scene.com, sizeof(ts.com));
+    ts.colour = scene.colour;
+    memcpy(ts.modelview, scene.modelview, sizeof(ts.modelview));
+    ts.fovy = ZOOM;
+    ts.samples = trace_samples;
+    ts.threads = threads;
+    if (trace_image(&ts, width, height, traced)) {
+      fprintf(stderr, "glsnake-render: out of memory\n");
+      exit(1);
+    }
+    return;
+  }
+
+  raster_draw(raster, &scene);
+}
+
+static int write_traced(FILE *fp) {
+  fprintf(fp, "P6\n%d %d\n255\n", width, height);
+  fwrite(traced, 3, (size_t)width * height, fp);
+  return ferror(fp) ? -1 : 0;
+}
+
+static void write_model(unsigned long number, const char *name) {
+  char path[4096], file_name[MODEL_NAME_LENGTH];
+  const char *p;
+  size_t len = 0;
+  FILE *fp;
+
+  for (p = name; *p && len < sizeof(file_name) - 1; p++)
+    file_name[len++] = (char)((isalnum((unsigned char)*p) || *p == '-') ? *p
+                                                                        : '_');
+  file_name[len] = '\0';
+  snprintf(path, sizeof(path), "%s/%06lu-%s.ppm", out_dir, number,
+           len ? file_name : "unnamed");
+
+  if (!(fp = fopen(path, "wb")) ||
+      (trace_samples ? write_traced(fp) : raster_write_ppm(raster, fp)) ||
+      fclose(fp)) {
+    perror(path);
+    exit(1);
+  }
+}
+
+static double msecs(void) {
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+static void benchmark(const struct glsnake_shape *shape, int frames) {
+  float yspin = YSPIN, zspin = ZSPIN;
+  double start = msecs();
+  int i;
+
+  for (i = 0; i < frames; i++) {
+    render(shape, yspin, zspin);
+    yspin += 360.0 * YANGVEL * FRAME_MSEC / 1000.0;
+    zspin += 360.0 * ZANGVEL * FRAME_MSEC / 1000.0;
+  }
+  printf("%d frames at %dx%d: %.3f ms/frame\n", frames, width, height,
+         (msecs() - start) / frames);
+}
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: glsnake-render [-s widthxheight] [-e explode] [-t] "
+          "[-r rays] [-j threads] [-o directory] [-b frames] [file...]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv) {
+  int c, frames = 0, benchmarked = 0, file;
+  unsigned long number = 0;
+
+  while ((c = getopt(argc, argv, "s:e:tr:j:o:b:")) != -1) {
+    switch (c) {
+      case 's':
+        if (sscanf(optarg, "%dx%d", &width, &height) != 2 || width < 1 ||
+            height < 1)
+          usage();
+        break;
+      case 'e':
+        explode = (float)atof(optarg);
+        break;
+      case 't':
+        transparent = 1;
+        break;
+      case 'r':
+        if ((trace_samples = atoi(optarg)) < 1) usage();
+        break;
+      case 'j':
+        threads = atoi(optarg);
+        break;
+      case 'o':
+        out_dir = optarg;
+        break;
+      case 'b':
+        frames = atoi(optarg);
+        break;
+      default:
+        usage();
+    }
+  }
+
+  if (trace_samples ? !(traced = malloc((size_t)width * height * 3))
+                    : !(raster = raster_new(threads)) ||
+                          raster_resize(raster, width, height)) {
+    fprintf(stderr, "glsnake-render: out of memory\n");
+    return 1;
+  }
+
+  /* with no files, read standard input */
+  for (file = optind;
+       !benchmarked && (file < argc || (file == optind && optind == argc));
+       file++) {
+    FILE *in = file < argc ? fopen(argv[file], "r") : stdin;
+    const char *path = file < argc ? argv[file] : "<stdin>";
+    char line[4096];
+    int lineno = 0;
+
+    if (!in) {
+      perror(path);
+      return 1;
+    }
+    while (fgets(line, sizeof(line), in)) {
+      struct glsnake_shape shape;
+      char name[MODEL_NAME_LENGTH];
+      char *p = line + strspn(line, " \t");
+
+      lineno++;
+      p[strcspn(p, "\r\n")] = '\0';
+      if (*p == '#' || *p == '\0') continue;
+      if (parse_shape(p, name, sizeof(name), &shape)) {
+        fprintf(stderr, "%s:%d: can't parse model\n", path, lineno);
+        continue;
+      }
+      if (frames > 0) {
+        benchmark(&shape, frames);
+        benchmarked = 1;
+        break;
+      }
+      render(&shape, YSPIN, ZSPIN);
+      write_model(number++, name);
+    }
+    if (in != stdin) fclose(in);
+  }
+
+  if (raster) raster_free(raster);
+  free(traced);
+  return 0;
+}
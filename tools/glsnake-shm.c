@@ -0,0 +1,235 @@
+/* glsnake-shm.c - read, or stress, the state glsnake publishes with -shm
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* Prints the latest frame glsnake published with -shm.  With -t it
+ * instead reads with that many threads at once, as fast as they can, and
+ * checks every frame read is whole: the node transforms and centre must be
+ * the ones its joints give.  -w writes frames as fast as it can too, so no
+ * glsnake is needed. */
+
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "geometry.h"
+#include "shmstate.h"
+
+struct reader_stats {
+  unsigned long reads, retries, frames, torn, backwards;
+};
+
+static const char *name;
+static volatile int stop;
+static struct shm_state_reader reader;
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: glsnake-shm [-t threads] [-s seconds] [-w] name\n"
+          "  -t  read with this many threads, checking every frame\n"
+          "  -s  for this many seconds (default 5)\n"
+          "  -w  write frames too, instead of glsnake\n");
+  exit(2);
+}
+
+static double now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* whether m and com are what joint and explode give */
+static int whole(const struct glsnake_state *state) {
+  struct glsnake_shape shape;
+  float m[NODE_COUNT + 1][16], com[3];
+  int i, k;
+
+  memcpy(shape.node, state->joint, sizeof(shape.node));
+  node_transforms(&shape, state->explode, m);
+  snake_centre(m, com);
+  for (i = 0; i <= NODE_COUNT; i++)
+    for (k = 0; k < 16; k++)
+      if (fabs(m[i][k] - state->m[i][k]) > 1e-4) return 0;
+  for (k = 0; k < 3; k++)
+    if (fabs(com[k] - state->com[k]) > 1e-4) return 0;
+  return 1;
+}
+
+static void *read_frames(void *arg) {
+  struct reader_stats *stats = arg;
+  struct glsnake_state state;
+  uint64_t last = 0;
+
+  while (!stop) {
+    unsigned seq;
+
+    /* the zero copy interface, copying only so as to check afterwards */
+    for (;;) {
+      seq = shm_state_read_begin(&reader);
+      memcpy(&state, reader.state, sizeof(state));
+      if (!shm_state_read_retry(&reader, seq)) break;
+      stats->retries++;
+    }
+    stats->reads++;
+    if (!whole(&state)) stats->torn++;
+    if (state.frame < last) stats->backwards++;
+    if (state.frame != last) stats->frames++;
+    last = state.frame;
+  }
+  return NULL;
+}
+
+static void *write_frames(void *arg) {
+  unsigned long *frames = arg;
+  unsigned int seed = 1;
+
+  while (!stop) {
+    struct glsnake_state state;
+    struct glsnake_shape shape;
+    int i;
+
+    /* as glsnake does, only hold readers up for the copy */
+    memset(&state, 0, sizeof(state));
+    state.frame = ++*frames;
+    state.seconds = now();
+    for (i = 0; i < NODE_COUNT; i++)
+      shape.node[i] = state.joint[i] = (float)(rand_r(&seed) % 360);
+    state.explode = (float)(rand_r(&seed) % 100) / 1000;
+    node_transforms(&shape, state.explode, state.m);
+    snake_centre(state.m, state.com);
+    memcpy(shm_state_begin(), &state, sizeof(state));
+    shm_state_end();
+  }
+  return NULL;
+}
+
+static void print_state(void) {
+  struct glsnake_state state;
+  int i;
+
+  if (shm_state_read(&reader, &state)) {
+    fprintf(stderr, "glsnake-shm: the writer died part way through a frame\n");
+    exit(1);
+  }
+  printf("writer %lu, frame %llu at %.3f s\n",
+         (unsigned long)reader.segment->writer,
+         (unsigned long long)state.frame, state.seconds);
+  printf("model %d \"%s\"%s%s\n", state.preset_index, state.name,
+         state.morphing ? ", morphing" : "", state.paused ? ", paused" : "");
+  printf("legal %d, cyclic %d, last turn %.0f\n", state.is_legal,
+         state.is_cyclic, state.last_turn);
+  printf("spin %.2f %.2f, explode %.3f, centre %.3f %.3f %.3f\n", state.yspin,
+         state.zspin, state.explode, state.com[0], state.com[1], state.com[2]);
+  printf("joints");
+  for (i = 0; i < NODE_COUNT - 1; i++) printf(" %.1f", state.joint[i]);
+  putchar('\n');
+}
+
+int main(int argc, char **argv) {
+  pthread_t *threads, writer;
+  struct reader_stats *stats, total;
+  unsigned long written = 0;
+  double seconds = 5.0, start;
+  int c, n = 0, write = 0, i, err;
+
+  while ((c = getopt(argc, argv, "t:s:w")) != -1) {
+    switch (c) {
+      case 't':
+        if ((n = atoi(optarg)) <= 0) usage();
+        break;
+      case 's':
+        if ((seconds = atof(optarg)) <= 0.0) usage();
+        break;
+      case 'w':
+        write = 1;
+        break;
+      default:
+        usage();
+    }
+  }
+  if (optind != argc - 1) usage();
+  name = argv[optind];
+
+  if (write && shm_state_open(name)) {
+    perror(name);
+    return 1;
+  }
+  if ((err = shm_state_attach(&reader, name))) {
+    if (err == -1)
+      perror(name);
+    else
+      fprintf(stderr, "glsnake-shm: %s isn't glsnake's state\n", name);
+    return 1;
+  }
+  if (!n) {
+    print_state();
+    return 0;
+  }
+
+  threads = calloc((size_t)n, sizeof(*threads));
+  stats = calloc((size_t)n, sizeof(*stats));
+  if (!threads || !stats) {
+    fprintf(stderr, "glsnake-shm: out of memory\n");
+    return 1;
+  }
+  if (write && pthread_create(&writer, NULL, write_frames, &written)) {
+    fprintf(stderr, "glsnake-shm: can't start the writer\n");
+    return 1;
+  }
+  for (i = 0; i < n; i++)
+    if (pthread_create(&threads[i], NULL, read_frames, &stats[i])) {
+      fprintf(stderr, "glsnake-shm: can't start reader %d\n", i);
+      return 1;
+    }
+  start = now();
+  usleep((useconds_t)(seconds * 1e6));
+  stop = 1;
+  memset(&total, 0, sizeof(total));
+  for (i = 0; i < n; i++) {
+    pthread_join(threads[i], NULL);
+    total.reads += stats[i].reads;
+    total.retries += stats[i].retries;
+    total.frames += stats[i].frames;
+    total.torn += stats[i].torn;
+    total.backwards += stats[i].backwards;
+  }
+  seconds = now() - start;
+  if (write) pthread_join(writer, NULL);
+
+  if (write) printf("%.0f frames written a second\n", written / seconds);
+  printf("%d readers: %.0f reads a second, %.0f new frames a second each, "
+         "%.2f%% retried\n",
+         n, total.reads / seconds, total.frames / seconds / n,
+         total.reads ? 100.0 * total.retries / (total.reads + total.retries)
+                     : 0.0);
+  printf("%lu torn, %lu out of order\n", total.torn, total.backwards);
+  shm_state_detach(&reader);
+  if (write) shm_state_close();
+  free(threads);
+  free(stats);
+  return total.torn || total.backwards ? 1 : 0;
+}
@@ -0,0 +1,136 @@
+/* glsnake-stats.c - dump and add up the counters of every running glsnake
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* Reads every stats file glsnake -stats has left in a directory and
+ * prints a line for each glsnake still running, then one for all of them
+ * together, with the frame time percentiles taken over all their frames. */
+
+#include <dirent.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "stats.h"
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: glsnake-stats [-a] [-k] dir\n"
+          "  -a  only print the total\n"
+          "  -k  remove files left by glsnakes that are no longer running\n");
+  exit(2);
+}
+
+static void print_header(void) {
+  printf("%8s %8s %10s %7s %8s %8s %8s %6s %8s %6s %6s\n", "pid", "uptime",
+         "frames", "fps", "mean ms", "p99 ms", "dropped", "cpu%", "morphs",
+         "hit%", "preset");
+}
+
+static void print_line(const char *pid, const struct glsnake_stats *s,
+                       double uptime, const char *preset) {
+  uint64_t checks = s->metrics_hits + s->metrics_misses;
+
+  printf("%8s %8.0f %10llu %7.1f %8.2f %8.2f %8llu %6.1f %8llu %6.1f %6s\n",
+         pid,
+         uptime, (unsigned long long)s->frames,
+         uptime > 0.0 ? s->frames / uptime : 0.0,
+         s->frames ? s->frame_usec / 1000.0 / s->frames : 0.0,
+         stats_percentile(s->histogram, 0.99), (unsigned long long)s->dropped,
+         uptime > 0.0 ? s->cpu_usec / 1e4 / uptime : 0.0,
+         (unsigned long long)s->morphs,
+         checks ? 100.0 * s->metrics_hits / checks : 0.0, preset);
+}
+
+int main(int argc, char **argv) {
+  struct glsnake_stats s, total;
+  double uptime, total_uptime = 0.0;
+  const char *dir;
+  struct dirent *entry;
+  int c, only_total = 0, remove_stale = 0, running = 0, i;
+  DIR *d;
+
+  while ((c = getopt(argc, argv, "ak")) != -1) {
+    switch (c) {
+      case 'a':
+        only_total = 1;
+        break;
+      case 'k':
+        remove_stale = 1;
+        break;
+      default:
+        usage();
+    }
+  }
+  if (optind != argc - 1) usage();
+  dir = argv[optind];
+  if (!(d = opendir(dir))) {
+    perror(dir);
+    return 1;
+  }
+
+  memset(&total, 0, sizeof(total));
+  if (!only_total) print_header();
+  while ((entry = readdir(d))) {
+    size_t len = strlen(entry->d_name);
+    char path[1024], pid[16], preset[16];
+
+    if (len <= strlen(STATS_SUFFIX) ||
+        strcmp(entry->d_name + len - strlen(STATS_SUFFIX), STATS_SUFFIX))
+      continue;
+    snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+    if (stats_read(path, &s)) continue;
+    if (kill((pid_t)s.pid, 0) && errno == ESRCH) {
+      if (remove_stale && unlink(path)) perror(path);
+      continue;
+    }
+
+    running++;
+    /* as of the last time the counters were brought up to date */
+    uptime = (double)(s.updated - s.started);
+    total_uptime += uptime;
+    total.frames += s.frames;
+    total.morphs += s.morphs;
+    total.metrics_hits += s.metrics_hits;
+    total.metrics_misses += s.metrics_misses;
+    total.frame_usec += s.frame_usec;
+    total.dropped += s.dropped;
+    total.cpu_usec += s.cpu_usec;
+    for (i = 0; i < STATS_BUCKETS; i++) total.histogram[i] += s.histogram[i];
+    if (!only_total) {
+      snprintf(pid, sizeof(pid), "%lu", (unsigned long)s.pid);
+      snprintf(preset, sizeof(preset), "%lld", (long long)s.preset);
+      print_line(pid, &s, uptime, preset);
+    }
+  }
+  closedir(d);
+
+  if (only_total) print_header();
+  /* rates are per glsnake, on average */
+  print_line("total", &total, running ? total_uptime / running : 0.0, "-");
+  if (running > 1)
+    printf("(%d running; fps and cpu%% are summed over them)\n", running);
+  return 0;
+}
@@ -0,0 +1,447 @@
+/* glsnake-thumbs.c - draw a thumbnail of every model into one atlas image
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/* Every model of a catalogue is drawn with the software renderer, at the
+ * orientation glsnake first shows it in and scaled to fill a square, into
+ * one cell of an atlas.  The atlas is a PPM whose sides are powers of two,
+ * so that glsnake -atlas can load it straight into a texture; comments in
+ * its header give the thumbnail size and the packed shape in each cell, in
+ * order.
+ *
+ * Each model is drawn by whichever worker thread gets to it first, each
+ * with its own single threaded renderer.  Thumbnails are kept in a cache
+ * directory, named after the packed shape and the settings they were drawn
+ * with, so drawing the atlas again only draws the models it hasn't seen
+ * before. */
+
+#include <ctype.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "geometry.h"
+#include "raster.h"
+#include "shape.h"
+
+/* as in glsnake */
+#define EXPLODE 0.03
+#define YSPIN 60.0
+#define ZSPIN -45.0
+#define DISTANCE 20.0
+
+#define MAX_THREADS 256
+#define MIN_SIZE 8
+#define MAX_SIZE 1024
+/* bump this when thumbnails are drawn differently, so that old ones in the
+ * cache are no longer used */
+#define CACHE_VERSION 1
+
+static const float colour[2][2][4] = {
+    /* cyclic - green */
+    {{0.4, 0.8, 0.2, 1.0}, {1.0, 1.0, 1.0, 1.0}},
+    /* acyclic - blue */
+    {{0.3, 0.1, 0.9, 1.0}, {1.0, 1.0, 1.0, 1.0}}};
+
+static int size = 64;
+static float explode = EXPLODE;
+static const char *cache_dir;
+static const char *thumb_dir;
+
+struct thumb {
+  char name[MODEL_NAME_LENGTH];
+  struct glsnake_shape shape;
+  uint64_t packed;
+};
+
+static struct thumb *thumbs;
+static size_t thumb_count, thumb_alloc;
+
+/* the atlas, top row first as a PPM has it */
+static unsigned char *atlas;
+static int atlas_columns, atlas_width, atlas_height;
+
+static size_t next_thumb;
+static unsigned long drawn, cached;
+static int failures;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void cache_path(char *path, size_t len, uint64_t packed) {
+  snprintf(path, len, "%s/%016" PRIx64 "-%d-%d-v%d.ppm", cache_dir, packed,
+           size, (int)(explode * 1000.0 + 0.5), CACHE_VERSION);
+}
+
+/* copy a size x size RGB image, top row first, into its cell */
+static void put_cell(size_t index, const unsigned char *rgb) {
+  unsigned char *cell =
+      atlas + ((index / atlas_columns) * size * (size_t)atlas_width +
+               (index % atlas_columns) * size) * 3;
+  int y;
+
+  for (y = 0; y < size; y++)
+    memcpy(cell + (size_t)y * atlas_width * 3, rgb + (size_t)y * size * 3,
+           (size_t)size * 3);
+}
+
+/* returns 0 if a thumbnail of the right size was read into rgb */
+static int read_cached(const char *path, unsigned char *rgb) {
+  FILE *fp = fopen(path, "rb");
+  int w, h, max, ok;
+
+  if (!fp) return -1;
+  ok = fscanf(fp, "P6 %d %d %d", &w, &h, &max) == 3 && w == size &&
+       h == size && max == 255 && fgetc(fp) == '\n' &&
+       fread(rgb, 3, (size_t)size * size, fp) == (size_t)size * size;
+  fclose(fp);
+  return ok ? 0 : -1;
+}
+
+static int write_ppm(const char *path, const unsigned char *rgb) {
+  FILE *fp = fopen(path, "wb");
+
+  if (!fp) return -1;
+  fprintf(fp, "P6\n%d %d\n255\n", size, size);
+  fwrite(rgb, 3, (size_t)size * size, fp);
+  if (ferror(fp)) {
+    fclose(fp);
+    return -1;
+  }
+  return fclose(fp) ? -1 : 0;
+}
+
+/* write to a temporary file and rename it, so that another run reading the
+ * cache at the same time never sees half a thumbnail */
+static void write_cached(const char *path, const unsigned char *rgb,
+                         int worker) {
+  char tmp[4096 + 64];
+
+  snprintf(tmp, sizeof(tmp), "%s.%ld.%d", path, (long)getpid(), worker);
+  if (write_ppm(tmp, rgb) || rename(tmp, path)) {
+    perror(tmp);
+    remove(tmp);
+  }
+}
+
+static void draw(struct raster *raster, const struct glsnake_shape *shape,
+                 unsigned char *rgb) {
+  float m[NODE_COUNT + 1][16], rot[16], look[16];
+  float node_colour[NODE_COUNT][4];
+  float radius = 0.0;
+  struct raster_scene scene;
+  struct snake_metrics metrics;
+  const unsigned char *pixels;
+  int i, x, y;
+
+  calc_snake_metrics_shape(shape, &metrics);
+  for (i = 0; i < NODE_COUNT; i++)
+    memcpy(node_colour[i], colour[metrics.is_cyclic ? 0 : 1][(i + 1) % 2],
+           sizeof(node_colour[i]));
+
+  node_transforms(shape, explode, m);
+  memset(&scene, 0, sizeof(scene));
+  scene.m = m;
+  snake_centre(m, scene.com);
+  scene.colour = (const float(*)[4])node_colour;
+
+  /* the snake fits in a sphere around its centre of mass */
+  for (i = 1; i <= NODE_COUNT; i++) {
+    static const float middle[3] = {0.5, 0.5, 0.5};
+    float p[3];
+
+    matrix_transform(m[i], middle, p);
+    p[0] -= scene.com[0];
+    p[1] -= scene.com[1];
+    p[2] -= scene.com[2];
+    if (sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]) > radius)
+      radius = sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+  }
+  radius += M_SQRT1_2 + explode;
+
+  matrix_rotation(scene.modelview, YSPIN, 0.0, 1.0, 0.0);
+  matrix_rotation(rot, ZSPIN, 0.0, 0.0, 1.0);
+  matrix_multiply(scene.modelview, scene.modelview, rot);
+
+  /* look from far enough away that the sphere just fills the square */
+  matrix_perspective(scene.projection,
+                     2.0 * asin(radius / DISTANCE) * 180.0 / M_PI, 1.0,
+                     DISTANCE - radius, DISTANCE + radius);
+  matrix_identity(look);
+  look[14] = -DISTANCE;
+  matrix_multiply(scene.projection, scene.projection, look);
+
+  raster_draw(raster, &scene);
+
+  /* RGBA bottom row first to RGB top row first */
+  pixels = raster_pixels(raster);
+  for (y = 0; y < size; y++)
+    for (x = 0; x < size; x++)
+      memcpy(rgb + ((size_t)(size - 1 - y) * size + x) * 3,
+             pixels + ((size_t)y * size + x) * 4, 3);
+}
+
+static void write_thumb(size_t index, const unsigned char *rgb) {
+  char path[4096], file_name[MODEL_NAME_LENGTH];
+  const char *p;
+  size_t len = 0;
+
+  for (p = thumbs[index].name; *p && len < sizeof(file_name) - 1; p++)
+    file_name[len++] = (char)((isalnum((unsigned char)*p) || *p == '-') ? *p
+                                                                        : '_');
+  file_name[len] = '\0';
+  snprintf(path, sizeof(path), "%s/%06lu-%s.ppm", thumb_dir,
+           (unsigned long)index, len ? file_name : "unnamed");
+  if (write_ppm(path, rgb)) {
+    perror(path);
+    pthread_mutex_lock(&lock);
+    failures++;
+    pthread_mutex_unlock(&lock);
+  }
+}
+
+static void *worker(void *arg) {
+  int id = (int)(intptr_t)arg;
+  struct raster *raster = raster_new(1);
+  unsigned char *rgb = malloc((size_t)size * size * 3);
+
+  if (!raster || !rgb || raster_resize(raster, size, size)) {
+    fprintf(stderr, "glsnake-thumbs: out of memory\n");
+    exit(1);
+  }
+
+  for (;;) {
+    char path[4096];
+    size_t index;
+    int hit;
+
+    pthread_mutex_lock(&lock);
+    index = next_thumb++;
+    pthread_mutex_unlock(&lock);
+    if (index >= thumb_count) break;
+
+    if (cache_dir) cache_path(path, sizeof(path), thumbs[index].packed);
+    hit = cache_dir && !read_cached(path, rgb);
+    if (!hit) {
+      draw(raster, &thumbs[index].shape, rgb);
+      if (cache_dir) write_cached(path, rgb, id);
+    }
+
+    /* each cell belongs to one thread, so no locking is needed */
+    put_cell(index, rgb);
+    if (thumb_dir) write_thumb(index, rgb);
+
+    pthread_mutex_lock(&lock);
+    if (hit)
+      cached++;
+    else
+      drawn++;
+    pthread_mutex_unlock(&lock);
+  }
+
+  raster_free(raster);
+  free(rgb);
+  return NULL;
+}
+
+static void read_models(FILE *in, const char *path) {
+  char line[4096];
+  int lineno = 0;
+
+  while (fgets(line, sizeof(line), in)) {
+    struct thumb thumb;
+    char *p = line + strspn(line, " \t");
+
+    lineno++;
+    p[strcspn(p, "\r\n")] = '\0';
+    if (*p == '#' || *p == '\0') continue;
+    if (parse_shape(p, thumb.name, sizeof(thumb.name), &thumb.shape) ||
+        pack_shape(&thumb.shape, &thumb.packed)) {
+      fprintf(stderr, "%s:%d: can't parse model\n", path, lineno);
+      failures++;
+      continue;
+    }
+    if (thumb_count == thumb_alloc) {
+      struct thumb *more;
+
+      thumb_alloc = thumb_alloc ? thumb_alloc * 2 : 256;
+      if (!(more = realloc(thumbs, thumb_alloc * sizeof(*thumbs)))) {
+        fprintf(stderr, "glsnake-thumbs: out of memory\n");
+        exit(1);
+      }
+      thumbs = more;
+    }
+    thumbs[thumb_count++] = thumb;
+  }
+}
+
+/* Lay the cells out in a power of two columns, about as many as there are
+ * rows, and round the height up to a power of two as well. */
+static void layout(void) {
+  size_t rows;
+
+  for (atlas_columns = 1;
+       (size_t)atlas_columns * atlas_columns < thumb_count;
+       atlas_columns *= 2)
+    ;
+  rows = (thumb_count + atlas_columns - 1) / atlas_columns;
+  atlas_width = atlas_columns * size;
+  for (atlas_height = size; (size_t)atlas_height < rows * size;
+       atlas_height *= 2)
+    ;
+}
+
+static int write_atlas(const char *path) {
+  FILE *fp = fopen(path, "wb");
+  size_t i;
+
+  if (!fp) return -1;
+  fprintf(fp, "P6\n# glsnake-thumbs %d\n", size);
+  for (i = 0; i < thumb_count; i++)
+    fprintf(fp, "# %016" PRIx64 " %s\n", thumbs[i].packed, thumbs[i].name);
+  fprintf(fp, "%d %d\n255\n", atlas_width, atlas_height);
+  fwrite(atlas, 3, (size_t)atlas_width * atlas_height, fp);
+  if (ferror(fp)) {
+    fclose(fp);
+    return -1;
+  }
+  return fclose(fp) ? -1 : 0;
+}
+
+/* the default cache, following the XDG base directory spec */
+static const char *default_cache_dir(void) {
+  static char path[4096];
+  const char *xdg = getenv("XDG_CACHE_HOME");
+  const char *home = getenv("HOME");
+
+  if (xdg && *xdg) {
+    snprintf(path, sizeof(path), "%s/glsnake-thumbs", xdg);
+  } else if (home && *home) {
+    snprintf(path, sizeof(path), "%s/.cache", home);
+    mkdir(path, 0755);
+    snprintf(path, sizeof(path), "%s/.cache/glsnake-thumbs", home);
+  } else {
+    return NULL;
+  }
+  return path;
+}
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: glsnake-thumbs [-s size] [-e explode] [-j threads] "
+          "[-c cache | -n] [-p directory] [-o atlas.ppm] [file...]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv) {
+  pthread_t threads[MAX_THREADS];
+  long nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+  const char *out = "glsnake-atlas.ppm";
+  int c, i, no_cache = 0;
+
+  while ((c = getopt(argc, argv, "s:e:j:c:np:o:")) != -1) {
+    switch (c) {
+      case 's':
+        size = atoi(optarg);
+        /* the atlas has to be a power of two on each side */
+        if (size < MIN_SIZE || size > MAX_SIZE || (size & (size - 1)))
+          usage();
+        break;
+      case 'e':
+        explode = (float)atof(optarg);
+        break;
+      case 'j':
+        nthreads = atol(optarg);
+        break;
+      case 'c':
+        cache_dir = optarg;
+        break;
+      case 'n':
+        no_cache = 1;
+        break;
+      case 'p':
+        thumb_dir = optarg;
+        break;
+      case 'o':
+        out = optarg;
+        break;
+      default:
+        usage();
+    }
+  }
+  if (nthreads < 1) nthreads = 1;
+  if (nthreads > MAX_THREADS) nthreads = MAX_THREADS;
+
+  if (no_cache)
+    cache_dir = NULL;
+  else if (!cache_dir)
+    cache_dir = default_cache_dir();
+  if (cache_dir && mkdir(cache_dir, 0755) && errno != EEXIST) {
+    perror(cache_dir);
+    cache_dir = NULL;
+  }
+
+  if (optind == argc) read_models(stdin, "<stdin>");
+  for (; optind < argc; optind++) {
+    FILE *in = fopen(argv[optind], "r");
+
+    if (!in) {
+      perror(argv[optind]);
+      failures++;
+      continue;
+    }
+    read_models(in, argv[optind]);
+    fclose(in);
+  }
+  if (!thumb_count) {
+    fprintf(stderr, "glsnake-thumbs: no models\n");
+    return 1;
+  }
+
+  layout();
+  if (!(atlas = calloc((size_t)atlas_width * atlas_height, 3))) {
+    fprintf(stderr, "glsnake-thumbs: out of memory\n");
+    return 1;
+  }
+
+  if ((size_t)nthreads > thumb_count) nthreads = (long)thumb_count;
+  for (i = 0; i < nthreads; i++)
+    if (pthread_create(&threads[i], NULL, worker, (void *)(intptr_t)i)) {
+      perror("pthread_create");
+      return 1;
+    }
+  for (i = 0; i < nthreads; i++) pthread_join(threads[i], NULL);
+
+  if (write_atlas(out)) {
+    perror(out);
+    return 1;
+  }
+  fprintf(stderr, "%s: %dx%d, %lu drawn, %lu from the cache\n", out,
+          atlas_width, atlas_height, drawn, cached);
+
+  free(atlas);
+  free(thumbs);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,467 @@
+/* trace.c - a ray tracer for high quality stills of the snake
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+/* The transformed prisms go into a bounding volume hierarchy, and the image
+ * is traced a tile at a time by as many threads as there are processors.
+ * Lights are the two gl_init sets up, given a little size so that shadows
+ * are soft, plus ambient light scaled by how open the surface is. */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "geometry.h"
+#include "trace.h"
+
+#define TILE_SIZE 16
+#define MAX_THREADS 64
+/* triangles in a leaf of the hierarchy */
+#define LEAF_SIZE 4
+#define STACK_DEPTH 64
+/* how far secondary rays start off the surface */
+#define EPSILON 1e-4
+
+/* the camera sits this far down the z axis, as gluLookAt puts it */
+#define CAMERA_DISTANCE 20.0
+
+static const float light_dir[2][3] = {{0.0, 10.0, 20.0}, {0.0, 20.0, -1.0}};
+/* angular radius of the lights, in radians */
+#define LIGHT_SIZE 0.08
+#define AMBIENT 0.35
+#define SPECULAR 0.1
+#define SHININESS 20.0
+/* occluders further away than this don't darken the ambient light */
+#define OCCLUSION_DISTANCE 1.5
+
+struct tri {
+  float v0[3], e1[3], e2[3];
+  float n[3];
+  float centre[3];
+  int node;
+};
+
+struct bvh_node {
+  float min[3], max[3];
+  /* a leaf holds count triangles from first, otherwise its children are
+   * first and first + 1 */
+  int first;
+  int count;
+};
+
+struct tracer {
+  const struct trace_scene *scene;
+  int width, height;
+  unsigned char *rgb;
+
+  struct tri *tri;
+  int tri_count;
+  struct bvh_node *node;
+  int node_count;
+
+  int tiles_x, tiles;
+  int next_tile;
+#ifdef HAVE_PTHREAD
+  pthread_mutex_t lock;
+#endif
+};
+
+static float dot(const float a[3], const float b[3]) {
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static void cross(float out[3], const float a[3], const float b[3]) {
+  out[0] = a[1] * b[2] - a[2] * b[1];
+  out[1] = a[2] * b[0] - a[0] * b[2];
+  out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static void normalise(float v[3]) {
+  float len = sqrt(dot(v, v));
+
+  v[0] /= len;
+  v[1] /= len;
+  v[2] /= len;
+}
+
+/* a small, fast generator; each pixel has its own so that images come out
+ * the same however the tiles are shared out */
+static float random_unit(unsigned int *state) {
+  unsigned int x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return (x >> 8) / 16777216.0;
+}
+
+/* Put the triangles of every node into eye space. */
+static int build_triangles(struct tracer *t) {
+  const struct trace_scene *scene = t->scene;
+  int i, k, f;
+
+  t->tri = malloc(NODE_COUNT * SOLID_PRISM_TRIANGLES * sizeof(struct tri));
+  if (!t->tri) return -1;
+
+  t->tri_count = 0;
+  for (i = 0; i < NODE_COUNT; i++) {
+    float v[SOLID_PRISM_VERTICES][3];
+
+    for (k = 0; k < SOLID_PRISM_VERTICES; k++) {
+      float p[3];
+
+      matrix_transform(scene->m[i], solid_prism_v[k], p);
+      p[0] -= scene->com[0];
+      p[1] -= scene->com[1];
+      p[2] -= scene->com[2];
+      matrix_transform(scene->modelview, p, v[k]);
+      v[k][2] -= CAMERA_DISTANCE;
+    }
+    for (f = 0; f < SOLID_PRISM_FACES; f++) {
+      const struct prism_face *face = &solid_prism_f[f];
+      float n[3];
+
+      matrix_rotate(n, scene->m[i], solid_prism_n[face->normal]);
+      matrix_rotate(n, scene->modelview, n);
+      normalise(n);
+      for (k = 1; k < face->count - 1; k++) {
+        struct tri *tr = &t->tri[t->tri_count++];
+        const float *a = v[face->v[0]], *b = v[face->v[k]],
+                    *c = v[face->v[k + 1]];
+        int j;
+
+        for (j = 0; j < 3; j++) {
+          tr->v0[j] = a[j];
+          tr->e1[j] = b[j] - a[j];
+          tr->e2[j] = c[j] - a[j];
+          tr->centre[j] = (a[j] + b[j] + c[j]) / 3.0;
+        }
+        memcpy(tr->n, n, sizeof(n));
+        tr->node = i;
+      }
+    }
+  }
+  return 0;
+}
+
+static int sort_axis;
+
+static int compare_centre(const void *a, const void *b) {
+  float ca = ((const struct tri *)a)->centre[sort_axis];
+  float cb = ((const struct tri *)b)->centre[sort_axis];
+
+  return ca < cb ? -1 : ca > cb;
+}
+
+/* Fill in node index with the triangles from first, splitting them in half
+ * along their longest axis until they fit in a leaf. */
+static void build_node(struct tracer *t, int index, int first, int count) {
+  struct bvh_node *node = &t->node[index];
+  float cmin[3], cmax[3];
+  int i, j, k, axis = 0;
+
+  for (k = 0; k < 3; k++) {
+    node->min[k] = cmin[k] = HUGE_VAL;
+    node->max[k] = cmax[k] = -HUGE_VAL;
+  }
+  for (i = first; i < first + count; i++) {
+    const struct tri *tr = &t->tri[i];
+
+    for (k = 0; k < 3; k++) {
+      float p[3] = {0.0, 0.0, 0.0};
+
+      for (j = 0; j < 3; j++) {
+        p[j] = tr->v0[j] + (k == 1 ? tr->e1[j] : k == 2 ? tr->e2[j] : 0.0);
+        if (p[j] < node->min[j]) node->min[j] = p[j];
+        if (p[j] > node->max[j]) node->max[j] = p[j];
+      }
+      if (tr->centre[k] < cmin[k]) cmin[k] = tr->centre[k];
+      if (tr->centre[k] > cmax[k]) cmax[k] = tr->centre[k];
+    }
+  }
+
+  if (count <= LEAF_SIZE) {
+    node->first = first;
+    node->count = count;
+    return;
+  }
+
+  for (k = 1; k < 3; k++)
+    if (cmax[k] - cmin[k] > cmax[axis] - cmin[axis]) axis = k;
+  sort_axis = axis;
+  qsort(t->tri + first, (size_t)count, sizeof(struct tri), compare_centre);
+
+  node->first = t->node_count;
+  node->count = 0;
+  t->node_count += 2;
+  build_node(t, node->first, first, count / 2);
+  build_node(t, node->first + 1, first + count / 2, count - count / 2);
+}
+
+/* Where the ray enters the node's box, or -1 if it misses it before
+ * tmax. */
+static float hits_box(const struct bvh_node *node, const float o[3],
+                      const float inv[3], float tmax) {
+  float tmin = 0.0;
+  int k;
+
+  for (k = 0; k < 3; k++) {
+    float t0 = (node->min[k] - o[k]) * inv[k];
+    float t1 = (node->max[k] - o[k]) * inv[k];
+
+    if (t0 > t1) {
+      float swap = t0;
+
+      t0 = t1;
+      t1 = swap;
+    }
+    if (t0 > tmin) tmin = t0;
+    if (t1 < tmax) tmax = t1;
+    if (tmin > tmax) return -1.0;
+  }
+  return tmin;
+}
+
+/* Find the nearest triangle along the ray closer than *dist, or with any
+ * set, any triangle at all.  Returns its index or -1, and sets *dist. */
+static int intersect(const struct tracer *t, const float o[3],
+                     const float d[3], float *dist, int any) {
+  int stack[STACK_DEPTH], top = 0, hit = -1;
+  float inv[3];
+  int k;
+
+  for (k = 0; k < 3; k++) inv[k] = 1.0 / d[k];
+
+  if (hits_box(&t->node[0], o, inv, *dist) < 0.0) return -1;
+  stack[top++] = 0;
+  while (top) {
+    const struct bvh_node *node = &t->node[stack[--top]];
+    int i;
+
+    if (node->count == 0) {
+      /* visit the nearer child first, so that the further one can often
+       * be skipped */
+      int nearer = node->first, further = node->first + 1;
+      float tn = hits_box(&t->node[nearer], o, inv, *dist);
+      float tf = hits_box(&t->node[further], o, inv, *dist);
+
+      if (tf >= 0.0 && (tn < 0.0 || tf < tn)) {
+        int swap = nearer;
+        float tswap = tn;
+
+        nearer = further;
+        further = swap;
+        tn = tf;
+        tf = tswap;
+      }
+      if (tf >= 0.0) stack[top++] = further;
+      if (tn >= 0.0) stack[top++] = nearer;
+      continue;
+    }
+    for (i = node->first; i < node->first + node->count; i++) {
+      const struct tri *tr = &t->tri[i];
+      float p[3], q[3], s[3], det, u, v, dt;
+
+      cross(p, d, tr->e2);
+      det = dot(tr->e1, p);
+      if (fabs(det) < 1e-12) continue;
+      for (k = 0; k < 3; k++) s[k] = o[k] - tr->v0[k];
+      u = dot(s, p) / det;
+      if (u < 0.0 || u > 1.0) continue;
+      cross(q, s, tr->e1);
+      v = dot(d, q) / det;
+      if (v < 0.0 || u + v > 1.0) continue;
+      dt = dot(tr->e2, q) / det;
+      if (dt > EPSILON && dt < *dist) {
+        *dist = dt;
+        hit = i;
+        if (any) return hit;
+      }
+    }
+  }
+  return hit;
+}
+
+/* Two unit vectors at right angles to n and to each other. */
+static void basis(const float n[3], float a[3], float b[3]) {
+  float up[3] = {0.0, 0.0, 0.0};
+
+  up[fabs(n[0]) < 0.6 ? 0 : 1] = 1.0;
+  cross(a, n, up);
+  normalise(a);
+  cross(b, n, a);
+}
+
+/* Trace one ray from the camera, returning its colour in col. */
+static void trace_ray(const struct tracer *t, const float d[3],
+                      unsigned int *seed, float col[3]) {
+  static const float origin[3] = {0.0, 0.0, 0.0};
+  const struct tri *tr;
+  const float *base;
+  float dist = HUGE_VAL, p[3], n[3], a[3], b[3], r[3];
+  float light, spec = 0.0, u, v, far;
+  int hit, l, k;
+
+  if ((hit = intersect(t, origin, d, &dist, 0)) < 0) {
+    memcpy(col, t->scene->background, 3 * sizeof(float));
+    return;
+  }
+  tr = &t->tri[hit];
+  base = t->scene->colour[tr->node];
+  memcpy(n, tr->n, sizeof(n));
+  if (dot(n, d) > 0.0)
+    for (k = 0; k < 3; k++) n[k] = -n[k];
+  for (k = 0; k < 3; k++) p[k] = d[k] * dist + n[k] * EPSILON;
+
+  /* ambient light, less where a cosine weighted ray hits something close */
+  basis(n, a, b);
+  u = random_unit(seed);
+  v = 2.0 * M_PI * random_unit(seed);
+  for (k = 0; k < 3; k++)
+    r[k] = sqrt(u) * (cos(v) * a[k] + sin(v) * b[k]) + sqrt(1.0 - u) * n[k];
+  far = OCCLUSION_DISTANCE;
+  light = intersect(t, p, r, &far, 1) < 0 ? AMBIENT : 0.0;
+
+  for (l = 0; l < 2; l++) {
+    float ld[3], h[3], s, nl;
+
+    /* aim at a random point on the light */
+    memcpy(ld, light_dir[l], sizeof(ld));
+    normalise(ld);
+    nl = dot(n, ld);
+    if (nl <= 0.0) continue;
+    basis(ld, a, b);
+    u = LIGHT_SIZE * sqrt(random_unit(seed));
+    v = 2.0 * M_PI * random_unit(seed);
+    for (k = 0; k < 3; k++)
+      r[k] = ld[k] + u * (cos(v) * a[k] + sin(v) * b[k]);
+    far = HUGE_VAL;
+    if (intersect(t, p, r, &far, 1) >= 0) continue;
+
+    light += nl;
+    for (k = 0; k < 3; k++) h[k] = ld[k] - d[k];
+    normalise(h);
+    s = dot(n, h);
+    if (s > 0.0) spec += SPECULAR * pow(s, SHININESS);
+  }
+
+  for (k = 0; k < 3; k++) col[k] = base[k] * light + spec;
+}
+
+static void trace_tile(const struct tracer *t, int tile) {
+  const struct trace_scene *scene = t->scene;
+  float scale = tan(scene->fovy * M_PI / 360.0);
+  float aspect = (float)t->width / t->height;
+  int x0 = (tile % t->tiles_x) * TILE_SIZE, y0 = (tile / t->tiles_x) * TILE_SIZE;
+  int x, y, s, k;
+
+  for (y = y0; y < y0 + TILE_SIZE && y < t->height; y++)
+    for (x = x0; x < x0 + TILE_SIZE && x < t->width; x++) {
+      unsigned int seed = (unsigned int)(y * t->width + x) * 2654435761U + 1;
+      float sum[3] = {0.0, 0.0, 0.0};
+      unsigned char *out = t->rgb + 3 * ((size_t)y * t->width + x);
+      int samples = scene->samples > 0 ? scene->samples : 1;
+
+      for (s = 0; s < samples; s++) {
+        float d[3], col[3];
+
+        d[0] = (2.0 * (x + random_unit(&seed)) / t->width - 1.0) * scale * aspect;
+        d[1] = (1.0 - 2.0 * (y + random_unit(&seed)) / t->height) * scale;
+        d[2] = -1.0;
+        normalise(d);
+        trace_ray(t, d, &seed, col);
+        for (k = 0; k < 3; k++) sum[k] += col[k];
+      }
+      for (k = 0; k < 3; k++) {
+        float c = sum[k] / samples;
+
+        out[k] = (unsigned char)(255.0 * (c < 0.0 ? 0.0 : c > 1.0 ? 1.0 : c));
+      }
+    }
+}
+
+static void *trace_worker(void *arg) {
+  struct tracer *t = arg;
+
+  for (;;) {
+    int tile;
+
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&t->lock);
+#endif
+    tile = t->next_tile++;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_unlock(&t->lock);
+#endif
+    if (tile >= t->tiles) break;
+    trace_tile(t, tile);
+  }
+  return NULL;
+}
+
+int trace_image(const struct trace_scene *scene, int width, int height,
+                unsigned char *rgb) {
+  struct tracer t;
+#ifdef HAVE_PTHREAD
+  pthread_t thread[MAX_THREADS];
+  int threads = scene->threads, i;
+#endif
+
+  memset(&t, 0, sizeof(t));
+  t.scene = scene;
+  t.width = width;
+  t.height = height;
+  t.rgb = rgb;
+
+  if (build_triangles(&t)) return -1;
+  if (!(t.node = malloc(2 * t.tri_count * sizeof(struct bvh_node)))) {
+    free(t.tri);
+    return -1;
+  }
+  t.node_count = 1;
+  build_node(&t, 0, 0, t.tri_count);
+
+  t.tiles_x = (width + TILE_SIZE - 1) / TILE_SIZE;
+  t.tiles = t.tiles_x * ((height + TILE_SIZE - 1) / TILE_SIZE);
+
+#ifdef HAVE_PTHREAD
+  if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  if (threads > MAX_THREADS) threads = MAX_THREADS;
+  pthread_mutex_init(&t.lock, NULL);
+  /* the calling thread traces too */
+  for (i = 0; i < threads - 1; i++)
+    if (pthread_create(&thread[i], NULL, trace_worker, &t)) break;
+  trace_worker(&t);
+  while (i-- > 0) pthread_join(thread[i], NULL);
+  pthread_mutex_destroy(&t.lock);
+#else
+  trace_worker(&t);
+#endif
+
+  free(t.node);
+  free(t.tri);
+  return 0;
+}
@@ -0,0 +1,53 @@
+/* trace.h - a ray tracer for high quality stills of the snake
+ *
+ * (c) 2001-2005 Jamie Wilkinson <jaq@spacepants.org>
+ * (c) 2001-2003 Andrew Bennetts <andrew@puzzling.org>
+ * (c) 2001-2006 Peter Aylett <aylett@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef GLSNAKE_TRACE_H
+#define GLSNAKE_TRACE_H
+
+#include "shape.h"
+
+/* what to trace, placed as glsnake's GL setup would place it */
+struct trace_scene {
+  /* where each node goes, from node_transforms */
+  float (*m)[16];
+  /* the centre of mass, which is moved to the origin */
+  float com[3];
+  /* the colour of each node; alpha is ignored */
+  const float (*colour)[4];
+  float modelview[16];
+  /* vertical field of view in degrees, as given to gluPerspective */
+  float fovy;
+  float background[3];
+  /* rays per pixel; each one that hits also sends one shadow ray towards
+   * each light and one ambient occlusion ray */
+  int samples;
+  /* 0 for one per processor */
+  int threads;
+};
+
+/* Trace the scene into rgb, width by height pixels, top row first.  It
+ * uses threads of its own, but is not to be called from two threads at
+ * once.  Returns -1 if out of memory. */
+int trace_image(const struct trace_scene *scene, int width, int height,
+                unsigned char *rgb);
+
+#endif /* GLSNAKE_TRACE_H */